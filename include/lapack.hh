@@ -20,5 +20,16 @@ const char* lapackpp_id();
 }  // namespace lapack
 
 #include "lapack/wrappers.hh"
+#include "lapack/ooc.hh"
+#include "lapack/matrix_file.hh"
+#include "lapack/qr_stream.hh"
+#include "lapack/sketch.hh"
+#include "lapack/chfsi.hh"
+#include "lapack/layout.hh"
+#include "lapack/matrix_view.hh"
+#include "lapack/async.hh"
+#include "lapack/instrument.hh"
+#include "lapack/trace.hh"
+#include "lapack/tune.hh"
 
 #endif // LAPACK_HH
@@ -0,0 +1,266 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_ASYNC_HH
+#define LAPACK_ASYNC_HH
+
+#include "lapack/util.hh"
+#include "lapack/wrappers.hh"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Asynchronous host execution of LAPACK routines.
+///
+/// Each call enqueues the routine on an executor and returns a Future
+/// holding its info value. A call may depend on earlier Futures; it is
+/// enqueued only once they have all completed, so a worker thread never
+/// blocks waiting on a dependency. Pipelines across many matrices then
+/// overlap naturally:
+///
+///     std::vector< lapack::async::Future > solves;
+///     for (int i = 0; i < batch; ++i) {
+///         auto f = lapack::async::potrf( uplo, n, A[i], lda );
+///         solves.push_back(
+///             lapack::async::potrs( uplo, n, nrhs, A[i], lda, B[i], ldb,
+///                                   { f } ) );
+///     }
+///     lapack::async::wait_all( solves );
+///
+/// Arrays passed to an asynchronous call must stay valid, and must not be
+/// accessed by the caller or unordered calls, until its Future is ready.
+///
+/// If a dependency throws or returns info != 0, the dependent call is not
+/// run, and its Future throws Error. Exceptions in the routine itself,
+/// e.g., from argument checks, are rethrown by Future::get.
+///
+/// Each routine may itself be multithreaded by BLAS; for many small
+/// problems, a single-threaded BLAS with a larger pool is usually faster.
+namespace async {
+
+namespace internal {
+class State;
+}
+
+//------------------------------------------------------------------------------
+/// Runs tasks, possibly concurrently and in any order.
+/// Derive from Executor to run asynchronous calls on a user thread pool.
+/// @ingroup util
+class Executor {
+public:
+    virtual ~Executor() {}
+
+    /// Runs task, or queues it to run later. The task does not throw.
+    virtual void execute( std::function<void ()> task ) = 0;
+};
+
+//------------------------------------------------------------------------------
+/// Fixed-size pool of host threads that run tasks in FIFO order.
+/// The destructor finishes all queued tasks, then joins the threads.
+/// @ingroup util
+class ThreadPool: public Executor {
+public:
+    /// Creates pool of num_threads threads;
+    /// if num_threads <= 0, one per hardware thread.
+    explicit ThreadPool( int num_threads=0 );
+    ~ThreadPool();
+
+    ThreadPool( ThreadPool const& ) = delete;
+    ThreadPool& operator = ( ThreadPool const& ) = delete;
+
+    void execute( std::function<void ()> task ) override;
+
+    int num_threads() const { return int( threads_.size() ); }
+
+private:
+    void run();
+
+    std::vector< std::thread > threads_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque< std::function<void ()> > queue_;
+    bool stop_;
+};
+
+//------------------------------------------------------------------------------
+/// @return process-wide ThreadPool used when no executor is given,
+/// created on first use with one thread per hardware thread.
+/// @ingroup util
+Executor& default_executor();
+
+//------------------------------------------------------------------------------
+/// Handle to the info value of an asynchronous call. Copies share the
+/// same result, as with std::shared_future, so one Future can be a
+/// dependency of several calls and also be waited on.
+/// @ingroup util
+class Future {
+public:
+    /// Creates an invalid Future, with no associated call.
+    Future() {}
+
+    /// @return true if associated with a call.
+    bool valid() const { return state_ != nullptr; }
+
+    /// @return true if the call has completed, without waiting.
+    bool ready() const;
+
+    /// Waits for the call to complete.
+    void wait() const;
+
+    /// Waits for the call to complete.
+    /// @return the routine's info value.
+    /// Rethrows any exception from the routine or its dependencies.
+    int64_t get() const;
+
+private:
+    explicit Future( std::shared_ptr< internal::State > state )
+        : state_( std::move( state ) )
+    {}
+
+    friend Future submit( std::function< int64_t () >,
+                          std::vector< Future > const&, Executor* );
+
+    std::shared_ptr< internal::State > state_;
+};
+
+//------------------------------------------------------------------------------
+/// Runs task on exec (default_executor() if null) after all deps complete.
+/// This is the building block for the routines below, and can run any
+/// routine that returns info, e.g., from a lambda.
+///
+/// @return Future for task's info value.
+/// @ingroup util
+Future submit( std::function< int64_t () > task,
+               std::vector< Future > const& deps={},
+               Executor* exec=nullptr );
+
+//------------------------------------------------------------------------------
+/// Waits for all futures, then rethrows the first exception, if any.
+/// @return first nonzero info, or 0.
+/// @ingroup util
+int64_t wait_all( std::vector< Future > const& futures );
+
+// -----------------------------------------------------------------------------
+// Asynchronous versions of the routines, with the same arguments, followed
+// by dependencies and executor. Each returns the Future for its info.
+
+// -----------------------------------------------------------------------------
+/// Asynchronous lapack::geqrf.
+/// @ingroup geqrf
+template <typename scalar_t>
+Future geqrf(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* tau,
+    std::vector< Future > const& deps={}, Executor* exec=nullptr )
+{
+    return submit( [=]() {
+        return lapack::geqrf( m, n, A, lda, tau );
+    }, deps, exec );
+}
+
+// -----------------------------------------------------------------------------
+/// Asynchronous lapack::gesv.
+/// @ingroup gesv
+template <typename scalar_t>
+Future gesv(
+    int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    scalar_t* B, int64_t ldb,
+    std::vector< Future > const& deps={}, Executor* exec=nullptr )
+{
+    return submit( [=]() {
+        return lapack::gesv( n, nrhs, A, lda, ipiv, B, ldb );
+    }, deps, exec );
+}
+
+// -----------------------------------------------------------------------------
+/// Asynchronous lapack::getrf.
+/// @ingroup gesv_computational
+template <typename scalar_t>
+Future getrf(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    std::vector< Future > const& deps={}, Executor* exec=nullptr )
+{
+    return submit( [=]() {
+        return lapack::getrf( m, n, A, lda, ipiv );
+    }, deps, exec );
+}
+
+// -----------------------------------------------------------------------------
+/// Asynchronous lapack::getrs; usually depends on a getrf.
+/// @ingroup gesv_computational
+template <typename scalar_t>
+Future getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    int64_t const* ipiv,
+    scalar_t* B, int64_t ldb,
+    std::vector< Future > const& deps={}, Executor* exec=nullptr )
+{
+    return submit( [=]() {
+        return lapack::getrs( trans, n, nrhs, A, lda, ipiv, B, ldb );
+    }, deps, exec );
+}
+
+// -----------------------------------------------------------------------------
+/// Asynchronous lapack::heevd.
+/// @ingroup heev
+template <typename scalar_t>
+Future heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W,
+    std::vector< Future > const& deps={}, Executor* exec=nullptr )
+{
+    return submit( [=]() {
+        return lapack::heevd( jobz, uplo, n, A, lda, W );
+    }, deps, exec );
+}
+
+// -----------------------------------------------------------------------------
+/// Asynchronous lapack::potrf.
+/// @ingroup posv_computational
+template <typename scalar_t>
+Future potrf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    std::vector< Future > const& deps={}, Executor* exec=nullptr )
+{
+    return submit( [=]() {
+        return lapack::potrf( uplo, n, A, lda );
+    }, deps, exec );
+}
+
+// -----------------------------------------------------------------------------
+/// Asynchronous lapack::potrs; usually depends on a potrf.
+/// @ingroup posv_computational
+template <typename scalar_t>
+Future potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    std::vector< Future > const& deps={}, Executor* exec=nullptr )
+{
+    return submit( [=]() {
+        return lapack::potrs( uplo, n, nrhs, A, lda, B, ldb );
+    }, deps, exec );
+}
+
+}  // namespace async
+}  // namespace lapack
+
+#endif // LAPACK_ASYNC_HH
@@ -0,0 +1,37 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_CHFSI_HH
+#define LAPACK_CHFSI_HH
+
+#include "lapack/util.hh"
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Statistics of the Chebyshev-filtered subspace iteration `heev_chfsi`.
+/// @ingroup heev
+struct ChfsiStats {
+    int64_t iters    = 0;      ///< filter and Rayleigh-Ritz iterations
+    int64_t subspace = 0;      ///< size of the search subspace
+    int64_t matvecs  = 0;      ///< products of A with a vector
+    double  residual = 0;      ///< max relative residual of returned pairs
+    bool    fallback = false;  ///< true if heevr computed the result
+};
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t heev_chfsi(
+    lapack::Uplo uplo, int64_t n, int64_t nev,
+    scalar_t const* A, int64_t lda,
+    blas::real_type< scalar_t >* W,
+    scalar_t* Z, int64_t ldz,
+    bool warm,
+    blas::real_type< scalar_t > tol, int64_t maxiter,
+    ChfsiStats* stats=nullptr );
+
+}  // namespace lapack
+
+#endif // LAPACK_CHFSI_HH
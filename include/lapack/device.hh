@@ -9,16 +9,33 @@
 #include "blas/device.hh"
 #include "lapack/util.hh"
 
+#include <algorithm>
+#include <vector>
+
 #if defined(LAPACK_HAVE_CUBLAS)
     #include <cusolverDn.h>
 #endif
 
+// Without a GPU backend, the device routines run on the host, on memory
+// allocated on the host, asynchronously on a worker thread of the Queue.
+#if ! (defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_SYCL))
+    #define LAPACK_HAVE_HOST_QUEUE
+
+    #include <condition_variable>
+    #include <deque>
+    #include <exception>
+    #include <functional>
+    #include <mutex>
+    #include <thread>
+#endif
+
 namespace lapack {
 
 // Since we pass pointers to these integers, their types have to match
 // the vendor libraries.
 #if defined(LAPACK_HAVE_CUBLAS)
     typedef int device_info_int;
+    typedef int device_sytrf_pivot_int;
     #if CUSOLVER_VERSION >= 11000
         typedef int64_t device_pivot_int;
     #else
@@ -28,18 +45,73 @@ namespace lapack {
 #elif defined(LAPACK_HAVE_ROCBLAS)
     typedef rocblas_int device_info_int;
     typedef rocblas_int device_pivot_int;
+    typedef rocblas_int device_sytrf_pivot_int;
 
 #else
     typedef int64_t device_info_int;   ///< int type for returned info
     typedef int64_t device_pivot_int;  ///< int type for pivot vector (getrf, etc.)
+    typedef int64_t device_sytrf_pivot_int;  ///< int type for sytrf pivot vector
 #endif
 
+#if defined(LAPACK_HAVE_HOST_QUEUE)
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Host stand-in for a GPU stream: one worker thread that runs tasks in the
+/// order they were enqueued. The thread is started on the first enqueue.
+/// The destructor finishes all queued tasks, then joins the thread.
+class HostStream {
+public:
+    HostStream();
+    ~HostStream();
+
+    HostStream( HostStream const& ) = delete;
+    HostStream& operator = ( HostStream const& ) = delete;
+
+    void enqueue( std::function<void ()> task );
+
+    /// Waits for all enqueued tasks, then rethrows the first exception
+    /// thrown by a task since the last sync, if any.
+    void sync();
+
+private:
+    void run();
+
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable idle_cv_;
+    std::deque< std::function<void ()> > queue_;
+    bool busy_;
+    bool stop_;
+    std::exception_ptr error_;
+};
+
+}  // namespace internal
+#endif
+
+//------------------------------------------------------------------------------
+/// Statistics of a Queue's workspace and dev_info pool.
+struct PoolStats {
+    size_t  dev_work_bytes;     ///< current size of device workspace
+    size_t  host_work_bytes;    ///< current size of host workspace
+    int64_t info_slots;         ///< current number of dev_info slots
+    int64_t info_pending;       ///< dev_info slots used since last info()
+    int64_t work_requests;      ///< workspace requests
+    int64_t grows;              ///< requests that grew a buffer, each a sync
+};
+
 //------------------------------------------------------------------------------
 class Queue: public blas::Queue
 {
 public:
     Queue()
-      : blas::Queue()
+      : blas::Queue(),
+        pool_dev_work_( nullptr ),
+        pool_host_work_( nullptr ),
+        pool_dev_info_( nullptr ),
+        pool_info_used_( 0 ),
+        pool_stats_()
         #if defined(LAPACK_HAVE_CUBLAS)
             , solver_( nullptr )
             #if CUSOLVER_VERSION >= 11000
@@ -49,7 +121,12 @@ public:
     {}
 
     Queue( int device )
-      : blas::Queue( device )
+      : blas::Queue( device ),
+        pool_dev_work_( nullptr ),
+        pool_host_work_( nullptr ),
+        pool_dev_info_( nullptr ),
+        pool_info_used_( 0 ),
+        pool_stats_()
         #if defined(LAPACK_HAVE_CUBLAS)
             , solver_( nullptr )
             #if CUSOLVER_VERSION >= 11000
@@ -60,6 +137,8 @@ public:
 
     ~Queue()
     {
+        pool_free();
+
         #if defined(LAPACK_HAVE_CUBLAS)
             blas::internal_set_device( device() );
             #if CUSOLVER_VERSION >= 11000
@@ -114,7 +193,91 @@ public:
         #endif
     #endif
 
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        /// Enqueues task to run on the host, after all tasks enqueued before
+        /// it. This is the stream that the device routines run on when
+        /// there is no GPU backend.
+        void enqueue( std::function<void ()> task )
+        {
+            host_stream_.enqueue( std::move( task ) );
+        }
+    #endif
+
+    /// Waits for all work enqueued on the queue, including, with the host
+    /// backend, tasks on the host stream. With the host backend, rethrows
+    /// an exception thrown by a task, as a GPU backend reports asynchronous
+    /// errors on sync.
+    ///
+    /// This hides blas::Queue::sync, which is not virtual and does not wait
+    /// for the host stream, since BLAS++ does not know about it. Calls
+    /// through a lapack::Queue, as in existing device code, wait for all
+    /// work; see sync_all for calls through a blas::Queue&.
+    void sync()
+    {
+        #if defined(LAPACK_HAVE_HOST_QUEUE)
+            host_stream_.sync();
+        #endif
+        blas::Queue::sync();
+    }
+
+    /// Same as sync. Only code that can reach the queue through a
+    /// blas::Queue& needs it: there, queue.sync() silently resolves to
+    /// blas::Queue::sync, while sync_all does not compile, so the missing
+    /// wait for the host stream is caught.
+    void sync_all()
+    {
+        sync();
+    }
+
+    //----------------------------------------
+    // Workspace and dev_info pool, used by the device routines that take
+    // neither workspace nor dev_info. Buffers grow to the largest size
+    // requested and are kept until the queue is destroyed. Growing syncs
+    // the queue, since calls already enqueued may use the old buffer.
+
+    /// @return device workspace of at least bytes, owned by the queue.
+    void* pool_dev_work( size_t bytes );
+
+    /// @return host workspace of at least bytes, owned by the queue.
+    void* pool_host_work( size_t bytes );
+
+    /// @return next dev_info slot, owned by the queue, to be read by info().
+    device_info_int* pool_dev_info();
+
+    /// Reads back the dev_info slots used since the last info(), which
+    /// frees them for reuse. Syncs the queue; after sync() this adds only
+    /// the copy of the slots to the host.
+    ///
+    /// Only the first non-zero info, in the order the calls were enqueued,
+    /// is returned; the infos of later calls are discarded, and which call
+    /// failed is not recorded. To check a particular call, call info()
+    /// right after it, or pass that call its own dev_info.
+    ///
+    /// @return first non-zero info, or 0 if all calls since the last
+    /// info() succeeded.
+    int64_t info();
+
+    /// @return statistics of the pool.
+    PoolStats pool_stats() const
+    {
+        return pool_stats_;
+    }
+
 private:
+    void pool_free();
+    void pool_read_info();
+
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        internal::HostStream host_stream_;
+    #endif
+
+    void* pool_dev_work_;
+    char* pool_host_work_;
+    device_info_int* pool_dev_info_;
+    int64_t pool_info_used_;  // slots of pool_dev_info_ used since info()
+    std::vector< device_info_int > pool_info_read_;  // slots read on grow
+    PoolStats pool_stats_;
+
     #if defined(LAPACK_HAVE_CUBLAS)
         cusolverDnHandle_t solver_;
         #if CUSOLVER_VERSION >= 11000
@@ -123,6 +286,101 @@ private:
     #endif
 };
 
+//==============================================================================
+// Memory routines for the device routines. With a GPU backend, these call the
+// BLAS++ device routines. With the host backend (LAPACK_HAVE_HOST_QUEUE),
+// device memory is host memory, and copies are enqueued on the queue's host
+// stream, so they are ordered with the device routines as on a GPU.
+// Use these, not blas::device_malloc, etc., which throw without a GPU.
+
+//------------------------------------------------------------------------------
+/// @return true if the device routines can run: a GPU is present,
+/// or the host backend is used.
+inline bool device_available()
+{
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        return true;
+    #else
+        return blas::get_device_count() > 0;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// @return device memory for nelements of type T.
+/// Free it with lapack::device_free.
+template <typename T>
+T* device_malloc( int64_t nelements, lapack::Queue& queue )
+{
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        return new T[ nelements ];
+    #else
+        return blas::device_malloc< T >( nelements, queue );
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// Frees device memory from lapack::device_malloc, after the work enqueued
+/// before it.
+template <typename T>
+void device_free( T* ptr, lapack::Queue& queue )
+{
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        queue.enqueue( [ptr]() { delete[] ptr; } );
+    #else
+        blas::device_free( ptr, queue );
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// Copies nelements from src to dst, each in host or device memory.
+template <typename T>
+void device_memcpy(
+    T* dst, T const* src, int64_t nelements, lapack::Queue& queue )
+{
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        queue.enqueue( [=]() { std::copy( src, src + nelements, dst ); } );
+    #else
+        blas::device_memcpy( dst, src, nelements, queue );
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// Copies vector of length n from src to dst, each in host or device memory.
+template <typename T>
+void device_copy_vector(
+    int64_t n,
+    T const* src, int64_t inc_src,
+    T*       dst, int64_t inc_dst, lapack::Queue& queue )
+{
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        queue.enqueue( [=]() {
+            for (int64_t i = 0; i < n; ++i)
+                dst[ i*inc_dst ] = src[ i*inc_src ];
+        } );
+    #else
+        blas::device_copy_vector( n, src, inc_src, dst, inc_dst, queue );
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// Copies m-by-n matrix from src to dst, each in host or device memory.
+template <typename T>
+void device_copy_matrix(
+    int64_t m, int64_t n,
+    T const* src, int64_t ld_src,
+    T*       dst, int64_t ld_dst, lapack::Queue& queue )
+{
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        queue.enqueue( [=]() {
+            for (int64_t j = 0; j < n; ++j)
+                std::copy( &src[ j*ld_src ], &src[ j*ld_src + m ],
+                           &dst[ j*ld_dst ] );
+        } );
+    #else
+        blas::device_copy_matrix( m, n, src, ld_src, dst, ld_dst, queue );
+    #endif
+}
+
 //------------------------------------------------------------------------------
 template <typename scalar_t>
 void potrf(
@@ -178,6 +436,375 @@ void heevd(
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue );
 
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    scalar_t* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template <typename scalar_t>
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+// ormqr alias to unmqr
+template <typename scalar_t>
+inline void ormqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    unmqr_work_size_bytes( side, trans, m, n, k, dA, ldda, dtau, dC, lddc,
+                           dev_work_size, host_work_size, queue );
+}
+
+template <typename scalar_t>
+inline void ormqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    unmqr( side, trans, m, n, k, dA, ldda, dtau, dC, lddc,
+           dev_work, dev_work_size, host_work, host_work_size,
+           dev_info, queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template <typename scalar_t>
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+// orgqr alias to ungqr
+template <typename scalar_t>
+inline void orgqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    ungqr_work_size_bytes( m, n, k, dA, ldda, dtau,
+                           dev_work_size, host_work_size, queue );
+}
+
+template <typename scalar_t>
+inline void orgqr(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    ungqr( m, n, k, dA, ldda, dtau,
+           dev_work, dev_work_size, host_work, host_work_size,
+           dev_info, queue );
+}
+
+//------------------------------------------------------------------------------
+// With cuSolver, requires m >= n.
+template <typename scalar_t>
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template <typename scalar_t>
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//------------------------------------------------------------------------------
+// For complex, A is symmetric, not Hermitian.
+template <typename scalar_t>
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template <typename scalar_t>
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//------------------------------------------------------------------------------
+// Not available with cuSolver or rocSolver, which lack a sytrs taking the
+// pivots from their sytrf; it throws Error there.
+template <typename scalar_t>
+void sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda, device_sytrf_pivot_int const* dev_ipiv,
+    scalar_t* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template <typename scalar_t>
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//==============================================================================
+// Overloads that take workspace and dev_info from the queue's pool, to avoid
+// allocating them for each call. After queue.sync(), queue.info() returns
+// the first non-zero info of these calls.
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void potrf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    lapack::Queue& queue )
+{
+    potrf( uplo, n, dA, ldda, queue.pool_dev_info(), queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void getrf(
+    int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, device_pivot_int* dev_ipiv,
+    lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    getrf_work_size_bytes( m, n, dA, ldda,
+                           &dev_work_size, &host_work_size, queue );
+    getrf( m, n, dA, ldda, dev_ipiv,
+           queue.pool_dev_work( dev_work_size ), dev_work_size,
+           queue.pool_host_work( host_work_size ), host_work_size,
+           queue.pool_dev_info(), queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void geqrf(
+    int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, scalar_t* dtau,
+    lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    geqrf_work_size_bytes( m, n, dA, ldda,
+                           &dev_work_size, &host_work_size, queue );
+    geqrf( m, n, dA, ldda, dtau,
+           queue.pool_dev_work( dev_work_size ), dev_work_size,
+           queue.pool_host_work( host_work_size ), host_work_size,
+           queue.pool_dev_info(), queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    heevd_work_size_bytes( jobz, uplo, n, dA, ldda, dW,
+                           &dev_work_size, &host_work_size, queue );
+    heevd( jobz, uplo, n, dA, ldda, dW,
+           queue.pool_dev_work( dev_work_size ), dev_work_size,
+           queue.pool_host_work( host_work_size ), host_work_size,
+           queue.pool_dev_info(), queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    lapack::Queue& queue )
+{
+    potrs( uplo, n, nrhs, dA, ldda, dB, lddb, queue.pool_dev_info(), queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    scalar_t* dB, int64_t lddb,
+    lapack::Queue& queue )
+{
+    getrs( trans, n, nrhs, dA, ldda, dev_ipiv, dB, lddb,
+           queue.pool_dev_info(), queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    unmqr_work_size_bytes( side, trans, m, n, k, dA, ldda, dtau, dC, lddc,
+                           &dev_work_size, &host_work_size, queue );
+    unmqr( side, trans, m, n, k, dA, ldda, dtau, dC, lddc,
+           queue.pool_dev_work( dev_work_size ), dev_work_size,
+           queue.pool_host_work( host_work_size ), host_work_size,
+           queue.pool_dev_info(), queue );
+}
+
+// ormqr alias to unmqr
+template <typename scalar_t>
+inline void ormqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    lapack::Queue& queue )
+{
+    unmqr( side, trans, m, n, k, dA, ldda, dtau, dC, lddc, queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    ungqr_work_size_bytes( m, n, k, dA, ldda, dtau,
+                           &dev_work_size, &host_work_size, queue );
+    ungqr( m, n, k, dA, ldda, dtau,
+           queue.pool_dev_work( dev_work_size ), dev_work_size,
+           queue.pool_host_work( host_work_size ), host_work_size,
+           queue.pool_dev_info(), queue );
+}
+
+// orgqr alias to ungqr
+template <typename scalar_t>
+inline void orgqr(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    lapack::Queue& queue )
+{
+    ungqr( m, n, k, dA, ldda, dtau, queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    gesvd_work_size_bytes( jobu, jobvt, m, n, dA, ldda, dS,
+                           dU, lddu, dVT, lddvt,
+                           &dev_work_size, &host_work_size, queue );
+    gesvd( jobu, jobvt, m, n, dA, ldda, dS, dU, lddu, dVT, lddvt,
+           queue.pool_dev_work( dev_work_size ), dev_work_size,
+           queue.pool_host_work( host_work_size ), host_work_size,
+           queue.pool_dev_info(), queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    sytrf_work_size_bytes( uplo, n, dA, ldda,
+                           &dev_work_size, &host_work_size, queue );
+    sytrf( uplo, n, dA, ldda, dev_ipiv,
+           queue.pool_dev_work( dev_work_size ), dev_work_size,
+           queue.pool_host_work( host_work_size ), host_work_size,
+           queue.pool_dev_info(), queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda, device_sytrf_pivot_int const* dev_ipiv,
+    scalar_t* dB, int64_t lddb,
+    lapack::Queue& queue )
+{
+    sytrs( uplo, n, nrhs, dA, ldda, dev_ipiv, dB, lddb,
+           queue.pool_dev_info(), queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    trtri_work_size_bytes( uplo, diag, n, dA, ldda,
+                           &dev_work_size, &host_work_size, queue );
+    trtri( uplo, diag, n, dA, ldda,
+           queue.pool_dev_work( dev_work_size ), dev_work_size,
+           queue.pool_host_work( host_work_size ), host_work_size,
+           queue.pool_dev_info(), queue );
+}
+
 }  // namespace lapack
 
 #endif // LAPACK_DEVICE_HH
@@ -9,6 +9,7 @@
 #include "lapack.hh"
 #include "blas/flops.hh"
 
+#include <algorithm>
 #include <complex>
 
 namespace lapack {
@@ -315,6 +316,266 @@ inline double fadds_lanhe(lapack::Norm norm, double n)
     }
 }
 
+//------------------------------------------------------------ tpqrt
+// QR of [ A; B ], A n-by-n upper triangular, B m-by-n.
+// For l = 0, B rectangular; an upper bound for l > 0, B pentagonal.
+inline double fmuls_tpqrt(double m, double n)
+    { return m*n*(n + 1); }
+
+inline double fadds_tpqrt(double m, double n)
+    { return m*n*n; }
+
+//------------------------------------------------------------ tpmqrt
+// Applies k reflectors with m (left) or n (right) nonzeros in V
+// to [ A; B ], B m-by-n. For l = 0; an upper bound for l > 0.
+inline double fmuls_tpmqrt(double m, double n, double k)
+    { return 2*m*n*k; }
+
+inline double fadds_tpmqrt(double m, double n, double k)
+    { return 2*m*n*k; }
+
+//------------------------------------------------------------ potrf_update
+// Rank-k update of a Cholesky factor, by a QR factorization of [ R; V^H ].
+inline double fmuls_potrf_update(double n, double k)
+    { return fmuls_tpqrt(k, n); }
+
+inline double fadds_potrf_update(double n, double k)
+    { return fadds_tpqrt(k, n); }
+
+//------------------------------------------------------------ pptrf_update
+// Rank-k update of a Cholesky factor, one column of V at a time,
+// by Givens rotations.
+inline double fmuls_pptrf_update(double n, double k)
+    { return 2*k*n*(n + 1); }
+
+inline double fadds_pptrf_update(double n, double k)
+    { return k*n*(n + 1); }
+
+//------------------------------------------------------------ potrf_downdate
+// Rank-k downdate of a Cholesky factor, one column of V at a time,
+// by a triangular solve, then Givens rotations.
+inline double fmuls_potrf_downdate(double n, double k)
+    { return fmuls_pptrf_update(n, k) + 0.5*k*n*(n + 1); }
+
+inline double fadds_potrf_downdate(double n, double k)
+    { return fadds_pptrf_update(n, k) + 0.5*k*n*(n - 1); }
+
+//------------------------------------------------------------ qr_insert_col
+// Orthogonalizing the new column twice against Q, then n - j rotations
+// applied to columns of Q and rows of R.
+inline double fmuls_qr_insert_col(double m, double n, double j)
+    { return 4*m*n + 4*(m*(n - j) + 0.5*(n - j)*(n - j + 1)); }
+
+inline double fadds_qr_insert_col(double m, double n, double j)
+    { return 4*m*n + 2*(m*(n - j) + 0.5*(n - j)*(n - j + 1)); }
+
+//------------------------------------------------------------ qr_delete_col
+// n - 1 - j rotations applied to columns of Q and rows of R.
+inline double fmuls_qr_delete_col(double m, double n, double j)
+    { return 4*(m*(n - 1 - j) + 0.5*(n - 1 - j)*(n - 2 - j)); }
+
+inline double fadds_qr_delete_col(double m, double n, double j)
+    { return 0.5*fmuls_qr_delete_col(m, n, j); }
+
+//------------------------------------------------------------ qr_insert_col_implicit
+// With Q not stored: a reflector of length m - n applied to ncol columns
+// of C, then n - j rotations applied to rows of R and of C.
+inline double fmuls_qr_insert_col_implicit(double m, double n, double j, double ncol)
+    { return 2*(m - n)*(ncol + 1) + 4*(0.5*(n - j)*(n - j + 1) + (n - j)*ncol); }
+
+inline double fadds_qr_insert_col_implicit(double m, double n, double j, double ncol)
+    { return 2*(m - n)*ncol + 2*(0.5*(n - j)*(n - j + 1) + (n - j)*ncol); }
+
+//------------------------------------------------------------ qr_delete_col_implicit
+// n - 1 - j rotations applied to rows of R and of C.
+inline double fmuls_qr_delete_col_implicit(double n, double j, double ncol)
+    { return 4*(0.5*(n - 1 - j)*(n - 2 - j) + (n - 1 - j)*ncol); }
+
+inline double fadds_qr_delete_col_implicit(double n, double j, double ncol)
+    { return 0.5*fmuls_qr_delete_col_implicit(n, j, ncol); }
+
+//------------------------------------------------------------ gbtrf
+// Leading terms, assuming U fills in to kl + ku superdiagonals,
+// its bound with partial pivoting; less if fewer rows are interchanged.
+inline double fmuls_gbtrf(double m, double n, double kl, double ku)
+    { return std::min(m, n)*kl*(kl + ku + 1); }
+
+inline double fadds_gbtrf(double m, double n, double kl, double ku)
+    { return std::min(m, n)*kl*(kl + ku); }
+
+//------------------------------------------------------------ gbtrs
+inline double fmuls_gbtrs(double n, double kl, double ku, double nrhs)
+    { return nrhs*n*(2*kl + ku + 1); }
+
+inline double fadds_gbtrs(double n, double kl, double ku, double nrhs)
+    { return nrhs*n*(2*kl + ku); }
+
+//------------------------------------------------------------ gttrf
+inline double fmuls_gttrf(double n)
+    { return 2*(n - 1); }
+
+inline double fadds_gttrf(double n)
+    { return n - 1; }
+
+//------------------------------------------------------------ gttrs
+inline double fmuls_gttrs(double n, double nrhs)
+    { return nrhs*(4*n - 4); }
+
+inline double fadds_gttrs(double n, double nrhs)
+    { return nrhs*(3*n - 4); }
+
+//------------------------------------------------------------ pttrf
+inline double fmuls_pttrf(double n)
+    { return 2*(n - 1); }
+
+inline double fadds_pttrf(double n)
+    { return n - 1; }
+
+//------------------------------------------------------------ pttrs
+inline double fmuls_pttrs(double n, double nrhs)
+    { return nrhs*(3*n - 2); }
+
+inline double fadds_pttrs(double n, double nrhs)
+    { return nrhs*2*(n - 1); }
+
+//------------------------------------------------------------ tbtrs
+inline double fmuls_tbtrs(double n, double kd, double nrhs)
+    { return nrhs*(n*(kd + 1) - 0.5*kd*(kd + 1)); }
+
+inline double fadds_tbtrs(double n, double kd, double nrhs)
+    { return nrhs*(n*kd - 0.5*kd*(kd + 1)); }
+
+//------------------------------------------------------------ hegst
+inline double fmuls_hegst(double n)
+    { return 0.5*n*n*n; }
+
+inline double fadds_hegst(double n)
+    { return 0.5*n*n*n; }
+
+//------------------------------------------------------------ hbtrd
+// Leading terms; forming Q adds 3 n^3 (kd - 1) / kd flops.
+inline double fmuls_hbtrd(lapack::Job jobz, double n, double kd)
+{
+    double q = (jobz == lapack::Job::NoVec || kd <= 0 ? 0 : 1.5*n*n*n*(kd - 1)/kd);
+    return 3*n*n*kd + q;
+}
+
+inline double fadds_hbtrd(lapack::Job jobz, double n, double kd)
+    { return fmuls_hbtrd(jobz, n, kd); }
+
+//------------------------------------------------------------ gghrd
+// Leading terms, for ilo = 1 and ihi = n.
+inline double fmuls_gghrd(lapack::Job compq, lapack::Job compz, double n)
+{
+    return (4 + (compq == lapack::Job::NoVec ? 0 : 2)
+              + (compz == lapack::Job::NoVec ? 0 : 1.5))*n*n*n;
+}
+
+inline double fadds_gghrd(lapack::Job compq, lapack::Job compz, double n)
+    { return fmuls_gghrd(compq, compz, n); }
+
+//------------------------------------------------------------ tzrzf
+inline double fmuls_tzrzf(double m, double n)
+    { return (n - m + 1)*m*(m - 1) + 2*m*(n - m + 1); }
+
+inline double fadds_tzrzf(double m, double n)
+    { return (n - m + 1)*m*(m - 1) + m*(n - m + 1); }
+
+//------------------------------------------------------------ unmrz
+// Each of the k reflectors has l + 1 nonzeros.
+inline double fmuls_unmrz(lapack::Side side, double m, double n, double k, double l)
+    { return 2*k*(l + 1)*(side == lapack::Side::Left ? n : m); }
+
+inline double fadds_unmrz(lapack::Side side, double m, double n, double k, double l)
+    { return fmuls_unmrz(side, m, n, k, l); }
+
+//------------------------------------------------------------ larf
+inline double fmuls_larf(lapack::Side side, double m, double n)
+    { return 2*m*n + (side == lapack::Side::Left ? n : m); }
+
+inline double fadds_larf(lapack::Side, double m, double n)
+    { return 2*m*n; }
+
+//------------------------------------------------------------ larfy
+inline double fmuls_larfy(double n)
+    { return 2*n*n + 3*n; }
+
+inline double fadds_larfy(double n)
+    { return 2*n*n; }
+
+//------------------------------------------------------------ larfb
+inline double fmuls_larfb(lapack::Side side, double m, double n, double k)
+{
+    return (side == lapack::Side::Left
+            ? 2*m*n*k + 0.5*n*k*k
+            : 2*m*n*k + 0.5*m*k*k);
+}
+
+inline double fadds_larfb(lapack::Side side, double m, double n, double k)
+    { return fmuls_larfb(side, m, n, k); }
+
+//------------------------------------------------------------ larft
+inline double fmuls_larft(double n, double k)
+    { return 0.5*n*k*k - 1./6*k*k*k; }
+
+inline double fadds_larft(double n, double k)
+    { return 0.5*n*k*k - 1./6*k*k*k; }
+
+//------------------------------------------------------------ lascl
+// For a general matrix; an upper bound for the other matrix types.
+inline double fmuls_lascl(double m, double n)
+    { return m*n; }
+
+inline double fadds_lascl(double, double)
+    { return 0; }
+
+//------------------------------------------------------------ lasr
+inline double fmuls_lasr(lapack::Side side, double m, double n)
+{
+    return (side == lapack::Side::Left
+            ? 4*n*(m - 1)
+            : 4*m*(n - 1));
+}
+
+inline double fadds_lasr(lapack::Side side, double m, double n)
+    { return 0.5*fmuls_lasr(side, m, n); }
+
+//------------------------------------------------------------ lassq
+inline double fmuls_lassq(double n)
+    { return n; }
+
+inline double fadds_lassq(double n)
+    { return n; }
+
+//------------------------------------------------------------ sturm
+// Excludes the data-dependent rescaling.
+inline double fmuls_sturm(double n)
+    { return 3*(n - 1); }
+
+inline double fadds_sturm(double n)
+    { return 2*n - 1; }
+
+//------------------------------------------------------------ lan*
+// Norms of structured matrices, from their number of entries, nz.
+// Non-symmetric types count as lange does for m*n entries.
+inline double fmuls_lan(lapack::Norm norm, double nz)
+    { return norm == lapack::Norm::Fro ? nz : 0; }
+
+inline double fadds_lan(lapack::Norm norm, double nz)
+    { return norm == lapack::Norm::Max ? 0 : nz; }
+
+// Symmetric types store nz entries; the one and infinity norms add
+// the off-diagonal ones twice, as lanhe does.
+inline double fadds_lan_sym(lapack::Norm norm, double nz)
+{
+    switch (norm) {
+    case lapack::Norm::One: return 2*nz;
+    case lapack::Norm::Inf: return 2*nz;
+    case lapack::Norm::Fro: return nz;
+    default:                return 0;
+    }
+}
+
 //==============================================================================
 // template class. Example:
 // gbyte< float >::gemv( m, n ) yields bytes transferred for sgemv.
@@ -365,6 +626,19 @@ public:
     static double potrs(double n, double nrhs)
         { return 1e-9 * (mul_ops*fmuls_potrs(n, nrhs) + add_ops*fadds_potrs(n, nrhs)); }
 
+    // Cholesky update and downdate
+    static double potrf_update(double n, double k)
+        { return 1e-9 * (mul_ops*fmuls_potrf_update(n, k) + add_ops*fadds_potrf_update(n, k)); }
+
+    static double pptrf_update(double n, double k)
+        { return 1e-9 * (mul_ops*fmuls_pptrf_update(n, k) + add_ops*fadds_pptrf_update(n, k)); }
+
+    static double potrf_downdate(double n, double k)
+        { return 1e-9 * (mul_ops*fmuls_potrf_downdate(n, k) + add_ops*fadds_potrf_downdate(n, k)); }
+
+    static double pptrf_downdate(double n, double k)
+        { return potrf_downdate(n, k); }
+
     // Band Cholesky
     static double pbsv(double n, double nrhs, double k)
         { return pbtrf(n, k) + pbtrs(n, nrhs, k); }
@@ -466,6 +740,109 @@ public:
     static double ormlq(lapack::Side side, double m, double n, double k)
         { return unmlq(side, m, n, k); }
 
+    // generate or multiply by Q from tridiagonal reduction,
+    // Q = H(n-1) ... H(1)
+    static double ungtr(double n)
+        { return ungqr(n - 1, n - 1, n - 1); }
+
+    static double orgtr(double n)
+        { return ungtr(n); }
+
+    static double unmtr(lapack::Side side, double m, double n)
+    {
+        return (side == lapack::Side::Left
+                ? unmqr(side, m - 1, n, m - 1)
+                : unmqr(side, m, n - 1, n - 1));
+    }
+
+    static double ormtr(lapack::Side side, double m, double n)
+        { return unmtr(side, m, n); }
+
+    // generate or multiply by Q from Hessenberg reduction,
+    // Q = H(ilo) ... H(ihi-1)
+    static double unghr(double ilo, double ihi)
+        { return ungqr(ihi - ilo, ihi - ilo, ihi - ilo); }
+
+    static double orghr(double ilo, double ihi)
+        { return unghr(ilo, ihi); }
+
+    static double unmhr(lapack::Side side, double m, double n, double ilo, double ihi)
+    {
+        double nh = ihi - ilo;
+        return (side == lapack::Side::Left
+                ? unmqr(side, nh, n, nh)
+                : unmqr(side, m, nh, nh));
+    }
+
+    static double ormhr(lapack::Side side, double m, double n, double ilo, double ihi)
+        { return unmhr(side, m, n, ilo, ihi); }
+
+    // generate or multiply by Q or P^H from bidiagonal reduction
+    static double ungbr(lapack::Vect vect, double m, double n, double k)
+    {
+        return (vect == lapack::Vect::Q
+                ? ungqr(m, n, std::min(m, k))
+                : unglq(m, n, std::min(n, k)));
+    }
+
+    static double orgbr(lapack::Vect vect, double m, double n, double k)
+        { return ungbr(vect, m, n, k); }
+
+    static double unmbr(lapack::Vect vect, lapack::Side side, double m, double n, double k)
+    {
+        double nq = (side == lapack::Side::Left ? m : n);
+        return (vect == lapack::Vect::Q
+                ? unmqr(side, m, n, std::min(nq, k))
+                : unmlq(side, m, n, std::min(nq, k)));
+    }
+
+    static double ormbr(lapack::Vect vect, lapack::Side side, double m, double n, double k)
+        { return unmbr(vect, side, m, n, k); }
+
+    // reconstruct Householder vectors from an m-by-n orthonormal Q;
+    // excludes forming the triangular block reflectors T
+    static double unhr_col(double m, double n)
+        { return getrf(n, n) + blas::Gflop<T>::trsm(blas::Side::Right, m - n, n); }
+
+    static double orhr_col(double m, double n)
+        { return unhr_col(m, n); }
+
+    // generalized QR and RQ
+    static double ggqrf(double n, double m, double p)
+        { return geqrf(n, m) + unmqr(lapack::Side::Left, n, p, std::min(n, m)) + gerqf(n, p); }
+
+    static double ggrqf(double m, double p, double n)
+        { return gerqf(m, n) + unmrq(lapack::Side::Right, p, n, std::min(m, n)) + geqrf(p, n); }
+
+    // update a QR factorization by inserting or deleting a column
+    static double qr_insert_col(double m, double n, double j)
+        { return 1e-9 * (mul_ops*fmuls_qr_insert_col(m, n, j) + add_ops*fadds_qr_insert_col(m, n, j)); }
+
+    static double qr_delete_col(double m, double n, double j)
+        { return 1e-9 * (mul_ops*fmuls_qr_delete_col(m, n, j) + add_ops*fadds_qr_delete_col(m, n, j)); }
+
+    static double qr_insert_col_implicit(double m, double n, double j, double ncol)
+        { return 1e-9 * (mul_ops*fmuls_qr_insert_col_implicit(m, n, j, ncol) + add_ops*fadds_qr_insert_col_implicit(m, n, j, ncol)); }
+
+    static double qr_delete_col_implicit(double n, double j, double ncol)
+        { return 1e-9 * (mul_ops*fmuls_qr_delete_col_implicit(n, j, ncol) + add_ops*fadds_qr_delete_col_implicit(n, j, ncol)); }
+
+    // triangular-pentagonal QR and LQ, and applying their Q
+    static double tpqrt(double m, double n)
+        { return 1e-9 * (mul_ops*fmuls_tpqrt(m, n) + add_ops*fadds_tpqrt(m, n)); }
+
+    static double tplqt(double m, double n)
+        { return tpqrt(n, m); }
+
+    static double tpmqrt(double m, double n, double k)
+        { return 1e-9 * (mul_ops*fmuls_tpmqrt(m, n, k) + add_ops*fadds_tpmqrt(m, n, k)); }
+
+    static double tpmlqt(double m, double n, double k)
+        { return tpmqrt(m, n, k); }
+
+    static double tprfb(double m, double n, double k)
+        { return tpmqrt(m, n, k); }
+
     // least squares
     static double gels(double m, double n, double nrhs)
     {
@@ -475,6 +852,50 @@ public:
             : gelqf(m, n) + unmlq(left, n, nrhs, m) + blas::Gflop<T>::trsm(left, m, nrhs));
     }
 
+    // band LU
+    static double gbsv(double n, double kl, double ku, double nrhs)
+        { return gbtrf(n, n, kl, ku) + gbtrs(n, kl, ku, nrhs); }
+
+    static double gbtrf(double m, double n, double kl, double ku)
+        { return 1e-9 * (mul_ops*fmuls_gbtrf(m, n, kl, ku) + add_ops*fadds_gbtrf(m, n, kl, ku)); }
+
+    static double gbtrs(double n, double kl, double ku, double nrhs)
+        { return 1e-9 * (mul_ops*fmuls_gbtrs(n, kl, ku, nrhs) + add_ops*fadds_gbtrs(n, kl, ku, nrhs)); }
+
+    // tridiagonal LU
+    static double gtsv(double n, double nrhs)
+        { return gttrf(n) + gttrs(n, nrhs); }
+
+    static double gttrf(double n)
+        { return 1e-9 * (mul_ops*fmuls_gttrf(n) + add_ops*fadds_gttrf(n)); }
+
+    static double gttrs(double n, double nrhs)
+        { return 1e-9 * (mul_ops*fmuls_gttrs(n, nrhs) + add_ops*fadds_gttrs(n, nrhs)); }
+
+    // tridiagonal LDL^H
+    static double ptsv(double n, double nrhs)
+        { return pttrf(n) + pttrs(n, nrhs); }
+
+    static double pttrf(double n)
+        { return 1e-9 * (mul_ops*fmuls_pttrf(n) + add_ops*fadds_pttrf(n)); }
+
+    static double pttrs(double n, double nrhs)
+        { return 1e-9 * (mul_ops*fmuls_pttrs(n, nrhs) + add_ops*fadds_pttrs(n, nrhs)); }
+
+    // triangular solve
+    static double trtrs(double n, double nrhs)
+        { return blas::Gflop<T>::trsm(blas::Side::Left, n, nrhs); }
+
+    static double tbtrs(double n, double kd, double nrhs)
+        { return 1e-9 * (mul_ops*fmuls_tbtrs(n, kd, nrhs) + add_ops*fadds_tbtrs(n, kd, nrhs)); }
+
+    // constrained and generalized least squares, leading terms
+    static double gglse(double m, double n, double p)
+        { return ggrqf(p, m, n); }
+
+    static double ggglm(double n, double m, double p)
+        { return ggqrf(n, m, p); }
+
     // triangle inverse
     static double trtri(double n)
         { return 1e-9 * (mul_ops*fmuls_trtri(n) + add_ops*fadds_trtri(n)); }
@@ -490,6 +911,37 @@ public:
     static double sytrd(double n)
         { return hetrd(n); }
 
+    static double hbtrd(lapack::Job jobz, double n, double kd)
+        { return 1e-9 * (mul_ops*fmuls_hbtrd(jobz, n, kd) + add_ops*fadds_hbtrd(jobz, n, kd)); }
+
+    static double sbtrd(lapack::Job jobz, double n, double kd)
+        { return hbtrd(jobz, n, kd); }
+
+    // Sturm sequence count of eigenvalues less than u
+    static double sturm(double n)
+        { return 1e-9 * (mul_ops*fmuls_sturm(n) + add_ops*fadds_sturm(n)); }
+
+    // generalized eigenvalue: reduction to standard form,
+    // and to Hessenberg-triangular form
+    static double hegst(double n)
+        { return 1e-9 * (mul_ops*fmuls_hegst(n) + add_ops*fadds_hegst(n)); }
+
+    static double sygst(double n)
+        { return hegst(n); }
+
+    static double gghrd(lapack::Job compq, lapack::Job compz, double n)
+        { return 1e-9 * (mul_ops*fmuls_gghrd(compq, compz, n) + add_ops*fadds_gghrd(compq, compz, n)); }
+
+    // RZ, trapezoidal to triangular
+    static double tzrzf(double m, double n)
+        { return 1e-9 * (mul_ops*fmuls_tzrzf(m, n) + add_ops*fadds_tzrzf(m, n)); }
+
+    static double unmrz(lapack::Side side, double m, double n, double k, double l)
+        { return 1e-9 * (mul_ops*fmuls_unmrz(side, m, n, k, l) + add_ops*fadds_unmrz(side, m, n, k, l)); }
+
+    static double ormrz(lapack::Side side, double m, double n, double k, double l)
+        { return unmrz(side, m, n, k, l); }
+
     // bidiagonal reduction (SVD)
     static double gebrd(double m, double n)
         { return 1e-9 * (mul_ops*fmuls_gebrd(m, n) + add_ops*fadds_gebrd(m, n)); }
@@ -498,6 +950,38 @@ public:
     static double larfg(double n)
         { return 1e-9 * (mul_ops*fmuls_larfg(n) + add_ops*fadds_larfg(n)); }
 
+    // back transform eigenvectors of a balanced matrix, scaling rows ilo:ihi
+    static double gebak(lapack::Balance balance, double m, double ilo, double ihi)
+    {
+        return (balance == lapack::Balance::Scale || balance == lapack::Balance::Both
+                ? 1e-9 * mul_ops*m*(ihi - ilo + 1)
+                : 0);
+    }
+
+    // Householder reflector apply
+    static double larf(lapack::Side side, double m, double n)
+        { return 1e-9 * (mul_ops*fmuls_larf(side, m, n) + add_ops*fadds_larf(side, m, n)); }
+
+    static double larfy(double n)
+        { return 1e-9 * (mul_ops*fmuls_larfy(n) + add_ops*fadds_larfy(n)); }
+
+    // block Householder reflector apply and form T
+    static double larfb(lapack::Side side, double m, double n, double k)
+        { return 1e-9 * (mul_ops*fmuls_larfb(side, m, n, k) + add_ops*fadds_larfb(side, m, n, k)); }
+
+    static double larft(double n, double k)
+        { return 1e-9 * (mul_ops*fmuls_larft(n, k) + add_ops*fadds_larft(n, k)); }
+
+    // scale, plane rotations, sum of squares
+    static double lascl(double m, double n)
+        { return 1e-9 * (mul_ops*fmuls_lascl(m, n) + add_ops*fadds_lascl(m, n)); }
+
+    static double lasr(lapack::Side side, double m, double n)
+        { return 1e-9 * (mul_ops*fmuls_lasr(side, m, n) + add_ops*fadds_lasr(side, m, n)); }
+
+    static double lassq(double n)
+        { return 1e-9 * (mul_ops*fmuls_lassq(n) + add_ops*fadds_lassq(n)); }
+
     // matrix add
     static double geadd(double m, double n)
         { return 1e-9 * (mul_ops*fmuls_geadd(m, n) + add_ops*fadds_geadd(m, n)); }
@@ -515,6 +999,54 @@ public:
 
     static double lansy(lapack::Norm norm, double n)
         { return lanhe(norm, n); }
+
+    static double lanhp(lapack::Norm norm, double n)
+        { return lanhe(norm, n); }
+
+    static double lansp(lapack::Norm norm, double n)
+        { return lanhe(norm, n); }
+
+    static double langb(lapack::Norm norm, double n, double kl, double ku)
+        { return lan(norm, n*(kl + ku + 1) - 0.5*(kl*(kl + 1) + ku*(ku + 1))); }
+
+    static double langt(lapack::Norm norm, double n)
+        { return lan(norm, 3*n - 2); }
+
+    static double lanhs(lapack::Norm norm, double n)
+        { return lan(norm, 0.5*n*(n + 1) + n - 1); }
+
+    static double lantr(lapack::Norm norm, double m, double n)
+    {
+        return lan(norm, m >= n
+                         ? 0.5*n*(n + 1) + (m - n)*n
+                         : 0.5*m*(m + 1) + (n - m)*m);
+    }
+
+    static double lantp(lapack::Norm norm, double n)
+        { return lantr(norm, n, n); }
+
+    static double lantb(lapack::Norm norm, double n, double k)
+        { return lan(norm, n*(k + 1) - 0.5*k*(k + 1)); }
+
+    static double lanhb(lapack::Norm norm, double n, double k)
+        { return lan_sym(norm, n*(k + 1) - 0.5*k*(k + 1)); }
+
+    static double lansb(lapack::Norm norm, double n, double k)
+        { return lanhb(norm, n, k); }
+
+    static double lanht(lapack::Norm norm, double n)
+        { return lan_sym(norm, 2*n - 1); }
+
+    static double lanst(lapack::Norm norm, double n)
+        { return lanht(norm, n); }
+
+private:
+    // norm of a matrix with nz entries
+    static double lan(lapack::Norm norm, double nz)
+        { return 1e-9 * (mul_ops*fmuls_lan(norm, nz) + add_ops*fadds_lan(norm, nz)); }
+
+    static double lan_sym(lapack::Norm norm, double nz)
+        { return 1e-9 * (mul_ops*fmuls_lan(norm, nz) + add_ops*fadds_lan_sym(norm, nz)); }
 };
 
 }  // namespace lapack
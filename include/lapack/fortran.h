@@ -14915,6 +14915,83 @@ void LAPACK_dlaed4(
     double const* d, double const* z, double* delta,
     double const* rho, double* lambda, lapack_int* info );
 
+#define LAPACK_slasd4 LAPACK_GLOBAL( slasd4, SLASD4 )
+void LAPACK_slasd4(
+    lapack_int const* n, lapack_int const* i,
+    float const* d, float const* z, float* delta,
+    float const* rho, float* sigma, float* work, lapack_int* info );
+#define LAPACK_dlasd4 LAPACK_GLOBAL( dlasd4, DLASD4 )
+void LAPACK_dlasd4(
+    lapack_int const* n, lapack_int const* i,
+    double const* d, double const* z, double* delta,
+    double const* rho, double* sigma, double* work, lapack_int* info );
+
+#define LAPACK_slarrb LAPACK_GLOBAL( slarrb, SLARRB )
+void LAPACK_slarrb(
+    lapack_int const* n, float const* d, float const* lld,
+    lapack_int const* ifirst, lapack_int const* ilast,
+    float const* rtol1, float const* rtol2, lapack_int const* offset,
+    float* w, float* wgap, float* werr,
+    float* work, lapack_int* iwork,
+    float const* pivmin, float const* spdiam, lapack_int const* twist,
+    lapack_int* info );
+#define LAPACK_dlarrb LAPACK_GLOBAL( dlarrb, DLARRB )
+void LAPACK_dlarrb(
+    lapack_int const* n, double const* d, double const* lld,
+    lapack_int const* ifirst, lapack_int const* ilast,
+    double const* rtol1, double const* rtol2, lapack_int const* offset,
+    double* w, double* wgap, double* werr,
+    double* work, lapack_int* iwork,
+    double const* pivmin, double const* spdiam, lapack_int const* twist,
+    lapack_int* info );
+
+#define LAPACK_slarrv LAPACK_GLOBAL( slarrv, SLARRV )
+void LAPACK_slarrv(
+    lapack_int const* n, float const* vl, float const* vu,
+    float* d, float* l, float const* pivmin,
+    lapack_int const* isplit, lapack_int const* m,
+    lapack_int const* dol, lapack_int const* dou,
+    float const* minrgp, float const* rtol1, float const* rtol2,
+    float* w, float* werr, float* wgap,
+    lapack_int const* iblock, lapack_int const* indexw,
+    float const* gers, float* Z, lapack_int const* ldz,
+    lapack_int* isuppz, float* work, lapack_int* iwork,
+    lapack_int* info );
+#define LAPACK_dlarrv LAPACK_GLOBAL( dlarrv, DLARRV )
+void LAPACK_dlarrv(
+    lapack_int const* n, double const* vl, double const* vu,
+    double* d, double* l, double const* pivmin,
+    lapack_int const* isplit, lapack_int const* m,
+    lapack_int const* dol, lapack_int const* dou,
+    double const* minrgp, double const* rtol1, double const* rtol2,
+    double* w, double* werr, double* wgap,
+    lapack_int const* iblock, lapack_int const* indexw,
+    double const* gers, double* Z, lapack_int const* ldz,
+    lapack_int* isuppz, double* work, lapack_int* iwork,
+    lapack_int* info );
+
+#define LAPACK_slagtf LAPACK_GLOBAL( slagtf, SLAGTF )
+void LAPACK_slagtf(
+    lapack_int const* n, float* a, float const* lambda,
+    float* b, float* c, float const* tol,
+    float* d, lapack_int* in, lapack_int* info );
+#define LAPACK_dlagtf LAPACK_GLOBAL( dlagtf, DLAGTF )
+void LAPACK_dlagtf(
+    lapack_int const* n, double* a, double const* lambda,
+    double* b, double* c, double const* tol,
+    double* d, lapack_int* in, lapack_int* info );
+
+#define LAPACK_slagts LAPACK_GLOBAL( slagts, SLAGTS )
+void LAPACK_slagts(
+    lapack_int const* job, lapack_int const* n,
+    float const* a, float const* b, float const* c, float const* d,
+    lapack_int const* in, float* y, float* tol, lapack_int* info );
+#define LAPACK_dlagts LAPACK_GLOBAL( dlagts, DLAGTS )
+void LAPACK_dlagts(
+    lapack_int const* job, lapack_int const* n,
+    double const* a, double const* b, double const* c, double const* d,
+    lapack_int const* in, double* y, double* tol, lapack_int* info );
+
 /* ----- random */
 #define LAPACK_slarnv LAPACK_GLOBAL( slarnv, SLARNV )
 void LAPACK_slarnv(
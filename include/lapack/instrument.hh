@@ -0,0 +1,166 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_INSTRUMENT_HH
+#define LAPACK_INSTRUMENT_HH
+
+#include "lapack/util.hh"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Per-routine instrumentation of the LAPACK wrappers.
+///
+/// When enabled, each wrapper records its call count, wall time,
+/// dimensions, and Gflop count (from lapack/flops.hh, where it has one),
+/// aggregated per routine and precision:
+///
+///     lapack::instrument::enable();
+///     ...  // application calls LAPACK++
+///     for (auto& r : lapack::instrument::snapshot()) {
+///         printf( "%c%-8s %8lld calls %10.4f sec %10.2f Gflop/s\n",
+///                 r.precision, r.routine.c_str(), llong( r.calls ),
+///                 r.time, r.gflop / r.time );
+///     }
+///
+/// It is disabled by default. Then each wrapper only checks an atomic flag.
+/// For a timeline of individual calls, see lapack/trace.hh.
+/// Times are inclusive: a wrapper that calls other wrappers, e.g., a driver
+/// that calls a workspace query, includes their time, and they are also
+/// recorded.
+namespace instrument {
+
+//------------------------------------------------------------------------------
+/// Statistics of one routine in one precision.
+/// @ingroup util
+struct Record {
+    std::string routine;    ///< wrapper name, e.g., "getrf"
+    char precision;         ///< 's', 'd', 'c', 'z'
+    int64_t calls;          ///< number of calls
+    double time;            ///< total wall time, in seconds
+    double gflop;           ///< total Gflop; 0 if the routine has no count:
+                            ///< it does no significant arithmetic, its count
+                            ///< depends on the data, or it has no formula
+    int64_t m_max;          ///< largest m of any call; 0 if no m argument
+    int64_t n_max;          ///< largest n of any call; 0 if no n argument
+    int64_t k_max;          ///< largest k, or nrhs, of any call; 0 if neither
+};
+
+/// Enables or disables recording. Safe to call while other threads run
+/// LAPACK++; calls in progress may or may not be recorded.
+/// @ingroup util
+void enable( bool on = true );
+
+/// @return true if recording is enabled.
+/// @ingroup util
+bool enabled();
+
+/// @return statistics of each routine and precision called since the last
+/// reset, sorted by routine, then precision.
+/// @ingroup util
+std::vector< Record > snapshot();
+
+/// Clears all statistics. Calls in progress may be recorded after it.
+/// @ingroup util
+void reset();
+
+}  // namespace instrument
+
+//------------------------------------------------------------------------------
+namespace internal {
+
+/// Bits of instrument_flags.
+enum InstrumentFlag {
+    InstrumentStats = 1,    ///< lapack::instrument
+    InstrumentTrace = 2,    ///< lapack::trace
+};
+
+/// Enabled instrumentation; 0 if none.
+extern std::atomic< int > instrument_flags;
+
+/// Bytes of workspace allocated by this thread while tracing;
+/// the difference over a call is the call's workspace.
+extern thread_local int64_t instrument_work_bytes;
+
+//------------------------------------------------------------------------------
+/// Statistics of one call site, i.e., one wrapper. Counters are static
+/// objects that register themselves on first use, and are never destroyed.
+class InstrumentCounter {
+public:
+    InstrumentCounter( char const* routine, char precision );
+
+    void add( int64_t m, int64_t n, int64_t k, double gflop, double time );
+    void get( instrument::Record* record );
+    void clear();
+
+    char const* routine() const { return routine_; }
+    char precision() const { return precision_; }
+
+private:
+    char const* routine_;
+    char precision_;
+    std::atomic< int64_t > calls_;
+    std::atomic< double > time_;
+    std::atomic< double > gflop_;
+    std::atomic< int64_t > m_max_;
+    std::atomic< int64_t > n_max_;
+    std::atomic< int64_t > k_max_;
+};
+
+//------------------------------------------------------------------------------
+/// @return wall time in seconds, from an arbitrary origin.
+double instrument_time();
+
+//------------------------------------------------------------------------------
+/// Times a call, from construction to destruction, and adds it to counter
+/// and to the trace, as enabled. Does nothing if counter is null, which is
+/// the case when disabled, so this is inline to cost only the null checks.
+class InstrumentTimer {
+public:
+    InstrumentTimer( InstrumentCounter* counter,
+                     int64_t m, int64_t n, int64_t k, double gflop )
+        : counter_( counter ),
+          m_( m ),
+          n_( n ),
+          k_( k ),
+          gflop_( gflop ),
+          start_( 0 ),
+          work_( 0 )
+    {
+        if (counter_ != nullptr)
+            start();
+    }
+
+    ~InstrumentTimer()
+    {
+        if (counter_ != nullptr)
+            stop();
+    }
+
+    /// Sets the Gflop count, for routines that know it only at the end.
+    void set_gflop( double gflop ) { gflop_ = gflop; }
+
+    InstrumentTimer( InstrumentTimer const& ) = delete;
+    InstrumentTimer& operator = ( InstrumentTimer const& ) = delete;
+
+private:
+    void start();
+    void stop();
+
+    InstrumentCounter* counter_;
+    int64_t m_, n_, k_;
+    double gflop_;
+    double start_;
+    int64_t work_;
+};
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_INSTRUMENT_HH
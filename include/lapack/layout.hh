@@ -0,0 +1,108 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_LAYOUT_HH
+#define LAPACK_LAYOUT_HH
+
+#include "lapack/util.hh"
+
+namespace lapack {
+
+// Layout-aware overloads of the main factorizations and drivers.
+// A row-major matrix is handled as the column-major transpose, using
+// transpose identities rather than copies; see src/layout.cc.
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void transpose_inplace(
+    lapack::Op op, int64_t n,
+    scalar_t* A, int64_t lda );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t gelqf(
+    blas::Layout layout, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* tau );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t geqrf(
+    blas::Layout layout, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* tau );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t gesdd(
+    blas::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t gesv(
+    blas::Layout layout, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    scalar_t* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t gesvd(
+    blas::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t getrf(
+    blas::Layout layout, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t getrs(
+    blas::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    int64_t const* ipiv,
+    scalar_t* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t heevd(
+    blas::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t posv(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t potrf(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t potrs(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb );
+
+}  // namespace lapack
+
+#endif // LAPACK_LAYOUT_HH
@@ -0,0 +1,130 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_MATRIX_FILE_HH
+#define LAPACK_MATRIX_FILE_HH
+
+#include "lapack/util.hh"
+#include "lapack/ooc.hh"
+
+#include <string>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Description of a matrix file, from its header.
+///
+/// A matrix file is a 64-byte header followed by the matrix data:
+///
+/// Bytes | Field
+/// ------|------
+///  0- 7 | magic "LAPACKPP"
+///  8-11 | version, uint32, currently 1; also detects byte order
+/// 12    | precision: 's', 'd', 'c', 'z'
+/// 13    | layout: 'C' column-major, 'R' row-major
+/// 14    | matrix type, as lapack::MatrixType: 'G', 'L', 'U', 'H', ...
+/// 15    | reserved, 0
+/// 16-23 | m, int64
+/// 24-31 | n, int64
+/// 32-39 | ld, int64; ld >= m if column-major, ld >= n if row-major
+/// 40-47 | alignment, int64; offset is a multiple of alignment
+/// 48-55 | offset, int64; byte offset of the data
+/// 56-63 | reserved, 0
+///
+/// The data is n columns (column-major) or m rows (row-major) of ld
+/// elements each, in native byte order. With the default 4096-byte
+/// alignment, the data is page aligned, so a memory-mapped file
+/// can be passed directly to LAPACK routines.
+/// @ingroup ooc
+struct MatrixFileInfo {
+    char precision;             ///< 's', 'd', 'c', 'z'
+    blas::Layout layout;
+    lapack::MatrixType type;
+    int64_t m, n, ld;
+    int64_t alignment;          ///< alignment of offset, in bytes
+    int64_t offset;             ///< byte offset of data
+};
+
+/// Reads the header of a matrix file, e.g., to select the precision.
+MatrixFileInfo read_matrix_file_info( std::string const& filename );
+
+//------------------------------------------------------------------------------
+/// Matrix file mapped into memory with mmap, or MapViewOfFile on Windows.
+/// The data can be passed directly to LAPACK routines, without copying:
+///
+///     lapack::MatrixFile< double > A( "A.mat" );
+///     lapack::potrf( Uplo::Lower, A.n(), A.data(), A.ld() );
+///
+/// If opened read-only (the default), the mapping is copy-on-write:
+/// routines can overwrite the matrix in memory, but the file is unchanged.
+/// If opened writable, changes are written to the file.
+/// @ingroup ooc
+template <typename scalar_t>
+class MatrixFile {
+public:
+    /// Opens and maps an existing matrix file.
+    /// Throws Error if the file is invalid or its precision does not
+    /// match scalar_t.
+    explicit MatrixFile( std::string const& filename, bool writable=false );
+
+    /// Creates a matrix file of zeros, mapped writable.
+    /// If ld = 0, ld is m for column-major, n for row-major.
+    static MatrixFile create(
+        std::string const& filename, int64_t m, int64_t n,
+        lapack::MatrixType type=lapack::MatrixType::General,
+        blas::Layout layout=blas::Layout::ColMajor,
+        int64_t ld=0, int64_t alignment=4096 );
+
+    ~MatrixFile();
+
+    MatrixFile( MatrixFile&& other );
+    MatrixFile& operator = ( MatrixFile&& other );
+    MatrixFile( MatrixFile const& ) = delete;
+    MatrixFile& operator = ( MatrixFile const& ) = delete;
+
+    scalar_t*       data()       { return data_; }
+    scalar_t const* data() const { return data_; }
+
+    int64_t m()  const { return info_.m;  }
+    int64_t n()  const { return info_.n;  }
+    int64_t ld() const { return info_.ld; }
+    blas::Layout layout() const { return info_.layout; }
+    lapack::MatrixType type() const { return info_.type; }
+    MatrixFileInfo const& info() const { return info_; }
+
+    /// @return the matrix for out-of-core routines such as potrf_ooc,
+    /// accessing the file with pread and pwrite. Requires column-major.
+    OOCMatrix< scalar_t > ooc() const;
+
+    /// Flushes changes of a writable file to storage.
+    void sync();
+
+private:
+    MatrixFile();
+    void map( bool writable );
+    void close();
+
+    MatrixFileInfo info_;
+    int fd_;
+    void* map_;
+    size_t map_size_;
+    scalar_t* data_;
+};
+
+//------------------------------------------------------------------------------
+/// Writes an m-by-n column-major matrix A to a matrix file.
+/// If layout is RowMajor, the file is written row-major (transposed).
+/// @ingroup ooc
+template <typename scalar_t>
+void write_matrix_file(
+    std::string const& filename, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    lapack::MatrixType type=lapack::MatrixType::General,
+    blas::Layout layout=blas::Layout::ColMajor,
+    int64_t alignment=4096 );
+
+}  // namespace lapack
+
+#endif // LAPACK_MATRIX_FILE_HH
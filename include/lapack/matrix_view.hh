@@ -0,0 +1,396 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_MATRIX_VIEW_HH
+#define LAPACK_MATRIX_VIEW_HH
+
+#include "lapack/util.hh"
+#include "lapack/layout.hh"
+
+#include <type_traits>
+#include <utility>
+
+// std::mdspan (C++23), or the reference implementation in
+// std::experimental (e.g., kokkos/mdspan), if available.
+#if defined( __has_include )
+    #if __has_include( <mdspan> )
+        #include <mdspan>
+    #endif
+    #if __has_include( <experimental/mdspan> ) \
+        && ! defined( LAPACK_NO_EXPERIMENTAL_MDSPAN )
+        #include <experimental/mdspan>
+        #define LAPACK_HAVE_EXPERIMENTAL_MDSPAN
+    #endif
+#endif
+#if defined( __cpp_lib_mdspan )
+    #define LAPACK_HAVE_MDSPAN
+#endif
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Non-owning view of an m-by-n matrix, stored in column-major or
+/// row-major order with leading dimension ld:
+/// element (i, j) is data[ i + j*ld ] (ColMajor) or data[ i*ld + j ]
+/// (RowMajor). Views are cheap to copy and are passed by value.
+///
+/// A view of a submatrix of a larger matrix, or of a user container,
+/// is passed to the overloads below with zero copies:
+///
+///     std::vector< double > buf( ld*N );
+///     lapack::MatrixView< double > A( buf.data(), M, N, ld );
+///     lapack::potrf( lapack::Uplo::Lower, A.sub( 0, n, 0, n ) );
+///
+/// scalar_t may be const, for read-only arguments.
+/// A std::mdspan (or std::experimental::mdspan) that has unit stride in
+/// one dimension is accepted anywhere a MatrixView is; see make_view.
+///
+/// @ingroup util
+template <typename scalar_t>
+class MatrixView {
+public:
+    using value_type = std::remove_const_t< scalar_t >;
+
+    /// Creates a view of the m-by-n matrix A with leading dimension ld,
+    /// stored in the given layout.
+    MatrixView( scalar_t* A, int64_t m, int64_t n, int64_t ld,
+                blas::Layout layout = blas::Layout::ColMajor )
+        : data_( A ), m_( m ), n_( n ), ld_( ld ), layout_( layout )
+    {
+        lapack_error_if( m < 0 );
+        lapack_error_if( n < 0 );
+        lapack_error_if( ld < blas::max( 1, layout == blas::Layout::ColMajor
+                                                ? m : n ) );
+    }
+
+    /// Creates a view of the contiguous m-by-n column-major matrix A.
+    MatrixView( scalar_t* A, int64_t m, int64_t n )
+        : MatrixView( A, m, n, blas::max( 1, m ) )
+    {}
+
+    /// Converts a view of T to a read-only view of T const.
+    template <typename T,
+              typename = std::enable_if_t<
+                  std::is_same< T const, scalar_t >::value > >
+    MatrixView( MatrixView< T > const& A )
+        : data_( A.data() ), m_( A.m() ), n_( A.n() ), ld_( A.ld() ),
+          layout_( A.layout() )
+    {}
+
+    scalar_t*    data()   const { return data_;   }
+    int64_t      m()      const { return m_;      }
+    int64_t      n()      const { return n_;      }
+    int64_t      ld()     const { return ld_;     }
+    blas::Layout layout() const { return layout_; }
+
+    /// @return reference to element (i, j), 0-based.
+    scalar_t& operator () ( int64_t i, int64_t j ) const
+    {
+        return layout_ == blas::Layout::ColMajor ? data_[ i + j*ld_ ]
+                                                 : data_[ i*ld_ + j ];
+    }
+
+    /// @return view of the mb-by-nb submatrix starting at (i, j),
+    /// that is, rows i : i+mb-1 and columns j : j+nb-1, 0-based.
+    MatrixView sub( int64_t i, int64_t mb, int64_t j, int64_t nb ) const
+    {
+        lapack_error_if( i < 0 || mb < 0 || i + mb > m_ );
+        lapack_error_if( j < 0 || nb < 0 || j + nb > n_ );
+        return MatrixView( (mb > 0 && nb > 0) ? &(*this)( i, j ) : data_,
+                           mb, nb, ld_, layout_ );
+    }
+
+private:
+    scalar_t* data_;
+    int64_t m_, n_, ld_;
+    blas::Layout layout_;
+};
+
+//------------------------------------------------------------------------------
+/// @return the view itself; see the mdspan overloads.
+/// @ingroup util
+template <typename scalar_t>
+MatrixView< scalar_t > make_view( MatrixView< scalar_t > A )
+{
+    return A;
+}
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Converts a rank-2 mdspan, with unit stride in one dimension, to a view.
+/// Static extents are read as constants, so for fixed-size mdspans the
+/// dimensions fold into the call after inlining.
+template <typename scalar_t, typename Mdspan>
+MatrixView< scalar_t > mdspan_to_view( Mdspan const& A )
+{
+    static_assert( Mdspan::rank() == 2, "mdspan must be rank 2" );
+    int64_t m  = A.extent( 0 );
+    int64_t n  = A.extent( 1 );
+    int64_t s0 = A.stride( 0 );
+    int64_t s1 = A.stride( 1 );
+    // With one row or column, the stride across it is arbitrary.
+    if (s0 == 1 && (n <= 1 || s1 >= blas::max( 1, m ))) {
+        return MatrixView< scalar_t >(
+            A.data_handle(), m, n, n <= 1 ? blas::max( 1, m ) : s1,
+            blas::Layout::ColMajor );
+    }
+    if (s1 == 1 && (m <= 1 || s0 >= blas::max( 1, n ))) {
+        return MatrixView< scalar_t >(
+            A.data_handle(), m, n, m <= 1 ? blas::max( 1, n ) : s0,
+            blas::Layout::RowMajor );
+    }
+    throw Error( "mdspan must have unit stride in one dimension" );
+}
+
+}  // namespace internal
+
+#if defined( LAPACK_HAVE_MDSPAN )
+//------------------------------------------------------------------------------
+/// @return view of a rank-2 std::mdspan, with layout_left (ColMajor),
+/// layout_right (RowMajor), or layout_stride with unit stride in one
+/// dimension. Throws Error otherwise.
+/// @ingroup util
+template <typename T, typename Extents, typename LayoutPolicy>
+MatrixView< T > make_view(
+    std::mdspan< T, Extents, LayoutPolicy > const& A )
+{
+    return internal::mdspan_to_view< T >( A );
+}
+#endif
+
+#if defined( LAPACK_HAVE_EXPERIMENTAL_MDSPAN )
+//------------------------------------------------------------------------------
+/// @return view of a rank-2 std::experimental::mdspan; see above.
+/// @ingroup util
+template <typename T, typename Extents, typename LayoutPolicy>
+MatrixView< T > make_view(
+    std::experimental::mdspan< T, Extents, LayoutPolicy > const& A )
+{
+    return internal::mdspan_to_view< T >( A );
+}
+#endif
+
+namespace internal {
+
+/// Type of view for a MatrixView or mdspan; SFINAE fails for other types.
+template <typename Matrix>
+using view_type = decltype( make_view( std::declval< Matrix const& >() ) );
+
+/// Scalar type, without const, of a MatrixView or mdspan.
+template <typename Matrix>
+using view_scalar = typename view_type< Matrix >::value_type;
+
+/// Checks that all views have the same layout.
+template <typename... Views>
+bool same_layout( blas::Layout layout, Views const&... views )
+{
+    bool same = true;
+    // C++17 fold expression
+    ((same = same && views.layout() == layout), ...);
+    return same;
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+// Overloads of the Layout wrappers in lapack/layout.hh that take a
+// MatrixView or mdspan and read the dimensions, leading dimension, and
+// layout from it. Vector arguments (ipiv, tau, S, W) remain pointers.
+// All matrix arguments of one call must have the same layout.
+
+// -----------------------------------------------------------------------------
+/// @see lapack::gelqf
+/// @ingroup gelqf
+template <typename MatrixA,
+          typename = internal::view_type< MatrixA > >
+int64_t gelqf( MatrixA const& A_, internal::view_scalar< MatrixA >* tau )
+{
+    auto A = make_view( A_ );
+    return gelqf( A.layout(), A.m(), A.n(), A.data(), A.ld(), tau );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::geqrf
+/// @ingroup geqrf
+template <typename MatrixA,
+          typename = internal::view_type< MatrixA > >
+int64_t geqrf( MatrixA const& A_, internal::view_scalar< MatrixA >* tau )
+{
+    auto A = make_view( A_ );
+    return geqrf( A.layout(), A.m(), A.n(), A.data(), A.ld(), tau );
+}
+
+// -----------------------------------------------------------------------------
+/// U is m-by-min(m,n) and VT is min(m,n)-by-n for jobz = SomeVec;
+/// m-by-m and n-by-n for jobz = AllVec. Their views are not referenced
+/// for jobz = NoVec or OverwriteVec, but must still have A's layout.
+/// @see lapack::gesdd
+/// @ingroup gesvd
+template <typename MatrixA, typename MatrixU, typename MatrixVT,
+          typename = internal::view_type< MatrixA > >
+int64_t gesdd(
+    lapack::Job jobz, MatrixA const& A_,
+    blas::real_type< internal::view_scalar< MatrixA > >* S,
+    MatrixU const& U_, MatrixVT const& VT_ )
+{
+    auto A  = make_view( A_ );
+    auto U  = make_view( U_ );
+    auto VT = make_view( VT_ );
+    lapack_error_if( ! internal::same_layout( A.layout(), U, VT ) );
+    return gesdd( A.layout(), jobz, A.m(), A.n(), A.data(), A.ld(), S,
+                  U.data(), U.ld(), VT.data(), VT.ld() );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves A X = B, with A n-by-n and B n-by-nrhs.
+/// @see lapack::gesv
+/// @ingroup gesv
+template <typename MatrixA, typename MatrixB,
+          typename = internal::view_type< MatrixA >,
+          typename = internal::view_type< MatrixB > >
+int64_t gesv( MatrixA const& A_, int64_t* ipiv, MatrixB const& B_ )
+{
+    auto A = make_view( A_ );
+    auto B = make_view( B_ );
+    lapack_error_if( A.m() != A.n() || B.m() != A.n() );
+    lapack_error_if( ! internal::same_layout( A.layout(), B ) );
+    return gesv( A.layout(), A.n(), B.n(), A.data(), A.ld(), ipiv,
+                 B.data(), B.ld() );
+}
+
+// -----------------------------------------------------------------------------
+/// Sizes of U and VT depend on jobu and jobvt, as in lapack::gesvd.
+/// Views that are not referenced must still have A's layout.
+/// @see lapack::gesvd
+/// @ingroup gesvd
+template <typename MatrixA, typename MatrixU, typename MatrixVT,
+          typename = internal::view_type< MatrixA > >
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, MatrixA const& A_,
+    blas::real_type< internal::view_scalar< MatrixA > >* S,
+    MatrixU const& U_, MatrixVT const& VT_ )
+{
+    auto A  = make_view( A_ );
+    auto U  = make_view( U_ );
+    auto VT = make_view( VT_ );
+    lapack_error_if( ! internal::same_layout( A.layout(), U, VT ) );
+    return gesvd( A.layout(), jobu, jobvt, A.m(), A.n(), A.data(), A.ld(), S,
+                  U.data(), U.ld(), VT.data(), VT.ld() );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::getrf
+/// @ingroup gesv_computational
+template <typename MatrixA,
+          typename = internal::view_type< MatrixA > >
+int64_t getrf( MatrixA const& A_, int64_t* ipiv )
+{
+    auto A = make_view( A_ );
+    return getrf( A.layout(), A.m(), A.n(), A.data(), A.ld(), ipiv );
+}
+
+// -----------------------------------------------------------------------------
+/// A is the n-by-n factor from getrf; B is n-by-nrhs.
+/// @see lapack::getrs
+/// @ingroup gesv_computational
+template <typename MatrixA, typename MatrixB,
+          typename = internal::view_type< MatrixA >,
+          typename = internal::view_type< MatrixB > >
+int64_t getrs(
+    lapack::Op trans, MatrixA const& A_, int64_t const* ipiv,
+    MatrixB const& B_ )
+{
+    auto A = make_view( A_ );
+    auto B = make_view( B_ );
+    lapack_error_if( A.m() != A.n() || B.m() != A.n() );
+    lapack_error_if( ! internal::same_layout( A.layout(), B ) );
+    return getrs( A.layout(), trans, A.n(), B.n(), A.data(), A.ld(), ipiv,
+                  B.data(), B.ld() );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heevd
+/// @ingroup heev
+template <typename MatrixA,
+          typename = internal::view_type< MatrixA > >
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, MatrixA const& A_,
+    blas::real_type< internal::view_scalar< MatrixA > >* W )
+{
+    auto A = make_view( A_ );
+    lapack_error_if( A.m() != A.n() );
+    return heevd( A.layout(), jobz, uplo, A.n(), A.data(), A.ld(), W );
+}
+
+// -----------------------------------------------------------------------------
+/// @return norm of A; the 1-norm and infinity-norm are swapped for
+/// row-major views, so no copy is needed.
+/// @see lapack::lange
+/// @ingroup norm
+template <typename MatrixA>
+blas::real_type< internal::view_scalar< MatrixA > > lange(
+    lapack::Norm norm, MatrixA const& A_ )
+{
+    auto A = make_view( A_ );
+    if (A.layout() == blas::Layout::ColMajor)
+        return lange( norm, A.m(), A.n(), A.data(), A.ld() );
+    if (norm == Norm::One)
+        norm = Norm::Inf;
+    else if (norm == Norm::Inf)
+        norm = Norm::One;
+    return lange( norm, A.n(), A.m(), A.data(), A.ld() );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves A X = B, with A n-by-n Hermitian positive definite
+/// and B n-by-nrhs.
+/// @see lapack::posv
+/// @ingroup posv
+template <typename MatrixA, typename MatrixB,
+          typename = internal::view_type< MatrixA >,
+          typename = internal::view_type< MatrixB > >
+int64_t posv( lapack::Uplo uplo, MatrixA const& A_, MatrixB const& B_ )
+{
+    auto A = make_view( A_ );
+    auto B = make_view( B_ );
+    lapack_error_if( A.m() != A.n() || B.m() != A.n() );
+    lapack_error_if( ! internal::same_layout( A.layout(), B ) );
+    return posv( A.layout(), uplo, A.n(), B.n(), A.data(), A.ld(),
+                 B.data(), B.ld() );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::potrf
+/// @ingroup posv_computational
+template <typename MatrixA,
+          typename = internal::view_type< MatrixA > >
+int64_t potrf( lapack::Uplo uplo, MatrixA const& A_ )
+{
+    auto A = make_view( A_ );
+    lapack_error_if( A.m() != A.n() );
+    return potrf( A.layout(), uplo, A.n(), A.data(), A.ld() );
+}
+
+// -----------------------------------------------------------------------------
+/// A is the n-by-n factor from potrf; B is n-by-nrhs.
+/// @see lapack::potrs
+/// @ingroup posv_computational
+template <typename MatrixA, typename MatrixB,
+          typename = internal::view_type< MatrixA >,
+          typename = internal::view_type< MatrixB > >
+int64_t potrs( lapack::Uplo uplo, MatrixA const& A_, MatrixB const& B_ )
+{
+    auto A = make_view( A_ );
+    auto B = make_view( B_ );
+    lapack_error_if( A.m() != A.n() || B.m() != A.n() );
+    lapack_error_if( ! internal::same_layout( A.layout(), B ) );
+    return potrs( A.layout(), uplo, A.n(), B.n(), A.data(), A.ld(),
+                  B.data(), B.ld() );
+}
+
+}  // namespace lapack
+
+#endif // LAPACK_MATRIX_VIEW_HH
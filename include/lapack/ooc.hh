@@ -0,0 +1,94 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_OOC_HH
+#define LAPACK_OOC_HH
+
+#include "lapack/util.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// I/O statistics of an out-of-core routine.
+/// @ingroup ooc
+struct OOCStats {
+    int64_t bytes_read    = 0;  ///< bytes read from storage
+    int64_t bytes_written = 0;  ///< bytes written to storage
+    double  time          = 0;  ///< total time, in seconds
+    double  io_time       = 0;  ///< time spent in reads and writes, in seconds
+    double  wait_time     = 0;  ///< time computation waited on I/O, in seconds
+
+    /// @return fraction of I/O time hidden behind computation, in [0, 1].
+    double overlap() const
+    {
+        return io_time > 0 ? std::max( 0.0, 1 - wait_time / io_time ) : 1.0;
+    }
+};
+
+//------------------------------------------------------------------------------
+/// Column-major m-by-n matrix stored out of core, either in a file, accessed
+/// with pread and pwrite, or in a memory region, e.g., mapped with mmap.
+/// Element (i, j) is at element offset i + j*ld from the start.
+/// The matrix does not own the file or memory.
+/// @ingroup ooc
+template <typename scalar_t>
+class OOCMatrix {
+public:
+    /// Matrix in the open file fd, starting at byte offset.
+    /// The file must be opened for reading, and writing if factored.
+    /// fd is from POSIX open, or from _open on Windows; on Windows, open
+    /// the file with _O_BINARY.
+    OOCMatrix( int fd, int64_t offset, int64_t m, int64_t n, int64_t ld );
+
+    /// Matrix in the memory region data, e.g., mapped with mmap.
+    OOCMatrix( scalar_t* data, int64_t m, int64_t n, int64_t ld );
+
+    int64_t m()  const { return m_;  }
+    int64_t n()  const { return n_;  }
+    int64_t ld() const { return ld_; }
+
+    /// Copies the mb-by-nb submatrix starting at (i, j) to B.
+    void read( int64_t i, int64_t j, int64_t mb, int64_t nb,
+               scalar_t* B, int64_t ldb ) const;
+
+    /// Copies B to the mb-by-nb submatrix starting at (i, j).
+    void write( int64_t i, int64_t j, int64_t mb, int64_t nb,
+                scalar_t const* B, int64_t ldb ) const;
+
+private:
+    int fd_;
+    int64_t offset_;
+    scalar_t* data_;
+    int64_t m_, n_, ld_;
+};
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t potrf_ooc(
+    lapack::Uplo uplo, int64_t n,
+    OOCMatrix< scalar_t > const& A,
+    size_t window, OOCStats* stats=nullptr );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t potrs_ooc(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    OOCMatrix< scalar_t > const& A,
+    scalar_t* B, int64_t ldb,
+    size_t window, OOCStats* stats=nullptr );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t getrf_ooc(
+    int64_t m, int64_t n,
+    OOCMatrix< scalar_t > const& A,
+    int64_t* ipiv,
+    size_t window, OOCStats* stats=nullptr );
+
+}  // namespace lapack
+
+#endif // LAPACK_OOC_HH
@@ -0,0 +1,116 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_QR_STREAM_HH
+#define LAPACK_QR_STREAM_HH
+
+#include "lapack/util.hh"
+
+#include <vector>
+
+// Requires tpqrt and tpmqrt from LAPACK >= 3.4.
+#if LAPACK_VERSION >= 30400
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Streaming QR factorization for least squares problems
+/// $\min_X || A X - B ||_F$ where rows of A and B arrive in blocks.
+///
+/// Holds the n-by-n upper triangular factor R of A = QR, and the
+/// n-by-nrhs matrix $Z = Q^H B$. Appending k rows costs $O(k n^2)$,
+/// instead of $O(m n^2)$ to refactor A with geqrf:
+///
+///     lapack::QRStream< double > qr( n, nrhs );
+///     while (...) {
+///         qr.update( k, Anew, lda, Bnew, ldb );  // tpqrt, tpmqrt
+///         qr.solve( X, ldx );                    // trtrs
+///     }
+///
+/// With a forgetting factor $\lambda < 1$, before each update, R, Z,
+/// and the residual norms are scaled by $\sqrt{\lambda}$, so a row appended
+/// t updates ago has weight $\lambda^t$ in the least squares problem.
+///
+/// Available if LAPACK++ is built with LAPACK >= 3.4.
+///
+/// For a sliding window, downdate removes rows appended earlier,
+/// using the LINPACK algorithm (xCHDD) of Saunders. Rows to remove must be
+/// scaled by $\sqrt{\lambda^t}$ if a forgetting factor is used.
+///
+/// @ingroup gels
+template <typename scalar_t>
+class QRStream {
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    /// Creates an empty factorization (no rows) of n columns with
+    /// nrhs right-hand sides.
+    ///
+    /// @param[in] n      Number of columns of A. n >= 0.
+    /// @param[in] nrhs   Number of columns of B. nrhs >= 0.
+    /// @param[in] forget Forgetting factor, 0 < forget <= 1.
+    /// @param[in] nb     Block size for tpqrt; if 0, a default is used.
+    explicit QRStream( int64_t n, int64_t nrhs=1, real_t forget=1,
+                       int64_t nb=0 );
+
+    /// Appends k rows A (k-by-n) and B (k-by-nrhs).
+    /// B is not referenced if nrhs = 0.
+    void update( int64_t k, scalar_t const* A, int64_t lda,
+                 scalar_t const* B, int64_t ldb );
+
+    /// Removes k rows A (k-by-n) and B (k-by-nrhs) appended earlier.
+    /// B is not referenced if nrhs = 0.
+    ///
+    /// @return = 0: successful exit.
+    /// @return > 0: if return value = i, removing row i would make R
+    ///     singular. No rows were removed: the factorization is
+    ///     unchanged.
+    int64_t downdate( int64_t k, scalar_t const* A, int64_t lda,
+                      scalar_t const* B, int64_t ldb );
+
+    /// Solves $R X = Z$ for the n-by-nrhs least squares solution X.
+    ///
+    /// @return = 0: successful exit.
+    /// @return > 0: if return value = i, R(i,i) is exactly zero;
+    ///     fewer than n independent rows have been appended.
+    int64_t solve( scalar_t* X, int64_t ldx ) const;
+
+    /// Removes all rows.
+    void reset();
+
+    int64_t n()    const { return n_;    }
+    int64_t nrhs() const { return nrhs_; }
+
+    /// @return number of rows appended, less rows removed.
+    int64_t m()    const { return m_;    }
+
+    real_t forget() const { return forget_; }
+    void   forget( real_t forget );
+
+    /// The n-by-n upper triangular factor R, with leading dimension n.
+    scalar_t const* R() const { return R_.data(); }
+
+    /// The n-by-nrhs matrix $Z = Q^H B$, with leading dimension n.
+    scalar_t const* Z() const { return Z_.data(); }
+
+    /// @return residual norm $|| A x_j - b_j ||_2$ of column j of B.
+    real_t residual_norm( int64_t j ) const { return rnorm_[ j ]; }
+
+private:
+    int64_t n_, nrhs_, nb_, m_;
+    real_t forget_;
+    std::vector< scalar_t > R_, Z_;
+    std::vector< real_t >   rnorm_;
+
+    // workspace
+    std::vector< scalar_t > V_, C_, T_;
+    std::vector< real_t >   cs_;
+};
+
+}  // namespace lapack
+
+#endif // LAPACK >= 3.4
+
+#endif // LAPACK_QR_STREAM_HH
@@ -0,0 +1,38 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_SKETCH_HH
+#define LAPACK_SKETCH_HH
+
+#include "lapack/util.hh"
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Statistics of a sketch-and-precondition solver, with the time of
+/// each phase.
+/// @ingroup gels
+struct SketchStats {
+    int64_t sketch_rows = 0;     ///< rows d of the sketch S A
+    int64_t iters       = 0;     ///< max iterations over right-hand sides
+    bool    converged   = true;  ///< all right-hand sides met the tolerance
+    double  time_sketch = 0;     ///< time to form S A and S B, in seconds
+    double  time_qr     = 0;     ///< time to factor S A = Q R, in seconds
+    double  time_solve  = 0;     ///< time of the iterative solve, in seconds
+    double  time        = 0;     ///< total time, in seconds
+};
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t gels_sketch(
+    int64_t m, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    blas::real_type< scalar_t > tol, int64_t maxiter,
+    SketchStats* stats=nullptr );
+
+}  // namespace lapack
+
+#endif // LAPACK_SKETCH_HH
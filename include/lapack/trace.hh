@@ -0,0 +1,136 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_TRACE_HH
+#define LAPACK_TRACE_HH
+
+#include "lapack/instrument.hh"
+
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Timeline of individual LAPACK++ calls, for viewing in Perfetto
+/// (https://ui.perfetto.dev) or chrome://tracing.
+///
+/// When enabled, each wrapper records an event with its thread, start and
+/// end times, dimensions, and the workspace it allocated. Tasks of
+/// lapack::async and of the host lapack::Queue are also recorded, with the
+/// time they waited to start, so the wrapper calls nest inside them.
+/// Overlapping events on more threads than cores show oversubscription,
+/// e.g., between the async thread pool and a multithreaded BLAS.
+///
+///     lapack::trace::enable();
+///     ...  // application calls LAPACK++
+///     lapack::trace::dump( "trace.json" );
+///
+/// Without recompiling, setting the environment variable
+///
+///     LAPACKPP_TRACE=trace.json
+///
+/// enables tracing at startup and dumps the trace to that file at exit.
+///
+/// Each thread records into its own fixed-size ring buffer, without locks;
+/// when it is full, the thread's oldest events are overwritten. A buffer is
+/// allocated on a thread's first event while tracing is enabled. When the
+/// thread exits, its buffer, with its events, is reused by the next thread
+/// to record events, so memory is bounded by the number of threads
+/// tracing at once, not by the number of threads created.
+namespace trace {
+
+//------------------------------------------------------------------------------
+/// One call.
+/// @ingroup util
+struct Event {
+    std::string name;       ///< e.g., "dgetrf", or "async", "queue" for tasks
+    std::string category;   ///< "lapack", "async", or "queue"
+    int64_t thread;         ///< thread number, from 1 in order of first event
+    int64_t m;              ///< m argument; 0 if none
+    int64_t n;              ///< n argument; 0 if none
+    int64_t k;              ///< k or nrhs argument; 0 if neither
+    int64_t work_bytes;     ///< workspace allocated during the call
+    double queued;          ///< time enqueued, for tasks; else start
+    double start;           ///< start time, in seconds since tracing began
+    double end;             ///< end time, in seconds since tracing began
+};
+
+/// Enables or disables tracing. Safe to call while other threads run
+/// LAPACK++; calls in progress may or may not be recorded.
+/// @ingroup util
+void enable( bool on = true );
+
+/// @return true if tracing is enabled.
+/// @ingroup util
+bool enabled();
+
+/// @return events of all threads, including threads that have exited,
+/// sorted by start time. Events of an exited thread are kept until its
+/// buffer is reused and wraps around.
+/// @ingroup util
+std::vector< Event > events();
+
+/// Discards all events, and frees the buffers of exited threads.
+/// Events recorded concurrently may be kept.
+/// @ingroup util
+void clear();
+
+/// Writes events() to filename in Chrome trace-event JSON format.
+/// Throws Error if the file cannot be written.
+/// @ingroup util
+void dump( std::string const& filename );
+
+/// Writes events() to an open file in Chrome trace-event JSON format.
+/// @ingroup util
+void dump( FILE* file );
+
+}  // namespace trace
+
+//------------------------------------------------------------------------------
+namespace internal {
+
+/// Records an event on this thread's buffer. routine and category must be
+/// static strings. Times are from instrument_time().
+void trace_event(
+    char const* routine, char precision, char const* category,
+    int64_t m, int64_t n, int64_t k, int64_t work_bytes,
+    double queued, double start, double end );
+
+/// @return instrument_time() if tracing is enabled, else 0.
+/// Use for the time a task is enqueued.
+double trace_time();
+
+//------------------------------------------------------------------------------
+/// If tracing is enabled, records an event of category for a task, from
+/// construction to destruction, with the time it waited since queued.
+class TraceScope {
+public:
+    /// queued is from trace_time() when the task was enqueued; 0 if unknown.
+    TraceScope( char const* category, double queued );
+    ~TraceScope();
+
+    TraceScope( TraceScope const& ) = delete;
+    TraceScope& operator = ( TraceScope const& ) = delete;
+
+private:
+    char const* category_;
+    double queued_;
+    double start_;
+    int64_t work_;
+    bool on_;
+};
+
+/// If tracing is enabled, returns task wrapped in a TraceScope of category,
+/// with the time from now until it starts; otherwise returns task.
+std::function<void ()> trace_task(
+    char const* category, std::function<void ()> task );
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_TRACE_HH
@@ -0,0 +1,111 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_TUNE_HH
+#define LAPACK_TUNE_HH
+
+#include "lapack/util.hh"
+
+#include <string>
+#include <vector>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Tuned block sizes of blocked factorizations, overriding the NB and NX
+/// that LAPACK gets from ILAENV, whose defaults were set for hardware of
+/// long ago. Tuned routines are
+///
+///     routine         size        nb                      nx
+///     getrf           min(m, n)   block size              --
+///     geqrf           min(m, n)   block size              crossover
+///     gebrd           min(m, n)   block size              crossover
+///     hetrd           n           block size              crossover
+///     hetrd_2stage    n           band width kd           --
+///
+/// where hetrd and hetrd_2stage include the real sytrd and sytrd_2stage.
+///
+/// The table is usually generated by test/tune.py, which times the tester
+/// over a sweep of block sizes, and loaded at startup from the file named
+/// by the environment variable
+///
+///     LAPACKPP_TUNE=tune.txt
+///
+/// The block sizes take effect only with the opt-in build option
+/// ilaenv_override=yes (see INSTALL.md). Then LAPACK++ interposes the
+/// Fortran ILAENV and ILAENV2STAGE functions, so the LAPACK routines,
+/// called through the usual wrappers, get the tuned nb and nx; the
+/// algorithms are LAPACK's own. Other queries are forwarded to the LAPACK
+/// library. This requires LAPACK++ and a reference-style LAPACK that
+/// calls ILAENV to be shared libraries, and is for Linux and other ELF
+/// platforms. Vendor libraries that don't call ILAENV ignore the table.
+/// Without ilaenv_override, the table can be edited, loaded, and saved,
+/// but LAPACK uses its defaults.
+///
+/// Sizes beyond the largest tuned range, and routines that are not tuned,
+/// use LAPACK's defaults.
+///
+/// Lookups are lock-free. Updates to the table (set, clear, load) are meant
+/// for setup: each publishes a new copy of the table and keeps the old one,
+/// as a concurrent lookup may still read it.
+namespace tune {
+
+//------------------------------------------------------------------------------
+/// Block sizes of one routine and precision, for sizes up to n_max.
+/// @ingroup util
+struct Entry {
+    std::string routine;    ///< e.g., "getrf"; see the table above
+    char precision;         ///< 's', 'd', 'c', 'z'
+    int64_t n_max;          ///< largest size; -1 for all larger sizes
+    int64_t nb;             ///< block size, or kd for hetrd_2stage
+    int64_t nx;             ///< crossover size; -1 for LAPACK's default
+};
+
+/// Sets the block sizes of routine in precision for sizes up to n_max
+/// that no entry with a smaller n_max covers; n_max = -1 for all sizes
+/// above the other entries. Replaces an entry with the same routine,
+/// precision, and n_max.
+/// Throws Error if routine is not tunable, or nb < 1.
+/// @ingroup util
+void set( std::string const& routine, char precision,
+          int64_t n_max, int64_t nb, int64_t nx = -1 );
+
+/// @return all entries, sorted by routine, precision, then n_max.
+/// @ingroup util
+std::vector< Entry > entries();
+
+/// Removes all entries, so LAPACK's defaults are used.
+/// @ingroup util
+void clear();
+
+/// Replaces the entries with those in a tuning file, as written by save.
+/// Each line has routine, precision, n_max, nb, and optionally nx;
+/// # starts a comment. Throws Error if the file cannot be read or has
+/// an invalid line, leaving the entries unchanged.
+/// @ingroup util
+void load( std::string const& filename );
+
+/// Writes the entries to a tuning file. Throws Error if it cannot be
+/// written.
+/// @ingroup util
+void save( std::string const& filename );
+
+}  // namespace tune
+
+//------------------------------------------------------------------------------
+namespace internal {
+
+/// Looks up the tuned block sizes of routine in precision for size n.
+/// If tuned, sets nb and nx (-1 for default) and returns true;
+/// otherwise returns false. Lock-free: reads an immutable snapshot of
+/// the table, so it is safe in ILAENV, which LAPACK calls often.
+bool tuned_block_size(
+    char const* routine, char precision, int64_t n,
+    int64_t* nb, int64_t* nx );
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_TUNE_HH
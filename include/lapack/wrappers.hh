@@ -100,6 +100,15 @@ int64_t bdsdc(
     double* Q,
     int64_t* IQ );
 
+// -----------------------------------------------------------------------------
+template <typename real_t>
+int64_t bdsdc_mt(
+    lapack::Uplo uplo, lapack::Job compq, int64_t n,
+    real_t* D,
+    real_t* E,
+    real_t* U, int64_t ldu,
+    real_t* VT, int64_t ldvt );
+
 // -----------------------------------------------------------------------------
 int64_t bdsqr(
     lapack::Uplo uplo, int64_t n, int64_t ncvt, int64_t nru, int64_t ncc,
@@ -424,6 +433,14 @@ int64_t gbsv(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t gbsv_spike(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    scalar_t const* AB, int64_t ldab,
+    scalar_t* B, int64_t ldb,
+    int64_t nparts = 0 );
+
 // -----------------------------------------------------------------------------
 int64_t gbsvx(
     lapack::Factored fact, lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
@@ -1187,6 +1204,14 @@ int64_t geqp3(
     int64_t* jpvt,
     std::complex<double>* tau );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t geqp3_rand(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* jpvt,
+    scalar_t* tau );
+
 // -----------------------------------------------------------------------------
 int64_t geqr(
     int64_t m, int64_t n,
@@ -1638,6 +1663,15 @@ int64_t gesvd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t gesvd_qdwh(
+    lapack::Job jobz, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt );
+
 // -----------------------------------------------------------------------------
 int64_t gesvdx(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
@@ -2442,6 +2476,16 @@ int64_t gtsv(
     std::complex<double>* DU,
     std::complex<double>* B, int64_t ldb );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t gtsv_spike(
+    int64_t n, int64_t nrhs,
+    scalar_t const* DL,
+    scalar_t const* D,
+    scalar_t const* DU,
+    scalar_t* B, int64_t ldb,
+    int64_t nparts = 0 );
+
 // -----------------------------------------------------------------------------
 int64_t gtsvx(
     lapack::Factored fact, lapack::Op trans, int64_t n, int64_t nrhs,
@@ -2812,6 +2856,13 @@ int64_t heev_2stage(
     std::complex<double>* A, int64_t lda,
     double* W );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t heev_qdwh(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W );
+
 // -----------------------------------------------------------------------------
 int64_t heevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -3585,6 +3636,14 @@ int64_t hseqr(
     std::complex<double>* W,
     std::complex<double>* Z, int64_t ldz );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t interp_decomp(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    int64_t* jpvt,
+    scalar_t* T, int64_t ldt );
+
 // -----------------------------------------------------------------------------
 // real types have no-op dummy inline functions, to facilitate templating
 inline void lacgv(
@@ -3665,6 +3724,23 @@ int64_t laed4(
     double rho,
     double* lambda );
 
+// -----------------------------------------------------------------------------
+int64_t laed4_all(
+    int64_t n,
+    float const* d,
+    float const* z,
+    float* Delta, int64_t lddelta,
+    float rho,
+    float* lambda );
+
+int64_t laed4_all(
+    int64_t n,
+    double const* d,
+    double const* z,
+    double* Delta, int64_t lddelta,
+    double rho,
+    double* lambda );
+
 // -----------------------------------------------------------------------------
 void laev2(
     float a, float b, float c,
@@ -5425,6 +5501,13 @@ int64_t poequb(
     double* scond,
     double* amax );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t polar(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* H, int64_t ldh );
+
 // -----------------------------------------------------------------------------
 int64_t porfs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -5633,6 +5716,34 @@ int64_t potrf(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* V, int64_t ldv );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t potrf_downdate_mt(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* V, int64_t ldv );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* V, int64_t ldv );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void potrf_update_mt(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* V, int64_t ldv );
+
 // -----------------------------------------------------------------------------
 int64_t potrf2(
     lapack::Uplo uplo, int64_t n,
@@ -5862,6 +5973,20 @@ int64_t pptrf(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* AP );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t pptrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* AP,
+    scalar_t const* V, int64_t ldv );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void pptrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* AP,
+    scalar_t const* V, int64_t ldv );
+
 // -----------------------------------------------------------------------------
 int64_t pptri(
     lapack::Uplo uplo, int64_t n,
@@ -6192,6 +6317,66 @@ int64_t pttrs(
     std::complex<double> const* E,
     std::complex<double>* B, int64_t ldb );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr );
+
+template <typename scalar_t>
+void qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    scalar_t* R, int64_t ldr,
+    int64_t ncol, scalar_t* C, int64_t ldc );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    scalar_t const* x );
+
+template <typename scalar_t>
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    scalar_t* R, int64_t ldr,
+    scalar_t* w,
+    int64_t ncol, scalar_t* C, int64_t ldc );
+
+template <typename scalar_t>
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j, int64_t nb,
+    scalar_t const* V, int64_t ldv,
+    scalar_t const* T, int64_t ldt,
+    scalar_t* R, int64_t ldr,
+    scalar_t const* x,
+    int64_t ncol, scalar_t* C, int64_t ldc );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t rsvd(
+    int64_t m, int64_t n, int64_t k, int64_t p, int64_t q,
+    scalar_t const* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt,
+    int64_t* iseed );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t rsvd_adaptive(
+    int64_t m, int64_t n, blas::real_type< scalar_t > tol,
+    int64_t kmax, int64_t nb, int64_t q,
+    scalar_t const* A, int64_t lda,
+    int64_t* k,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt,
+    blas::real_type< scalar_t >* error,
+    int64_t* iseed );
+
 // -----------------------------------------------------------------------------
 int64_t sbev(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
@@ -7292,6 +7477,14 @@ int64_t stedc(
     double* E,
     std::complex<double>* Z, int64_t ldz );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t stedc_mt(
+    lapack::Job compz, int64_t n,
+    blas::real_type< scalar_t >* D,
+    blas::real_type< scalar_t >* E,
+    scalar_t* Z, int64_t ldz );
+
 // -----------------------------------------------------------------------------
 int64_t stegr(
     lapack::Job jobz, lapack::Range range, int64_t n,
@@ -7370,6 +7563,18 @@ int64_t stein(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t stein_mt(
+    int64_t n,
+    blas::real_type< scalar_t > const* D,
+    blas::real_type< scalar_t > const* E, int64_t m,
+    blas::real_type< scalar_t > const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    scalar_t* Z, int64_t ldz,
+    int64_t* ifail );
+
 // -----------------------------------------------------------------------------
 int64_t stemr(
     lapack::Job jobz, lapack::Range range, int64_t n,
@@ -7411,6 +7616,19 @@ int64_t stemr(
     int64_t* isuppz,
     bool* tryrac );
 
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t stemr_mt(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    blas::real_type< scalar_t > const* D,
+    blas::real_type< scalar_t > const* E,
+    blas::real_type< scalar_t > vl, blas::real_type< scalar_t > vu,
+    int64_t il, int64_t iu,
+    int64_t* nfound,
+    blas::real_type< scalar_t >* W,
+    scalar_t* Z, int64_t ldz,
+    int64_t* isuppz );
+
 // -----------------------------------------------------------------------------
 int64_t steqr(
     lapack::Job compz, int64_t n,
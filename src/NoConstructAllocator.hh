@@ -6,6 +6,8 @@
 #ifndef LAPACK_NO_CONSTRUCT_ALLOCATOR_HH
 #define LAPACK_NO_CONSTRUCT_ALLOCATOR_HH
 
+#include "lapack/instrument.hh"
+
 #include <cstddef>  // std::size_t
 #include <limits>   // std::numeric_limits
 #include <new>      // std::bad_alloc, std::bad_array_new_length
@@ -42,6 +44,11 @@ struct NoConstructAllocator
         if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
             throw std::bad_array_new_length();
 
+        // Workspace of the call being traced.
+        if (internal::instrument_flags.load( std::memory_order_relaxed )
+            & internal::InstrumentTrace)
+            internal::instrument_work_bytes += n*sizeof(T);
+
         void* memPtr = nullptr;
         #if defined( _WIN32 ) || defined( _WIN64 )
             memPtr = _aligned_malloc( n*sizeof(T), 64 );
@@ -0,0 +1,265 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/async.hh"
+#include "lapack/trace.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <string>
+
+namespace lapack {
+namespace async {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Shared result of an asynchronous call. When the call finishes, it runs
+// the continuations registered by dependent calls. They run on the thread
+// that finished the call, outside the lock.
+class State {
+public:
+    // Sets the result, wakes waiters, and runs continuations.
+    void finish( int64_t info, std::exception_ptr error )
+    {
+        std::vector< std::function<void ()> > continuations;
+        {
+            std::lock_guard< std::mutex > lock( mutex_ );
+            info_  = info;
+            error_ = error;
+            done_  = true;
+            continuations.swap( continuations_ );
+        }
+        cv_.notify_all();
+        for (auto& f : continuations)
+            f();
+    }
+
+    // Runs f when the call finishes; immediately if it already has.
+    void then( std::function<void ()> f )
+    {
+        {
+            std::lock_guard< std::mutex > lock( mutex_ );
+            if (! done_) {
+                continuations_.push_back( std::move( f ) );
+                return;
+            }
+        }
+        f();
+    }
+
+    bool ready()
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        return done_;
+    }
+
+    void wait()
+    {
+        std::unique_lock< std::mutex > lock( mutex_ );
+        cv_.wait( lock, [this] { return done_; } );
+    }
+
+    // After wait(): rethrows the error, or returns info.
+    int64_t get()
+    {
+        wait();
+        if (error_)
+            std::rethrow_exception( error_ );
+        return info_;
+    }
+
+    // After finish(): exception describing why a dependent call
+    // cannot run, or null if this call succeeded.
+    std::exception_ptr failure()
+    {
+        if (error_)
+            return error_;
+        if (info_ != 0) {
+            return std::make_exception_ptr( Error(
+                "dependency returned info = " + std::to_string( info_ ) ) );
+        }
+        return nullptr;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool done_ = false;
+    int64_t info_ = 0;
+    std::exception_ptr error_;
+    std::vector< std::function<void ()> > continuations_;
+};
+
+}  // namespace internal
+
+//==============================================================================
+// ThreadPool
+
+//------------------------------------------------------------------------------
+ThreadPool::ThreadPool( int num_threads )
+    : stop_( false )
+{
+    if (num_threads <= 0)
+        num_threads = std::max( 1u, std::thread::hardware_concurrency() );
+    threads_.reserve( num_threads );
+    for (int i = 0; i < num_threads; ++i)
+        threads_.emplace_back( &ThreadPool::run, this );
+}
+
+//------------------------------------------------------------------------------
+// Drains the queue, so no task outlives the pool.
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& thread : threads_)
+        thread.join();
+}
+
+//------------------------------------------------------------------------------
+void ThreadPool::run()
+{
+    while (true) {
+        std::function<void ()> task;
+        {
+            std::unique_lock< std::mutex > lock( mutex_ );
+            cv_.wait( lock, [this] { return stop_ || ! queue_.empty(); } );
+            if (queue_.empty())
+                return;  // stop_ and drained
+            task = std::move( queue_.front() );
+            queue_.pop_front();
+        }
+        task();
+    }
+}
+
+//------------------------------------------------------------------------------
+void ThreadPool::execute( std::function<void ()> task )
+{
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        queue_.push_back( std::move( task ) );
+    }
+    cv_.notify_one();
+}
+
+//------------------------------------------------------------------------------
+Executor& default_executor()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+//==============================================================================
+// Future
+
+//------------------------------------------------------------------------------
+bool Future::ready() const
+{
+    lapack_error_if( ! valid() );
+    return state_->ready();
+}
+
+//------------------------------------------------------------------------------
+void Future::wait() const
+{
+    lapack_error_if( ! valid() );
+    state_->wait();
+}
+
+//------------------------------------------------------------------------------
+int64_t Future::get() const
+{
+    lapack_error_if( ! valid() );
+    return state_->get();
+}
+
+//------------------------------------------------------------------------------
+Future submit(
+    std::function< int64_t () > task,
+    std::vector< Future > const& deps,
+    Executor* exec )
+{
+    for (auto const& dep : deps)
+        lapack_error_if( ! dep.valid() );
+    if (exec == nullptr)
+        exec = &default_executor();
+
+    auto state = std::make_shared< internal::State >();
+
+    // Dependencies are held until the task is enqueued, to check them.
+    std::vector< std::shared_ptr< internal::State > > dep_states;
+    dep_states.reserve( deps.size() );
+    for (auto const& dep : deps)
+        dep_states.push_back( dep.state_ );
+
+    auto launch = [state, task, exec, dep_states]() {
+        for (auto const& dep : dep_states) {
+            std::exception_ptr failure = dep->failure();
+            if (failure) {
+                state->finish( 0, failure );
+                return;
+            }
+        }
+        double queued = lapack::internal::trace_time();
+        exec->execute( [state, task, queued]() {
+            int64_t info = 0;
+            std::exception_ptr error;
+            {
+                // Traced before finish, so waiters see the event.
+                lapack::internal::TraceScope scope( "async", queued );
+                try {
+                    info = task();
+                }
+                catch (...) {
+                    error = std::current_exception();
+                }
+            }
+            state->finish( info, error );
+        } );
+    };
+
+    // One count per dependency, plus one released below, so the task is
+    // launched exactly once, after the last dependency finishes.
+    auto pending = std::make_shared< std::atomic< int64_t > >(
+        int64_t( deps.size() ) + 1 );
+    auto arrive = [pending, launch]() {
+        if (--(*pending) == 0)
+            launch();
+    };
+    for (auto const& dep : dep_states)
+        dep->then( arrive );
+    arrive();
+
+    return Future( state );
+}
+
+//------------------------------------------------------------------------------
+int64_t wait_all( std::vector< Future > const& futures )
+{
+    int64_t info = 0;
+    std::exception_ptr error;
+    for (auto const& future : futures) {
+        try {
+            int64_t future_info = future.get();
+            if (info == 0)
+                info = future_info;
+        }
+        catch (...) {
+            if (! error)
+                error = std::current_exception();
+        }
+    }
+    if (error)
+        std::rethrow_exception( error );
+    return info;
+}
+
+}  // namespace async
+}  // namespace lapack
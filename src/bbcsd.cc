@@ -37,6 +37,8 @@ int64_t bbcsd(
     float* B22D,
     float* B22E )
 {
+    lapack_instrument( "bbcsd", 's', m, 0, 0, internal::gflop_data_dependent );
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -123,6 +125,8 @@ int64_t bbcsd(
     double* B22D,
     double* B22E )
 {
+    lapack_instrument( "bbcsd", 'd', m, 0, 0, internal::gflop_data_dependent );
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -209,6 +213,8 @@ int64_t bbcsd(
     float* B22D,
     float* B22E )
 {
+    lapack_instrument( "bbcsd", 'c', m, 0, 0, internal::gflop_data_dependent );
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -480,6 +486,8 @@ int64_t bbcsd(
     double* B22D,
     double* B22E )
 {
+    lapack_instrument( "bbcsd", 'z', m, 0, 0, internal::gflop_data_dependent );
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -27,6 +27,8 @@ int64_t bdsdc(
     float* Q,
     int64_t* IQ )
 {
+    lapack_instrument( "bdsdc", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char compq_ = to_char_comp( compq );
     lapack_int n_ = to_lapack_int( n );
@@ -42,8 +44,8 @@ int64_t bdsdc(
     int64_t lwork = 0;
     switch (compq) {
         case Job::NoVec:      lwork = 4*n; break;
-        case Job::Vec:        lwork = 6*n; break;
-        case Job::CompactVec: lwork = 3*n*n + 4*n; break;
+        case Job::Vec:        lwork = 3*n*n + 4*n; break;
+        case Job::CompactVec: lwork = 6*n; break;
         default:
             assert( false );
             break;
@@ -187,6 +189,8 @@ int64_t bdsdc(
     double* Q,
     int64_t* IQ )
 {
+    lapack_instrument( "bdsdc", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char compq_ = to_char_comp( compq );
     lapack_int n_ = to_lapack_int( n );
@@ -202,8 +206,8 @@ int64_t bdsdc(
     int64_t lwork = 0;
     switch (compq) {
         case Job::NoVec:      lwork = 4*n; break;
-        case Job::Vec:        lwork = 6*n; break;
-        case Job::CompactVec: lwork = 3*n*n + 4*n; break;
+        case Job::Vec:        lwork = 3*n*n + 4*n; break;
+        case Job::CompactVec: lwork = 6*n; break;
         default:
             assert( false );
             break;
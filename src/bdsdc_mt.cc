@@ -0,0 +1,642 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+// Subproblems of at most this size are solved directly by bdsqr.
+static const int64_t bdsdc_mt_leaf_size = 32;
+
+//------------------------------------------------------------------------------
+// Overloads to select the LAPACK lasd4 precision.
+static void lasd4_fortran(
+    lapack_int const* n, lapack_int const* i, float const* d, float const* z,
+    float* delta, float const* rho, float* sigma, float* work, lapack_int* info )
+{
+    LAPACK_slasd4( n, i, d, z, delta, rho, sigma, work, info );
+}
+
+static void lasd4_fortran(
+    lapack_int const* n, lapack_int const* i, double const* d, double const* z,
+    double* delta, double const* rho, double* sigma, double* work, lapack_int* info )
+{
+    LAPACK_dlasd4( n, i, d, z, delta, rho, sigma, work, info );
+}
+
+//------------------------------------------------------------------------------
+// Node of the divide-and-conquer tree, covering the n-by-(n + sqre) upper
+// bidiagonal matrix in rows [ offset, offset + n ) and columns
+// [ offset, offset + n + sqre ). Internal nodes are split into the
+// nl-by-(nl + 1) upper left subproblem, row offset + nl, and the
+// nr-by-(nr + sqre) lower right subproblem, nr = n - nl - 1.
+// Leaves have nl = 0. height is 0 for leaves.
+struct BdsdcNode {
+    int64_t offset, n, sqre, nl, height;
+};
+
+//------------------------------------------------------------------------------
+// Recursively splits the subproblem into leaves of size at most
+// leaf_size, appending internal nodes to merges. Returns the node height.
+static int64_t bdsdc_mt_split(
+    int64_t offset, int64_t n, int64_t sqre,
+    std::vector< BdsdcNode >& leaves,
+    std::vector< BdsdcNode >& merges )
+{
+    if (n <= bdsdc_mt_leaf_size) {
+        leaves.push_back( { offset, n, sqre, 0, 0 } );
+        return 0;
+    }
+    int64_t nl = (n - 1) / 2;
+    int64_t nr = n - nl - 1;
+    int64_t h1 = bdsdc_mt_split( offset,          nl, 1,    leaves, merges );
+    int64_t h2 = bdsdc_mt_split( offset + nl + 1, nr, sqre, leaves, merges );
+    int64_t height = max( h1, h2 ) + 1;
+    merges.push_back( { offset, n, sqre, nl, height } );
+    return height;
+}
+
+//------------------------------------------------------------------------------
+// Computes the SVD of an n-by-(n + sqre) upper bidiagonal leaf,
+// B = U [ S 0 ] V^T, with singular values in ascending order.
+// If sqre = 1, column n of V is the null vector of B.
+// A non-square leaf is first rotated from the right to lower bidiagonal,
+// as in LAPACK's lasdq, then bdsqr is applied.
+template <typename real_t>
+static int64_t bdsdc_mt_leaf(
+    int64_t n, int64_t sqre,
+    real_t* D, real_t* E,
+    real_t* U, int64_t ldu,
+    real_t* V, int64_t ldv )
+{
+    const real_t zero = 0;
+    const real_t one  = 1;
+    int64_t m = n + sqre;
+
+    std::vector< real_t > VT( m*m );
+    lapack::laset( MatrixType::General, m, m, zero, one, &VT[ 0 ], m );
+    lapack::laset( MatrixType::General, n, n, zero, one, U, ldu );
+
+    Uplo uplo = Uplo::Upper;
+    if (sqre == 1) {
+        // B G = [ L 0 ] with L lower bidiagonal; accumulate G^T in VT.
+        for (int64_t i = 0; i < n; ++i) {
+            real_t c, s, r;
+            lapack::lartg( D[ i ], E[ i ], &c, &s, &r );
+            D[ i ] = r;
+            if (i < n - 1) {
+                E[ i ] = s*D[ i+1 ];
+                D[ i+1 ] = c*D[ i+1 ];
+            }
+            blas::rot( m, &VT[ i ], m, &VT[ i+1 ], m, c, s );
+        }
+        uplo = Uplo::Lower;
+    }
+
+    real_t dummy = 0;
+    int64_t info = lapack::bdsqr( uplo, n, m, n, 0, D, E,
+                                  &VT[ 0 ], m, U, ldu, &dummy, 1 );
+    if (info != 0)
+        return info;
+
+    // bdsqr sorts in descending order; reverse, and set V = VT^T.
+    std::reverse( D, D + n );
+    for (int64_t j = 0; j < n/2; ++j)
+        blas::swap( n, &U[ j*ldu ], 1, &U[ (n - 1 - j)*ldu ], 1 );
+    for (int64_t j = 0; j < n; ++j)
+        blas::copy( m, &VT[ n - 1 - j ], m, &V[ j*ldv ], 1 );
+    if (sqre == 1)
+        blas::copy( m, &VT[ n ], m, &V[ n*ldv ], 1 );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Merges the SVDs of the two subproblems of an n-by-(n + sqre) upper
+// bidiagonal matrix, split at row nl with alpha = D( nl ) and
+// beta = E( nl ) coupling the subproblems.
+// On entry, D( 0:nl-1 ) and D( nl+1:n-1 ) are the singular values of each
+// subproblem, in ascending order, and U and V are block diagonal with
+// their singular vectors.
+// On exit, D, U, and V are the SVD of the whole subproblem, with singular
+// values in ascending order; if sqre = 1, column n of V is the null vector.
+// Same algorithm as LAPACK's lasd1: deflation (lasd2), then the secular
+// equation and Gu-Eisenstat singular vectors (lasd3).
+// If parallel, OpenMP threads are used inside the merge; otherwise the
+// caller is expected to run several merges concurrently.
+// Returns 0, or > 0 if lasd4 failed.
+template <typename real_t>
+static int64_t bdsdc_mt_merge(
+    int64_t nl, int64_t nr, int64_t sqre,
+    real_t* D, real_t beta,
+    real_t* U, int64_t ldu,
+    real_t* V, int64_t ldv, bool parallel )
+{
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    const real_t one = 1;
+    int64_t n = nl + nr + 1;
+    int64_t m = n + sqre;
+    int64_t nlp1 = nl + 1;
+
+    // Scale.
+    real_t orgnrm = max( std::abs( D[ nl ] ), std::abs( beta ) );
+    for (int64_t i = 0; i < n; ++i)
+        orgnrm = max( orgnrm, std::abs( D[ i ] ) );
+    lapack::lascl( MatrixType::General, 0, 0, orgnrm, one, n, 1, D, n );
+    real_t alpha = D[ nl ];
+    beta /= orgnrm;
+
+    // The merged matrix, in the bases of the subproblems' singular vectors,
+    // has the row z, coming from row nl, above diag( 0, D1, D2 ).
+    // Position 0 is the zero singular value, i.e., the left null vector,
+    // combined with the right one if sqre = 1. Positions 1, ..., n-1 are the
+    // singular values of the subproblems, with the columns of U and V
+    // holding their vectors, and the structure of the columns
+    // (0: upper left, 1: dense, 2: lower right).
+    std::vector< real_t > dv( n ), zv( n );
+    std::vector< int64_t > col( n );
+    std::vector< int > typ( n );
+    for (int64_t i = 0; i < nl; ++i) {
+        dv [ 1 + i ] = D[ i ];
+        zv [ 1 + i ] = alpha * V[ nl + i*ldv ];
+        col[ 1 + i ] = i;
+        typ[ 1 + i ] = 0;
+    }
+    for (int64_t j = 0; j < nr; ++j) {
+        dv [ nlp1 + j ] = D[ nlp1 + j ];
+        zv [ nlp1 + j ] = beta * V[ nlp1 + (nlp1 + j)*ldv ];
+        col[ nlp1 + j ] = nlp1 + j;
+        typ[ nlp1 + j ] = 2;
+    }
+    real_t z1 = alpha * V[ nl + nl*ldv ];
+    real_t zm = (sqre == 1 ? beta * V[ nlp1 + (m - 1)*ldv ] : 0);
+
+    // Merge the two ascending lists of singular values.
+    std::vector< int64_t > indx( n - 1 );
+    for (int64_t i = 1, j = nlp1, c = 0; c < n - 1; ++c) {
+        if (j >= n || (i < nlp1 && dv[ i ] <= dv[ j ]))
+            indx[ c ] = i++;
+        else
+            indx[ c ] = j++;
+    }
+
+    real_t dmax = (n > 1 ? dv[ indx[ n - 2 ] ] : 0);
+    real_t tol = 8 * eps * max( dmax, max( std::abs( alpha ), std::abs( beta ) ) );
+
+    // Deflate singular values with small z components, and pairs of close
+    // singular values by rotating both U and V to zero one z component.
+    std::vector< int64_t > nondefl, defl;
+    nondefl.reserve( n );
+    defl.reserve( n );
+    int64_t jprev = -1;
+    for (int64_t jj = 0; jj < n - 1; ++jj) {
+        int64_t j = indx[ jj ];
+        if (std::abs( zv[ j ] ) <= tol) {
+            defl.push_back( j );
+        }
+        else if (jprev < 0) {
+            jprev = j;
+        }
+        else if (std::abs( dv[ j ] - dv[ jprev ] ) <= tol) {
+            real_t s = zv[ jprev ];
+            real_t c = zv[ j ];
+            real_t tau = std::hypot( c, s );
+            c /= tau;
+            s = -s / tau;
+            zv[ j ] = tau;
+            zv[ jprev ] = 0;
+            blas::rot( n, &U[ col[ jprev ]*ldu ], 1, &U[ col[ j ]*ldu ], 1, c, s );
+            blas::rot( m, &V[ col[ jprev ]*ldv ], 1, &V[ col[ j ]*ldv ], 1, c, s );
+            if (typ[ j ] != typ[ jprev ])
+                typ[ j ] = 1;
+            defl.push_back( jprev );
+            jprev = j;
+        }
+        else {
+            nondefl.push_back( jprev );
+            jprev = j;
+        }
+    }
+    if (jprev >= 0)
+        nondefl.push_back( jprev );
+
+    // Position 0. If sqre = 1, rotate the two right null vectors so that
+    // one has z component z0 and the other is the new null vector,
+    // in column m-1 of V.
+    real_t z0;
+    if (sqre == 1) {
+        z0 = std::hypot( z1, zm );
+        real_t c = one, s = 0;
+        if (z0 <= tol) {
+            z0 = tol;
+        }
+        else {
+            c = z1 / z0;
+            s = zm / z0;
+        }
+        blas::rot( m, &V[ nl*ldv ], 1, &V[ (m - 1)*ldv ], 1, c, s );
+    }
+    else {
+        z0 = (std::abs( z1 ) <= tol ? tol : z1);
+    }
+
+    int64_t k = 1 + nondefl.size();
+    std::vector< real_t > dsig( k ), zs( k );
+    dsig[ 0 ] = 0;
+    zs[ 0 ] = z0;
+    for (int64_t i = 1; i < k; ++i) {
+        dsig[ i ] = dv[ nondefl[ i-1 ] ];
+        zs[ i ] = zv[ nondefl[ i-1 ] ];
+    }
+    if (k > 1 && std::abs( dsig[ 1 ] ) <= tol/2)
+        dsig[ 1 ] = tol/2;
+
+    // Solve the secular equation, then form singular vectors of the
+    // merged matrix in Qu and Qv.
+    std::vector< real_t > sigma( k );
+    std::vector< real_t > Qu( k*k ), Qv( k*k );
+    if (k == 1) {
+        sigma[ 0 ] = std::abs( zs[ 0 ] );
+        Qu[ 0 ] = std::copysign( one, zs[ 0 ] );
+        Qv[ 0 ] = one;
+    }
+    else {
+        real_t rho = blas::nrm2( k, &zs[ 0 ], 1 );
+        std::vector< real_t > zn( zs );
+        blas::scal( k, 1 / rho, &zn[ 0 ], 1 );
+        rho = rho*rho;
+
+        // Dm( i, j ) = dsig( i ) - sigma( j ), Dp( i, j ) = dsig( i ) + sigma( j ).
+        std::vector< real_t > Dm( k*k ), Dp( k*k );
+        lapack_int k_ = to_lapack_int( k );
+        int64_t first_fail = k;
+        #pragma omp parallel for schedule( dynamic, 16 ) if (parallel) \
+                reduction( min: first_fail )
+        for (int64_t j = 0; j < k; ++j) {
+            lapack_int j_ = lapack_int( j + 1 );
+            lapack_int info_ = 0;
+            lasd4_fortran( &k_, &j_, &dsig[ 0 ], &zn[ 0 ], &Dm[ j*k ], &rho,
+                           &sigma[ j ], &Dp[ j*k ], &info_ );
+            if (info_ != 0)
+                first_fail = min( first_fail, j );
+        }
+        if (first_fail < k)
+            return first_fail + 1;
+
+        // Recompute z using the Gu-Eisenstat formula, pairing each factor
+        // with its interlacing neighbor, so the vectors are orthogonal.
+        std::vector< real_t > zh( k );
+        #pragma omp parallel for schedule( static ) if (parallel)
+        for (int64_t i = 0; i < k; ++i) {
+            real_t zi = Dm[ i + (k-1)*k ] * Dp[ i + (k-1)*k ];
+            for (int64_t j = 0; j < i; ++j) {
+                zi *= Dm[ i + j*k ] * Dp[ i + j*k ]
+                      / (dsig[ i ] - dsig[ j ]) / (dsig[ i ] + dsig[ j ]);
+            }
+            for (int64_t j = i; j < k - 1; ++j) {
+                zi *= Dm[ i + j*k ] * Dp[ i + j*k ]
+                      / (dsig[ i ] - dsig[ j+1 ]) / (dsig[ i ] + dsig[ j+1 ]);
+            }
+            zh[ i ] = std::copysign( std::sqrt( std::abs( zi ) ), zs[ i ] );
+        }
+
+        #pragma omp parallel for schedule( static ) if (parallel)
+        for (int64_t j = 0; j < k; ++j) {
+            real_t* qu = &Qu[ j*k ];
+            real_t* qv = &Qv[ j*k ];
+            for (int64_t i = 0; i < k; ++i) {
+                qv[ i ] = zh[ i ] / Dm[ i + j*k ] / Dp[ i + j*k ];
+                qu[ i ] = (i == 0 ? -one : dsig[ i ] * qv[ i ]);
+            }
+            blas::scal( k, 1 / blas::nrm2( k, qu, 1 ), qu, 1 );
+            blas::scal( k, 1 / blas::nrm2( k, qv, 1 ), qv, 1 );
+        }
+    }
+
+    // Uk = U( :, cols ) Qu. Position 0 is e_{nl}, so row nl of Uk
+    // is row 0 of Qu, and the other columns are zero in row nl.
+    std::vector< int64_t > cols( k );
+    std::vector< int > types( k );
+    for (int64_t i = 1; i < k; ++i) {
+        cols[ i ] = col[ nondefl[ i-1 ] ];
+        types[ i ] = typ[ nondefl[ i-1 ] ];
+    }
+    cols[ 0 ] = nl;
+    types[ 0 ] = -1;
+    std::vector< real_t > Uk( n*k );
+    internal::dc_update_vectors( n, nl, k, &cols[ 0 ], &types[ 0 ],
+                                 U, ldu, &Qu[ 0 ], k, &Uk[ 0 ], n );
+    for (int64_t j = 0; j < k; ++j)
+        Uk[ nl + j*n ] = Qu[ j*k ];
+
+    // Vk = V( :, cols ) Qv.
+    types[ 0 ] = (sqre == 1 ? 1 : 0);
+    std::vector< real_t > Vk( m*k );
+    internal::dc_update_vectors( m, nlp1, k, &cols[ 0 ], &types[ 0 ],
+                                 V, ldv, &Qv[ 0 ], k, &Vk[ 0 ], m );
+
+    // Merge the new and deflated singular triplets into ascending order.
+    std::stable_sort( defl.begin(), defl.end(),
+                      [&dv]( int64_t a, int64_t b ) { return dv[ a ] < dv[ b ]; } );
+    int64_t nd = defl.size();
+    std::vector< real_t > Ud( n * max( 1, nd ) ), Vd( m * max( 1, nd ) ), dd( nd );
+    for (int64_t j = 0; j < nd; ++j) {
+        dd[ j ] = dv[ defl[ j ] ];
+        blas::copy( n, &U[ col[ defl[ j ] ]*ldu ], 1, &Ud[ j*n ], 1 );
+        blas::copy( m, &V[ col[ defl[ j ] ]*ldv ], 1, &Vd[ j*m ], 1 );
+    }
+
+    std::vector< real_t const* > usrc( n ), vsrc( n );
+    for (int64_t i = 0, j = 0, c = 0; c < n; ++c) {
+        if (j >= nd || (i < k && sigma[ i ] <= dd[ j ])) {
+            D[ c ] = sigma[ i ];
+            usrc[ c ] = &Uk[ i*n ];
+            vsrc[ c ] = &Vk[ i*m ];
+            ++i;
+        }
+        else {
+            D[ c ] = dd[ j ];
+            usrc[ c ] = &Ud[ j*n ];
+            vsrc[ c ] = &Vd[ j*m ];
+            ++j;
+        }
+    }
+    #pragma omp parallel for schedule( static ) if (parallel)
+    for (int64_t c = 0; c < n; ++c) {
+        blas::copy( n, usrc[ c ], 1, &U[ c*ldu ], 1 );
+        blas::copy( m, vsrc[ c ], 1, &V[ c*ldv ], 1 );
+    }
+
+    // Undo scaling.
+    lapack::lascl( MatrixType::General, 0, 0, one, orgnrm, n, 1, D, n );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Computes the SVD of the n-by-n upper bidiagonal matrix (D, E),
+// B = U S V^T, with singular values in descending order.
+// Note V, not V^T, is returned.
+template <typename real_t>
+static int64_t bdsdc_mt_solve(
+    int64_t n, real_t* D, real_t* E,
+    real_t* U, int64_t ldu,
+    real_t* V, int64_t ldv )
+{
+    const real_t zero = 0;
+    const real_t one  = 1;
+
+    lapack::laset( MatrixType::General, n, n, zero, zero, U, ldu );
+    lapack::laset( MatrixType::General, n, n, zero, zero, V, ldv );
+
+    real_t orgnrm = lapack::lanst( Norm::Max, n, D, E );
+    if (orgnrm == 0) {
+        lapack::laset( MatrixType::General, n, n, zero, one, U, ldu );
+        lapack::laset( MatrixType::General, n, n, zero, one, V, ldv );
+        return 0;
+    }
+    lapack::lascl( MatrixType::General, 0, 0, orgnrm, one, n, 1, D, n );
+    lapack::lascl( MatrixType::General, 0, 0, orgnrm, one, n - 1, 1, E, n - 1 );
+
+    // As in LAPACK's bdsdc, perturb tiny diagonal entries to eps, and split
+    // into unreduced blocks at tiny off-diagonal entries.
+    const real_t eps = real_t( 0.9 ) * std::numeric_limits< real_t >::epsilon();
+    for (int64_t i = 0; i < n; ++i) {
+        if (std::abs( D[ i ] ) < eps)
+            D[ i ] = std::copysign( eps, D[ i ] );
+    }
+
+    std::vector< BdsdcNode > leaves, merges;
+    int64_t max_height = 0;
+    for (int64_t start = 0; start < n; ) {
+        int64_t end = start;
+        while (end < n - 1 && std::abs( E[ end ] ) >= eps)
+            ++end;
+        max_height = max( max_height,
+                          bdsdc_mt_split( start, end - start + 1, 0,
+                                          leaves, merges ) );
+        start = end + 1;
+    }
+
+    // Solve leaves.
+    int64_t nleaves = leaves.size();
+    std::vector< int64_t > info_leaf( nleaves, 0 );
+    #pragma omp parallel for schedule( dynamic )
+    for (int64_t i = 0; i < nleaves; ++i) {
+        int64_t o = leaves[ i ].offset;
+        info_leaf[ i ] = bdsdc_mt_leaf(
+            leaves[ i ].n, leaves[ i ].sqre, &D[ o ], &E[ o ],
+            &U[ o + o*ldu ], ldu, &V[ o + o*ldv ], ldv );
+    }
+    for (int64_t i = 0; i < nleaves; ++i) {
+        if (info_leaf[ i ] != 0)
+            return info_leaf[ i ];
+    }
+
+    // Merge level by level, as in stedc_mt.
+    #ifdef _OPENMP
+        int64_t nthreads = omp_get_max_threads();
+    #else
+        int64_t nthreads = 1;
+    #endif
+    for (int64_t height = 1; height <= max_height; ++height) {
+        std::vector< BdsdcNode > level;
+        for (auto const& node : merges) {
+            if (node.height == height)
+                level.push_back( node );
+        }
+        int64_t nlevel = level.size();
+        bool concurrent = nlevel >= nthreads;
+        std::vector< int64_t > info_merge( nlevel, 0 );
+        #pragma omp parallel for schedule( dynamic ) if (concurrent)
+        for (int64_t i = 0; i < nlevel; ++i) {
+            BdsdcNode const& node = level[ i ];
+            int64_t o = node.offset;
+            info_merge[ i ] = bdsdc_mt_merge(
+                node.nl, node.n - node.nl - 1, node.sqre,
+                &D[ o ], E[ o + node.nl ],
+                &U[ o + o*ldu ], ldu, &V[ o + o*ldv ], ldv, ! concurrent );
+        }
+        for (int64_t i = 0; i < nlevel; ++i) {
+            if (info_merge[ i ] != 0)
+                return info_merge[ i ];
+        }
+    }
+
+    lapack::lascl( MatrixType::General, 0, 0, one, orgnrm, n, 1, D, n );
+
+    // Sort all singular values into descending order.
+    std::vector< int64_t > perm( n );
+    for (int64_t i = 0; i < n; ++i)
+        perm[ i ] = i;
+    std::stable_sort( perm.begin(), perm.end(),
+                      [D]( int64_t a, int64_t b ) { return D[ a ] > D[ b ]; } );
+    std::vector< real_t > Dsort( n );
+    for (int64_t i = 0; i < n; ++i)
+        Dsort[ i ] = D[ perm[ i ] ];
+    std::copy( Dsort.begin(), Dsort.end(), D );
+    internal::dc_permute_columns( n, n, &perm[ 0 ], U, ldu );
+    internal::dc_permute_columns( n, n, &perm[ 0 ], V, ldv );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes the singular value decomposition (SVD) of a real n-by-n
+/// (upper or lower) bidiagonal matrix B: $B = U S VT$,
+/// using a native, multithreaded divide and conquer method.
+///
+/// As in `lapack::bdsdc`, the bidiagonal matrix is split into unreduced
+/// blocks, then each block is recursively split at a middle row into
+/// upper-left and lower-right bidiagonal subproblems, down to subproblems
+/// of size 32. Here the whole tree is run in parallel using OpenMP: the
+/// leaves are solved concurrently using `lapack::bdsqr`, and merges at each
+/// level of the tree are run concurrently while there are enough of them
+/// for all the threads. Near the root, each merge is itself multithreaded:
+/// the roots of the secular equation are computed in parallel by LAPACK's
+/// lasd4, and the singular vector updates use gemm. Each merge follows
+/// LAPACK's lasd1: deflation, then the Gu-Eisenstat formula for
+/// numerically orthogonal singular vectors.
+///
+/// This can replace `lapack::bdsdc` in gesdd-style drivers: reduce A to
+/// bidiagonal using `lapack::gebrd`, call bdsdc_mt, then apply the
+/// transformations using `lapack::ormbr`.
+///
+/// Workspace of about 4 n^2 reals is allocated.
+///
+/// Overloaded versions are available for
+/// `float`, `double`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: B is upper bidiagonal.
+///     - lapack::Uplo::Lower: B is lower bidiagonal.
+///
+/// @param[in] compq
+///     Whether singular vectors are to be computed:
+///     - lapack::Job::NoVec: Compute singular values only,
+///       using `lapack::bdsqr`.
+///     - lapack::Job::Vec: Compute singular values and singular vectors.
+///     The compact form, lapack::Job::CompactVec, is not supported.
+///
+/// @param[in] n
+///     The order of the matrix B. n >= 0.
+///
+/// @param[in,out] D
+///     The vector D of length n.
+///     On entry, the n diagonal elements of the bidiagonal matrix B.
+///     On exit, if successful, the singular values of B,
+///     in descending order.
+///
+/// @param[in,out] E
+///     The vector E of length n-1.
+///     On entry, the elements of E contain the offdiagonal
+///     elements of the bidiagonal matrix whose SVD is desired.
+///     On exit, E has been destroyed.
+///
+/// @param[out] U
+///     The n-by-n matrix U, stored in an ldu-by-n array.
+///     If compq = Vec, then on exit, if successful, U contains the
+///     left singular vectors of the bidiagonal matrix.
+///     For other values of compq, U is not referenced.
+///
+/// @param[in] ldu
+///     The leading dimension of the array U. ldu >= 1.
+///     If singular vectors are desired, then ldu >= max( 1, n ).
+///
+/// @param[out] VT
+///     The n-by-n matrix VT, stored in an ldvt-by-n array.
+///     If compq = Vec, then on exit, if successful, VT^T contains the
+///     right singular vectors of the bidiagonal matrix.
+///     For other values of compq, VT is not referenced.
+///
+/// @param[in] ldvt
+///     The leading dimension of the array VT. ldvt >= 1.
+///     If singular vectors are desired, then ldvt >= max( 1, n ).
+///
+/// @return = 0: successful exit.
+/// @return > 0: The algorithm failed to compute a singular value.
+///
+/// @ingroup bdsvd
+template <typename real_t>
+int64_t bdsdc_mt(
+    lapack::Uplo uplo, lapack::Job compq, int64_t n,
+    real_t* D,
+    real_t* E,
+    real_t* U, int64_t ldu,
+    real_t* VT, int64_t ldvt )
+{
+    lapack_instrument( "bdsdc_mt", internal::precision_char< real_t >(),
+                       0, n, 0, internal::gflop_data_dependent );
+
+    lapack_error_if( uplo != Uplo::Upper && uplo != Uplo::Lower );
+    lapack_error_if( compq != Job::NoVec && compq != Job::Vec );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldu < 1 || (compq == Job::Vec && ldu < n) );
+    lapack_error_if( ldvt < 1 || (compq == Job::Vec && ldvt < n) );
+
+    if (n == 0)
+        return 0;
+
+    if (compq == Job::NoVec) {
+        real_t dummy = 0;
+        return lapack::bdsqr( uplo, n, 0, 0, 0, D, E,
+                              &dummy, 1, &dummy, 1, &dummy, 1 );
+    }
+
+    if (n == 1) {
+        U[ 0 ] = std::copysign( real_t( 1 ), D[ 0 ] );
+        VT[ 0 ] = 1;
+        D[ 0 ] = std::abs( D[ 0 ] );
+        return 0;
+    }
+
+    // If B is lower bidiagonal, B^T = U' S V'^T is upper bidiagonal with
+    // the same D and E, so U = V' and V = U'.
+    int64_t info;
+    if (uplo == Uplo::Upper)
+        info = bdsdc_mt_solve( n, D, E, U, ldu, VT, ldvt );
+    else
+        info = bdsdc_mt_solve( n, D, E, VT, ldvt, U, ldu );
+    if (info != 0)
+        return info;
+
+    // VT holds V; transpose in place.
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < j; ++i)
+            std::swap( VT[ i + j*ldvt ], VT[ j + i*ldvt ] );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t bdsdc_mt< float >(
+    lapack::Uplo uplo, lapack::Job compq, int64_t n,
+    float* D,
+    float* E,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt );
+
+template
+int64_t bdsdc_mt< double >(
+    lapack::Uplo uplo, lapack::Job compq, int64_t n,
+    double* D,
+    double* E,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt );
+
+}  // namespace lapack
@@ -26,6 +26,8 @@ int64_t bdsqr(
     float* U, int64_t ldu,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "bdsqr", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ncvt_ = to_lapack_int( ncvt );
@@ -64,6 +66,8 @@ int64_t bdsqr(
     double* U, int64_t ldu,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "bdsqr", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ncvt_ = to_lapack_int( ncvt );
@@ -102,6 +106,8 @@ int64_t bdsqr(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "bdsqr", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ncvt_ = to_lapack_int( ncvt );
@@ -239,6 +245,8 @@ int64_t bdsqr(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "bdsqr", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ncvt_ = to_lapack_int( ncvt );
@@ -28,6 +28,8 @@ int64_t bdsvdx(
     float* S,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "bdsvdx", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -196,6 +198,8 @@ int64_t bdsvdx(
     double* S,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "bdsvdx", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -0,0 +1,102 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_CHOL_UPDATE_INTERNAL_HH
+#define LAPACK_CHOL_UPDATE_INTERNAL_HH
+
+#include "lapack.hh"
+
+#include <cmath>
+
+namespace lapack {
+namespace internal {
+
+// Rank-1 update and downdate of an upper triangular Cholesky factor R,
+// A = R^H R, adding or removing a row x: R_new^H R_new = R^H R +- x^H x.
+// Element (i, j), i <= j, of R is at R[ idx( i, j ) ], so the same code
+// handles full and packed storage. A lower factor L, A = L L^H, is handled
+// as R = L^T, which factors conj( A ).
+// Shared by potrf_update, potrf_downdate, pptrf_update, pptrf_downdate.
+
+//------------------------------------------------------------------------------
+// Adds row x, which is overwritten, using Givens rotations (LINPACK xCHUD).
+// Rows of R are scaled so its diagonal stays real and positive.
+// Workspace c, s, phase of length n.
+template <typename scalar_t, typename index_t>
+void chol_update1(
+    int64_t n, scalar_t* R, index_t idx, scalar_t* x,
+    blas::real_type< scalar_t >* c, scalar_t* s, scalar_t* phase )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+
+    for (int64_t j = 0; j < n; ++j) {
+        // Apply previous rotations to column j and x_j.
+        scalar_t xj = x[ j ];
+        for (int64_t i = 0; i < j; ++i) {
+            scalar_t& Rij = R[ idx( i, j ) ];
+            scalar_t t = c[ i ]*Rij + s[ i ]*xj;
+            xj  = c[ i ]*xj - conj( s[ i ] )*Rij;
+            Rij = phase[ i ] * t;
+        }
+        // Rotation to eliminate x_j.
+        scalar_t r;
+        lapack::lartg( R[ idx( j, j ) ], xj, &c[ j ], &s[ j ], &r );
+        real_t absr = std::abs( r );
+        phase[ j ] = (absr == 0 ? scalar_t( 1 ) : conj( r ) / absr);
+        R[ idx( j, j ) ] = absr;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Removes row x, given a = R^{-H} conj( x ), which is overwritten,
+// using Givens rotations (LINPACK xCHDD).
+// Returns false, with R unchanged, if ||a|| >= 1, i.e., R^H R - x^H x is
+// not positive definite. If parallel, columns are updated concurrently.
+// Workspace c of length n.
+template <typename scalar_t, typename index_t>
+bool chol_downdate1(
+    int64_t n, scalar_t* R, index_t idx, scalar_t* a,
+    blas::real_type< scalar_t >* c, bool parallel )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+
+    const real_t one = 1;
+    real_t norm = blas::nrm2( n, a, 1 );
+    if (! (norm < one))
+        return false;
+
+    // Rotations reducing [ a; alpha ] to [ 0; 1 ]; s overwrites a.
+    scalar_t* s = a;
+    real_t alpha = std::sqrt( (one - norm) * (one + norm) );
+    for (int64_t i = n - 1; i >= 0; --i) {
+        real_t scale = alpha + std::abs( s[ i ] );
+        real_t ai = alpha / scale;
+        scalar_t b = s[ i ] / scale;
+        norm = std::hypot( ai, std::abs( b ) );
+        c[ i ] = ai / norm;
+        s[ i ] = conj( b ) / norm;
+        alpha = scale * norm;
+    }
+
+    // Apply the rotations; columns are independent.
+    #pragma omp parallel for schedule( dynamic, 16 ) if (parallel)
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t xx = 0;
+        for (int64_t i = j; i >= 0; --i) {
+            scalar_t& Rij = R[ idx( i, j ) ];
+            scalar_t t = c[ i ]*xx + s[ i ]*Rij;
+            Rij = c[ i ]*Rij - conj( s[ i ] )*xx;
+            xx = t;
+        }
+    }
+    return true;
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_CHOL_UPDATE_INTERNAL_HH
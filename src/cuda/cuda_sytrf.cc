@@ -0,0 +1,229 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_CUBLAS)
+
+#include "lapack/device.hh"
+#include "cuda_common.hh"
+
+//==============================================================================
+// todo: put into BLAS++ header somewhere.
+namespace blas {
+namespace internal {
+
+cublasFillMode_t uplo2cublas( blas::Uplo uplo );
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around cuSolver to deal with precisions.
+cusolverStatus_t cusolver_sytrf_bufferSize(
+    cusolverDnHandle_t solver, int n,
+    float* dA, int ldda, int* lwork )
+{
+    return cusolverDnSsytrf_bufferSize(
+        solver, n,
+        dA, ldda, lwork );
+}
+
+//----------
+cusolverStatus_t cusolver_sytrf_bufferSize(
+    cusolverDnHandle_t solver, int n,
+    double* dA, int ldda, int* lwork )
+{
+    return cusolverDnDsytrf_bufferSize(
+        solver, n,
+        dA, ldda, lwork );
+}
+
+//----------
+cusolverStatus_t cusolver_sytrf_bufferSize(
+    cusolverDnHandle_t solver, int n,
+    std::complex<float>* dA, int ldda, int* lwork )
+{
+    return cusolverDnCsytrf_bufferSize(
+        solver, n,
+        (cuFloatComplex*) dA, ldda, lwork );
+}
+
+//----------
+cusolverStatus_t cusolver_sytrf_bufferSize(
+    cusolverDnHandle_t solver, int n,
+    std::complex<double>* dA, int ldda, int* lwork )
+{
+    return cusolverDnZsytrf_bufferSize(
+        solver, n,
+        (cuDoubleComplex*) dA, ldda, lwork );
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around cuSolver to deal with precisions.
+cusolverStatus_t cusolver_sytrf(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n,
+    float* dA, int ldda, int* dipiv,
+    float* dev_work, int lwork, int* info )
+{
+    return cusolverDnSsytrf(
+        solver, uplo, n,
+        dA, ldda, dipiv,
+        dev_work, lwork, info );
+}
+
+//----------
+cusolverStatus_t cusolver_sytrf(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n,
+    double* dA, int ldda, int* dipiv,
+    double* dev_work, int lwork, int* info )
+{
+    return cusolverDnDsytrf(
+        solver, uplo, n,
+        dA, ldda, dipiv,
+        dev_work, lwork, info );
+}
+
+//----------
+cusolverStatus_t cusolver_sytrf(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n,
+    std::complex<float>* dA, int ldda, int* dipiv,
+    std::complex<float>* dev_work, int lwork, int* info )
+{
+    return cusolverDnCsytrf(
+        solver, uplo, n,
+        (cuFloatComplex*) dA, ldda, dipiv,
+        (cuFloatComplex*) dev_work, lwork, info );
+}
+
+//----------
+cusolverStatus_t cusolver_sytrf(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n,
+    std::complex<double>* dA, int ldda, int* dipiv,
+    std::complex<double>* dev_work, int lwork, int* info )
+{
+    return cusolverDnZsytrf(
+        solver, uplo, n,
+        (cuDoubleComplex*) dA, ldda, dipiv,
+        (cuDoubleComplex*) dev_work, lwork, info );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver workspace query.
+template <typename scalar_t>
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    auto solver = queue.solver();
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // query for workspace size
+    int lwork;
+    blas_dev_call(
+        cusolver_sytrf_bufferSize( solver, n, dA, ldda, &lwork ));
+    *dev_work_size = lwork * sizeof(scalar_t);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    // todo: check for overflow
+    auto solver = queue.solver();
+    auto uplo_ = blas::internal::uplo2cublas( uplo );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // launch kernel
+    int lwork = dev_work_size / sizeof(scalar_t);
+    blas_dev_call(
+        cusolver_sytrf(
+            solver, uplo_, n, dA, ldda, dev_ipiv,
+            (scalar_t*) dev_work, lwork, dev_info ));
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
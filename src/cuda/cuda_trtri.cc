@@ -0,0 +1,154 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_CUBLAS)
+
+#include "lapack/device.hh"
+#include "cuda_common.hh"
+
+//==============================================================================
+// todo: put into BLAS++ header somewhere.
+namespace blas {
+namespace internal {
+
+cublasFillMode_t uplo2cublas( blas::Uplo uplo );
+cublasDiagType_t diag2cublas( blas::Diag diag );
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver workspace query.
+// cusolverDnXtrtri is available since cuSolver 11.2 (CUDA 11.4).
+template <typename scalar_t>
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    #if CUSOLVER_VERSION >= 11200
+        auto solver = queue.solver();
+        auto uplo_ = blas::internal::uplo2cublas( uplo );
+        auto diag_ = blas::internal::diag2cublas( diag );
+
+        // for cuda, rocm, call set_device; for oneapi, do nothing.
+        blas::internal_set_device( queue.device() );
+
+        // query for workspace size
+        blas_dev_call(
+            cusolverDnXtrtri_bufferSize(
+                solver, uplo_, diag_, n,
+                CudaTraits<scalar_t>::datatype, dA, ldda,
+                dev_work_size, host_work_size ));
+    #else
+        *dev_work_size  = 0;
+        *host_work_size = 0;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    #if CUSOLVER_VERSION >= 11200
+        // todo: check for overflow
+        auto solver = queue.solver();
+        auto uplo_ = blas::internal::uplo2cublas( uplo );
+        auto diag_ = blas::internal::diag2cublas( diag );
+
+        // for cuda, rocm, call set_device; for oneapi, do nothing.
+        blas::internal_set_device( queue.device() );
+
+        // launch kernel
+        blas_dev_call(
+            cusolverDnXtrtri(
+                solver, uplo_, diag_, n,
+                CudaTraits<scalar_t>::datatype, dA, ldda,
+                dev_work, dev_work_size,
+                host_work, host_work_size, dev_info ));
+    #else
+        throw lapack::Error( "trtri requires cuSolver >= 11.2", __func__ );
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    float* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    double* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<float>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<double>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    float* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    double* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<float>* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<double>* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
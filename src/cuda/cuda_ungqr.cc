@@ -0,0 +1,219 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_CUBLAS)
+
+#include "lapack/device.hh"
+#include "cuda_common.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around cuSolver to deal with precisions.
+cusolverStatus_t cusolver_ungqr_bufferSize(
+    cusolverDnHandle_t solver, int m, int n, int k,
+    float const* dA, int ldda, float const* dtau, int* lwork )
+{
+    return cusolverDnSorgqr_bufferSize(
+        solver, m, n, k,
+        dA, ldda, dtau, lwork );
+}
+
+//----------
+cusolverStatus_t cusolver_ungqr_bufferSize(
+    cusolverDnHandle_t solver, int m, int n, int k,
+    double const* dA, int ldda, double const* dtau, int* lwork )
+{
+    return cusolverDnDorgqr_bufferSize(
+        solver, m, n, k,
+        dA, ldda, dtau, lwork );
+}
+
+//----------
+cusolverStatus_t cusolver_ungqr_bufferSize(
+    cusolverDnHandle_t solver, int m, int n, int k,
+    std::complex<float> const* dA, int ldda, std::complex<float> const* dtau, int* lwork )
+{
+    return cusolverDnCungqr_bufferSize(
+        solver, m, n, k,
+        (cuFloatComplex const*) dA, ldda, (cuFloatComplex const*) dtau, lwork );
+}
+
+//----------
+cusolverStatus_t cusolver_ungqr_bufferSize(
+    cusolverDnHandle_t solver, int m, int n, int k,
+    std::complex<double> const* dA, int ldda, std::complex<double> const* dtau, int* lwork )
+{
+    return cusolverDnZungqr_bufferSize(
+        solver, m, n, k,
+        (cuDoubleComplex const*) dA, ldda, (cuDoubleComplex const*) dtau, lwork );
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around cuSolver to deal with precisions.
+cusolverStatus_t cusolver_ungqr(
+    cusolverDnHandle_t solver, int m, int n, int k,
+    float* dA, int ldda, float const* dtau,
+    float* dev_work, int lwork, int* info )
+{
+    return cusolverDnSorgqr(
+        solver, m, n, k,
+        dA, ldda, dtau,
+        dev_work, lwork, info );
+}
+
+//----------
+cusolverStatus_t cusolver_ungqr(
+    cusolverDnHandle_t solver, int m, int n, int k,
+    double* dA, int ldda, double const* dtau,
+    double* dev_work, int lwork, int* info )
+{
+    return cusolverDnDorgqr(
+        solver, m, n, k,
+        dA, ldda, dtau,
+        dev_work, lwork, info );
+}
+
+//----------
+cusolverStatus_t cusolver_ungqr(
+    cusolverDnHandle_t solver, int m, int n, int k,
+    std::complex<float>* dA, int ldda, std::complex<float> const* dtau,
+    std::complex<float>* dev_work, int lwork, int* info )
+{
+    return cusolverDnCungqr(
+        solver, m, n, k,
+        (cuFloatComplex*) dA, ldda, (cuFloatComplex const*) dtau,
+        (cuFloatComplex*) dev_work, lwork, info );
+}
+
+//----------
+cusolverStatus_t cusolver_ungqr(
+    cusolverDnHandle_t solver, int m, int n, int k,
+    std::complex<double>* dA, int ldda, std::complex<double> const* dtau,
+    std::complex<double>* dev_work, int lwork, int* info )
+{
+    return cusolverDnZungqr(
+        solver, m, n, k,
+        (cuDoubleComplex*) dA, ldda, (cuDoubleComplex const*) dtau,
+        (cuDoubleComplex*) dev_work, lwork, info );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver workspace query.
+template <typename scalar_t>
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    auto solver = queue.solver();
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // query for workspace size
+    int lwork;
+    blas_dev_call(
+        cusolver_ungqr_bufferSize(
+            solver, m, n, k, dA, ldda, dtau, &lwork ));
+    *dev_work_size = lwork * sizeof(scalar_t);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    // todo: check for overflow
+    auto solver = queue.solver();
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // launch kernel
+    int lwork = dev_work_size / sizeof(scalar_t);
+    blas_dev_call(
+        cusolver_ungqr(
+            solver, m, n, k, dA, ldda, dtau,
+            (scalar_t*) dev_work, lwork, dev_info ));
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    float* dA, int64_t ldda, float const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    double* dA, int64_t ldda, double const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* dA, int64_t ldda, std::complex<float> const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* dA, int64_t ldda, std::complex<double> const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    float* dA, int64_t ldda, float const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    double* dA, int64_t ldda, double const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* dA, int64_t ldda, std::complex<float> const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* dA, int64_t ldda, std::complex<double> const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
@@ -0,0 +1,275 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_CUBLAS)
+
+#include "lapack/device.hh"
+#include "cuda_common.hh"
+
+//==============================================================================
+// todo: put into BLAS++ header somewhere.
+namespace blas {
+namespace internal {
+
+cublasSideMode_t side2cublas( blas::Side side );
+cublasOperation_t op2cublas( blas::Op op );
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around cuSolver to deal with precisions.
+cusolverStatus_t cusolver_unmqr_bufferSize(
+    cusolverDnHandle_t solver, cublasSideMode_t side, cublasOperation_t trans,
+    int m, int n, int k,
+    float const* dA, int ldda, float const* dtau,
+    float const* dC, int lddc, int* lwork )
+{
+    return cusolverDnSormqr_bufferSize(
+        solver, side, trans, m, n, k,
+        dA, ldda, dtau,
+        dC, lddc, lwork );
+}
+
+//----------
+cusolverStatus_t cusolver_unmqr_bufferSize(
+    cusolverDnHandle_t solver, cublasSideMode_t side, cublasOperation_t trans,
+    int m, int n, int k,
+    double const* dA, int ldda, double const* dtau,
+    double const* dC, int lddc, int* lwork )
+{
+    return cusolverDnDormqr_bufferSize(
+        solver, side, trans, m, n, k,
+        dA, ldda, dtau,
+        dC, lddc, lwork );
+}
+
+//----------
+cusolverStatus_t cusolver_unmqr_bufferSize(
+    cusolverDnHandle_t solver, cublasSideMode_t side, cublasOperation_t trans,
+    int m, int n, int k,
+    std::complex<float> const* dA, int ldda, std::complex<float> const* dtau,
+    std::complex<float> const* dC, int lddc, int* lwork )
+{
+    return cusolverDnCunmqr_bufferSize(
+        solver, side, trans, m, n, k,
+        (cuFloatComplex const*) dA, ldda, (cuFloatComplex const*) dtau,
+        (cuFloatComplex const*) dC, lddc, lwork );
+}
+
+//----------
+cusolverStatus_t cusolver_unmqr_bufferSize(
+    cusolverDnHandle_t solver, cublasSideMode_t side, cublasOperation_t trans,
+    int m, int n, int k,
+    std::complex<double> const* dA, int ldda, std::complex<double> const* dtau,
+    std::complex<double> const* dC, int lddc, int* lwork )
+{
+    return cusolverDnZunmqr_bufferSize(
+        solver, side, trans, m, n, k,
+        (cuDoubleComplex const*) dA, ldda, (cuDoubleComplex const*) dtau,
+        (cuDoubleComplex const*) dC, lddc, lwork );
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around cuSolver to deal with precisions.
+cusolverStatus_t cusolver_unmqr(
+    cusolverDnHandle_t solver, cublasSideMode_t side, cublasOperation_t trans,
+    int m, int n, int k,
+    float const* dA, int ldda, float const* dtau,
+    float* dC, int lddc,
+    float* dev_work, int lwork, int* info )
+{
+    return cusolverDnSormqr(
+        solver, side, trans, m, n, k,
+        dA, ldda, dtau,
+        dC, lddc,
+        dev_work, lwork, info );
+}
+
+//----------
+cusolverStatus_t cusolver_unmqr(
+    cusolverDnHandle_t solver, cublasSideMode_t side, cublasOperation_t trans,
+    int m, int n, int k,
+    double const* dA, int ldda, double const* dtau,
+    double* dC, int lddc,
+    double* dev_work, int lwork, int* info )
+{
+    return cusolverDnDormqr(
+        solver, side, trans, m, n, k,
+        dA, ldda, dtau,
+        dC, lddc,
+        dev_work, lwork, info );
+}
+
+//----------
+cusolverStatus_t cusolver_unmqr(
+    cusolverDnHandle_t solver, cublasSideMode_t side, cublasOperation_t trans,
+    int m, int n, int k,
+    std::complex<float> const* dA, int ldda, std::complex<float> const* dtau,
+    std::complex<float>* dC, int lddc,
+    std::complex<float>* dev_work, int lwork, int* info )
+{
+    return cusolverDnCunmqr(
+        solver, side, trans, m, n, k,
+        (cuFloatComplex const*) dA, ldda, (cuFloatComplex const*) dtau,
+        (cuFloatComplex*) dC, lddc,
+        (cuFloatComplex*) dev_work, lwork, info );
+}
+
+//----------
+cusolverStatus_t cusolver_unmqr(
+    cusolverDnHandle_t solver, cublasSideMode_t side, cublasOperation_t trans,
+    int m, int n, int k,
+    std::complex<double> const* dA, int ldda, std::complex<double> const* dtau,
+    std::complex<double>* dC, int lddc,
+    std::complex<double>* dev_work, int lwork, int* info )
+{
+    return cusolverDnZunmqr(
+        solver, side, trans, m, n, k,
+        (cuDoubleComplex const*) dA, ldda, (cuDoubleComplex const*) dtau,
+        (cuDoubleComplex*) dC, lddc,
+        (cuDoubleComplex*) dev_work, lwork, info );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver workspace query.
+template <typename scalar_t>
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    auto solver = queue.solver();
+    // For real, ConjTrans is Trans.
+    if (trans == Op::ConjTrans && ! blas::is_complex<scalar_t>::value)
+        trans = Op::Trans;
+    auto side_  = blas::internal::side2cublas( side );
+    auto trans_ = blas::internal::op2cublas( trans );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // query for workspace size
+    int lwork;
+    blas_dev_call(
+        cusolver_unmqr_bufferSize(
+            solver, side_, trans_, m, n, k, dA, ldda, dtau, dC, lddc,
+            &lwork ));
+    *dev_work_size = lwork * sizeof(scalar_t);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    // todo: check for overflow
+    auto solver = queue.solver();
+    // For real, ConjTrans is Trans.
+    if (trans == Op::ConjTrans && ! blas::is_complex<scalar_t>::value)
+        trans = Op::Trans;
+    auto side_  = blas::internal::side2cublas( side );
+    auto trans_ = blas::internal::op2cublas( trans );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // launch kernel
+    int lwork = dev_work_size / sizeof(scalar_t);
+    blas_dev_call(
+        cusolver_unmqr(
+            solver, side_, trans_, m, n, k, dA, ldda, dtau, dC, lddc,
+            (scalar_t*) dev_work, lwork, dev_info ));
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* dA, int64_t ldda, float const* dtau,
+    float* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* dA, int64_t ldda, double const* dtau,
+    double* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* dA, int64_t ldda, std::complex<float> const* dtau,
+    std::complex<float>* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* dA, int64_t ldda, std::complex<double> const* dtau,
+    std::complex<double>* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* dA, int64_t ldda, float const* dtau,
+    float* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* dA, int64_t ldda, double const* dtau,
+    double* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* dA, int64_t ldda, std::complex<float> const* dtau,
+    std::complex<float>* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* dA, int64_t ldda, std::complex<double> const* dtau,
+    std::complex<double>* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
@@ -0,0 +1,149 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/device.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// With the host backend, "device" memory is host memory, and it is freed on
+// the host stream, after the tasks that may use it.
+template <typename T>
+T* pool_device_malloc( size_t n, [[maybe_unused]] lapack::Queue& queue )
+{
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        return new T[ n ];
+    #else
+        return blas::device_malloc< T >( n, queue );
+    #endif
+}
+
+template <typename T>
+void pool_device_free( T* ptr, lapack::Queue& queue )
+{
+    if (ptr == nullptr)
+        return;
+
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        queue.enqueue( [ptr]() { delete[] ptr; } );
+    #else
+        blas::device_free( ptr, queue );
+    #endif
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+void* Queue::pool_dev_work( size_t bytes )
+{
+    pool_stats_.work_requests += 1;
+    if (bytes > pool_stats_.dev_work_bytes) {
+        pool_stats_.grows += 1;
+        sync();
+        pool_device_free( (char*) pool_dev_work_, *this );
+        pool_dev_work_ = pool_device_malloc< char >( bytes, *this );
+        pool_stats_.dev_work_bytes = bytes;
+    }
+    return pool_dev_work_;
+}
+
+//------------------------------------------------------------------------------
+void* Queue::pool_host_work( size_t bytes )
+{
+    pool_stats_.work_requests += 1;
+    if (bytes > pool_stats_.host_work_bytes) {
+        pool_stats_.grows += 1;
+        sync();
+        delete[] pool_host_work_;
+        pool_host_work_ = new char[ bytes ];
+        pool_stats_.host_work_bytes = bytes;
+    }
+    return pool_host_work_;
+}
+
+//------------------------------------------------------------------------------
+device_info_int* Queue::pool_dev_info()
+{
+    if (pool_info_used_ == pool_stats_.info_slots) {
+        // Save the used slots before reallocating, doubling the slots.
+        int64_t slots = std::max( int64_t( 16 ), 2*pool_stats_.info_slots );
+        pool_stats_.grows += 1;
+        pool_read_info();
+        pool_device_free( pool_dev_info_, *this );
+        pool_dev_info_ = pool_device_malloc< device_info_int >( slots, *this );
+        pool_stats_.info_slots = slots;
+    }
+    pool_stats_.info_pending += 1;
+    return &pool_dev_info_[ pool_info_used_++ ];
+}
+
+//------------------------------------------------------------------------------
+// Syncs, then appends the used slots to pool_info_read_.
+void Queue::pool_read_info()
+{
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        sync();
+        pool_info_read_.insert( pool_info_read_.end(), pool_dev_info_,
+                                pool_dev_info_ + pool_info_used_ );
+    #else
+        size_t n = pool_info_read_.size();
+        pool_info_read_.resize( n + pool_info_used_ );
+        if (pool_info_used_ > 0) {
+            blas::device_memcpy( pool_info_read_.data() + n, pool_dev_info_,
+                                 pool_info_used_, *this );
+        }
+        sync();
+    #endif
+    pool_info_used_ = 0;
+}
+
+//------------------------------------------------------------------------------
+int64_t Queue::info()
+{
+    pool_read_info();
+
+    int64_t info = 0;
+    for (auto slot : pool_info_read_) {
+        if (slot != 0) {
+            info = slot;
+            break;
+        }
+    }
+    pool_info_read_.clear();
+    pool_stats_.info_pending = 0;
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Called by the destructor. Calls enqueued before may still use the buffers.
+void Queue::pool_free()
+{
+    #if ! defined(LAPACK_HAVE_HOST_QUEUE)
+        if (pool_dev_work_ != nullptr || pool_dev_info_ != nullptr
+            || pool_host_work_ != nullptr) {
+            blas::Queue::sync();
+        }
+    #endif
+    pool_device_free( (char*) pool_dev_work_, *this );
+    pool_device_free( pool_dev_info_, *this );
+    pool_dev_work_ = nullptr;
+    pool_dev_info_ = nullptr;
+
+    // With the host backend, tasks may still use the host workspace.
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        char* host_work = pool_host_work_;
+        if (host_work != nullptr)
+            enqueue( [host_work]() { delete[] host_work; } );
+    #else
+        delete[] pool_host_work_;
+    #endif
+    pool_host_work_ = nullptr;
+}
+
+}  // namespace lapack
@@ -21,6 +21,8 @@ int64_t disna(
     float const* D,
     float* SEP )
 {
+    lapack_instrument( "disna", 's', m, n, 0, internal::gflop_none );
+
     char jobcond_ = to_char( jobcond );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -43,6 +45,8 @@ int64_t disna(
     double const* D,
     double* SEP )
 {
+    lapack_instrument( "disna", 'd', m, n, 0, internal::gflop_none );
+
     char jobcond_ = to_char( jobcond );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
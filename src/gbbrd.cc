@@ -27,6 +27,8 @@ int64_t gbbrd(
     float* PT, int64_t ldpt,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "gbbrd", 's', m, n, 0, internal::gflop_no_formula );
+
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -69,6 +71,8 @@ int64_t gbbrd(
     double* PT, int64_t ldpt,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "gbbrd", 'd', m, n, 0, internal::gflop_no_formula );
+
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -111,6 +115,8 @@ int64_t gbbrd(
     std::complex<float>* PT, int64_t ldpt,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "gbbrd", 'c', m, n, 0, internal::gflop_no_formula );
+
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -240,6 +246,8 @@ int64_t gbbrd(
     std::complex<double>* PT, int64_t ldpt,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "gbbrd", 'z', m, n, 0, internal::gflop_no_formula );
+
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
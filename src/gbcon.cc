@@ -24,6 +24,8 @@ int64_t gbcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "gbcon", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -63,6 +65,8 @@ int64_t gbcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "gbcon", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -102,6 +106,8 @@ int64_t gbcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "gbcon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -193,6 +199,8 @@ int64_t gbcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "gbcon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -26,6 +26,8 @@ int64_t gbequ(
     float* colcnd,
     float* amax )
 {
+    lapack_instrument( "gbequ", 's', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -55,6 +57,8 @@ int64_t gbequ(
     double* colcnd,
     double* amax )
 {
+    lapack_instrument( "gbequ", 'd', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -84,6 +88,8 @@ int64_t gbequ(
     float* colcnd,
     float* amax )
 {
+    lapack_instrument( "gbequ", 'c', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -178,6 +184,8 @@ int64_t gbequ(
     double* colcnd,
     double* amax )
 {
+    lapack_instrument( "gbequ", 'z', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -26,6 +26,8 @@ int64_t gbequb(
     float* colcnd,
     float* amax )
 {
+    lapack_instrument( "gbequb", 's', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -55,6 +57,8 @@ int64_t gbequb(
     double* colcnd,
     double* amax )
 {
+    lapack_instrument( "gbequb", 'd', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -84,6 +88,8 @@ int64_t gbequb(
     float* colcnd,
     float* amax )
 {
+    lapack_instrument( "gbequb", 'c', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -185,6 +191,8 @@ int64_t gbequb(
     double* colcnd,
     double* amax )
 {
+    lapack_instrument( "gbequb", 'z', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
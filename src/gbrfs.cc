@@ -28,6 +28,9 @@ int64_t gbrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "gbrfs", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -80,6 +83,9 @@ int64_t gbrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "gbrfs", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -132,6 +138,9 @@ int64_t gbrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "gbrfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -270,6 +279,9 @@ int64_t gbrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "gbrfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -35,6 +35,9 @@ int64_t gbrfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    lapack_instrument( "gbrfsx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -99,6 +102,9 @@ int64_t gbrfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    lapack_instrument( "gbrfsx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -163,6 +169,9 @@ int64_t gbrfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    lapack_instrument( "gbrfsx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -528,6 +537,9 @@ int64_t gbrfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    lapack_instrument( "gbrfsx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
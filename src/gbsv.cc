@@ -24,6 +24,9 @@ int64_t gbsv(
     int64_t* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "gbsv", 's', 0, n, nrhs,
+                       Gflop< float >::gbsv( n, kl, ku, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
     lapack_int ku_ = to_lapack_int( ku );
@@ -61,6 +64,9 @@ int64_t gbsv(
     int64_t* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "gbsv", 'd', 0, n, nrhs,
+                       Gflop< double >::gbsv( n, kl, ku, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
     lapack_int ku_ = to_lapack_int( ku );
@@ -98,6 +104,9 @@ int64_t gbsv(
     int64_t* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "gbsv", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::gbsv( n, kl, ku, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
     lapack_int ku_ = to_lapack_int( ku );
@@ -217,6 +226,9 @@ int64_t gbsv(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "gbsv", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::gbsv( n, kl, ku, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
     lapack_int ku_ = to_lapack_int( ku );
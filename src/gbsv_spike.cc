@@ -0,0 +1,380 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <vector>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+int64_t spike_num_parts( int64_t n, int64_t nparts, int64_t min_size )
+{
+    if (nparts <= 0) {
+        #ifdef _OPENMP
+            nparts = omp_get_max_threads();
+        #else
+            nparts = 1;
+        #endif
+    }
+    min_size = max( min_size, 1 );
+    return max( min( nparts, n / min_size ), 1 );
+}
+
+//------------------------------------------------------------------------------
+// SPIKE reduced system.
+//
+// Partition j holds rows offsets[ j ] : offsets[ j+1 ]-1. On entry, B holds
+// the partition solutions g_j = A_j^{-1} b_j, and S holds the spikes:
+// columns 0 : ku-1 are V_j = A_j^{-1} [ 0; B_j ], the coupling to the
+// first ku unknowns of partition j+1, and columns ku : ku+kl-1 are
+// W_j = A_j^{-1} [ C_j; 0 ], the coupling to the last kl unknowns of
+// partition j-1. The exact solution satisfies
+//
+//     x_j = g_j - V_j t_{j+1} - W_j b_{j-1},
+//
+// where t_j is the top ku and b_j is the bottom kl unknowns of x_j.
+// Restricting this to the rows of t_j and b_j gives a banded system of
+// order nparts*(kl + ku) for the interface unknowns, which is solved here
+// with gbsv. Then all partitions are updated independently.
+//
+// Returns 0, or n + 1 if the reduced system is singular.
+//
+template <typename scalar_t>
+int64_t spike_reduced_solve(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    int64_t nparts, int64_t const* offsets,
+    scalar_t const* S, int64_t lds,
+    scalar_t* B, int64_t ldb )
+{
+    const scalar_t one = 1;
+    int64_t nb = kl + ku;
+    if (nparts <= 1 || nb == 0)
+        return 0;
+
+    // Interface unknowns are ordered [ t_0, b_0, t_1, b_1, ... ].
+    int64_t nr = nparts * nb;
+    int64_t klr = max( 2*kl + ku - 1, 0 );
+    int64_t kur = max( kl + 2*ku - 1, 0 );
+    int64_t ldr = 2*klr + kur + 1;
+    std::vector< scalar_t > AR( ldr * nr );
+    std::vector< scalar_t > XR( nr * nrhs );
+    std::vector< int64_t > ipiv( nr );
+
+    // AR(i, j) in gbtrf storage.
+    auto ar = [&]( int64_t i, int64_t j ) -> scalar_t& {
+        return AR[ klr + kur + i - j + j*ldr ];
+    };
+
+    for (int64_t j = 0; j < nparts; ++j) {
+        int64_t s  = offsets[ j ];
+        int64_t nj = offsets[ j+1 ] - s;
+        for (int64_t r = 0; r < nb; ++r) {
+            // Local row li within partition j of interface unknown r.
+            int64_t li  = (r < ku ? r : nj - nb + r);
+            int64_t row = j*nb + r;
+            ar( row, row ) = one;
+            if (j < nparts - 1) {
+                for (int64_t c = 0; c < ku; ++c)
+                    ar( row, (j + 1)*nb + c ) = S[ s + li + c*lds ];
+            }
+            if (j > 0) {
+                for (int64_t c = 0; c < kl; ++c)
+                    ar( row, (j - 1)*nb + ku + c ) = S[ s + li + (ku + c)*lds ];
+            }
+            for (int64_t k = 0; k < nrhs; ++k)
+                XR[ row + k*nr ] = B[ s + li + k*ldb ];
+        }
+    }
+
+    int64_t info = lapack::gbsv( nr, klr, kur, nrhs, &AR[ 0 ], ldr,
+                                 &ipiv[ 0 ], &XR[ 0 ], nr );
+    if (info != 0)
+        return n + 1;
+
+    // Recover x_j = g_j - V_j t_{j+1} - W_j b_{j-1}, independently per part.
+    #pragma omp parallel for schedule( static )
+    for (int64_t j = 0; j < nparts; ++j) {
+        int64_t s  = offsets[ j ];
+        int64_t nj = offsets[ j+1 ] - s;
+        if (j < nparts - 1 && ku > 0) {
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                        nj, nrhs, ku,
+                        -one, &S[ s ], lds,
+                              &XR[ (j + 1)*nb ], nr,
+                        one,  &B[ s ], ldb );
+        }
+        if (j > 0 && kl > 0) {
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                        nj, nrhs, kl,
+                        -one, &S[ s + ku*lds ], lds,
+                              &XR[ (j - 1)*nb + ku ], nr,
+                        one,  &B[ s ], ldb );
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t spike_reduced_solve< float >(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    int64_t nparts, int64_t const* offsets,
+    float const* S, int64_t lds,
+    float* B, int64_t ldb );
+
+template
+int64_t spike_reduced_solve< double >(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    int64_t nparts, int64_t const* offsets,
+    double const* S, int64_t lds,
+    double* B, int64_t ldb );
+
+template
+int64_t spike_reduced_solve< std::complex<float> >(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    int64_t nparts, int64_t const* offsets,
+    std::complex<float> const* S, int64_t lds,
+    std::complex<float>* B, int64_t ldb );
+
+template
+int64_t spike_reduced_solve< std::complex<double> >(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    int64_t nparts, int64_t const* offsets,
+    std::complex<double> const* S, int64_t lds,
+    std::complex<double>* B, int64_t ldb );
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// where A is an n-by-n band matrix, with kl subdiagonals and ku
+/// superdiagonals, using the partitioned SPIKE algorithm, which has
+/// parallelism within a single system.
+///
+/// The rows are split into nparts contiguous partitions. In parallel,
+/// each diagonal block $A_j$ is factored using `lapack::gbtrf` (with
+/// partial pivoting inside the block) and used to compute the partial
+/// solution $A_j^{-1} B_j$ and the spikes, $A_j^{-1}$ applied to the
+/// coupling blocks with the neighboring partitions. The small banded
+/// system for the kl + ku unknowns at each partition interface is then
+/// solved with `lapack::gbsv`, and the partitions are updated in parallel.
+/// Threads are provided by OpenMP, if LAPACK++ is compiled with it.
+///
+/// Because pivoting is done only within partitions, this requires each
+/// diagonal block to be nonsingular; it is intended for diagonally
+/// dominant or otherwise well-conditioned band matrices, such as those
+/// arising from discretized PDEs. Unlike `lapack::gbsv`, A is not
+/// overwritten, and needs no extra kl rows for fill-in.
+/// Workspace of size about n*(2*kl + ku + 1 + kl + ku) is allocated.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] kl
+///     The number of subdiagonals within the band of A. kl >= 0.
+///
+/// @param[in] ku
+///     The number of superdiagonals within the band of A. ku >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in] AB
+///     The n-by-n band matrix A, stored in an ldab-by-n array,
+///     in the same band format as BLAS `gbmv`:
+///     A(i,j) is stored in AB(ku+i-j, j) for max(0, j-ku) <= i <= min(n-1, j+kl).
+///
+/// @param[in] ldab
+///     The leading dimension of the array AB. ldab >= kl+ku+1.
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On entry, the n-by-nrhs right hand side matrix B.
+///     On successful exit, the n-by-nrhs solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[in] nparts
+///     The number of partitions. If nparts <= 0, uses the number of
+///     OpenMP threads. It is reduced as needed so that each partition has
+///     at least kl + ku rows. With one partition, this is equivalent to
+///     `lapack::gbsv`.
+///
+/// @return = 0: successful exit
+/// @return > 0 and <= n: if return value = i, U(i,i) of the LU factorization
+///     of the diagonal block containing row i is exactly zero.
+///     The solution has not been computed, and B is unchanged.
+/// @return = n+1: the reduced interface system is singular.
+///     The solution has not been computed, and B is overwritten by the
+///     partial solutions of the diagonal blocks.
+///
+/// @ingroup gbsv
+template <typename scalar_t>
+int64_t gbsv_spike(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    scalar_t const* AB, int64_t ldab,
+    scalar_t* B, int64_t ldb,
+    int64_t nparts )
+{
+    // The spikes are kl + ku more right-hand sides; the reduced system is
+    // lower order.
+    lapack_instrument( "gbsv_spike", internal::precision_char< scalar_t >(),
+                       0, n, nrhs,
+                       Gflop< scalar_t >::gbsv( n, kl, ku, nrhs + kl + ku ) );
+
+    lapack_error_if( n < 0 );
+    lapack_error_if( kl < 0 );
+    lapack_error_if( ku < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldab < kl + ku + 1 );
+    lapack_error_if( ldb < max( 1, n ) );
+
+    if (n == 0)
+        return 0;
+
+    int64_t nb = kl + ku;
+    nparts = internal::spike_num_parts( n, nparts, nb );
+
+    std::vector< int64_t > offsets( nparts + 1 );
+    for (int64_t j = 0; j <= nparts; ++j)
+        offsets[ j ] = j * n / nparts;
+
+    // Spikes [ V, W ], n-by-(ku + kl).
+    int64_t lds = n;
+    std::vector< scalar_t > S( lds * nb );
+    std::vector< int64_t > info_part( nparts );
+
+    // LU factors of the diagonal blocks, in gbtrf storage with kl extra
+    // rows for fill-in; block j is in columns s:e-1.
+    int64_t ldabf = 2*kl + ku + 1;
+    std::vector< scalar_t > ABf( ldabf * n );
+    std::vector< int64_t > ipiv( n );
+
+    // Factor all diagonal blocks before touching B, so B is unchanged
+    // if any block is singular.
+    #pragma omp parallel for schedule( static )
+    for (int64_t j = 0; j < nparts; ++j) {
+        int64_t s  = offsets[ j ];
+        int64_t e  = offsets[ j+1 ];
+        int64_t nj = e - s;
+
+        // Copy diagonal block, dropping coupling outside the block.
+        scalar_t* ABj = &ABf[ s*ldabf ];
+        for (int64_t jj = 0; jj < nj; ++jj) {
+            int64_t ibegin = max( 0, jj - ku );
+            int64_t iend   = min( nj, jj + kl + 1 );
+            for (int64_t i = ibegin; i < iend; ++i) {
+                ABj[ kl + ku + i - jj + jj*ldabf ]
+                    = AB[ ku + i - jj + (s + jj)*ldab ];
+            }
+        }
+
+        int64_t iinfo = lapack::gbtrf( nj, nj, kl, ku, ABj, ldabf,
+                                       &ipiv[ s ] );
+        if (iinfo != 0)
+            info_part[ j ] = s + iinfo;
+    }
+
+    for (int64_t j = 0; j < nparts; ++j) {
+        if (info_part[ j ] != 0)
+            return info_part[ j ];
+    }
+
+    // Solve for B_j and the spikes.
+    #pragma omp parallel for schedule( static )
+    for (int64_t j = 0; j < nparts; ++j) {
+        int64_t s  = offsets[ j ];
+        int64_t e  = offsets[ j+1 ];
+        int64_t nj = e - s;
+        scalar_t const* ABj = &ABf[ s*ldabf ];
+
+        lapack::gbtrs( Op::NoTrans, nj, kl, ku, nrhs, ABj, ldabf,
+                       &ipiv[ s ], &B[ s ], ldb );
+
+        // V_j = A_j^{-1} [ 0; B_j ], with B_j lower triangular in the
+        // last ku rows, coupling to the first ku columns of partition j+1.
+        if (j < nparts - 1 && ku > 0) {
+            for (int64_t c = 0; c < ku; ++c) {
+                for (int64_t r = c; r < ku; ++r) {
+                    int64_t i  = s + nj - ku + r;  // global row
+                    int64_t jc = e + c;            // global col
+                    S[ i + c*lds ] = AB[ ku + i - jc + jc*ldab ];
+                }
+            }
+            lapack::gbtrs( Op::NoTrans, nj, kl, ku, ku, ABj, ldabf,
+                           &ipiv[ s ], &S[ s ], lds );
+        }
+
+        // W_j = A_j^{-1} [ C_j; 0 ], with C_j upper triangular in the
+        // first kl rows, coupling to the last kl columns of partition j-1.
+        if (j > 0 && kl > 0) {
+            for (int64_t c = 0; c < kl; ++c) {
+                for (int64_t r = 0; r <= c; ++r) {
+                    int64_t i  = s + r;            // global row
+                    int64_t jc = s - kl + c;       // global col
+                    S[ i + (ku + c)*lds ] = AB[ ku + i - jc + jc*ldab ];
+                }
+            }
+            lapack::gbtrs( Op::NoTrans, nj, kl, ku, kl, ABj, ldabf,
+                           &ipiv[ s ], &S[ s + ku*lds ], lds );
+        }
+    }
+
+    return internal::spike_reduced_solve(
+        n, kl, ku, nrhs, nparts, &offsets[ 0 ], &S[ 0 ], lds, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t gbsv_spike< float >(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float const* AB, int64_t ldab,
+    float* B, int64_t ldb,
+    int64_t nparts );
+
+template
+int64_t gbsv_spike< double >(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double const* AB, int64_t ldab,
+    double* B, int64_t ldb,
+    int64_t nparts );
+
+template
+int64_t gbsv_spike< std::complex<float> >(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float> const* AB, int64_t ldab,
+    std::complex<float>* B, int64_t ldb,
+    int64_t nparts );
+
+template
+int64_t gbsv_spike< std::complex<double> >(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double> const* AB, int64_t ldab,
+    std::complex<double>* B, int64_t ldb,
+    int64_t nparts );
+
+}  // namespace lapack
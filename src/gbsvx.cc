@@ -32,6 +32,9 @@ int64_t gbsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "gbsvx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     char equed_ = to_char( *equed );
@@ -97,6 +100,9 @@ int64_t gbsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "gbsvx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     char equed_ = to_char( *equed );
@@ -162,6 +168,9 @@ int64_t gbsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "gbsvx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     char equed_ = to_char( *equed );
@@ -448,6 +457,9 @@ int64_t gbsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "gbsvx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     char equed_ = to_char( *equed );
@@ -23,6 +23,9 @@ int64_t gbtrf(
     float* AB, int64_t ldab,
     int64_t* ipiv )
 {
+    lapack_instrument( "gbtrf", 's', m, n, 0,
+                       Gflop< float >::gbtrf( m, n, kl, ku ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -57,6 +60,9 @@ int64_t gbtrf(
     double* AB, int64_t ldab,
     int64_t* ipiv )
 {
+    lapack_instrument( "gbtrf", 'd', m, n, 0,
+                       Gflop< double >::gbtrf( m, n, kl, ku ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -91,6 +97,9 @@ int64_t gbtrf(
     std::complex<float>* AB, int64_t ldab,
     int64_t* ipiv )
 {
+    lapack_instrument( "gbtrf", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::gbtrf( m, n, kl, ku ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -193,6 +202,9 @@ int64_t gbtrf(
     std::complex<double>* AB, int64_t ldab,
     int64_t* ipiv )
 {
+    lapack_instrument( "gbtrf", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::gbtrf( m, n, kl, ku ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
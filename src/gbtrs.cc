@@ -24,6 +24,9 @@ int64_t gbtrs(
     int64_t const* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "gbtrs", 's', 0, n, nrhs,
+                       Gflop< float >::gbtrs( n, kl, ku, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -60,6 +63,9 @@ int64_t gbtrs(
     int64_t const* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "gbtrs", 'd', 0, n, nrhs,
+                       Gflop< double >::gbtrs( n, kl, ku, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -96,6 +102,9 @@ int64_t gbtrs(
     int64_t const* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "gbtrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::gbtrs( n, kl, ku, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -194,6 +203,10 @@ int64_t gbtrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "gbtrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::gbtrs( n, kl, ku,
+                                                             nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
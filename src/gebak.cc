@@ -22,6 +22,9 @@ int64_t gebak(
     float const* scale, int64_t m,
     float* V, int64_t ldv )
 {
+    lapack_instrument( "gebak", 's', m, n, 0,
+                       Gflop< float >::gebak( balance, m, ilo, ihi ) );
+
     char balance_ = to_char( balance );
     char side_ = to_char( side );
     lapack_int n_ = to_lapack_int( n );
@@ -49,6 +52,9 @@ int64_t gebak(
     double const* scale, int64_t m,
     double* V, int64_t ldv )
 {
+    lapack_instrument( "gebak", 'd', m, n, 0,
+                       Gflop< double >::gebak( balance, m, ilo, ihi ) );
+
     char balance_ = to_char( balance );
     char side_ = to_char( side );
     lapack_int n_ = to_lapack_int( n );
@@ -76,6 +82,10 @@ int64_t gebak(
     float const* scale, int64_t m,
     std::complex<float>* V, int64_t ldv )
 {
+    lapack_instrument( "gebak", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::gebak( balance, m, ilo,
+                                                            ihi ) );
+
     char balance_ = to_char( balance );
     char side_ = to_char( side );
     lapack_int n_ = to_lapack_int( n );
@@ -152,6 +162,10 @@ int64_t gebak(
     double const* scale, int64_t m,
     std::complex<double>* V, int64_t ldv )
 {
+    lapack_instrument( "gebak", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::gebak( balance, m, ilo,
+                                                             ihi ) );
+
     char balance_ = to_char( balance );
     char side_ = to_char( side );
     lapack_int n_ = to_lapack_int( n );
@@ -24,6 +24,8 @@ int64_t gebal(
     int64_t* ihi,
     float* scale )
 {
+    lapack_instrument( "gebal", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char balance_ = to_char( balance );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -53,6 +55,8 @@ int64_t gebal(
     int64_t* ihi,
     double* scale )
 {
+    lapack_instrument( "gebal", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char balance_ = to_char( balance );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -82,6 +86,8 @@ int64_t gebal(
     int64_t* ihi,
     float* scale )
 {
+    lapack_instrument( "gebal", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char balance_ = to_char( balance );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -200,6 +206,8 @@ int64_t gebal(
     int64_t* ihi,
     double* scale )
 {
+    lapack_instrument( "gebal", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char balance_ = to_char( balance );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -26,6 +26,8 @@ int64_t gebrd(
     float* tauq,
     float* taup )
 {
+    lapack_instrument( "gebrd", 's', m, n, 0, Gflop< float >::gebrd( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -74,6 +76,8 @@ int64_t gebrd(
     double* tauq,
     double* taup )
 {
+    lapack_instrument( "gebrd", 'd', m, n, 0, Gflop< double >::gebrd( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -122,6 +126,9 @@ int64_t gebrd(
     std::complex<float>* tauq,
     std::complex<float>* taup )
 {
+    lapack_instrument( "gebrd", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::gebrd( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -298,6 +305,9 @@ int64_t gebrd(
     std::complex<double>* tauq,
     std::complex<double>* taup )
 {
+    lapack_instrument( "gebrd", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::gebrd( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -23,6 +23,8 @@ int64_t gecon(
     float const* A, int64_t lda, float anorm,
     float* rcond )
 {
+    lapack_instrument( "gecon", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -51,6 +53,8 @@ int64_t gecon(
     double const* A, int64_t lda, double anorm,
     double* rcond )
 {
+    lapack_instrument( "gecon", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -79,6 +83,8 @@ int64_t gecon(
     std::complex<float> const* A, int64_t lda, float anorm,
     float* rcond )
 {
+    lapack_instrument( "gecon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -145,6 +151,8 @@ int64_t gecon(
     std::complex<double> const* A, int64_t lda, double anorm,
     double* rcond )
 {
+    lapack_instrument( "gecon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -26,6 +26,8 @@ int64_t geequ(
     float* colcnd,
     float* amax )
 {
+    lapack_instrument( "geequ", 's', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -53,6 +55,8 @@ int64_t geequ(
     double* colcnd,
     double* amax )
 {
+    lapack_instrument( "geequ", 'd', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -80,6 +84,8 @@ int64_t geequ(
     float* colcnd,
     float* amax )
 {
+    lapack_instrument( "geequ", 'c', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -164,6 +170,8 @@ int64_t geequ(
     double* colcnd,
     double* amax )
 {
+    lapack_instrument( "geequ", 'z', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -24,6 +24,8 @@ int64_t gees(
     std::complex<float>* W,
     float* VS, int64_t ldvs )
 {
+    lapack_instrument( "gees", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     lapack_int n_ = to_lapack_int( n );
@@ -88,6 +90,8 @@ int64_t gees(
     std::complex<double>* W,
     double* VS, int64_t ldvs )
 {
+    lapack_instrument( "gees", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     lapack_int n_ = to_lapack_int( n );
@@ -152,6 +156,8 @@ int64_t gees(
     std::complex<float>* W,
     std::complex<float>* VS, int64_t ldvs )
 {
+    lapack_instrument( "gees", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     lapack_int n_ = to_lapack_int( n );
@@ -210,6 +216,8 @@ int64_t gees(
     std::complex<double>* W,
     std::complex<double>* VS, int64_t ldvs )
 {
+    lapack_instrument( "gees", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     lapack_int n_ = to_lapack_int( n );
@@ -26,6 +26,8 @@ int64_t geesx(
     float* rconde,
     float* rcondv )
 {
+    lapack_instrument( "geesx", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     char sense_ = to_char( sense );
@@ -98,6 +100,8 @@ int64_t geesx(
     double* rconde,
     double* rcondv )
 {
+    lapack_instrument( "geesx", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     char sense_ = to_char( sense );
@@ -170,6 +174,8 @@ int64_t geesx(
     float* rconde,
     float* rcondv )
 {
+    lapack_instrument( "geesx", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     char sense_ = to_char( sense );
@@ -231,6 +237,8 @@ int64_t geesx(
     double* rconde,
     double* rcondv )
 {
+    lapack_instrument( "geesx", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     char sense_ = to_char( sense );
@@ -25,6 +25,8 @@ int64_t geev(
     float* VL, int64_t ldvl,
     float* VR, int64_t ldvr )
 {
+    lapack_instrument( "geev", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -83,6 +85,8 @@ int64_t geev(
     double* VL, int64_t ldvl,
     double* VR, int64_t ldvr )
 {
+    lapack_instrument( "geev", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -141,6 +145,8 @@ int64_t geev(
     std::complex<float>* VL, int64_t ldvl,
     std::complex<float>* VR, int64_t ldvr )
 {
+    lapack_instrument( "geev", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -295,6 +301,8 @@ int64_t geev(
     std::complex<double>* VL, int64_t ldvl,
     std::complex<double>* VR, int64_t ldvr )
 {
+    lapack_instrument( "geev", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -23,6 +23,8 @@ int64_t gehrd(
     float* A, int64_t lda,
     float* tau )
 {
+    lapack_instrument( "gehrd", 's', 0, n, 0, Gflop< float >::gehrd( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
@@ -63,6 +65,8 @@ int64_t gehrd(
     double* A, int64_t lda,
     double* tau )
 {
+    lapack_instrument( "gehrd", 'd', 0, n, 0, Gflop< double >::gehrd( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
@@ -103,6 +107,9 @@ int64_t gehrd(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    lapack_instrument( "gehrd", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::gehrd( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
@@ -220,6 +227,9 @@ int64_t gehrd(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    lapack_instrument( "gehrd", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::gehrd( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
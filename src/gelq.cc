@@ -24,6 +24,8 @@ int64_t gelq(
     float* A, int64_t lda,
     float* T, int64_t tsize )
 {
+    lapack_instrument( "gelq", 's', m, n, 0, Gflop< float >::gelqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -63,6 +65,8 @@ int64_t gelq(
     double* A, int64_t lda,
     double* T, int64_t tsize )
 {
+    lapack_instrument( "gelq", 'd', m, n, 0, Gflop< double >::gelqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -102,6 +106,9 @@ int64_t gelq(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* T, int64_t tsize )
 {
+    lapack_instrument( "gelq", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::gelqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -141,6 +148,9 @@ int64_t gelq(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* T, int64_t tsize )
 {
+    lapack_instrument( "gelq", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::gelqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
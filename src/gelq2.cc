@@ -23,6 +23,8 @@ int64_t gelq2(
     float* A, int64_t lda,
     float* tau )
 {
+    lapack_instrument( "gelq2", 's', m, n, 0, Gflop< float >::gelqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -49,6 +51,8 @@ int64_t gelq2(
     double* A, int64_t lda,
     double* tau )
 {
+    lapack_instrument( "gelq2", 'd', m, n, 0, Gflop< double >::gelqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -75,6 +79,9 @@ int64_t gelq2(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    lapack_instrument( "gelq2", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::gelqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -150,6 +157,9 @@ int64_t gelq2(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    lapack_instrument( "gelq2", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::gelqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
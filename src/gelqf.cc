@@ -23,6 +23,8 @@ int64_t gelqf(
     float* A, int64_t lda,
     float* tau )
 {
+    lapack_instrument( "gelqf", 's', m, n, 0, Gflop< float >::gelqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -62,6 +64,8 @@ int64_t gelqf(
     double* A, int64_t lda,
     double* tau )
 {
+    lapack_instrument( "gelqf", 'd', m, n, 0, Gflop< double >::gelqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -101,6 +105,9 @@ int64_t gelqf(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    lapack_instrument( "gelqf", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::gelqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -189,6 +196,9 @@ int64_t gelqf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    lapack_instrument( "gelqf", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::gelqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
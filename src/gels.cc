@@ -23,6 +23,9 @@ int64_t gels(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "gels", 's', m, n, nrhs,
+                       Gflop< float >::gels( m, n, nrhs ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -71,6 +74,9 @@ int64_t gels(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "gels", 'd', m, n, nrhs,
+                       Gflop< double >::gels( m, n, nrhs ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -119,6 +125,9 @@ int64_t gels(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "gels", 'c', m, n, nrhs,
+                       Gflop< std::complex<float> >::gels( m, n, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -253,6 +262,9 @@ int64_t gels(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "gels", 'z', m, n, nrhs,
+                       Gflop< std::complex<double> >::gels( m, n, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
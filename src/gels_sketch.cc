@@ -0,0 +1,389 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+
+// Rows of the sketch, as a multiple of n (Blendenpik uses 4).
+static const int64_t gels_sketch_oversample = 4;
+
+// Nonzeros per column of the sparse sign embedding.
+static const int64_t gels_sketch_nnz = 8;
+
+// Rows of A hashed at a time when forming the sketch.
+static const int64_t gels_sketch_rows = 1024;
+
+// Seed of the embedding's hash.
+static const uint64_t gels_sketch_seed = 0x9e3779b97f4a7c15ull;
+
+//------------------------------------------------------------------------------
+static double gels_sketch_wtime()
+{
+    using namespace std::chrono;
+    return duration< double >( steady_clock::now().time_since_epoch() ).count();
+}
+
+//------------------------------------------------------------------------------
+// splitmix64 hash, used to generate the embedding on the fly, so each thread
+// generates the same embedding without storing it.
+static inline uint64_t gels_sketch_hash( uint64_t x )
+{
+    x += gels_sketch_seed;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+//------------------------------------------------------------------------------
+// Computes the d-by-ncols sketch Y = S X of the m-by-ncols matrix X, where
+// the d-by-m sparse sign embedding S has s nonzeros +-1/sqrt(s) per column,
+// in rows chosen by hashing. Columns of X are split among threads.
+template <typename scalar_t>
+static void sparse_sign_sketch(
+    int64_t m, int64_t ncols, int64_t d, int64_t s,
+    scalar_t const* X, int64_t ldx,
+    scalar_t* Y, int64_t ldy )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const real_t scale = 1 / std::sqrt( real_t( s ) );
+
+    #pragma omp parallel
+    {
+        int64_t nthreads = 1, tid = 0;
+        #ifdef _OPENMP
+            nthreads = omp_get_num_threads();
+            tid = omp_get_thread_num();
+        #endif
+        int64_t chunk = (ncols + nthreads - 1) / nthreads;
+        int64_t j0 = tid * chunk;
+        int64_t j1 = min( ncols, j0 + chunk );
+
+        std::vector< int64_t > row( gels_sketch_rows * s );
+        std::vector< real_t > sign( gels_sketch_rows * s );
+        for (int64_t j = j0; j < j1; ++j)
+            std::fill_n( &Y[ j*ldy ], d, scalar_t( 0 ) );
+
+        for (int64_t i0 = 0; i0 < m && j0 < j1; i0 += gels_sketch_rows) {
+            int64_t ib = min( gels_sketch_rows, m - i0 );
+            for (int64_t k = 0; k < ib*s; ++k) {
+                uint64_t h = gels_sketch_hash( uint64_t( i0*s + k ) );
+                row[ k ] = int64_t( (h >> 1) % uint64_t( d ) );
+                sign[ k ] = (h & 1) ? scale : -scale;
+            }
+            for (int64_t j = j0; j < j1; ++j) {
+                scalar_t const* Xj = &X[ j*ldx ];
+                scalar_t* Yj = &Y[ j*ldy ];
+                for (int64_t i = 0; i < ib; ++i) {
+                    scalar_t xij = Xj[ i0 + i ];
+                    for (int64_t k = i*s; k < (i + 1)*s; ++k)
+                        Yj[ row[ k ] ] += sign[ k ] * xij;
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Solves the overdetermined least squares problem
+/// \[
+///     \min || A X - B ||_2,
+/// \]
+/// with A an m-by-n matrix of full rank, m >= n, using a randomized
+/// sketch-and-precondition method (Blendenpik, LSRN). For m >> n, this is
+/// several times faster than `lapack::gels`, which costs $2 m n^2$ flops.
+///
+/// 1. The d-by-n sketch S A is formed with a sparse sign embedding S,
+///    which has 8 random nonzeros $\pm 1/\sqrt{8}$ per column, d = 4 n.
+///    This costs $O(m n)$, reading A once.
+/// 2. The sketch is factored S A = Q R with `lapack::geqrf`. Then A R^{-1}
+///    is well conditioned, independent of the conditioning of A.
+/// 3. Starting from the sketch-and-solve estimate $R^{-1} Q^H S b$, LSQR
+///    solves the problem preconditioned by R for each right-hand side,
+///    converging in a few dozen iterations of gemv on A.
+///
+/// If m <= d, the sketch is skipped and R is from the QR of A.
+/// The embedding is deterministic: the same A and B give the same X.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= n.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of
+///     columns of the matrices B and X. nrhs >= 0.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     A is not modified.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[in,out] B
+///     The m-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On entry, the right hand side vectors.
+///     On successful exit, rows 1 to n of B contain the least squares
+///     solution vectors; rows n+1 to m are destroyed.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,m).
+///
+/// @param[in] tol
+///     The relative tolerance of LSQR: iterations stop when
+///     $|| (A R^{-1})^H r || \le tol \, || A R^{-1} || \, || r ||$,
+///     or $|| r || \le tol \, || b ||$.
+///     If tol <= 0, machine epsilon is used.
+///
+/// @param[in] maxiter
+///     The maximum number of LSQR iterations per right-hand side.
+///     maxiter >= 0.
+///
+/// @param[out] stats
+///     If not null, returns the sketch size, iterations, convergence,
+///     and time of each phase.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the i-th diagonal element of R is
+///     zero, so A does not have full rank; the solution is not computed.
+///
+/// @ingroup gels
+template <typename scalar_t>
+int64_t gels_sketch(
+    int64_t m, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    blas::real_type< scalar_t > tol, int64_t maxiter,
+    SketchStats* stats )
+{
+    // The number of iterations, hence the Gflop count, depends on the data;
+    // the count is set at the end.
+    lapack_instrument( "gels_sketch", internal::precision_char< scalar_t >(),
+                       m, n, nrhs, internal::gflop_data_dependent );
+
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    using G = Gflop< scalar_t >;
+    const scalar_t one = 1, zero = 0;
+
+    // check arguments
+    lapack_error_if( n < 0 );
+    lapack_error_if( m < n );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldb < max( 1, m ) );
+    lapack_error_if( maxiter < 0 );
+
+    SketchStats stats_;
+    double time = gels_sketch_wtime();
+
+    if (tol <= 0)
+        tol = std::numeric_limits< real_t >::epsilon();
+
+    if (n == 0 || nrhs == 0) {
+        if (stats)
+            *stats = stats_;
+        return 0;
+    }
+
+    // ---------- sketch [ S A, S B ]
+    double gflop = 0;
+    int64_t d = gels_sketch_oversample * n;
+    std::vector< scalar_t > SA, SB;
+    if (m <= d) {
+        d = m;
+        SA.resize( d * n );
+        SB.resize( d * nrhs );
+        lapack::lacpy( MatrixType::General, m, n, A, lda, SA.data(), d );
+        lapack::lacpy( MatrixType::General, m, nrhs, B, ldb, SB.data(), d );
+    }
+    else {
+        int64_t s = min( gels_sketch_nnz, d );
+        SA.resize( d * n );
+        SB.resize( d * nrhs );
+        sparse_sign_sketch( m, n,    d, s, A, lda, SA.data(), d );
+        sparse_sign_sketch( m, nrhs, d, s, B, ldb, SB.data(), d );
+        // each row of [ A, B ] is scaled and added to s rows of the sketch
+        gflop += G::gemm( m, n + nrhs, s );
+    }
+    stats_.sketch_rows = d;
+    double t = gels_sketch_wtime();
+    stats_.time_sketch = t - time;
+
+    // ---------- S A = Q R
+    std::vector< scalar_t > tau( n );
+    lapack::geqrf( d, n, SA.data(), d, tau.data() );
+    gflop += G::geqrf( d, n );
+    scalar_t const* R = SA.data();
+    for (int64_t i = 0; i < n; ++i) {
+        if (R[ i + i*d ] == zero) {
+            lapack_instrument_gflop( gflop );
+            stats_.time_qr = gels_sketch_wtime() - t;
+            stats_.time = gels_sketch_wtime() - time;
+            if (stats)
+                *stats = stats_;
+            return i + 1;
+        }
+    }
+    // X0 = R^{-1} Q^H S B, the sketch-and-solve estimate.
+    lapack::unmqr( Side::Left, Op::ConjTrans, d, nrhs, n, SA.data(), d,
+                   tau.data(), SB.data(), d );
+    blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper, Op::NoTrans,
+                Diag::NonUnit, n, nrhs, one, R, d, SB.data(), d );
+    gflop += G::unmqr( Side::Left, d, nrhs, n )
+           + G::trsm( Side::Left, n, nrhs );
+    double t2 = gels_sketch_wtime();
+    stats_.time_qr = t2 - t;
+
+    // ---------- LSQR on min || A R^{-1} y - r0 ||, with r0 = b - A x0,
+    // then x = x0 + R^{-1} y.
+    std::vector< scalar_t > u( m ), v( n ), w( n ), y( n ), tmp( n );
+    for (int64_t j = 0; j < nrhs; ++j) {
+        scalar_t* b  = &B[ j*ldb ];
+        scalar_t* x0 = &SB[ j*d ];
+        real_t bnorm = blas::nrm2( m, b, 1 );
+
+        // u = b - A x0
+        blas::copy( m, b, 1, u.data(), 1 );
+        blas::gemv( Layout::ColMajor, Op::NoTrans, m, n,
+                    -one, A, lda, x0, 1, one, u.data(), 1 );
+
+        // beta u = r0, alpha v = R^{-H} A^H u
+        real_t beta = blas::nrm2( m, u.data(), 1 );
+        real_t alpha = 0;
+        std::fill( y.begin(), y.end(), zero );
+        if (beta > 0) {
+            blas::scal( m, one / beta, u.data(), 1 );
+            blas::gemv( Layout::ColMajor, Op::ConjTrans, m, n,
+                        one, A, lda, u.data(), 1, zero, v.data(), 1 );
+            blas::trsv( Layout::ColMajor, Uplo::Upper, Op::ConjTrans,
+                        Diag::NonUnit, n, R, d, v.data(), 1 );
+            alpha = blas::nrm2( n, v.data(), 1 );
+        }
+        if (alpha > 0)
+            blas::scal( n, one / alpha, v.data(), 1 );
+        w = v;
+
+        real_t phibar = beta, rhobar = alpha;
+        real_t Mnorm2 = 0;  // estimate of || A R^{-1} ||_F^2
+        int64_t iter = 0;
+        bool done = (beta <= tol * bnorm || alpha == 0);
+        while (! done && iter < maxiter) {
+            ++iter;
+
+            // beta u = A R^{-1} v - alpha u
+            blas::copy( n, v.data(), 1, tmp.data(), 1 );
+            blas::trsv( Layout::ColMajor, Uplo::Upper, Op::NoTrans,
+                        Diag::NonUnit, n, R, d, tmp.data(), 1 );
+            blas::gemv( Layout::ColMajor, Op::NoTrans, m, n,
+                        one, A, lda, tmp.data(), 1, scalar_t( -alpha ), u.data(), 1 );
+            beta = blas::nrm2( m, u.data(), 1 );
+            if (beta > 0)
+                blas::scal( m, one / beta, u.data(), 1 );
+            Mnorm2 += alpha*alpha + beta*beta;
+
+            // alpha v = R^{-H} A^H u - beta v
+            blas::gemv( Layout::ColMajor, Op::ConjTrans, m, n,
+                        one, A, lda, u.data(), 1, zero, tmp.data(), 1 );
+            blas::trsv( Layout::ColMajor, Uplo::Upper, Op::ConjTrans,
+                        Diag::NonUnit, n, R, d, tmp.data(), 1 );
+            blas::axpy( n, scalar_t( -beta ), v.data(), 1, tmp.data(), 1 );
+            alpha = blas::nrm2( n, tmp.data(), 1 );
+            if (alpha > 0)
+                blas::scal( n, one / alpha, tmp.data(), 1 );
+            std::swap( v, tmp );
+
+            // Givens rotation to eliminate beta.
+            real_t rho = std::hypot( rhobar, beta );
+            real_t c = rhobar / rho;
+            real_t s = beta / rho;
+            real_t theta = s * alpha;
+            rhobar = -c * alpha;
+            real_t phi = c * phibar;
+            phibar = s * phibar;
+
+            // y += (phi/rho) w, w = v - (theta/rho) w
+            blas::axpy( n, scalar_t( phi / rho ), w.data(), 1, y.data(), 1 );
+            blas::scal( n, scalar_t( -theta / rho ), w.data(), 1 );
+            blas::axpy( n, one, v.data(), 1, w.data(), 1 );
+
+            // || r || = phibar, || M^H r || = phibar alpha |c|.
+            done = (phibar <= tol * bnorm)
+                   || (alpha * std::abs( c ) <= tol * std::sqrt( Mnorm2 ))
+                   || alpha == 0;
+        }
+        stats_.iters = max( stats_.iters, iter );
+        // setup and final solve, then per iteration, 2 products with A
+        // and 2 solves with R, ignoring O(m + n) terms
+        gflop += (iter + 1)*(2*G::gemv( m, n ) + 2*G::trsv( n ));
+        if (! done)
+            stats_.converged = false;
+
+        // x = x0 + R^{-1} y
+        blas::trsv( Layout::ColMajor, Uplo::Upper, Op::NoTrans,
+                    Diag::NonUnit, n, R, d, y.data(), 1 );
+        blas::axpy( n, one, y.data(), 1, x0, 1 );
+        blas::copy( n, x0, 1, b, 1 );
+    }
+    stats_.time_solve = gels_sketch_wtime() - t2;
+    stats_.time = gels_sketch_wtime() - time;
+    if (stats)
+        *stats = stats_;
+    lapack_instrument_gflop( gflop );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t gels_sketch< float >(
+    int64_t m, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb,
+    float tol, int64_t maxiter,
+    SketchStats* stats );
+
+template
+int64_t gels_sketch< double >(
+    int64_t m, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb,
+    double tol, int64_t maxiter,
+    SketchStats* stats );
+
+template
+int64_t gels_sketch< std::complex<float> >(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float tol, int64_t maxiter,
+    SketchStats* stats );
+
+template
+int64_t gels_sketch< std::complex<double> >(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double tol, int64_t maxiter,
+    SketchStats* stats );
+
+}  // namespace lapack
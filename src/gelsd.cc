@@ -25,6 +25,9 @@ int64_t gelsd(
     float* S, float rcond,
     int64_t* rank )
 {
+    lapack_instrument( "gelsd", 's', m, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -77,6 +80,9 @@ int64_t gelsd(
     double* S, double rcond,
     int64_t* rank )
 {
+    lapack_instrument( "gelsd", 'd', m, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -129,6 +135,9 @@ int64_t gelsd(
     float* S, float rcond,
     int64_t* rank )
 {
+    lapack_instrument( "gelsd", 'c', m, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -267,6 +276,9 @@ int64_t gelsd(
     double* S, double rcond,
     int64_t* rank )
 {
+    lapack_instrument( "gelsd", 'z', m, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -25,6 +25,9 @@ int64_t gelss(
     float* S, float rcond,
     int64_t* rank )
 {
+    lapack_instrument( "gelss", 's', m, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -72,6 +75,9 @@ int64_t gelss(
     double* S, double rcond,
     int64_t* rank )
 {
+    lapack_instrument( "gelss", 'd', m, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -119,6 +125,9 @@ int64_t gelss(
     float* S, float rcond,
     int64_t* rank )
 {
+    lapack_instrument( "gelss", 'c', m, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -237,6 +246,9 @@ int64_t gelss(
     double* S, double rcond,
     int64_t* rank )
 {
+    lapack_instrument( "gelss", 'z', m, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -25,6 +25,9 @@ int64_t gelsy(
     int64_t* jpvt, float rcond,
     int64_t* rank )
 {
+    lapack_instrument( "gelsy", 's', m, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -82,6 +85,9 @@ int64_t gelsy(
     int64_t* jpvt, double rcond,
     int64_t* rank )
 {
+    lapack_instrument( "gelsy", 'd', m, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -139,6 +145,9 @@ int64_t gelsy(
     int64_t* jpvt, float rcond,
     int64_t* rank )
 {
+    lapack_instrument( "gelsy", 'c', m, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -299,6 +308,9 @@ int64_t gelsy(
     int64_t* jpvt, double rcond,
     int64_t* rank )
 {
+    lapack_instrument( "gelsy", 'z', m, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
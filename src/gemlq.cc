@@ -25,6 +25,9 @@ int64_t gemlq(
     float const* T, int64_t tsize,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "gemlq", 's', m, n, k,
+                       Gflop< float >::unmlq( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -73,6 +76,9 @@ int64_t gemlq(
     double const* T, int64_t tsize,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "gemlq", 'd', m, n, k,
+                       Gflop< double >::unmlq( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -121,6 +127,9 @@ int64_t gemlq(
     std::complex<float> const* T, int64_t tsize,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "gemlq", 'c', m, n, k,
+                       Gflop< std::complex<float> >::unmlq( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -169,6 +178,9 @@ int64_t gemlq(
     std::complex<double> const* T, int64_t tsize,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "gemlq", 'z', m, n, k,
+                       Gflop< std::complex<double> >::unmlq( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -25,6 +25,9 @@ int64_t gemqr(
     float const* T, int64_t tsize,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "gemqr", 's', m, n, k,
+                       Gflop< float >::unmqr( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -73,6 +76,9 @@ int64_t gemqr(
     double const* T, int64_t tsize,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "gemqr", 'd', m, n, k,
+                       Gflop< double >::unmqr( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -121,6 +127,9 @@ int64_t gemqr(
     std::complex<float> const* T, int64_t tsize,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "gemqr", 'c', m, n, k,
+                       Gflop< std::complex<float> >::unmqr( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -169,6 +178,9 @@ int64_t gemqr(
     std::complex<double> const* T, int64_t tsize,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "gemqr", 'z', m, n, k,
+                       Gflop< std::complex<double> >::unmqr( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
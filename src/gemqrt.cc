@@ -25,6 +25,9 @@ int64_t gemqrt(
     float const* T, int64_t ldt,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "gemqrt", 's', m, n, k,
+                       Gflop< float >::unmqr( side, m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -67,6 +70,9 @@ int64_t gemqrt(
     double const* T, int64_t ldt,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "gemqrt", 'd', m, n, k,
+                       Gflop< double >::unmqr( side, m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -109,6 +115,9 @@ int64_t gemqrt(
     std::complex<float> const* T, int64_t ldt,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "gemqrt", 'c', m, n, k,
+                       Gflop< std::complex<float> >::unmqr( side, m, n, k ) );
+
     // for complex, map Trans to ConjTrans
     if (trans == Op::Trans)
         trans = Op::ConjTrans;
@@ -226,6 +235,9 @@ int64_t gemqrt(
     std::complex<double> const* T, int64_t ldt,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "gemqrt", 'z', m, n, k,
+                       Gflop< std::complex<double> >::unmqr( side, m, n, k ) );
+
     // for complex, map Trans to ConjTrans
     if (trans == Op::Trans)
         trans = Op::ConjTrans;
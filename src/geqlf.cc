@@ -23,6 +23,8 @@ int64_t geqlf(
     float* A, int64_t lda,
     float* tau )
 {
+    lapack_instrument( "geqlf", 's', m, n, 0, Gflop< float >::geqlf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -62,6 +64,8 @@ int64_t geqlf(
     double* A, int64_t lda,
     double* tau )
 {
+    lapack_instrument( "geqlf", 'd', m, n, 0, Gflop< double >::geqlf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -101,6 +105,9 @@ int64_t geqlf(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    lapack_instrument( "geqlf", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::geqlf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -194,6 +201,9 @@ int64_t geqlf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    lapack_instrument( "geqlf", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::geqlf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
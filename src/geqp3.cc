@@ -23,6 +23,8 @@ int64_t geqp3(
     int64_t* jpvt,
     float* tau )
 {
+    lapack_instrument( "geqp3", 's', m, n, 0, Gflop< float >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -74,6 +76,8 @@ int64_t geqp3(
     int64_t* jpvt,
     double* tau )
 {
+    lapack_instrument( "geqp3", 'd', m, n, 0, Gflop< double >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -125,6 +129,9 @@ int64_t geqp3(
     int64_t* jpvt,
     std::complex<float>* tau )
 {
+    lapack_instrument( "geqp3", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -180,6 +187,9 @@ int64_t geqp3(
     int64_t* jpvt,
     std::complex<double>* tau )
 {
+    lapack_instrument( "geqp3", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
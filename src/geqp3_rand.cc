@@ -0,0 +1,393 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <vector>
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+// Block size: number of pivots chosen from each sketch.
+static const int64_t geqp3_rand_nb = 64;
+
+// Oversampling: the sketch has nb + p rows.
+static const int64_t geqp3_rand_p = 8;
+
+//------------------------------------------------------------------------------
+// Permutes columns of the m-by-ncols matrix A, the ns-by-ncols matrix Y,
+// and perm so the columns listed in cols (1-based, length nsel) come first,
+// in that order, using swaps.
+template <typename scalar_t>
+static void geqp3_rand_select(
+    int64_t m, int64_t ncols, int64_t nsel, int64_t const* cols,
+    scalar_t* A, int64_t lda,
+    int64_t ns, scalar_t* Y, int64_t* perm )
+{
+    // where[ c ] is the current position of the original column c;
+    // at[ i ] is the original column at position i.
+    std::vector< int64_t > where( ncols ), at( ncols );
+    for (int64_t i = 0; i < ncols; ++i) {
+        where[ i ] = i;
+        at[ i ] = i;
+    }
+    for (int64_t i = 0; i < nsel; ++i) {
+        int64_t p = where[ cols[ i ] - 1 ];
+        if (p != i) {
+            blas::swap( m,  &A[ i*lda ], 1, &A[ p*lda ], 1 );
+            blas::swap( ns, &Y[ i*ns  ], 1, &Y[ p*ns  ], 1 );
+            std::swap( perm[ i ], perm[ p ] );
+            std::swap( at[ i ], at[ p ] );
+            where[ at[ i ] ] = i;
+            where[ at[ p ] ] = p;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Gflop count of geqp3_rand_work: factoring kmax columns, updating the rest,
+// and forming the sketch; updating the sketch and factoring it are
+// lower order.
+template <typename scalar_t>
+static double geqp3_rand_gflop( int64_t m, int64_t n, int64_t kmax )
+{
+    using G = Gflop< scalar_t >;
+    int64_t ns = geqp3_rand_nb + geqp3_rand_p;
+    return G::geqrf( m, kmax ) + G::unmqr( Side::Left, m, n - kmax, kmax )
+           + G::gemm( ns, n, m );
+}
+
+//------------------------------------------------------------------------------
+// Randomized blocked QR with column pivoting (HQRRP) of the first kmax
+// columns; see geqp3_rand. Columns kmax+1 to n are updated, but not
+// factored. jpvt has geqp3 semantics on input and output.
+template <typename scalar_t>
+static void geqp3_rand_work(
+    int64_t m, int64_t n, int64_t kmax,
+    scalar_t* A, int64_t lda,
+    int64_t* jpvt,
+    scalar_t* tau )
+{
+    using blas::Layout;
+    const scalar_t one = 1;
+    const int64_t minmn = min( m, n );
+    kmax = min( kmax, minmn );
+
+    // Move fixed columns to the front, as geqp3 does.
+    std::vector< int64_t > perm( n );
+    for (int64_t j = 0; j < n; ++j)
+        perm[ j ] = j;
+    int64_t nfix = 0;
+    for (int64_t j = 0; j < n; ++j) {
+        if (jpvt[ j ] != 0) {
+            if (j != nfix) {
+                blas::swap( m, &A[ j*lda ], 1, &A[ nfix*lda ], 1 );
+                std::swap( perm[ j ], perm[ nfix ] );
+            }
+            ++nfix;
+        }
+    }
+
+    // Factor fixed columns without pivoting.
+    int64_t j0 = min( nfix, minmn );
+    if (j0 > 0) {
+        lapack::geqrf( m, j0, A, lda, tau );
+        if (j0 < n) {
+            lapack::unmqr( Side::Left, Op::ConjTrans, m, n - j0, j0,
+                           A, lda, tau, &A[ j0*lda ], lda );
+        }
+    }
+
+    if (j0 < kmax) {
+        // Sketch Y = G A( j0:m, j0:n ), with G an ns-by-(m - j0) Gaussian.
+        const int64_t nb = geqp3_rand_nb;
+        const int64_t ns = nb + geqp3_rand_p;
+        int64_t mt = m - j0;
+        int64_t nt = n - j0;
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        std::vector< scalar_t > G( ns * mt ), Y( ns * nt ),
+                                Ys( ns * nt ), tau_s( ns ), tmp;
+        std::vector< int64_t > jpvt_s( nt ), jpvt_b( nb );
+        lapack::larnv( 3, iseed, G.size(), G.data() );
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                    ns, nt, mt, one, G.data(), ns, &A[ j0 + j0*lda ], lda,
+                    scalar_t( 0 ), Y.data(), ns );
+
+        for (int64_t j = j0; j < kmax; j += nb) {
+            int64_t jb = min( nb, kmax - j );
+            int64_t nr = n - j;      // remaining columns
+            scalar_t* Yj = &Y[ (j - j0)*ns ];
+            scalar_t* Gj = &G[ (j - j0)*ns ];
+
+            // Choose jb pivots from QRCP of the sketch of remaining columns.
+            if (nr > jb) {
+                lapack::lacpy( MatrixType::General, ns, nr, Yj, ns, Ys.data(), ns );
+                std::fill_n( jpvt_s.begin(), nr, 0 );
+                lapack::geqp3( ns, nr, Ys.data(), ns, jpvt_s.data(), tau_s.data() );
+                geqp3_rand_select( m, nr, jb, jpvt_s.data(), &A[ j*lda ], lda,
+                                   ns, Yj, &perm[ j ] );
+            }
+
+            // QRCP of the panel orders pivots within the block.
+            std::fill_n( jpvt_b.begin(), jb, 0 );
+            lapack::geqp3( m - j, jb, &A[ j + j*lda ], lda, jpvt_b.data(),
+                           &tau[ j ] );
+            // Apply the panel's permutation to rows 0:j of the panel.
+            tmp.resize( j*jb + jb );
+            lapack::lacpy( MatrixType::General, j, jb, &A[ j*lda ], lda,
+                           tmp.data(), max( 1, j ) );
+            std::vector< int64_t > perm_b( &perm[ j ], &perm[ j + jb ] );
+            for (int64_t i = 0; i < jb; ++i) {
+                int64_t c = jpvt_b[ i ] - 1;
+                blas::copy( j, &tmp[ c*j ], 1, &A[ (j + i)*lda ], 1 );
+                perm[ j + i ] = perm_b[ c ];
+            }
+
+            if (j + jb < n) {
+                // A( j:m, j+jb:n ) = Q^H A( j:m, j+jb:n )
+                lapack::unmqr( Side::Left, Op::ConjTrans, m - j, n - j - jb, jb,
+                               &A[ j + j*lda ], lda, &tau[ j ],
+                               &A[ j + (j + jb)*lda ], lda );
+
+                // Update the sketch to that of the trailing matrix:
+                // [ G1 G2 ] = G Q, then G2 A22 = Y2 - G1 R12.
+                if (j + jb < kmax) {
+                    lapack::unmqr( Side::Right, Op::NoTrans, ns, m - j, jb,
+                                   &A[ j + j*lda ], lda, &tau[ j ], Gj, ns );
+                    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                                ns, n - j - jb, jb,
+                                -one, Gj, ns, &A[ j + (j + jb)*lda ], lda,
+                                one, &Yj[ jb*ns ], ns );
+                }
+            }
+        }
+    }
+
+    for (int64_t j = 0; j < n; ++j)
+        jpvt[ j ] = perm[ j ] + 1;
+}
+
+//------------------------------------------------------------------------------
+/// Computes a QR factorization with column pivoting of an m-by-n matrix A:
+/// \[
+///     A P = Q R,
+/// \]
+/// using randomized blocked pivoting (HQRRP)
+/// [Martinsson, Quintana-Orti, Heavner, van de Geijn, 2017].
+/// The input and output are the same as `lapack::geqp3`, which it can
+/// replace.
+///
+/// geqp3 chooses one pivot at a time by the largest column norm, which
+/// requires downdating the norms after each column, so half of its
+/// operations are BLAS-2. Instead, geqp3_rand chooses a block of nb = 64
+/// pivots at a time from a QR with column pivoting of the small
+/// (nb + 8)-by-n sketch $Y = G A$, with G Gaussian. The block is factored
+/// with geqp3, which also orders the pivots within it, and the trailing
+/// matrix is updated with BLAS-3 `lapack::unmqr`. The sketch is updated
+/// without revisiting A. The cost is close to that of `lapack::geqrf`.
+///
+/// The pivots differ from geqp3's, but reveal the rank similarly well in
+/// practice. The random numbers are from `lapack::larnv` with a fixed seed,
+/// so results are reproducible.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the m-by-n matrix A.
+///     On exit, the upper triangle of the array contains the
+///     min(m,n)-by-n upper trapezoidal matrix R; the elements below
+///     the diagonal, together with the array tau, represent the
+///     unitary matrix Q as a product of min(m,n) elementary reflectors,
+///     as from geqp3.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[in,out] jpvt
+///     The vector jpvt of length n.
+///     On entry, if jpvt(j) != 0, the j-th column of A is permuted
+///     to the front of A*P (a leading column); if jpvt(j) = 0,
+///     the j-th column of A is a free column.
+///     On exit, if jpvt(j) = k, then the j-th column of A*P was
+///     the k-th column of A.
+///
+/// @param[out] tau
+///     The vector tau of length min(m,n).
+///     The scalar factors of the elementary reflectors.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqpf
+template <typename scalar_t>
+int64_t geqp3_rand(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* jpvt,
+    scalar_t* tau )
+{
+    lapack_instrument( "geqp3_rand", internal::precision_char< scalar_t >(),
+                       m, n, 0,
+                       geqp3_rand_gflop< scalar_t >( m, n, min( m, n ) ) );
+
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    geqp3_rand_work( m, n, min( m, n ), A, lda, jpvt, tau );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes a rank-k column interpolative decomposition (ID) of an m-by-n
+/// matrix A:
+/// \[
+///     A \approx C \, [ I, T ] P^T,
+/// \]
+/// where C = A(:, jpvt(1:k)) holds k columns of A, the skeleton, and T is
+/// k-by-(n-k), so that A(:, jpvt(k+1:n)) $\approx$ C T.
+///
+/// The skeleton is chosen by the first k steps of the randomized QR with
+/// column pivoting `lapack::geqp3_rand`, in $O(m n k)$ operations,
+/// and $T = R_{11}^{-1} R_{12}$.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The rank of the ID. 0 <= k <= min(m,n).
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the m-by-n matrix A.
+///     On exit, A is destroyed; rows 1:k contain [ R11, R12 ] of the
+///     partial pivoted QR factorization.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[in,out] jpvt
+///     The vector jpvt of length n.
+///     On entry, nonzero jpvt(j) marks a column to include in the skeleton,
+///     as in `lapack::geqp3`.
+///     On exit, jpvt(1:k) are the (1-based) indices of the skeleton columns,
+///     and jpvt(k+1:n) the indices of the remaining columns.
+///
+/// @param[out] T
+///     The k-by-(n-k) interpolation matrix T, stored in an ldt-by-(n-k) array.
+///
+/// @param[in] ldt
+///     The leading dimension of the array T. ldt >= max(1,k).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, R(i,i) is exactly zero, so A has rank
+///     less than k; T is not computed.
+///
+/// @ingroup geqpf
+template <typename scalar_t>
+int64_t interp_decomp(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    int64_t* jpvt,
+    scalar_t* T, int64_t ldt )
+{
+    lapack_instrument( "interp_decomp", internal::precision_char< scalar_t >(),
+                       m, n, k,
+                       geqp3_rand_gflop< scalar_t >( m, n, k )
+                       + Gflop< scalar_t >::trsm( Side::Left, k, n - k ) );
+
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 || k > min( m, n ) );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldt < max( 1, k ) );
+
+    std::vector< scalar_t > tau( min( m, n ) );
+    geqp3_rand_work( m, n, k, A, lda, jpvt, tau.data() );
+
+    for (int64_t i = 0; i < k; ++i) {
+        if (A[ i + i*lda ] == scalar_t( 0 ))
+            return i + 1;
+    }
+
+    // T = R11^{-1} R12
+    lapack::lacpy( MatrixType::General, k, n - k, &A[ k*lda ], lda, T, ldt );
+    blas::trsm( blas::Layout::ColMajor, Side::Left, Uplo::Upper, Op::NoTrans,
+                Diag::NonUnit, k, n - k, scalar_t( 1 ), A, lda, T, ldt );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t geqp3_rand< float >(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau );
+
+template
+int64_t geqp3_rand< double >(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau );
+
+template
+int64_t geqp3_rand< std::complex<float> >(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau );
+
+template
+int64_t geqp3_rand< std::complex<double> >(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau );
+
+template
+int64_t interp_decomp< float >(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* T, int64_t ldt );
+
+template
+int64_t interp_decomp< double >(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* T, int64_t ldt );
+
+template
+int64_t interp_decomp< std::complex<float> >(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* T, int64_t ldt );
+
+template
+int64_t interp_decomp< std::complex<double> >(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* T, int64_t ldt );
+
+}  // namespace lapack
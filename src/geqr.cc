@@ -25,6 +25,8 @@ int64_t geqr(
     float* A, int64_t lda,
     float* T, int64_t tsize )
 {
+    lapack_instrument( "geqr", 's', m, n, 0, Gflop< float >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -69,6 +71,8 @@ int64_t geqr(
     double* A, int64_t lda,
     double* T, int64_t tsize )
 {
+    lapack_instrument( "geqr", 'd', m, n, 0, Gflop< double >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -113,6 +117,9 @@ int64_t geqr(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* T, int64_t tsize )
 {
+    lapack_instrument( "geqr", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -246,6 +253,9 @@ int64_t geqr(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* T, int64_t tsize )
 {
+    lapack_instrument( "geqr", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
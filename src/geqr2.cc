@@ -23,6 +23,8 @@ int64_t geqr2(
     float* A, int64_t lda,
     float* tau )
 {
+    lapack_instrument( "geqr2", 's', m, n, 0, Gflop< float >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -49,6 +51,8 @@ int64_t geqr2(
     double* A, int64_t lda,
     double* tau )
 {
+    lapack_instrument( "geqr2", 'd', m, n, 0, Gflop< double >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -75,6 +79,9 @@ int64_t geqr2(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    lapack_instrument( "geqr2", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -153,6 +160,9 @@ int64_t geqr2(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    lapack_instrument( "geqr2", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
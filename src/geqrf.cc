@@ -23,6 +23,8 @@ int64_t geqrf(
     float* A, int64_t lda,
     float* tau )
 {
+    lapack_instrument( "geqrf", 's', m, n, 0, Gflop< float >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -62,6 +64,8 @@ int64_t geqrf(
     double* A, int64_t lda,
     double* tau )
 {
+    lapack_instrument( "geqrf", 'd', m, n, 0, Gflop< double >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -101,6 +105,9 @@ int64_t geqrf(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    lapack_instrument( "geqrf", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -191,6 +198,9 @@ int64_t geqrf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    lapack_instrument( "geqrf", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -24,6 +24,8 @@ int64_t geqrfp(
     float* A, int64_t lda,
     float* tau )
 {
+    lapack_instrument( "geqrfp", 's', m, n, 0, Gflop< float >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -62,6 +64,8 @@ int64_t geqrfp(
     double* A, int64_t lda,
     double* tau )
 {
+    lapack_instrument( "geqrfp", 'd', m, n, 0, Gflop< double >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -100,6 +104,9 @@ int64_t geqrfp(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    lapack_instrument( "geqrfp", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -138,6 +145,9 @@ int64_t geqrfp(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    lapack_instrument( "geqrfp", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -24,6 +24,8 @@ int64_t geqrt(
     float* A, int64_t lda,
     float* T, int64_t ldt )
 {
+    lapack_instrument( "geqrt", 's', m, n, 0, Gflop< float >::geqrt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nb_ = to_lapack_int( nb );
@@ -51,6 +53,8 @@ int64_t geqrt(
     double* A, int64_t lda,
     double* T, int64_t ldt )
 {
+    lapack_instrument( "geqrt", 'd', m, n, 0, Gflop< double >::geqrt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nb_ = to_lapack_int( nb );
@@ -78,6 +82,9 @@ int64_t geqrt(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* T, int64_t ldt )
 {
+    lapack_instrument( "geqrt", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::geqrt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nb_ = to_lapack_int( nb );
@@ -105,6 +112,9 @@ int64_t geqrt(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* T, int64_t ldt )
 {
+    lapack_instrument( "geqrt", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::geqrt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nb_ = to_lapack_int( nb );
@@ -23,6 +23,8 @@ int64_t geqrt3(
     float* A, int64_t lda,
     float* T, int64_t ldt )
 {
+    lapack_instrument( "geqrt3", 's', m, n, 0, Gflop< float >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -45,6 +47,8 @@ int64_t geqrt3(
     double* A, int64_t lda,
     double* T, int64_t ldt )
 {
+    lapack_instrument( "geqrt3", 'd', m, n, 0, Gflop< double >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -67,6 +71,9 @@ int64_t geqrt3(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* T, int64_t ldt )
 {
+    lapack_instrument( "geqrt3", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -89,6 +96,9 @@ int64_t geqrt3(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* T, int64_t ldt )
 {
+    lapack_instrument( "geqrt3", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::geqrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -28,6 +28,9 @@ int64_t gerfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "gerfs", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -78,6 +81,9 @@ int64_t gerfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "gerfs", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -128,6 +134,9 @@ int64_t gerfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "gerfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -252,6 +261,9 @@ int64_t gerfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "gerfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
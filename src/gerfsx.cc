@@ -35,6 +35,9 @@ int64_t gerfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    lapack_instrument( "gerfsx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -97,6 +100,9 @@ int64_t gerfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    lapack_instrument( "gerfsx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -159,6 +165,9 @@ int64_t gerfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    lapack_instrument( "gerfsx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -493,6 +502,9 @@ int64_t gerfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    lapack_instrument( "gerfsx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -23,6 +23,8 @@ int64_t gerqf(
     float* A, int64_t lda,
     float* tau )
 {
+    lapack_instrument( "gerqf", 's', m, n, 0, Gflop< float >::gerqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -62,6 +64,8 @@ int64_t gerqf(
     double* A, int64_t lda,
     double* tau )
 {
+    lapack_instrument( "gerqf", 'd', m, n, 0, Gflop< double >::gerqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -101,6 +105,9 @@ int64_t gerqf(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    lapack_instrument( "gerqf", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::gerqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -195,6 +202,9 @@ int64_t gerqf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    lapack_instrument( "gerqf", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::gerqf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -25,6 +25,8 @@ int64_t gesdd(
     float* U, int64_t ldu,
     float* VT, int64_t ldvt )
 {
+    lapack_instrument( "gesdd", 's', m, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -79,6 +81,8 @@ int64_t gesdd(
     double* U, int64_t ldu,
     double* VT, int64_t ldvt )
 {
+    lapack_instrument( "gesdd", 'd', m, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -133,6 +137,8 @@ int64_t gesdd(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt )
 {
+    lapack_instrument( "gesdd", 'c', m, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -310,6 +316,8 @@ int64_t gesdd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
 {
+    lapack_instrument( "gesdd", 'z', m, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -24,6 +24,9 @@ int64_t gesv(
     int64_t* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "gesv", 's', 0, n, nrhs,
+                       Gflop< float >::gesv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
@@ -59,6 +62,9 @@ int64_t gesv(
     int64_t* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "gesv", 'd', 0, n, nrhs,
+                       Gflop< double >::gesv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
@@ -94,6 +100,9 @@ int64_t gesv(
     int64_t* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "gesv", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::gesv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
@@ -178,6 +187,9 @@ int64_t gesv(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "gesv", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::gesv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
@@ -214,6 +226,9 @@ int64_t gesv(
     double* X, int64_t ldx,
     int64_t* iter )
 {
+    lapack_instrument( "gesv", 'd', 0, n, nrhs,
+                       Gflop< double >::gesv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
@@ -260,6 +275,9 @@ int64_t gesv(
     std::complex<double>* X, int64_t ldx,
     int64_t* iter )
 {
+    lapack_instrument( "gesv", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::gesv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
@@ -25,6 +25,8 @@ int64_t gesvd(
     float* U, int64_t ldu,
     float* VT, int64_t ldvt )
 {
+    lapack_instrument( "gesvd", 's', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     lapack_int m_ = to_lapack_int( m );
@@ -76,6 +78,8 @@ int64_t gesvd(
     double* U, int64_t ldu,
     double* VT, int64_t ldvt )
 {
+    lapack_instrument( "gesvd", 'd', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     lapack_int m_ = to_lapack_int( m );
@@ -127,6 +131,8 @@ int64_t gesvd(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt )
 {
+    lapack_instrument( "gesvd", 'c', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     lapack_int m_ = to_lapack_int( m );
@@ -291,6 +297,8 @@ int64_t gesvd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
 {
+    lapack_instrument( "gesvd", 'z', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     lapack_int m_ = to_lapack_int( m );
@@ -0,0 +1,188 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <vector>
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+
+//------------------------------------------------------------------------------
+/// Computes the singular value decomposition (SVD) of an m-by-n matrix A,
+/// using the QDWH polar decomposition (QDWH-SVD)
+/// [Nakatsukasa, Higham, 2013]:
+/// $A = U_p H$ by `lapack::polar`, then $H = V \Sigma V^H$ by
+/// `lapack::heev_qdwh`, giving $A = (U_p V) \Sigma V^H$.
+/// If m < n, the same is applied to $A^H$.
+///
+/// Only the economy SVD is computed: U is m-by-min(m,n) and
+/// V^H is min(m,n)-by-n, as in `lapack::gesdd` with jobz = SomeVec.
+/// All work is in BLAS-3 operations, without the bidiagonal reduction
+/// of gesvd and gesdd.
+///
+/// @param[in] jobz
+///     - lapack::Job::NoVec:   Compute singular values only;
+///     - lapack::Job::SomeVec: Compute min(m,n) left and right
+///                             singular vectors.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] S
+///     The vector S of length min(m,n).
+///     The singular values of A, sorted so that S(i) >= S(i+1).
+///
+/// @param[out] U
+///     The m-by-min(m,n) matrix U, stored in an ldu-by-min(m,n) array.
+///     If jobz = SomeVec, the left singular vectors of A.
+///     If jobz = NoVec, U is not referenced.
+///
+/// @param[in] ldu
+///     The leading dimension of the array U.
+///     If jobz = SomeVec, ldu >= max(1,m); otherwise ldu >= 1.
+///
+/// @param[out] VT
+///     The min(m,n)-by-n matrix V^H, stored in an ldvt-by-n array.
+///     If jobz = SomeVec, the right singular vectors of A, as rows.
+///     If jobz = NoVec, VT is not referenced.
+///
+/// @param[in] ldvt
+///     The leading dimension of the array VT.
+///     If jobz = SomeVec, ldvt >= max(1,min(m,n)); otherwise ldvt >= 1.
+///
+/// @return = 0: successful exit
+/// @return = 1: the QDWH iteration did not converge.
+/// @return > 1: heevd failed on a subproblem; see `lapack::heev_qdwh`.
+///
+/// @ingroup gesvd
+template <typename scalar_t>
+int64_t gesvd_qdwh(
+    lapack::Job jobz, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt )
+{
+    lapack_instrument( "gesvd_qdwh", internal::precision_char< scalar_t >(),
+                       m, n, 0, internal::gflop_data_dependent );
+
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    const scalar_t one = 1, zero = 0;
+
+    int64_t minmn = min( m, n );
+    bool wantvec = (jobz == Job::SomeVec);
+
+    // check arguments
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::SomeVec );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldu < 1 || (wantvec && ldu < m) );
+    lapack_error_if( ldvt < 1 || (wantvec && ldvt < minmn) );
+
+    // quick return
+    if (minmn == 0)
+        return 0;
+
+    // B = A or A^H is mb-by-k, mb >= k.
+    int64_t mb = max( m, n );
+    int64_t k  = minmn;
+    std::vector< scalar_t > B( mb*k ), H( k*k );
+    if (m >= n) {
+        lapack::lacpy( MatrixType::General, m, n, A, lda, B.data(), mb );
+    }
+    else {
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < m; ++i)
+                B[ j + i*mb ] = conj( A[ i + j*lda ] );
+    }
+
+    // B = U_p H; H = V Lambda V^H, with Lambda ascending.
+    int64_t info = lapack::polar( mb, k, B.data(), mb, H.data(), k );
+    if (info != 0)
+        return info;
+    std::vector< real_t > Lambda( k );
+    info = lapack::heev_qdwh( Job::Vec, Uplo::Lower, k, H.data(), k,
+                              Lambda.data() );
+    if (info != 0)
+        return 1 + info;
+
+    // Reverse to descending order. H is semi-definite, so negative
+    // eigenvalues are rounding errors.
+    for (int64_t i = 0; i < k; ++i)
+        S[ i ] = max( Lambda[ k-1-i ], real_t( 0 ) );
+    if (! wantvec)
+        return 0;
+    for (int64_t i = 0; i < k/2; ++i)
+        blas::swap( k, &H[ i*k ], 1, &H[ (k-1-i)*k ], 1 );
+
+    if (m >= n) {
+        // A = (U_p V) Sigma V^H.
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, m, k, k,
+                    one, B.data(), mb, H.data(), k, zero, U, ldu );
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < k; ++i)
+                VT[ i + j*ldvt ] = conj( H[ j + i*k ] );
+    }
+    else {
+        // A^H = (U_p V) Sigma V^H, so A = V Sigma (U_p V)^H.
+        lapack::lacpy( MatrixType::General, m, k, H.data(), k, U, ldu );
+        blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::ConjTrans, k, n, k,
+                    one, H.data(), k, B.data(), mb, zero, VT, ldvt );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t gesvd_qdwh< float >(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt );
+
+template
+int64_t gesvd_qdwh< double >(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt );
+
+template
+int64_t gesvd_qdwh< std::complex<float> >(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt );
+
+template
+int64_t gesvd_qdwh< std::complex<double> >(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt );
+
+}  // namespace lapack
@@ -28,6 +28,8 @@ int64_t gesvdx(
     float* U, int64_t ldu,
     float* VT, int64_t ldvt )
 {
+    lapack_instrument( "gesvdx", 's', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     char range_ = to_char( range );
@@ -89,6 +91,8 @@ int64_t gesvdx(
     double* U, int64_t ldu,
     double* VT, int64_t ldvt )
 {
+    lapack_instrument( "gesvdx", 'd', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     char range_ = to_char( range );
@@ -150,6 +154,8 @@ int64_t gesvdx(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt )
 {
+    lapack_instrument( "gesvdx", 'c', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     char range_ = to_char( range );
@@ -345,6 +351,8 @@ int64_t gesvdx(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
 {
+    lapack_instrument( "gesvdx", 'z', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     char range_ = to_char( range );
@@ -33,6 +33,9 @@ int64_t gesvx(
     float* berr,
     float* rpivotgrowth )
 {
+    lapack_instrument( "gesvx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     char equed_ = to_char( *equed );
@@ -98,6 +101,9 @@ int64_t gesvx(
     double* berr,
     double* rpivotgrowth )
 {
+    lapack_instrument( "gesvx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     char equed_ = to_char( *equed );
@@ -163,6 +169,9 @@ int64_t gesvx(
     float* berr,
     float* rpivotgrowth )
 {
+    lapack_instrument( "gesvx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     char equed_ = to_char( *equed );
@@ -439,6 +448,9 @@ int64_t gesvx(
     double* berr,
     double* rpivotgrowth )
 {
+    lapack_instrument( "gesvx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     char equed_ = to_char( *equed );
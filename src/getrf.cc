@@ -23,6 +23,8 @@ int64_t getrf(
     float* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "getrf", 's', m, n, 0, Gflop< float >::getrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -55,6 +57,8 @@ int64_t getrf(
     double* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "getrf", 'd', m, n, 0, Gflop< double >::getrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -87,6 +91,9 @@ int64_t getrf(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "getrf", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::getrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -161,6 +168,9 @@ int64_t getrf(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "getrf", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::getrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -25,6 +25,8 @@ int64_t getrf2(
     float* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "getrf2", 's', m, n, 0, Gflop< float >::getrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -57,6 +59,8 @@ int64_t getrf2(
     double* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "getrf2", 'd', m, n, 0, Gflop< double >::getrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -89,6 +93,9 @@ int64_t getrf2(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "getrf2", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::getrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -191,6 +198,9 @@ int64_t getrf2(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "getrf2", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::getrf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -0,0 +1,284 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "ooc_internal.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//------------------------------------------------------------------------------
+// Applies row interchanges ipiv[ i1 : i2-1 ] (1-based global row indices)
+// to the nb columns of buf, whose first row is global row r0.
+template <typename scalar_t>
+static void getrf_ooc_swap(
+    int64_t nb, scalar_t* buf, int64_t ld, int64_t r0,
+    int64_t i1, int64_t i2, int64_t const* ipiv )
+{
+    for (int64_t i = i1; i < i2; ++i) {
+        int64_t p = ipiv[ i ] - 1;
+        if (p != i)
+            blas::swap( nb, &buf[ i - r0 ], ld, &buf[ p - r0 ], ld );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Computes an LU factorization of a general m-by-n matrix A stored out of
+/// core, in a file or memory-mapped region, that may be larger than main
+/// memory, using partial pivoting with row interchanges:
+/// \[
+///     A = P L U,
+/// \]
+/// as in `lapack::getrf`.
+///
+/// This uses a left-looking algorithm on column panels. Each panel is read
+/// once, row interchanges so far are applied, it is updated by streaming in
+/// the previously factored panels (`blas::trsm`, `blas::gemm`), factored in
+/// memory with `lapack::getrf`, and written back. Row interchanges from
+/// later panels are applied to streamed panels on the fly; a final pass
+/// applies them to the factor L on storage.
+///
+/// Memory use is bounded by window, which holds 5 column panels of m rows:
+/// three for the current panel, the next one being read, and the previous
+/// one being written (and used directly for the next update), and two to
+/// double-buffer the streamed panels. All reads and writes run
+/// asynchronously on a background I/O thread, overlapped with computation.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The m-by-n matrix A, out of core. On exit, the factors L and U;
+///     the unit diagonal elements of L are not stored.
+///
+/// @param[out] ipiv
+///     The vector ipiv of length min(m,n).
+///     The pivot indices; for 1 <= i <= min(m,n), row i of the
+///     matrix was interchanged with row ipiv(i).
+///
+/// @param[in] window
+///     Bytes of memory to use for panels. The panel width is
+///     window / (5 m sizeof(scalar_t)), at least 1.
+///
+/// @param[out] stats
+///     If not null, on exit, bytes read and written, I/O time,
+///     and the time computation waited on I/O.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, $U(i,i)$ is exactly zero. The
+///     factorization has been completed, but the factor U is exactly
+///     singular, and division by zero will occur if it is used
+///     to solve a system of equations.
+///
+/// @ingroup gesv_computational
+template <typename scalar_t>
+int64_t getrf_ooc(
+    int64_t m, int64_t n,
+    OOCMatrix< scalar_t > const& A,
+    int64_t* ipiv,
+    size_t window, OOCStats* stats )
+{
+    lapack_instrument( "getrf_ooc", internal::precision_char< scalar_t >(),
+                       m, n, 0, Gflop< scalar_t >::getrf( m, n ) );
+
+    using internal::OOCWorker;
+    using blas::Layout;
+    using blas::Side;
+    using blas::Op;
+    using blas::Diag;
+
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( A.m() < m || A.n() < n );
+
+    if (m == 0 || n == 0) {
+        if (stats != nullptr)
+            *stats = OOCStats();
+        return 0;
+    }
+    double time = internal::ooc_wtime();
+
+    const scalar_t one = 1;
+    const int64_t nb = min( n, max( 1, int64_t(
+                                window / (5 * m * sizeof(scalar_t)) ) ) );
+    const int64_t nt = (n + nb - 1) / nb;
+    const int64_t mn = min( m, n );
+    const int64_t nl = (mn + nb - 1) / nb;  // panels with columns of L
+    const int64_t ld = m;
+
+    std::vector< scalar_t > panel[ 3 ], stream[ 2 ];
+    for (auto& buf : panel)
+        buf.resize( ld * nb );
+    for (auto& buf : stream)
+        buf.resize( ld * nb );
+    std::future<void> panel_done[ 3 ], stream_done[ 2 ];
+
+    // Declared after the buffers, so it drains before they are freed.
+    OOCWorker io;
+
+    // Reads rows i0 : m of panel j.
+    auto read_panel = [&]( int64_t j, scalar_t* buf, int64_t i0 ) {
+        int64_t j0 = j*nb;
+        int64_t jb = min( nb, n - j0 );
+        int64_t mb = m - i0;
+        return io.submit(
+            [&A, buf, ld, i0, j0, mb, jb] {
+                A.read( i0, j0, mb, jb, buf, ld );
+            },
+            sizeof(scalar_t) * mb * jb, 0 );
+    };
+
+    // Writes rows i0 : m of panel j.
+    auto write_panel = [&]( int64_t j, scalar_t const* buf, int64_t i0 ) {
+        int64_t j0 = j*nb;
+        int64_t jb = min( nb, n - j0 );
+        int64_t mb = m - i0;
+        return io.submit(
+            [&A, buf, ld, i0, j0, mb, jb] {
+                A.write( i0, j0, mb, jb, buf, ld );
+            },
+            0, sizeof(scalar_t) * mb * jb );
+    };
+
+    int64_t info = 0;
+    panel_done[ 0 ] = read_panel( 0, panel[ 0 ].data(), 0 );
+    for (int64_t k = 0; k < nt; ++k) {
+        int64_t k0 = k*nb;
+        int64_t kb = min( nb, n - k0 );
+        scalar_t* Ak = panel[ k % 3 ].data();
+        io.wait( panel_done[ k % 3 ] );
+
+        // Prefetch panel k+1 once the stream reads for panel k are queued.
+        // Its buffer last held panel k-2, whose write is queued before.
+        bool prefetched = false;
+        auto prefetch = [&] {
+            if (! prefetched && k + 1 < nt) {
+                panel_done[ (k+1) % 3 ] = read_panel(
+                    k + 1, panel[ (k+1) % 3 ].data(), 0 );
+            }
+            prefetched = true;
+        };
+
+        // Apply row interchanges from panels 0, ..., k-1.
+        getrf_ooc_swap( kb, Ak, ld, 0, 0, min( k0, mn ), ipiv );
+
+        // Update panel k with panels 0, ..., k-1 that have columns of L.
+        // Panels before k-1 are streamed from storage, rows j0 : m,
+        // with later row interchanges applied; panel k-1 is in memory.
+        int64_t nj = min( k, nl );
+        int64_t nstream = min( k - 1, nl );
+        if (nstream > 0)
+            stream_done[ 0 ] = read_panel( 0, stream[ 0 ].data(), 0 );
+        else
+            prefetch();
+        for (int64_t j = 0; j < nj; ++j) {
+            int64_t j0 = j*nb;
+            int64_t jb = min( nb, m - j0 );  // columns of L in panel j
+            scalar_t* Aj;
+            if (j < nstream) {
+                io.wait( stream_done[ j % 2 ] );
+                if (j + 1 < nstream) {
+                    stream_done[ (j+1) % 2 ] = read_panel(
+                        j + 1, stream[ (j+1) % 2 ].data(), (j+1)*nb );
+                }
+                else {
+                    prefetch();
+                }
+                Aj = stream[ j % 2 ].data();
+                getrf_ooc_swap( jb, Aj, ld, j0, j0 + nb, min( k0, mn ), ipiv );
+            }
+            else {
+                Aj = &panel[ (k-1) % 3 ][ j0 ];
+            }
+
+            // A(j0:j0+jb, k) = L(j, j)^{-1} A(j0:j0+jb, k)
+            // A(j0+jb:m, k) -= L(j0+jb:m, j) A(j0:j0+jb, k)
+            blas::trsm( Layout::ColMajor, Side::Left, Uplo::Lower,
+                        Op::NoTrans, Diag::Unit, jb, kb,
+                        one, Aj, ld, &Ak[ j0 ], ld );
+            if (m - j0 > jb) {
+                blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                            m - j0 - jb, kb, jb,
+                            -one, &Aj[ jb ], ld,
+                                  &Ak[ j0 ], ld,
+                             one, &Ak[ j0 + jb ], ld );
+            }
+        }
+
+        // Factor the rest of the panel.
+        if (k0 < m) {
+            int64_t iinfo = lapack::getrf( m - k0, kb, &Ak[ k0 ], ld,
+                                           &ipiv[ k0 ] );
+            if (iinfo > 0 && info == 0)
+                info = k0 + iinfo;
+            for (int64_t i = k0; i < min( k0 + kb, mn ); ++i)
+                ipiv[ i ] += k0;
+        }
+
+        panel_done[ k % 3 ] = write_panel( k, Ak, 0 );
+    }
+
+    // Apply row interchanges from later panels to L on storage,
+    // rows (j+1)*nb : m of panel j.
+    if (nl > 1) {
+        stream_done[ 0 ] = read_panel( 0, stream[ 0 ].data(), nb );
+        for (int64_t j = 0; j < nl - 1; ++j) {
+            int64_t i0 = (j+1)*nb;
+            scalar_t* Aj = stream[ j % 2 ].data();
+            io.wait( stream_done[ j % 2 ] );
+            if (j + 1 < nl - 1) {
+                // The buffer's previous write is queued before.
+                stream_done[ (j+1) % 2 ] = read_panel(
+                    j + 1, stream[ (j+1) % 2 ].data(), i0 + nb );
+            }
+            getrf_ooc_swap( nb, Aj, ld, i0, i0, mn, ipiv );
+            stream_done[ j % 2 ] = write_panel( j, Aj, i0 );
+        }
+    }
+
+    io.finish( internal::ooc_wtime() - time, stats );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t getrf_ooc< float >(
+    int64_t m, int64_t n,
+    OOCMatrix< float > const& A,
+    int64_t* ipiv,
+    size_t window, OOCStats* stats );
+
+template
+int64_t getrf_ooc< double >(
+    int64_t m, int64_t n,
+    OOCMatrix< double > const& A,
+    int64_t* ipiv,
+    size_t window, OOCStats* stats );
+
+template
+int64_t getrf_ooc< std::complex<float> >(
+    int64_t m, int64_t n,
+    OOCMatrix< std::complex<float> > const& A,
+    int64_t* ipiv,
+    size_t window, OOCStats* stats );
+
+template
+int64_t getrf_ooc< std::complex<double> >(
+    int64_t m, int64_t n,
+    OOCMatrix< std::complex<double> > const& A,
+    int64_t* ipiv,
+    size_t window, OOCStats* stats );
+
+}  // namespace lapack
@@ -23,6 +23,8 @@ int64_t getri(
     float* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "getri", 's', 0, n, 0, Gflop< float >::getri( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
@@ -69,6 +71,8 @@ int64_t getri(
     double* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "getri", 'd', 0, n, 0, Gflop< double >::getri( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
@@ -115,6 +119,9 @@ int64_t getri(
     std::complex<float>* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "getri", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::getri( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
@@ -193,6 +200,9 @@ int64_t getri(
     std::complex<double>* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "getri", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::getri( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
@@ -24,6 +24,9 @@ int64_t getrs(
     int64_t const* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "getrs", 's', 0, n, nrhs,
+                       Gflop< float >::getrs( n, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -59,6 +62,9 @@ int64_t getrs(
     int64_t const* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "getrs", 'd', 0, n, nrhs,
+                       Gflop< double >::getrs( n, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -94,6 +100,9 @@ int64_t getrs(
     int64_t const* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "getrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::getrs( n, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -182,6 +191,9 @@ int64_t getrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "getrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::getrs( n, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -24,6 +24,9 @@ int64_t getsls(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "getsls", 's', m, n, nrhs,
+                       Gflop< float >::gels( m, n, nrhs ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -84,6 +87,9 @@ int64_t getsls(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "getsls", 'd', m, n, nrhs,
+                       Gflop< double >::gels( m, n, nrhs ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -144,6 +150,9 @@ int64_t getsls(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "getsls", 'c', m, n, nrhs,
+                       Gflop< std::complex<float> >::gels( m, n, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -200,6 +209,9 @@ int64_t getsls(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "getsls", 'z', m, n, nrhs,
+                       Gflop< std::complex<double> >::gels( m, n, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -22,6 +22,9 @@ int64_t ggbak(
     float const* rscale, int64_t m,
     float* V, int64_t ldv )
 {
+    lapack_instrument( "ggbak", 's', m, n, 0,
+                       Gflop< float >::gebak( balance, m, ilo, ihi ) );
+
     char balance_ = to_char( balance );
     char side_ = to_char( side );
     lapack_int n_ = to_lapack_int( n );
@@ -50,6 +53,9 @@ int64_t ggbak(
     double const* rscale, int64_t m,
     double* V, int64_t ldv )
 {
+    lapack_instrument( "ggbak", 'd', m, n, 0,
+                       Gflop< double >::gebak( balance, m, ilo, ihi ) );
+
     char balance_ = to_char( balance );
     char side_ = to_char( side );
     lapack_int n_ = to_lapack_int( n );
@@ -78,6 +84,10 @@ int64_t ggbak(
     float const* rscale, int64_t m,
     std::complex<float>* V, int64_t ldv )
 {
+    lapack_instrument( "ggbak", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::gebak( balance, m, ilo,
+                                                            ihi ) );
+
     char balance_ = to_char( balance );
     char side_ = to_char( side );
     lapack_int n_ = to_lapack_int( n );
@@ -106,6 +116,10 @@ int64_t ggbak(
     double const* rscale, int64_t m,
     std::complex<double>* V, int64_t ldv )
 {
+    lapack_instrument( "ggbak", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::gebak( balance, m, ilo,
+                                                             ihi ) );
+
     char balance_ = to_char( balance );
     char side_ = to_char( side );
     lapack_int n_ = to_lapack_int( n );
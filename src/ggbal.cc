@@ -26,6 +26,8 @@ int64_t ggbal(
     float* lscale,
     float* rscale )
 {
+    lapack_instrument( "ggbal", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char balance_ = to_char( balance );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -66,6 +68,8 @@ int64_t ggbal(
     double* lscale,
     double* rscale )
 {
+    lapack_instrument( "ggbal", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char balance_ = to_char( balance );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -106,6 +110,8 @@ int64_t ggbal(
     float* lscale,
     float* rscale )
 {
+    lapack_instrument( "ggbal", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char balance_ = to_char( balance );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -146,6 +152,8 @@ int64_t ggbal(
     double* lscale,
     double* rscale )
 {
+    lapack_instrument( "ggbal", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char balance_ = to_char( balance );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -28,6 +28,8 @@ int64_t gges(
     float* VSL, int64_t ldvsl,
     float* VSR, int64_t ldvsr )
 {
+    lapack_instrument( "gges", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -105,6 +107,8 @@ int64_t gges(
     double* VSL, int64_t ldvsl,
     double* VSR, int64_t ldvsr )
 {
+    lapack_instrument( "gges", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -182,6 +186,8 @@ int64_t gges(
     std::complex<float>* VSL, int64_t ldvsl,
     std::complex<float>* VSR, int64_t ldvsr )
 {
+    lapack_instrument( "gges", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -253,6 +259,8 @@ int64_t gges(
     std::complex<double>* VSL, int64_t ldvsl,
     std::complex<double>* VSR, int64_t ldvsr )
 {
+    lapack_instrument( "gges", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
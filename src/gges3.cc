@@ -30,6 +30,8 @@ int64_t gges3(
     float* VSL, int64_t ldvsl,
     float* VSR, int64_t ldvsr )
 {
+    lapack_instrument( "gges3", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -107,6 +109,8 @@ int64_t gges3(
     double* VSL, int64_t ldvsl,
     double* VSR, int64_t ldvsr )
 {
+    lapack_instrument( "gges3", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -184,6 +188,8 @@ int64_t gges3(
     std::complex<float>* VSL, int64_t ldvsl,
     std::complex<float>* VSR, int64_t ldvsr )
 {
+    lapack_instrument( "gges3", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -255,6 +261,8 @@ int64_t gges3(
     std::complex<double>* VSL, int64_t ldvsl,
     std::complex<double>* VSR, int64_t ldvsr )
 {
+    lapack_instrument( "gges3", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
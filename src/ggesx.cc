@@ -30,6 +30,8 @@ int64_t ggesx(
     float* rconde,
     float* rcondv )
 {
+    lapack_instrument( "ggesx", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -119,6 +121,8 @@ int64_t ggesx(
     double* rconde,
     double* rcondv )
 {
+    lapack_instrument( "ggesx", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -208,6 +212,8 @@ int64_t ggesx(
     float* rconde,
     float* rcondv )
 {
+    lapack_instrument( "ggesx", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -291,6 +297,8 @@ int64_t ggesx(
     double* rconde,
     double* rcondv )
 {
+    lapack_instrument( "ggesx", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -26,6 +26,8 @@ int64_t ggev(
     float* VL, int64_t ldvl,
     float* VR, int64_t ldvr )
 {
+    lapack_instrument( "ggev", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -90,6 +92,8 @@ int64_t ggev(
     double* VL, int64_t ldvl,
     double* VR, int64_t ldvr )
 {
+    lapack_instrument( "ggev", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -154,6 +158,8 @@ int64_t ggev(
     std::complex<float>* VL, int64_t ldvl,
     std::complex<float>* VR, int64_t ldvr )
 {
+    lapack_instrument( "ggev", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -214,6 +220,8 @@ int64_t ggev(
     std::complex<double>* VL, int64_t ldvl,
     std::complex<double>* VR, int64_t ldvr )
 {
+    lapack_instrument( "ggev", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -28,6 +28,8 @@ int64_t ggev3(
     float* VL, int64_t ldvl,
     float* VR, int64_t ldvr )
 {
+    lapack_instrument( "ggev3", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -92,6 +94,8 @@ int64_t ggev3(
     double* VL, int64_t ldvl,
     double* VR, int64_t ldvr )
 {
+    lapack_instrument( "ggev3", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -156,6 +160,8 @@ int64_t ggev3(
     std::complex<float>* VL, int64_t ldvl,
     std::complex<float>* VR, int64_t ldvr )
 {
+    lapack_instrument( "ggev3", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -216,6 +222,8 @@ int64_t ggev3(
     std::complex<double>* VL, int64_t ldvl,
     std::complex<double>* VR, int64_t ldvr )
 {
+    lapack_instrument( "ggev3", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -26,6 +26,9 @@ int64_t ggglm(
     float* X,
     float* Y )
 {
+    lapack_instrument( "ggglm", 's', m, n, 0,
+                       Gflop< float >::ggglm( n, m, p ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -76,6 +79,9 @@ int64_t ggglm(
     double* X,
     double* Y )
 {
+    lapack_instrument( "ggglm", 'd', m, n, 0,
+                       Gflop< double >::ggglm( n, m, p ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -126,6 +132,9 @@ int64_t ggglm(
     std::complex<float>* X,
     std::complex<float>* Y )
 {
+    lapack_instrument( "ggglm", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::ggglm( n, m, p ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -260,6 +269,9 @@ int64_t ggglm(
     std::complex<double>* X,
     std::complex<double>* Y )
 {
+    lapack_instrument( "ggglm", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::ggglm( n, m, p ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -23,6 +23,9 @@ int64_t gghrd(
     float* Q, int64_t ldq,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "gghrd", 's', 0, n, 0,
+                       Gflop< float >::gghrd( compq, compz, n ) );
+
     char compq_ = to_char_comp( compq );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
@@ -55,6 +58,9 @@ int64_t gghrd(
     double* Q, int64_t ldq,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "gghrd", 'd', 0, n, 0,
+                       Gflop< double >::gghrd( compq, compz, n ) );
+
     char compq_ = to_char_comp( compq );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
@@ -87,6 +93,9 @@ int64_t gghrd(
     std::complex<float>* Q, int64_t ldq,
     std::complex<float>* Z, int64_t ldz )
 {
+    lapack_instrument( "gghrd", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::gghrd( compq, compz, n ) );
+
     char compq_ = to_char_comp( compq );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
@@ -119,6 +128,10 @@ int64_t gghrd(
     std::complex<double>* Q, int64_t ldq,
     std::complex<double>* Z, int64_t ldz )
 {
+    lapack_instrument( "gghrd", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::gghrd( compq, compz,
+                                                             n ) );
+
     char compq_ = to_char_comp( compq );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
@@ -26,6 +26,9 @@ int64_t gglse(
     float* D,
     float* X )
 {
+    lapack_instrument( "gglse", 's', m, n, 0,
+                       Gflop< float >::gglse( m, n, p ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int p_ = to_lapack_int( p );
@@ -76,6 +79,9 @@ int64_t gglse(
     double* D,
     double* X )
 {
+    lapack_instrument( "gglse", 'd', m, n, 0,
+                       Gflop< double >::gglse( m, n, p ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int p_ = to_lapack_int( p );
@@ -126,6 +132,9 @@ int64_t gglse(
     std::complex<float>* D,
     std::complex<float>* X )
 {
+    lapack_instrument( "gglse", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::gglse( m, n, p ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int p_ = to_lapack_int( p );
@@ -267,6 +276,9 @@ int64_t gglse(
     std::complex<double>* D,
     std::complex<double>* X )
 {
+    lapack_instrument( "gglse", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::gglse( m, n, p ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int p_ = to_lapack_int( p );
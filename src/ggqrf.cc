@@ -24,6 +24,9 @@ int64_t ggqrf(
     float* B, int64_t ldb,
     float* taub )
 {
+    lapack_instrument( "ggqrf", 's', m, n, 0,
+                       Gflop< float >::ggqrf( n, m, p ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -70,6 +73,9 @@ int64_t ggqrf(
     double* B, int64_t ldb,
     double* taub )
 {
+    lapack_instrument( "ggqrf", 'd', m, n, 0,
+                       Gflop< double >::ggqrf( n, m, p ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -116,6 +122,9 @@ int64_t ggqrf(
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* taub )
 {
+    lapack_instrument( "ggqrf", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::ggqrf( n, m, p ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -162,6 +171,9 @@ int64_t ggqrf(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* taub )
 {
+    lapack_instrument( "ggqrf", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::ggqrf( n, m, p ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
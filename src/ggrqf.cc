@@ -24,6 +24,9 @@ int64_t ggrqf(
     float* B, int64_t ldb,
     float* taub )
 {
+    lapack_instrument( "ggrqf", 's', m, n, 0,
+                       Gflop< float >::ggrqf( m, p, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
     lapack_int n_ = to_lapack_int( n );
@@ -70,6 +73,9 @@ int64_t ggrqf(
     double* B, int64_t ldb,
     double* taub )
 {
+    lapack_instrument( "ggrqf", 'd', m, n, 0,
+                       Gflop< double >::ggrqf( m, p, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
     lapack_int n_ = to_lapack_int( n );
@@ -116,6 +122,9 @@ int64_t ggrqf(
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* taub )
 {
+    lapack_instrument( "ggrqf", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::ggrqf( m, p, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
     lapack_int n_ = to_lapack_int( n );
@@ -162,6 +171,9 @@ int64_t ggrqf(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* taub )
 {
+    lapack_instrument( "ggrqf", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::ggrqf( m, p, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
     lapack_int n_ = to_lapack_int( n );
@@ -31,6 +31,8 @@ int64_t ggsvd3(
     float* V, int64_t ldv,
     float* Q, int64_t ldq )
 {
+    lapack_instrument( "ggsvd3", 's', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -104,6 +106,8 @@ int64_t ggsvd3(
     double* V, int64_t ldv,
     double* Q, int64_t ldq )
 {
+    lapack_instrument( "ggsvd3", 'd', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -177,6 +181,8 @@ int64_t ggsvd3(
     std::complex<float>* V, int64_t ldv,
     std::complex<float>* Q, int64_t ldq )
 {
+    lapack_instrument( "ggsvd3", 'c', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -254,6 +260,8 @@ int64_t ggsvd3(
     std::complex<double>* V, int64_t ldv,
     std::complex<double>* Q, int64_t ldq )
 {
+    lapack_instrument( "ggsvd3", 'z', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -30,6 +30,8 @@ int64_t ggsvp3(
     float* Q, int64_t ldq,
     float* tau )
 {
+    lapack_instrument( "ggsvp3", 's', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -100,6 +102,8 @@ int64_t ggsvp3(
     double* Q, int64_t ldq,
     double* tau )
 {
+    lapack_instrument( "ggsvp3", 'd', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -170,6 +174,8 @@ int64_t ggsvp3(
     std::complex<float>* Q, int64_t ldq,
     std::complex<float>* tau )
 {
+    lapack_instrument( "ggsvp3", 'c', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -244,6 +250,8 @@ int64_t ggsvp3(
     std::complex<double>* Q, int64_t ldq,
     std::complex<double>* tau )
 {
+    lapack_instrument( "ggsvp3", 'z', m, n, 0, internal::gflop_data_dependent );
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
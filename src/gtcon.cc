@@ -27,6 +27,8 @@ int64_t gtcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "gtcon", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -69,6 +71,8 @@ int64_t gtcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "gtcon", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -111,6 +115,8 @@ int64_t gtcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "gtcon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -207,6 +213,8 @@ int64_t gtcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "gtcon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -33,6 +33,9 @@ int64_t gtrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "gtrfs", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -91,6 +94,9 @@ int64_t gtrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "gtrfs", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -149,6 +155,9 @@ int64_t gtrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "gtrfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -298,6 +307,9 @@ int64_t gtrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "gtrfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -24,6 +24,9 @@ int64_t gtsv(
     float* DU,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "gtsv", 's', 0, n, nrhs,
+                       Gflop< float >::gtsv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
@@ -50,6 +53,9 @@ int64_t gtsv(
     double* DU,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "gtsv", 'd', 0, n, nrhs,
+                       Gflop< double >::gtsv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
@@ -76,6 +82,9 @@ int64_t gtsv(
     std::complex<float>* DU,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "gtsv", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::gtsv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
@@ -153,6 +162,9 @@ int64_t gtsv(
     std::complex<double>* DU,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "gtsv", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::gtsv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
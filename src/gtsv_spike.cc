@@ -0,0 +1,206 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <vector>
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+
+//------------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// where A is an n-by-n tridiagonal matrix, using the partitioned SPIKE
+/// algorithm, which has parallelism within a single system.
+///
+/// The rows are split into nparts contiguous partitions. In parallel,
+/// each tridiagonal diagonal block is factored using `lapack::gttrf`
+/// (with partial pivoting inside the block), and `lapack::gttrs` computes
+/// the partial solution and the two spikes coupling it to its neighbors.
+/// The reduced system for the 2 unknowns at each partition interface,
+/// of order 2*nparts, is solved with `lapack::gbsv`, then the partitions
+/// are updated in parallel. See `lapack::gbsv_spike` for details.
+/// Threads are provided by OpenMP, if LAPACK++ is compiled with it.
+///
+/// Because pivoting is done only within partitions, this requires each
+/// diagonal block to be nonsingular; this holds for diagonally dominant
+/// and for symmetric positive definite tridiagonal matrices. For an SPD
+/// matrix from `lapack::ptsv`, pass DL = conj(E), D, and DU = E.
+/// Unlike `lapack::gtsv`, DL, D, and DU are not overwritten.
+/// Workspace of size about 7*n is allocated.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in] DL
+///     The vector DL of length n-1, the (n-1) subdiagonal elements of A.
+///
+/// @param[in] D
+///     The vector D of length n, the diagonal elements of A.
+///
+/// @param[in] DU
+///     The vector DU of length n-1, the (n-1) superdiagonal elements of A.
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On entry, the n-by-nrhs right hand side matrix B.
+///     On successful exit, the n-by-nrhs solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[in] nparts
+///     The number of partitions. If nparts <= 0, uses the number of
+///     OpenMP threads. It is reduced as needed so that each partition has
+///     at least 2 rows. With one partition, this is equivalent to
+///     `lapack::gtsv`.
+///
+/// @return = 0: successful exit
+/// @return > 0 and <= n: if return value = i, U(i,i) of the LU factorization
+///     of the diagonal block containing row i is exactly zero.
+///     The solution has not been computed, and B is unchanged.
+/// @return = n+1: the reduced interface system is singular.
+///     The solution has not been computed, and B is overwritten by the
+///     partial solutions of the diagonal blocks.
+///
+/// @ingroup gtsv
+template <typename scalar_t>
+int64_t gtsv_spike(
+    int64_t n, int64_t nrhs,
+    scalar_t const* DL,
+    scalar_t const* D,
+    scalar_t const* DU,
+    scalar_t* B, int64_t ldb,
+    int64_t nparts )
+{
+    // The spikes are 2 more right-hand sides; the reduced system is
+    // lower order.
+    lapack_instrument( "gtsv_spike", internal::precision_char< scalar_t >(),
+                       0, n, nrhs, Gflop< scalar_t >::gtsv( n, nrhs + 2 ) );
+
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n ) );
+
+    if (n == 0)
+        return 0;
+
+    nparts = internal::spike_num_parts( n, nparts, 2 );
+
+    std::vector< int64_t > offsets( nparts + 1 );
+    for (int64_t j = 0; j <= nparts; ++j)
+        offsets[ j ] = j * n / nparts;
+
+    // Spikes [ V, W ], n-by-2.
+    int64_t lds = n;
+    std::vector< scalar_t > S( lds * 2 );
+    std::vector< int64_t > info_part( nparts );
+
+    // LU factors of the diagonal blocks; block j is in rows s:e-1.
+    std::vector< scalar_t > DLf( n ), Df( D, D + n ), DUf( n ), DU2f( n );
+    std::vector< int64_t > ipiv( n );
+
+    // Factor all diagonal blocks before touching B, so B is unchanged
+    // if any block is singular.
+    #pragma omp parallel for schedule( static )
+    for (int64_t j = 0; j < nparts; ++j) {
+        int64_t s  = offsets[ j ];
+        int64_t e  = offsets[ j+1 ];
+        int64_t nj = e - s;
+
+        std::copy( DL + s, DL + e - 1, &DLf[ s ] );
+        std::copy( DU + s, DU + e - 1, &DUf[ s ] );
+        int64_t iinfo = lapack::gttrf( nj, &DLf[ s ], &Df[ s ], &DUf[ s ],
+                                       &DU2f[ s ], &ipiv[ s ] );
+        if (iinfo != 0)
+            info_part[ j ] = s + iinfo;
+    }
+
+    for (int64_t j = 0; j < nparts; ++j) {
+        if (info_part[ j ] != 0)
+            return info_part[ j ];
+    }
+
+    // Solve for B_j and the spikes.
+    #pragma omp parallel for schedule( static )
+    for (int64_t j = 0; j < nparts; ++j) {
+        int64_t s  = offsets[ j ];
+        int64_t e  = offsets[ j+1 ];
+        int64_t nj = e - s;
+
+        lapack::gttrs( Op::NoTrans, nj, nrhs, &DLf[ s ], &Df[ s ], &DUf[ s ],
+                       &DU2f[ s ], &ipiv[ s ], &B[ s ], ldb );
+
+        // V_j = A_j^{-1} DU(e-1) e_last, coupling to x(e).
+        if (j < nparts - 1) {
+            S[ e - 1 ] = DU[ e - 1 ];
+            lapack::gttrs( Op::NoTrans, nj, 1, &DLf[ s ], &Df[ s ], &DUf[ s ],
+                           &DU2f[ s ], &ipiv[ s ], &S[ s ], lds );
+        }
+
+        // W_j = A_j^{-1} DL(s-1) e_first, coupling to x(s-1).
+        if (j > 0) {
+            S[ s + lds ] = DL[ s - 1 ];
+            lapack::gttrs( Op::NoTrans, nj, 1, &DLf[ s ], &Df[ s ], &DUf[ s ],
+                           &DU2f[ s ], &ipiv[ s ], &S[ s + lds ], lds );
+        }
+    }
+
+    return internal::spike_reduced_solve(
+        n, 1, 1, nrhs, nparts, &offsets[ 0 ], &S[ 0 ], lds, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t gtsv_spike< float >(
+    int64_t n, int64_t nrhs,
+    float const* DL,
+    float const* D,
+    float const* DU,
+    float* B, int64_t ldb,
+    int64_t nparts );
+
+template
+int64_t gtsv_spike< double >(
+    int64_t n, int64_t nrhs,
+    double const* DL,
+    double const* D,
+    double const* DU,
+    double* B, int64_t ldb,
+    int64_t nparts );
+
+template
+int64_t gtsv_spike< std::complex<float> >(
+    int64_t n, int64_t nrhs,
+    std::complex<float> const* DL,
+    std::complex<float> const* D,
+    std::complex<float> const* DU,
+    std::complex<float>* B, int64_t ldb,
+    int64_t nparts );
+
+template
+int64_t gtsv_spike< std::complex<double> >(
+    int64_t n, int64_t nrhs,
+    std::complex<double> const* DL,
+    std::complex<double> const* D,
+    std::complex<double> const* DU,
+    std::complex<double>* B, int64_t ldb,
+    int64_t nparts );
+
+}  // namespace lapack
@@ -34,6 +34,9 @@ int64_t gtsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "gtsvx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
@@ -97,6 +100,9 @@ int64_t gtsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "gtsvx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
@@ -160,6 +166,9 @@ int64_t gtsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "gtsvx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
@@ -379,6 +388,9 @@ int64_t gtsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "gtsvx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
@@ -26,6 +26,8 @@ int64_t gttrf(
     float* DU2,
     int64_t* ipiv )
 {
+    lapack_instrument( "gttrf", 's', 0, n, 0, Gflop< float >::gttrf( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -62,6 +64,8 @@ int64_t gttrf(
     double* DU2,
     int64_t* ipiv )
 {
+    lapack_instrument( "gttrf", 'd', 0, n, 0, Gflop< double >::gttrf( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -98,6 +102,9 @@ int64_t gttrf(
     std::complex<float>* DU2,
     int64_t* ipiv )
 {
+    lapack_instrument( "gttrf", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::gttrf( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -190,6 +197,9 @@ int64_t gttrf(
     std::complex<double>* DU2,
     int64_t* ipiv )
 {
+    lapack_instrument( "gttrf", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::gttrf( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -27,6 +27,9 @@ int64_t gttrs(
     int64_t const* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "gttrs", 's', 0, n, nrhs,
+                       Gflop< float >::gttrs( n, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -66,6 +69,9 @@ int64_t gttrs(
     int64_t const* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "gttrs", 'd', 0, n, nrhs,
+                       Gflop< double >::gttrs( n, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -105,6 +111,9 @@ int64_t gttrs(
     int64_t const* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "gttrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::gttrs( n, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -209,6 +218,9 @@ int64_t gttrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "gttrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::gttrs( n, nrhs ) );
+
     char trans_ = to_char( trans );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -23,6 +23,8 @@ int64_t hbevd(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    lapack_instrument( "hbevd", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -79,6 +81,8 @@ int64_t hbevd(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    lapack_instrument( "hbevd", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -25,6 +25,9 @@ int64_t hbevd_2stage(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    lapack_instrument( "hbevd_2stage", 'c', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -81,6 +84,9 @@ int64_t hbevd_2stage(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    lapack_instrument( "hbevd_2stage", 'z', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
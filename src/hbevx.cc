@@ -26,6 +26,8 @@ int64_t hbevx(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "hbevx", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -84,6 +86,8 @@ int64_t hbevx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "hbevx", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
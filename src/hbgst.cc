@@ -23,6 +23,8 @@ int64_t hbgst(
     std::complex<float> const* BB, int64_t ldbb,
     std::complex<float>* X, int64_t ldx )
 {
+    lapack_instrument( "hbgst", 'c', 0, n, 0, internal::gflop_no_formula );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -58,6 +60,8 @@ int64_t hbgst(
     std::complex<double> const* BB, int64_t ldbb,
     std::complex<double>* X, int64_t ldx )
 {
+    lapack_instrument( "hbgst", 'z', 0, n, 0, internal::gflop_no_formula );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
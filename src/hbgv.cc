@@ -24,6 +24,8 @@ int64_t hbgv(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    lapack_instrument( "hbgv", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -61,6 +63,8 @@ int64_t hbgv(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    lapack_instrument( "hbgv", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
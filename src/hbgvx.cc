@@ -27,6 +27,8 @@ int64_t hbgvx(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "hbgvx", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -89,6 +91,8 @@ int64_t hbgvx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "hbgvx", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -24,6 +24,9 @@ int64_t hbtrd(
     float* E,
     std::complex<float>* Q, int64_t ldq )
 {
+    lapack_instrument( "hbtrd", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hbtrd( jobz, n, kd ) );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -57,6 +60,9 @@ int64_t hbtrd(
     double* E,
     std::complex<double>* Q, int64_t ldq )
 {
+    lapack_instrument( "hbtrd", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hbtrd( jobz, n, kd ) );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -24,6 +24,8 @@ int64_t hecon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "hecon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -103,6 +105,8 @@ int64_t hecon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "hecon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
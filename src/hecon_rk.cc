@@ -27,6 +27,9 @@ int64_t hecon_rk(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "hecon_rk", 'c', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -142,6 +145,9 @@ int64_t hecon_rk(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "hecon_rk", 'z', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
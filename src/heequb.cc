@@ -25,6 +25,8 @@ int64_t heequb(
     float* scond,
     float* amax )
 {
+    lapack_instrument( "heequb", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -99,6 +101,8 @@ int64_t heequb(
     double* scond,
     double* amax )
 {
+    lapack_instrument( "heequb", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
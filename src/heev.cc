@@ -23,6 +23,8 @@ int64_t heev(
     std::complex<float>* A, int64_t lda,
     float* W )
 {
+    lapack_instrument( "heev", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -116,6 +118,8 @@ int64_t heev(
     std::complex<double>* A, int64_t lda,
     double* W )
 {
+    lapack_instrument( "heev", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
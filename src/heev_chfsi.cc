@@ -0,0 +1,383 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+// Degree of the Chebyshev filter.
+static const int chfsi_degree = 10;
+
+// Lanczos steps to bound the largest eigenvalue.
+static const int64_t chfsi_lanczos = 10;
+
+// Extra search vectors beyond nev: max( min_extra, nev / extra_div ).
+static const int64_t chfsi_min_extra = 8;
+static const int64_t chfsi_extra_div = 5;
+
+// Stall if the residual is not reduced by this factor in stall_iters
+// consecutive iterations.
+static const double chfsi_stall_factor = 0.9;
+static const int chfsi_stall_iters = 3;
+
+//------------------------------------------------------------------------------
+// Orthonormalizes the n-by-k matrix X with CholeskyQR2, falling back to
+// geqrf and ungqr if X is too ill-conditioned for Cholesky.
+// Workspace G, k-by-k.
+template <typename scalar_t>
+static void chfsi_orth( int64_t n, int64_t k, scalar_t* X, scalar_t* G )
+{
+    using blas::Layout;
+    for (int pass = 0; pass < 2; ++pass) {
+        blas::herk( Layout::ColMajor, Uplo::Upper, Op::ConjTrans, k, n,
+                    1.0, X, n, 0.0, G, k );
+        if (lapack::potrf( Uplo::Upper, k, G, k ) != 0) {
+            std::vector< scalar_t > tau( k );
+            lapack::geqrf( n, k, X, n, tau.data() );
+            lapack::ungqr( n, k, k, X, n, tau.data() );
+            return;
+        }
+        blas::trsm( Layout::ColMajor, Side::Right, Uplo::Upper, Op::NoTrans,
+                    Diag::NonUnit, n, k, scalar_t( 1 ), G, k, X, n );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Returns an upper bound on the eigenvalues of A, from k steps of Lanczos:
+// the largest eigenvalue of the tridiagonal T_k plus |beta_k|.
+template <typename scalar_t>
+static blas::real_type< scalar_t > chfsi_upper_bound(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t const* A, int64_t lda, int64_t* iseed )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+
+    std::vector< scalar_t > v( n ), v0( n, 0 ), w( n );
+    std::vector< real_t > d( k ), e( k );
+    lapack::larnv( 3, iseed, n, v.data() );
+    blas::scal( n, scalar_t( 1 / blas::nrm2( n, v.data(), 1 ) ), v.data(), 1 );
+
+    real_t beta = 0;
+    int64_t j = 0;
+    for (; j < k; ++j) {
+        blas::hemm( Layout::ColMajor, Side::Left, uplo, n, 1,
+                    scalar_t( 1 ), A, lda, v.data(), n, scalar_t( 0 ), w.data(), n );
+        real_t alpha = real( blas::dot( n, v.data(), 1, w.data(), 1 ) );
+        blas::axpy( n, scalar_t( -alpha ), v.data(),  1, w.data(), 1 );
+        blas::axpy( n, scalar_t( -beta  ), v0.data(), 1, w.data(), 1 );
+        beta = blas::nrm2( n, w.data(), 1 );
+        d[ j ] = alpha;
+        e[ j ] = beta;
+        if (beta == 0) {
+            ++j;
+            break;
+        }
+        std::swap( v0, v );
+        blas::copy( n, w.data(), 1, v.data(), 1 );
+        blas::scal( n, scalar_t( 1 / beta ), v.data(), 1 );
+    }
+    lapack::sterf( j, d.data(), e.data() );
+    return d[ j-1 ] + beta;
+}
+
+//------------------------------------------------------------------------------
+/// Computes the nev smallest eigenvalues, and corresponding eigenvectors,
+/// of an n-by-n Hermitian matrix A, using Chebyshev-filtered subspace
+/// iteration (ChFSI) [Zhou, Saad, 2007], optionally warm-started from
+/// the eigenvectors of a nearby matrix.
+///
+/// This is intended for sequences of slowly changing matrices, such as
+/// in self-consistent field (SCF) iterations: passing the previous
+/// eigenvectors in Z makes each solve take only a few iterations.
+/// Each iteration applies a degree 10 Chebyshev polynomial filter in A
+/// to the subspace, which damps the unwanted part of the spectrum. The
+/// subspace is then orthonormalized with CholeskyQR2 (falling back to
+/// `lapack::geqrf`), and the Rayleigh-Ritz projection is solved
+/// with `lapack::heevd`. Operations are BLAS-3 hemm and gemm.
+///
+/// The search subspace has nev + max( 8, nev/5 ) vectors. If that is
+/// more than n/2, or if the iteration stalls or does not converge within
+/// maxiter iterations, the result is computed by `lapack::heevr` instead.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] nev
+///     The number of eigenvalues wanted. 0 <= nev <= n.
+///
+/// @param[in] A
+///     The n-by-n Hermitian matrix A, stored in an lda-by-n array.
+///     Only the uplo triangle is referenced. A is not modified.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] W
+///     The vector W of length nev.
+///     The nev smallest eigenvalues, in ascending order.
+///
+/// @param[in,out] Z
+///     The n-by-nev matrix Z, stored in an ldz-by-nev array.
+///     On entry, if warm, approximate eigenvectors, e.g., from the
+///     previous matrix in a sequence; they need not be orthonormal.
+///     Otherwise, Z need not be set.
+///     On exit, the orthonormal eigenvectors, with Z(:,i) for W(i).
+///
+/// @param[in] ldz
+///     The leading dimension of the array Z. ldz >= max(1,n).
+///
+/// @param[in] warm
+///     If true, start from the vectors in Z; otherwise, from random vectors.
+///
+/// @param[in] tol
+///     Convergence tolerance: each pair has
+///     $|| A z - \lambda z || \le tol \, || A ||$, estimated.
+///     tol > 0.
+///
+/// @param[in] maxiter
+///     The maximum number of iterations before falling back to heevr.
+///     maxiter >= 0.
+///
+/// @param[out] stats
+///     If not null, returns the number of iterations, subspace size,
+///     matrix-vector products, residual, and whether heevr was used.
+///
+/// @return = 0: successful exit
+/// @return > 0: heevr failed; see `lapack::heevr`.
+///
+/// @ingroup heev
+template <typename scalar_t>
+int64_t heev_chfsi(
+    lapack::Uplo uplo, int64_t n, int64_t nev,
+    scalar_t const* A, int64_t lda,
+    blas::real_type< scalar_t >* W,
+    scalar_t* Z, int64_t ldz,
+    bool warm,
+    blas::real_type< scalar_t > tol, int64_t maxiter,
+    ChfsiStats* stats )
+{
+    // The number of iterations, hence the Gflop count, depends on the data;
+    // the count is set at the end.
+    lapack_instrument( "heev_chfsi", internal::precision_char< scalar_t >(),
+                       0, n, nev, internal::gflop_data_dependent );
+
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    const scalar_t one = 1, zero = 0;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nev < 0 || nev > n );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldz < max( 1, n ) );
+    lapack_error_if( tol <= 0 );
+    lapack_error_if( maxiter < 0 );
+
+    ChfsiStats stats_;
+    if (nev == 0) {
+        if (stats)
+            *stats = stats_;
+        return 0;
+    }
+
+    int64_t ns = min( n, nev + max( chfsi_min_extra, nev / chfsi_extra_div ) );
+    stats_.subspace = ns;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    bool done = false;
+
+    std::vector< scalar_t > X, AX, Y, T, H;
+    std::vector< real_t > theta;
+    if (2*ns <= n) {
+        X.resize( n*ns );
+        AX.resize( n*ns );
+        Y.resize( n*ns );
+        T.resize( n*ns );
+        H.resize( ns*ns );
+        theta.resize( ns );
+
+        // Initial subspace: Z, if warm, plus random vectors.
+        int64_t nz = 0;
+        if (warm) {
+            lapack::lacpy( MatrixType::General, n, nev, Z, ldz, X.data(), n );
+            nz = nev;
+        }
+        lapack::larnv( 3, iseed, n*(ns - nz), &X[ nz*n ] );
+
+        int64_t k = min( n, chfsi_lanczos );
+        real_t b = chfsi_upper_bound( uplo, n, k, A, lda, iseed );
+        stats_.matvecs += k;
+
+        // Rayleigh-Ritz: X = orth( X ) V, AX = A X, with H = X^H A X = V Theta V^H.
+        // Returns the max relative residual of the first nev pairs.
+        real_t anorm = 0;
+        auto rayleigh_ritz = [&]() {
+            chfsi_orth( n, ns, X.data(), H.data() );
+            blas::hemm( Layout::ColMajor, Side::Left, uplo, n, ns,
+                        one, A, lda, X.data(), n, zero, AX.data(), n );
+            stats_.matvecs += ns;
+            blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans, ns, ns, n,
+                        one, X.data(), n, AX.data(), n, zero, H.data(), ns );
+            lapack::heevd( Job::Vec, Uplo::Upper, ns, H.data(), ns, theta.data() );
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, n, ns, ns,
+                        one, X.data(), n, H.data(), ns, zero, Y.data(), n );
+            std::swap( X, Y );
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, n, ns, ns,
+                        one, AX.data(), n, H.data(), ns, zero, Y.data(), n );
+            std::swap( AX, Y );
+
+            anorm = max( std::abs( b ), std::abs( theta[ 0 ] ) );
+            real_t maxres = 0;
+            for (int64_t i = 0; i < nev; ++i) {
+                blas::axpy( n, scalar_t( -theta[ i ] ), &X[ i*n ], 1, &AX[ i*n ], 1 );
+                maxres = max( maxres, blas::nrm2( n, &AX[ i*n ], 1 ) );
+            }
+            return maxres / anorm;
+        };
+
+        real_t res = rayleigh_ritz();
+        real_t best = res;
+        int stall = 0;
+        while (res > tol && stats_.iters < maxiter) {
+            ++stats_.iters;
+
+            // Filter damping [ a, b ], with a the largest Ritz value,
+            // scaled to be 1 at a0, the smallest Ritz value.
+            real_t a  = theta[ ns-1 ];
+            real_t a0 = theta[ 0 ];
+            if (! (a0 < a && a < b))
+                break;
+            real_t e = (b - a) / 2;
+            real_t c = (b + a) / 2;
+            real_t sigma = e / (a0 - c);
+            real_t tau = 2 / sigma;
+
+            // Y = (A X - c X) sigma / e
+            blas::hemm( Layout::ColMajor, Side::Left, uplo, n, ns,
+                        scalar_t( sigma / e ), A, lda, X.data(), n,
+                        zero, Y.data(), n );
+            blas::axpy( n*ns, scalar_t( -c * sigma / e ), X.data(), 1, Y.data(), 1 );
+            for (int deg = 2; deg <= chfsi_degree; ++deg) {
+                // T = (A Y - c Y) 2 sigma_new / e - sigma sigma_new X
+                real_t sigma_new = 1 / (tau - sigma);
+                real_t s = 2 * sigma_new / e;
+                blas::copy( n*ns, X.data(), 1, T.data(), 1 );
+                blas::hemm( Layout::ColMajor, Side::Left, uplo, n, ns,
+                            scalar_t( s ), A, lda, Y.data(), n,
+                            scalar_t( -sigma * sigma_new ), T.data(), n );
+                blas::axpy( n*ns, scalar_t( -c * s ), Y.data(), 1, T.data(), 1 );
+                std::swap( X, Y );
+                std::swap( Y, T );
+                sigma = sigma_new;
+            }
+            std::swap( X, Y );
+            stats_.matvecs += chfsi_degree * ns;
+
+            res = rayleigh_ritz();
+            if (res < chfsi_stall_factor * best) {
+                best = res;
+                stall = 0;
+            }
+            else if (++stall >= chfsi_stall_iters) {
+                break;
+            }
+        }
+        if (res <= tol) {
+            std::copy( theta.begin(), theta.begin() + nev, W );
+            lapack::lacpy( MatrixType::General, n, nev, X.data(), n, Z, ldz );
+            stats_.residual = res;
+            done = true;
+        }
+    }
+
+    int64_t info = 0;
+    if (! done) {
+        // Fall back to heevr.
+        stats_.fallback = true;
+        std::vector< scalar_t > Acopy( (size_t) n*n );
+        std::vector< real_t > Wn( n );
+        std::vector< int64_t > isuppz( 2*n );
+        lapack::lacpy( (uplo == Uplo::Upper ? MatrixType::Upper : MatrixType::Lower),
+                       n, n, A, lda, Acopy.data(), n );
+        int64_t nfound;
+        info = lapack::heevr( Job::Vec, Range::Index, uplo, n, Acopy.data(), n,
+                              0, 0, 1, nev, 0, &nfound, Wn.data(), Z, ldz,
+                              isuppz.data() );
+        std::copy( Wn.begin(), Wn.begin() + nev, W );
+        stats_.residual = 0;
+    }
+
+    // Products with A, and Rayleigh-Ritz on each filtered subspace, excluding
+    // the eigensolvers of the ns-by-ns projection and of the heevr fallback.
+    if (2*ns <= n) {
+        using G = Gflop< scalar_t >;
+        double orth = 2*(G::herk( ns, n ) + G::potrf( ns )
+                         + G::trsm( Side::Right, n, ns ));
+        double rr = orth + G::gemm( ns, ns, n ) + 2*G::gemm( n, ns, ns );
+        lapack_instrument_gflop( stats_.matvecs * G::hemv( n )
+                                 + (stats_.iters + 1) * rr );
+    }
+    if (stats)
+        *stats = stats_;
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t heev_chfsi< float >(
+    lapack::Uplo uplo, int64_t n, int64_t nev,
+    float const* A, int64_t lda,
+    float* W,
+    float* Z, int64_t ldz,
+    bool warm,
+    float tol, int64_t maxiter,
+    ChfsiStats* stats );
+
+template
+int64_t heev_chfsi< double >(
+    lapack::Uplo uplo, int64_t n, int64_t nev,
+    double const* A, int64_t lda,
+    double* W,
+    double* Z, int64_t ldz,
+    bool warm,
+    double tol, int64_t maxiter,
+    ChfsiStats* stats );
+
+template
+int64_t heev_chfsi< std::complex<float> >(
+    lapack::Uplo uplo, int64_t n, int64_t nev,
+    std::complex<float> const* A, int64_t lda,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    bool warm,
+    float tol, int64_t maxiter,
+    ChfsiStats* stats );
+
+template
+int64_t heev_chfsi< std::complex<double> >(
+    lapack::Uplo uplo, int64_t n, int64_t nev,
+    std::complex<double> const* A, int64_t lda,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    bool warm,
+    double tol, int64_t maxiter,
+    ChfsiStats* stats );
+
+}  // namespace lapack
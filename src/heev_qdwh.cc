@@ -0,0 +1,268 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+using blas::real;
+
+// Subproblems of this order or less are solved with heevd.
+static const int64_t qdwh_eig_min = 128;
+
+//------------------------------------------------------------------------------
+// Sets A = (A + A^H) / 2 for the n-by-n matrix A, storing both triangles.
+template <typename scalar_t>
+static void qdwh_eig_symmetrize( int64_t n, scalar_t* A, int64_t lda )
+{
+    using real_t = blas::real_type< scalar_t >;
+    for (int64_t j = 0; j < n; ++j) {
+        A[ j + j*lda ] = real( A[ j + j*lda ] );
+        for (int64_t i = j + 1; i < n; ++i) {
+            scalar_t aij = (A[ i + j*lda ] + conj( A[ j + i*lda ] )) / real_t( 2 );
+            A[ i + j*lda ] = aij;
+            A[ j + i*lda ] = conj( aij );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Computes all eigenvalues W, in ascending order, and eigenvectors Z of the
+// n-by-n Hermitian matrix A, with both triangles stored. A is destroyed.
+// Splits the spectrum at the median of diag( A ): the polar factor U_p of
+// A - sigma I gives the spectral projector P = (U_p + I) / 2 onto the
+// eigenspace for eigenvalues > sigma. QR with column pivoting of P gives an
+// orthonormal basis [ V1, V2 ] with V1 spanning range( P ), its dimension k
+// the rank revealed by the diagonal of R, and the subproblems V1^H A V1 and
+// V2^H A V2 are solved recursively. If V1 does not span an invariant
+// subspace, i.e., V2^H A V1 is not negligible, the split would lose or
+// duplicate eigenpairs, so heevd is used instead. This happens when sigma
+// is within rounding of an eigenvalue, so P is not a projector.
+template <typename scalar_t>
+static int64_t qdwh_eig_rec(
+    int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W,
+    scalar_t* Z, int64_t ldz )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    const scalar_t one = 1, zero = 0;
+
+    auto base_case = [&]() {
+        lapack::lacpy( MatrixType::Lower, n, n, A, lda, Z, ldz );
+        return lapack::heevd( Job::Vec, Uplo::Lower, n, Z, ldz, W );
+    };
+    if (n <= qdwh_eig_min)
+        return base_case();
+
+    // sigma = median of diag( A ).
+    std::vector< real_t > diag( n );
+    for (int64_t i = 0; i < n; ++i)
+        diag[ i ] = real( A[ i + i*lda ] );
+    std::nth_element( diag.begin(), diag.begin() + n/2, diag.end() );
+    real_t sigma = diag[ n/2 ];
+
+    // P = (polar( A - sigma I ) + I) / 2.
+    std::vector< scalar_t > P( n*n );
+    lapack::lacpy( MatrixType::General, n, n, A, lda, P.data(), n );
+    for (int64_t i = 0; i < n; ++i)
+        P[ i + i*n ] -= sigma;
+    if (lapack::polar( n, n, P.data(), n, (scalar_t*) nullptr, 1 ) != 0)
+        return base_case();
+    for (int64_t i = 0; i < n; ++i)
+        P[ i + i*n ] += one;
+    blas::scal( n*n, scalar_t( 0.5 ), P.data(), 1 );
+
+    // V = [ V1, V2 ] from P Pi = V R.
+    std::vector< int64_t > jpvt( n, 0 );
+    std::vector< scalar_t > tau( n );
+    lapack::geqp3( n, n, P.data(), n, jpvt.data(), tau.data() );
+
+    // k = rank( P ) = number of eigenvalues > sigma, from the diagonal of R,
+    // which is nonincreasing in magnitude. For a projector, it drops from
+    // O(1/n) or more to O(eps). If every eigenvalue is on one side of sigma,
+    // e.g., many equal eigenvalues, use heevd.
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t rank_tol = std::sqrt( eps ) * std::abs( P[ 0 ] );
+    int64_t k = 0;
+    while (k < n && std::abs( P[ k + k*n ] ) > rank_tol)
+        ++k;
+    if (k <= 0 || k >= n)
+        return base_case();
+    int64_t n2 = n - k;
+
+    lapack::ungqr( n, n, n, P.data(), n, tau.data() );
+    scalar_t* V1 = P.data();
+    scalar_t* V2 = &P[ k*n ];
+
+    // A1 = V1^H A V1 is k-by-k, A2 = V2^H A V2 is n2-by-n2.
+    std::vector< scalar_t > AV( n*n ), A1( k*k ), A2( n2*n2 );
+    blas::hemm( Layout::ColMajor, Side::Left, Uplo::Lower, n, n,
+                one, A, lda, P.data(), n, zero, AV.data(), n );
+    blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans, k, k, n,
+                one, V1, n, AV.data(), n, zero, A1.data(), k );
+    blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans, n2, n2, n,
+                one, V2, n, &AV[ k*n ], n, zero, A2.data(), n2 );
+
+    // The split is accurate only if E = V2^H A V1 is negligible.
+    std::vector< scalar_t > E( n2*k );
+    blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans, n2, k, n,
+                one, V2, n, AV.data(), n, zero, E.data(), n2 );
+    real_t Anorm = lapack::lange( Norm::Fro, n, n, A, lda );
+    real_t Enorm = lapack::lange( Norm::Fro, n2, k, E.data(), n2 );
+    if (Enorm > n * eps * Anorm)
+        return base_case();
+    qdwh_eig_symmetrize( k, A1.data(), k );
+    qdwh_eig_symmetrize( n2, A2.data(), n2 );
+
+    // Eigenvalues <= sigma first: Z = [ V2 Z2, V1 Z1 ].
+    std::vector< scalar_t >& Z1 = AV;  // reuse AV
+    std::vector< scalar_t > Z2( n2*n2 );
+    int64_t info = qdwh_eig_rec( n2, A2.data(), n2, W, Z2.data(), n2 );
+    if (info != 0)
+        return info;
+    info = qdwh_eig_rec( k, A1.data(), k, &W[ n2 ], Z1.data(), k );
+    if (info != 0)
+        return info;
+    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, n, n2, n2,
+                one, V2, n, Z2.data(), n2, zero, Z, ldz );
+    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, n, k, k,
+                one, V1, n, Z1.data(), k, zero, &Z[ n2*ldz ], ldz );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes all eigenvalues and, optionally, eigenvectors of an
+/// n-by-n Hermitian matrix A, using QDWH-based spectral divide and
+/// conquer (QDWH-eig) [Nakatsukasa, Higham, 2013].
+///
+/// At each level, the spectrum is split at the median of the diagonal,
+/// $\sigma$. The polar factor $U_p$ of $A - \sigma I$, computed by
+/// `lapack::polar`, gives the spectral projector $(U_p + I)/2$ onto the
+/// eigenspace for eigenvalues greater than $\sigma$. An orthonormal basis
+/// of it, from QR with column pivoting, with dimension the rank revealed by
+/// R, splits A into two decoupled Hermitian subproblems, which are solved
+/// recursively. Subproblems of order 128 or less, or that fail to split,
+/// or whose split leaves a coupling $V_2^H A V_1$ above $n \epsilon
+/// ||A||_F$, as when $\sigma$ is within rounding of an eigenvalue, are
+/// solved by `lapack::heevd`.
+///
+/// Unlike `lapack::heevd`, there is no reduction to tridiagonal form,
+/// half of which is BLAS-2 work; everything is in BLAS-3 operations
+/// (geqrf, ungqr, potrf, trsm, gemm), at the cost of more flops.
+/// Eigenvectors are always computed internally.
+///
+/// @param[in] jobz
+///     - lapack::Job::NoVec: Compute eigenvalues only;
+///     - lapack::Job::Vec:   Compute eigenvalues and eigenvectors.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the Hermitian matrix A, in the uplo triangle.
+///     On exit, if jobz = Vec, A contains the orthonormal eigenvectors,
+///     with A(:,i) for W(i). If jobz = NoVec, A is unchanged.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] W
+///     The vector W of length n.
+///     The eigenvalues in ascending order.
+///
+/// @return = 0: successful exit
+/// @return > 0: heevd failed on a subproblem; see `lapack::heevd`.
+///
+/// @ingroup heev
+template <typename scalar_t>
+int64_t heev_qdwh(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W )
+{
+    lapack_instrument( "heev_qdwh", internal::precision_char< scalar_t >(),
+                       0, n, 0, internal::gflop_data_dependent );
+
+    // check arguments
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    // quick return
+    if (n == 0)
+        return 0;
+
+    // F = A, with both triangles stored.
+    std::vector< scalar_t > F( n*n ), Z( n*n );
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            bool stored = (uplo == Uplo::Lower ? i >= j : i <= j);
+            F[ i + j*n ] = stored ? A[ i + j*lda ] : conj( A[ j + i*lda ] );
+        }
+    }
+    qdwh_eig_symmetrize( n, F.data(), n );
+
+    int64_t info = qdwh_eig_rec( n, F.data(), n, W, Z.data(), n );
+    if (info != 0)
+        return info;
+
+    // Subproblems are separated by sigma only up to rounding;
+    // restore ascending order.
+    for (int64_t j = 1; j < n; ++j) {
+        for (int64_t i = j; i > 0 && W[ i ] < W[ i-1 ]; --i) {
+            std::swap( W[ i ], W[ i-1 ] );
+            blas::swap( n, &Z[ i*n ], 1, &Z[ (i-1)*n ], 1 );
+        }
+    }
+
+    if (jobz == Job::Vec)
+        lapack::lacpy( MatrixType::General, n, n, Z.data(), n, A, lda );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t heev_qdwh< float >(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
+
+template
+int64_t heev_qdwh< double >(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
+
+template
+int64_t heev_qdwh< std::complex<float> >(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W );
+
+template
+int64_t heev_qdwh< std::complex<double> >(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W );
+
+}  // namespace lapack
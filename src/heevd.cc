@@ -23,6 +23,8 @@ int64_t heevd(
     std::complex<float>* A, int64_t lda,
     float* W )
 {
+    lapack_instrument( "heevd", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -134,6 +136,8 @@ int64_t heevd(
     std::complex<double>* A, int64_t lda,
     double* W )
 {
+    lapack_instrument( "heevd", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -25,6 +25,9 @@ int64_t heevd_2stage(
     std::complex<float>* A, int64_t lda,
     float* W )
 {
+    lapack_instrument( "heevd_2stage", 'c', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -166,6 +169,9 @@ int64_t heevd_2stage(
     std::complex<double>* A, int64_t lda,
     double* W )
 {
+    lapack_instrument( "heevd_2stage", 'z', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -26,6 +26,8 @@ int64_t heevr(
     std::complex<float>* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "heevr", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -294,6 +296,8 @@ int64_t heevr(
     std::complex<double>* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "heevr", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
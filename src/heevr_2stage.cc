@@ -28,6 +28,9 @@ int64_t heevr_2stage(
     std::complex<float>* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "heevr_2stage", 'c', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -326,6 +329,9 @@ int64_t heevr_2stage(
     std::complex<double>* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "heevr_2stage", 'z', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -26,6 +26,8 @@ int64_t heevx(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "heevx", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -229,6 +231,8 @@ int64_t heevx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "heevx", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
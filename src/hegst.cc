@@ -21,6 +21,9 @@ int64_t hegst(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "hegst", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hegst( n ) );
+
     lapack_int itype_ = to_lapack_int( itype );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -45,6 +48,9 @@ int64_t hegst(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "hegst", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hegst( n ) );
+
     lapack_int itype_ = to_lapack_int( itype );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -23,6 +23,8 @@ int64_t hegv(
     std::complex<float>* B, int64_t ldb,
     float* W )
 {
+    lapack_instrument( "hegv", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -73,6 +75,8 @@ int64_t hegv(
     std::complex<double>* B, int64_t ldb,
     double* W )
 {
+    lapack_instrument( "hegv", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
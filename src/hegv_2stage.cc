@@ -25,6 +25,9 @@ int64_t hegv_2stage(
     std::complex<float>* B, int64_t ldb,
     float* W )
 {
+    lapack_instrument( "hegv_2stage", 'c', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -75,6 +78,9 @@ int64_t hegv_2stage(
     std::complex<double>* B, int64_t ldb,
     double* W )
 {
+    lapack_instrument( "hegv_2stage", 'z', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
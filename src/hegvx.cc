@@ -26,6 +26,8 @@ int64_t hegvx(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "hegvx", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -105,6 +107,8 @@ int64_t hegvx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "hegvx", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
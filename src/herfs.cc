@@ -28,6 +28,9 @@ int64_t herfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "herfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -162,6 +165,9 @@ int64_t herfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "herfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -34,6 +34,9 @@ int64_t herfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    lapack_instrument( "herfsx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -366,6 +369,9 @@ int64_t herfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    lapack_instrument( "herfsx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
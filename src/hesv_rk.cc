@@ -27,6 +27,9 @@ int64_t hesv_rk(
     int64_t* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "hesv_rk", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::hesv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -199,6 +202,9 @@ int64_t hesv_rk(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "hesv_rk", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::hesv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
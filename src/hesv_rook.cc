@@ -26,6 +26,9 @@ int64_t hesv_rook(
     int64_t* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "hesv_rook", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::hesv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -84,6 +87,9 @@ int64_t hesv_rook(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "hesv_rook", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::hesv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
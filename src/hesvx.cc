@@ -29,6 +29,9 @@ int64_t hesvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "hesvx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -239,6 +242,9 @@ int64_t hesvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "hesvx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
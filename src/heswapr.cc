@@ -23,6 +23,8 @@ void heswapr(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda, int64_t i1, int64_t i2 )
 {
+    lapack_instrument( "heswapr", 'c', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -71,6 +73,8 @@ void heswapr(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda, int64_t i1, int64_t i2 )
 {
+    lapack_instrument( "heswapr", 'z', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -25,6 +25,9 @@ int64_t hetrd(
     float* E,
     std::complex<float>* tau )
 {
+    lapack_instrument( "hetrd", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hetrd( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -178,6 +181,9 @@ int64_t hetrd(
     double* E,
     std::complex<double>* tau )
 {
+    lapack_instrument( "hetrd", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hetrd( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -28,6 +28,9 @@ int64_t hetrd_2stage(
     std::complex<float>* tau,
     std::complex<float>* hous2, int64_t lhous2 )
 {
+    lapack_instrument( "hetrd_2stage", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hetrd( n ) );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -191,6 +194,9 @@ int64_t hetrd_2stage(
     std::complex<double>* tau,
     std::complex<double>* hous2, int64_t lhous2 )
 {
+    lapack_instrument( "hetrd_2stage", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hetrd( n ) );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
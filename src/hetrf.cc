@@ -23,6 +23,9 @@ int64_t hetrf(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "hetrf", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hetrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -183,6 +186,9 @@ int64_t hetrf(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "hetrf", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hetrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -26,6 +26,9 @@ int64_t hetrf_rk(
     std::complex<float>* E,
     int64_t* ipiv )
 {
+    lapack_instrument( "hetrf_rk", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hetrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -237,6 +240,9 @@ int64_t hetrf_rk(
     std::complex<double>* E,
     int64_t* ipiv )
 {
+    lapack_instrument( "hetrf_rk", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hetrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
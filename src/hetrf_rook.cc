@@ -25,6 +25,9 @@ int64_t hetrf_rook(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "hetrf_rook", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hetrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -78,6 +81,9 @@ int64_t hetrf_rook(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "hetrf_rook", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hetrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -25,6 +25,9 @@ int64_t hetri2(
     std::complex<float>* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "hetri2", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hetri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -119,6 +122,9 @@ int64_t hetri2(
     std::complex<double>* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "hetri2", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hetri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -26,6 +26,9 @@ int64_t hetri_rk(
     std::complex<float> const* E,
     int64_t const* ipiv )
 {
+    lapack_instrument( "hetri_rk", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hetri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -164,6 +167,9 @@ int64_t hetri_rk(
     std::complex<double> const* E,
     int64_t const* ipiv )
 {
+    lapack_instrument( "hetri_rk", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hetri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
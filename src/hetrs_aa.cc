@@ -26,6 +26,9 @@ int64_t hetrs_aa(
     int64_t const* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "hetrs_aa", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::hetrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -108,6 +111,9 @@ int64_t hetrs_aa(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "hetrs_aa", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::hetrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -21,6 +21,9 @@ void hfrk(
     std::complex<float> const* A, int64_t lda, float beta,
     std::complex<float>* C )
 {
+    lapack_instrument( "hfrk", 'c', 0, n, k,
+                       Gflop< std::complex<float> >::herk( n, k ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
@@ -41,6 +44,9 @@ void hfrk(
     std::complex<double> const* A, int64_t lda, double beta,
     std::complex<double>* C )
 {
+    lapack_instrument( "hfrk", 'z', 0, n, k,
+                       Gflop< std::complex<double> >::herk( n, k ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
@@ -26,6 +26,8 @@ int64_t hgeqz(
     float* Q, int64_t ldq,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "hgeqz", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobschur_ = to_char( jobschur );
     char compq_ = to_char_comp( compq );
     char compz_ = to_char_comp( compz );
@@ -95,6 +97,8 @@ int64_t hgeqz(
     double* Q, int64_t ldq,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "hgeqz", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobschur_ = to_char( jobschur );
     char compq_ = to_char_comp( compq );
     char compz_ = to_char_comp( compz );
@@ -164,6 +168,8 @@ int64_t hgeqz(
     std::complex<float>* Q, int64_t ldq,
     std::complex<float>* Z, int64_t ldz )
 {
+    lapack_instrument( "hgeqz", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobschur_ = to_char( jobschur );
     char compq_ = to_char_comp( compq );
     char compz_ = to_char_comp( compz );
@@ -227,6 +233,8 @@ int64_t hgeqz(
     std::complex<double>* Q, int64_t ldq,
     std::complex<double>* Z, int64_t ldz )
 {
+    lapack_instrument( "hgeqz", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobschur_ = to_char( jobschur );
     char compq_ = to_char_comp( compq );
     char compz_ = to_char_comp( compz );
@@ -23,6 +23,8 @@ int64_t hpcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "hpcon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -56,6 +58,8 @@ int64_t hpcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "hpcon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
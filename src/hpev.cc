@@ -23,6 +23,8 @@ int64_t hpev(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    lapack_instrument( "hpev", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -54,6 +56,8 @@ int64_t hpev(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    lapack_instrument( "hpev", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -23,6 +23,8 @@ int64_t hpevd(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    lapack_instrument( "hpevd", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -77,6 +79,8 @@ int64_t hpevd(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    lapack_instrument( "hpevd", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -21,6 +21,9 @@ int64_t hpgst(
     std::complex<float>* AP,
     std::complex<float> const* BP )
 {
+    lapack_instrument( "hpgst", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hegst( n ) );
+
     lapack_int itype_ = to_lapack_int( itype );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -43,6 +46,9 @@ int64_t hpgst(
     std::complex<double>* AP,
     std::complex<double> const* BP )
 {
+    lapack_instrument( "hpgst", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hegst( n ) );
+
     lapack_int itype_ = to_lapack_int( itype );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -24,6 +24,8 @@ int64_t hpgv(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    lapack_instrument( "hpgv", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -58,6 +60,8 @@ int64_t hpgv(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    lapack_instrument( "hpgv", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
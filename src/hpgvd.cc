@@ -24,6 +24,8 @@ int64_t hpgvd(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    lapack_instrument( "hpgvd", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -82,6 +84,8 @@ int64_t hpgvd(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    lapack_instrument( "hpgvd", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
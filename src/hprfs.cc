@@ -27,6 +27,9 @@ int64_t hprfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "hprfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -74,6 +77,9 @@ int64_t hprfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "hprfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
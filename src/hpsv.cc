@@ -23,6 +23,9 @@ int64_t hpsv(
     int64_t* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "hpsv", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::hesv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -58,6 +61,9 @@ int64_t hpsv(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "hpsv", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::hesv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -28,6 +28,9 @@ int64_t hpsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "hpsvx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -80,6 +83,9 @@ int64_t hpsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "hpsvx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
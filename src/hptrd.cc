@@ -23,6 +23,9 @@ int64_t hptrd(
     float* E,
     std::complex<float>* tau )
 {
+    lapack_instrument( "hptrd", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hetrd( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -48,6 +51,9 @@ int64_t hptrd(
     double* E,
     std::complex<double>* tau )
 {
+    lapack_instrument( "hptrd", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hetrd( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
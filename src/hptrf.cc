@@ -22,6 +22,9 @@ int64_t hptrf(
     std::complex<float>* AP,
     int64_t* ipiv )
 {
+    lapack_instrument( "hptrf", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hetrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -53,6 +56,9 @@ int64_t hptrf(
     std::complex<double>* AP,
     int64_t* ipiv )
 {
+    lapack_instrument( "hptrf", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hetrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -22,6 +22,9 @@ int64_t hptri(
     std::complex<float>* AP,
     int64_t const* ipiv )
 {
+    lapack_instrument( "hptri", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::hetri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -54,6 +57,9 @@ int64_t hptri(
     std::complex<double>* AP,
     int64_t const* ipiv )
 {
+    lapack_instrument( "hptri", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::hetri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
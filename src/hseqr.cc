@@ -24,6 +24,8 @@ int64_t hseqr(
     std::complex<float>* W,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "hseqr", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobschur_ = to_char( jobschur );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
@@ -82,6 +84,8 @@ int64_t hseqr(
     std::complex<double>* W,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "hseqr", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobschur_ = to_char( jobschur );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
@@ -140,6 +144,8 @@ int64_t hseqr(
     std::complex<float>* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    lapack_instrument( "hseqr", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobschur_ = to_char( jobschur );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
@@ -315,6 +321,8 @@ int64_t hseqr(
     std::complex<double>* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    lapack_instrument( "hseqr", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobschur_ = to_char( jobschur );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
@@ -0,0 +1,176 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/tune.hh"
+#include "lapack/fortran.h"
+
+// Interposes ILAENV and ILAENV2STAGE, so LAPACK routines use the block
+// sizes in lapack::tune. Enabled by the build option ilaenv_override=yes;
+// see lapack/tune.hh.
+#ifdef LAPACK_ILAENV_OVERRIDE
+
+#include <dlfcn.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#define LAPACK_ilaenv       LAPACK_GLOBAL( ilaenv, ILAENV )
+#define LAPACK_ilaenv2stage LAPACK_GLOBAL( ilaenv2stage, ILAENV2STAGE )
+
+#define LAPACK_string_( name ) #name
+#define LAPACK_string( name ) LAPACK_string_( name )
+
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    #define LAPACK_ilaenv_strlen , size_t name_len, size_t opts_len
+    #define LAPACK_ilaenv_strlen_args , name_len, opts_len
+#else
+    #define LAPACK_ilaenv_strlen
+    #define LAPACK_ilaenv_strlen_args
+#endif
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+typedef lapack_int (*ilaenv_func)(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2,
+    lapack_int const* n3, lapack_int const* n4
+    LAPACK_ilaenv_strlen );
+
+//------------------------------------------------------------------------------
+// @return the LAPACK library's function symbol, which this one hides.
+// Aborts if there is none, as LAPACK has no way to handle an error here.
+ilaenv_func next_ilaenv( char const* symbol )
+{
+    void* func = dlsym( RTLD_NEXT, symbol );
+    if (func == nullptr) {
+        fprintf( stderr, "LAPACK++ ilaenv_override: %s not found in the"
+                 " LAPACK library, which must be a shared library\n",
+                 symbol );
+        std::abort();
+    }
+    return (ilaenv_func) func;
+}
+
+//------------------------------------------------------------------------------
+// Copies Fortran string name, of length len, to routine as lowercase,
+// without trailing blanks.
+void lower_name( char const* name, size_t len, char* routine, size_t size )
+{
+    size_t i = 0;
+    for (; i < len && i < size - 1 && name[ i ] != ' ' && name[ i ] != '\0';
+         ++i) {
+        routine[ i ] = char( std::tolower( (unsigned char) name[ i ] ) );
+    }
+    routine[ i ] = '\0';
+}
+
+//------------------------------------------------------------------------------
+// Maps a LAPACK routine name, e.g., "dsytrd", to the tuned routine
+// and its size.
+// @return the tuned routine, or nullptr if it isn't tuned.
+char const* tune_routine(
+    char const* routine, lapack_int n1, lapack_int n2, int64_t* n )
+{
+    if (routine[ 0 ] == '\0')
+        return nullptr;
+
+    char const* name = routine + 1;  // without precision
+    if (strcmp( name, "getrf" ) == 0
+        || strcmp( name, "geqrf" ) == 0
+        || strcmp( name, "gebrd" ) == 0) {
+        *n = std::min( n1, n2 );
+        return name;
+    }
+    if (strcmp( name, "sytrd" ) == 0 || strcmp( name, "hetrd" ) == 0) {
+        *n = n1;
+        return "hetrd";
+    }
+    return nullptr;
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace lapack
+
+extern "C" {
+
+//------------------------------------------------------------------------------
+// ILAENV( ispec, name, opts, n1, n2, n3, n4 ). Returns the tuned nb for
+// ispec = 1 and nx for ispec = 3, if set; otherwise forwards the query.
+lapack_int LAPACK_ilaenv(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2,
+    lapack_int const* n3, lapack_int const* n4
+    LAPACK_ilaenv_strlen )
+{
+    using namespace lapack::internal;
+    static ilaenv_func next = next_ilaenv( LAPACK_string( LAPACK_ilaenv ) );
+
+    if (*ispec == 1 || *ispec == 3) {
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+            size_t len = name_len;
+        #else
+            size_t len = strlen( name );
+        #endif
+        char routine[ 16 ];
+        lower_name( name, len, routine, sizeof(routine) );
+        int64_t n, nb, nx;
+        char const* tuned = tune_routine( routine, *n1, *n2, &n );
+        if (tuned != nullptr
+            && tuned_block_size( tuned, routine[ 0 ], n, &nb, &nx )) {
+            if (*ispec == 1)
+                return lapack_int( nb );
+            if (nx >= 0)
+                return lapack_int( nx );
+        }
+    }
+    return next( ispec, name, opts, n1, n2, n3, n4
+                 LAPACK_ilaenv_strlen_args );
+}
+
+//------------------------------------------------------------------------------
+// ILAENV2STAGE( ispec, name, opts, n1, n2, n3, n4 ). Returns the tuned kd
+// of hetrd_2stage for ispec = 1, if set; otherwise forwards the query.
+// xSYTRD_2STAGE and xHETRD_2STAGE query kd with n1 = n.
+lapack_int LAPACK_ilaenv2stage(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2,
+    lapack_int const* n3, lapack_int const* n4
+    LAPACK_ilaenv_strlen )
+{
+    using namespace lapack::internal;
+    static ilaenv_func next
+        = next_ilaenv( LAPACK_string( LAPACK_ilaenv2stage ) );
+
+    if (*ispec == 1) {
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+            size_t len = name_len;
+        #else
+            size_t len = strlen( name );
+        #endif
+        char routine[ 16 ];
+        lower_name( name, len, routine, sizeof(routine) );
+        int64_t nb, nx;
+        if (routine[ 0 ] != '\0'
+            && (strcmp( routine + 1, "sytrd_2stage" ) == 0
+                || strcmp( routine + 1, "hetrd_2stage" ) == 0)
+            && tuned_block_size( "hetrd_2stage", routine[ 0 ], *n1,
+                                 &nb, &nx )) {
+            return lapack_int( nb );
+        }
+    }
+    return next( ispec, name, opts, n1, n2, n3, n4
+                 LAPACK_ilaenv_strlen_args );
+}
+
+}  // extern "C"
+
+#endif  // LAPACK_ILAENV_OVERRIDE
@@ -0,0 +1,203 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/instrument.hh"
+#include "lapack/trace.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace lapack {
+
+namespace internal {
+
+std::atomic< int > instrument_flags( 0 );
+
+thread_local int64_t instrument_work_bytes = 0;
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Registry of all counters. Counters are static objects in the wrappers;
+// the registry is never destroyed, so counters that are constructed or
+// called during static destruction are safe.
+struct Registry {
+    std::mutex mutex;
+    std::vector< InstrumentCounter* > counters;
+};
+
+Registry& registry()
+{
+    static Registry* r = new Registry;
+    return *r;
+}
+
+//------------------------------------------------------------------------------
+// C++17 lacks atomic< double >::fetch_add.
+void atomic_add( std::atomic< double >& x, double y )
+{
+    double old = x.load( std::memory_order_relaxed );
+    while (! x.compare_exchange_weak( old, old + y,
+                                      std::memory_order_relaxed )) {}
+}
+
+void atomic_max( std::atomic< int64_t >& x, int64_t y )
+{
+    int64_t old = x.load( std::memory_order_relaxed );
+    while (old < y
+           && ! x.compare_exchange_weak( old, y,
+                                         std::memory_order_relaxed )) {}
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+double instrument_time()
+{
+    using clock = std::chrono::steady_clock;
+    return std::chrono::duration< double >(
+        clock::now().time_since_epoch() ).count();
+}
+
+//------------------------------------------------------------------------------
+void InstrumentTimer::start()
+{
+    start_ = instrument_time();
+    work_ = instrument_work_bytes;
+}
+
+//------------------------------------------------------------------------------
+void InstrumentTimer::stop()
+{
+    double end = instrument_time();
+    int flags = instrument_flags.load( std::memory_order_relaxed );
+    if (flags & InstrumentStats) {
+        counter_->add( m_, n_, k_, gflop_, end - start_ );
+    }
+    if (flags & InstrumentTrace) {
+        trace_event( counter_->routine(), counter_->precision(), "lapack",
+                     m_, n_, k_, instrument_work_bytes - work_,
+                     start_, start_, end );
+    }
+}
+
+//------------------------------------------------------------------------------
+InstrumentCounter::InstrumentCounter( char const* routine, char precision )
+    : routine_( routine ),
+      precision_( precision ),
+      calls_( 0 ),
+      time_( 0 ),
+      gflop_( 0 ),
+      m_max_( 0 ),
+      n_max_( 0 ),
+      k_max_( 0 )
+{
+    Registry& r = registry();
+    std::lock_guard< std::mutex > lock( r.mutex );
+    r.counters.push_back( this );
+}
+
+//------------------------------------------------------------------------------
+void InstrumentCounter::add(
+    int64_t m, int64_t n, int64_t k, double gflop, double time )
+{
+    calls_.fetch_add( 1, std::memory_order_relaxed );
+    atomic_add( time_, time );
+    atomic_add( gflop_, gflop );
+    atomic_max( m_max_, m );
+    atomic_max( n_max_, n );
+    atomic_max( k_max_, k );
+}
+
+//------------------------------------------------------------------------------
+// Adds this counter's statistics to record.
+void InstrumentCounter::get( instrument::Record* record )
+{
+    record->calls += calls_.load( std::memory_order_relaxed );
+    record->time  += time_ .load( std::memory_order_relaxed );
+    record->gflop += gflop_.load( std::memory_order_relaxed );
+    record->m_max = std::max( record->m_max,
+                              m_max_.load( std::memory_order_relaxed ) );
+    record->n_max = std::max( record->n_max,
+                              n_max_.load( std::memory_order_relaxed ) );
+    record->k_max = std::max( record->k_max,
+                              k_max_.load( std::memory_order_relaxed ) );
+}
+
+//------------------------------------------------------------------------------
+void InstrumentCounter::clear()
+{
+    calls_.store( 0, std::memory_order_relaxed );
+    time_ .store( 0, std::memory_order_relaxed );
+    gflop_.store( 0, std::memory_order_relaxed );
+    m_max_.store( 0, std::memory_order_relaxed );
+    n_max_.store( 0, std::memory_order_relaxed );
+    k_max_.store( 0, std::memory_order_relaxed );
+}
+
+}  // namespace internal
+
+namespace instrument {
+
+//------------------------------------------------------------------------------
+void enable( bool on )
+{
+    if (on)
+        internal::instrument_flags.fetch_or( internal::InstrumentStats );
+    else
+        internal::instrument_flags.fetch_and( ~internal::InstrumentStats );
+}
+
+//------------------------------------------------------------------------------
+bool enabled()
+{
+    int flags = internal::instrument_flags.load( std::memory_order_relaxed );
+    return (flags & internal::InstrumentStats) != 0;
+}
+
+//------------------------------------------------------------------------------
+// Several wrappers can have the same name and precision, e.g., overloads;
+// they are aggregated into one record.
+std::vector< Record > snapshot()
+{
+    std::map< std::pair< std::string, char >, Record > records;
+    {
+        internal::Registry& r = internal::registry();
+        std::lock_guard< std::mutex > lock( r.mutex );
+        for (auto counter : r.counters) {
+            auto key = std::make_pair( std::string( counter->routine() ),
+                                       counter->precision() );
+            auto iter = records.find( key );
+            if (iter == records.end()) {
+                Record record { key.first, key.second, 0, 0, 0, 0, 0, 0 };
+                iter = records.emplace( key, record ).first;
+            }
+            counter->get( &iter->second );
+        }
+    }
+
+    std::vector< Record > result;
+    for (auto& iter : records) {
+        if (iter.second.calls > 0)
+            result.push_back( iter.second );
+    }
+    return result;
+}
+
+//------------------------------------------------------------------------------
+void reset()
+{
+    internal::Registry& r = internal::registry();
+    std::lock_guard< std::mutex > lock( r.mutex );
+    for (auto counter : r.counters) {
+        counter->clear();
+    }
+}
+
+}  // namespace instrument
+}  // namespace lapack
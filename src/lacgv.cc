@@ -21,6 +21,8 @@ void lacgv(
     int64_t n,
     std::complex<float>* x, int64_t incx )
 {
+    lapack_instrument( "lacgv", 'c', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
@@ -53,6 +55,8 @@ void lacgv(
     int64_t n,
     std::complex<double>* x, int64_t incx )
 {
+    lapack_instrument( "lacgv", 'z', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
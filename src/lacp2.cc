@@ -21,6 +21,8 @@ void lacp2(
     float const* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "lacp2", 'c', m, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -40,6 +42,8 @@ void lacp2(
     double const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "lacp2", 'z', m, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
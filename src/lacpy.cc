@@ -22,6 +22,8 @@ void lacpy(
     float const* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "lacpy", 's', m, n, 0, internal::gflop_none );
+
     char matrixtype_ = to_char( matrixtype );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -42,6 +44,8 @@ void lacpy(
     double const* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "lacpy", 'd', m, n, 0, internal::gflop_none );
+
     char matrixtype_ = to_char( matrixtype );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -62,6 +66,8 @@ void lacpy(
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "lacpy", 'c', m, n, 0, internal::gflop_none );
+
     char matrixtype_ = to_char( matrixtype );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -116,6 +122,8 @@ void lacpy(
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "lacpy", 'z', m, n, 0, internal::gflop_none );
+
     char matrixtype_ = to_char( matrixtype );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -4,6 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
+#include "lapack_internal.hh"
 #include "lapack/fortran.h"
 
 #include <vector>
@@ -17,6 +18,8 @@ void lae2(
     float* rt1,
     float* rt2 )
 {
+    lapack_instrument( "lae2", 's', 0, 0, 0, internal::gflop_none );
+
     LAPACK_slae2(
         &a, &b, &c, rt1, rt2 );
 }
@@ -66,6 +69,8 @@ void lae2(
     double* rt1,
     double* rt2 )
 {
+    lapack_instrument( "lae2", 'd', 0, 0, 0, internal::gflop_none );
+
     LAPACK_dlae2(
         &a, &b, &c, rt1, rt2 );
 }
@@ -24,6 +24,8 @@ int64_t laed4(
     float* delta, float rho,
     float* lambda )
 {
+    lapack_instrument( "laed4", 's', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int i_ = to_lapack_int( i ) + 1;  // change to 1-based
     lapack_int info_ = 0;
@@ -100,6 +102,8 @@ int64_t laed4(
     double* delta, double rho,
     double* lambda )
 {
+    lapack_instrument( "laed4", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int i_ = to_lapack_int( i ) + 1;  // change to 1-based
     lapack_int info_ = 0;
@@ -0,0 +1,159 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+// Below this size, thread startup costs more than the root solves.
+static const int64_t laed4_all_threshold = 128;
+
+//------------------------------------------------------------------------------
+// Overloads to select the LAPACK laed4 precision in laed4_all_impl.
+static void laed4_fortran(
+    lapack_int const* n, lapack_int const* i, float const* d, float const* z,
+    float* delta, float const* rho, float* lambda, lapack_int* info )
+{
+    LAPACK_slaed4( n, i, d, z, delta, rho, lambda, info );
+}
+
+static void laed4_fortran(
+    lapack_int const* n, lapack_int const* i, double const* d, double const* z,
+    double* delta, double const* rho, double* lambda, lapack_int* info )
+{
+    LAPACK_dlaed4( n, i, d, z, delta, rho, lambda, info );
+}
+
+template <typename scalar_t>
+static int64_t laed4_all_impl(
+    int64_t n,
+    scalar_t const* d,
+    scalar_t const* z,
+    scalar_t* Delta, int64_t lddelta,
+    scalar_t rho,
+    scalar_t* lambda )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( Delta != nullptr && lddelta < max( 1, n ) );
+
+    lapack_int n_ = to_lapack_int( n );
+    int64_t first_fail = n;  // 0-based index of first failed root; n if none
+
+    // Each root is independent and uses exactly the same LAPACK laed4
+    // iteration, so results are bitwise identical to calling laed4 in a
+    // loop, regardless of the number of threads. Iteration counts vary
+    // per root, so use dynamic scheduling.
+    #pragma omp parallel if (n >= laed4_all_threshold)
+    {
+        // Scratch delta if the caller doesn't need it.
+        std::vector< scalar_t > delta_scratch;
+        if (Delta == nullptr)
+            delta_scratch.resize( n );
+
+        #pragma omp for schedule( dynamic, 16 ) reduction( min: first_fail )
+        for (int64_t i = 0; i < n; ++i) {
+            lapack_int i_ = lapack_int( i + 1 );  // change to 1-based
+            lapack_int info_ = 0;
+            scalar_t* delta = (Delta == nullptr
+                               ? &delta_scratch[ 0 ]
+                               : &Delta[ i*lddelta ]);
+            laed4_fortran( &n_, &i_, d, z, delta, &rho, &lambda[ i ], &info_ );
+            if (info_ > 0)
+                first_fail = min( first_fail, i );
+        }
+    }
+    return (first_fail < n ? first_fail + 1 : 0);
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup heev_auxiliary
+int64_t laed4_all(
+    int64_t n,
+    float const* d,
+    float const* z,
+    float* Delta, int64_t lddelta,
+    float rho,
+    float* lambda )
+{
+    lapack_instrument( "laed4_all", 's', 0, n, 0,
+                       internal::gflop_data_dependent );
+
+    return laed4_all_impl( n, d, z, Delta, lddelta, rho, lambda );
+}
+
+//------------------------------------------------------------------------------
+/// Computes all n updated eigenvalues of a symmetric rank-one modification
+/// to a diagonal matrix,
+/// \[
+///     diag( d ) + \rho z z^T,
+/// \]
+/// that is, all roots of the secular equation, in one call.
+/// This is equivalent to calling `lapack::laed4` for i = 0, ..., n-1,
+/// with bitwise identical results, but the independent root solves
+/// are distributed over OpenMP threads when n is large enough.
+///
+/// As for `lapack::laed4`, it is assumed that d(i) < d(j) for i < j,
+/// that rho > 0, and that the Euclidean norm of z is 1.
+///
+/// Overloaded versions are available for
+/// `float`, `double`.
+///
+/// @param[in] n
+///     The length of all arrays.
+///
+/// @param[in] d
+///     The vector d of length n.
+///     The original eigenvalues, in strictly increasing order.
+///
+/// @param[in] z
+///     The vector z of length n.
+///     The components of the updating vector.
+///
+/// @param[out] Delta
+///     The n-by-n matrix Delta, stored in an lddelta-by-n array.
+///     Column i contains delta for root i as returned by `lapack::laed4`,
+///     i.e., for n > 2, Delta(j, i) = d(j) - lambda(i), which is the
+///     information needed to construct the eigenvectors.
+///     If Delta is null, it is not returned.
+///
+/// @param[in] lddelta
+///     The leading dimension of the array Delta. lddelta >= max(1,n).
+///     Ignored if Delta is null.
+///
+/// @param[in] rho
+///     The scalar in the symmetric updating formula.
+///
+/// @param[out] lambda
+///     The vector lambda of length n.
+///     The updated eigenvalues, lambda(i) is the i-th root.
+///
+/// @retval = 0: successful exit
+/// @retval > 0: if return value = i, the updating process failed
+///     for root i-1 (0-based), the first root that failed.
+///     Other roots are still computed.
+///
+/// @ingroup heev_auxiliary
+int64_t laed4_all(
+    int64_t n,
+    double const* d,
+    double const* z,
+    double* Delta, int64_t lddelta,
+    double rho,
+    double* lambda )
+{
+    lapack_instrument( "laed4_all", 'd', 0, n, 0,
+                       internal::gflop_data_dependent );
+
+    return laed4_all_impl( n, d, z, Delta, lddelta, rho, lambda );
+}
+
+}  // namespace lapack
@@ -4,6 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
+#include "lapack_internal.hh"
 #include "lapack/fortran.h"
 
 #include <vector>
@@ -19,6 +20,8 @@ void laev2(
     float* cs1,
     float* sn1 )
 {
+    lapack_instrument( "laev2", 's', 0, 0, 0, internal::gflop_none );
+
     LAPACK_slaev2(
         &a, &b, &c, rt1, rt2, cs1, sn1 );
 }
@@ -32,6 +35,8 @@ void laev2(
     double* cs1,
     double* sn1 )
 {
+    lapack_instrument( "laev2", 'd', 0, 0, 0, internal::gflop_none );
+
     LAPACK_dlaev2(
         &a, &b, &c, rt1, rt2, cs1, sn1 );
 }
@@ -45,6 +50,8 @@ void laev2(
     float* cs1,
     std::complex<float>* sn1 )
 {
+    lapack_instrument( "laev2", 'c', 0, 0, 0, internal::gflop_none );
+
     LAPACK_claev2(
         (lapack_complex_float*) &a,
         (lapack_complex_float*) &b,
@@ -112,6 +119,8 @@ void laev2(
     double* cs1,
     std::complex<double>* sn1 )
 {
+    lapack_instrument( "laev2", 'z', 0, 0, 0, internal::gflop_none );
+
     LAPACK_zlaev2(
         (lapack_complex_double*) &a,
         (lapack_complex_double*) &b,
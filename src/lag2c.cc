@@ -21,6 +21,8 @@ int64_t lag2c(
     std::complex<double> const* A, int64_t lda,
     std::complex<float>* SA, int64_t ldsa )
 {
+    lapack_instrument( "lag2c", 'z', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -21,6 +21,8 @@ int64_t lag2s(
     double const* A, int64_t lda,
     float* SA, int64_t ldsa )
 {
+    lapack_instrument( "lag2s", 'd', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -21,6 +21,8 @@ int64_t lag2z(
     std::complex<float> const* SA, int64_t ldsa,
     std::complex<double>* A, int64_t lda )
 {
+    lapack_instrument( "lag2z", 'c', m, n, 0, internal::gflop_none );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldsa_ = to_lapack_int( ldsa );
@@ -25,6 +25,8 @@ int64_t lagge(
     float* A, int64_t lda,
     int64_t* iseed )
 {
+    lapack_instrument( "lagge", 's', m, n, 0, internal::gflop_no_formula );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -64,6 +66,8 @@ int64_t lagge(
     double* A, int64_t lda,
     int64_t* iseed )
 {
+    lapack_instrument( "lagge", 'd', m, n, 0, internal::gflop_no_formula );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -103,6 +107,8 @@ int64_t lagge(
     std::complex<float>* A, int64_t lda,
     int64_t* iseed )
 {
+    lapack_instrument( "lagge", 'c', m, n, 0, internal::gflop_no_formula );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -142,6 +148,8 @@ int64_t lagge(
     std::complex<double>* A, int64_t lda,
     int64_t* iseed )
 {
+    lapack_instrument( "lagge", 'z', m, n, 0, internal::gflop_no_formula );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
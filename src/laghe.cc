@@ -25,6 +25,8 @@ int64_t laghe(
     std::complex<float>* A, int64_t lda,
     int64_t* iseed )
 {
+    lapack_instrument( "laghe", 'c', 0, n, k, internal::gflop_no_formula );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
     lapack_int lda_ = to_lapack_int( lda );
@@ -62,6 +64,8 @@ int64_t laghe(
     std::complex<double>* A, int64_t lda,
     int64_t* iseed )
 {
+    lapack_instrument( "laghe", 'z', 0, n, k, internal::gflop_no_formula );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
     lapack_int lda_ = to_lapack_int( lda );
@@ -25,6 +25,8 @@ int64_t lagsy(
     float* A, int64_t lda,
     int64_t* iseed )
 {
+    lapack_instrument( "lagsy", 's', 0, n, k, internal::gflop_no_formula );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
     lapack_int lda_ = to_lapack_int( lda );
@@ -62,6 +64,8 @@ int64_t lagsy(
     double* A, int64_t lda,
     int64_t* iseed )
 {
+    lapack_instrument( "lagsy", 'd', 0, n, k, internal::gflop_no_formula );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
     lapack_int lda_ = to_lapack_int( lda );
@@ -99,6 +103,8 @@ int64_t lagsy(
     std::complex<float>* A, int64_t lda,
     int64_t* iseed )
 {
+    lapack_instrument( "lagsy", 'c', 0, n, k, internal::gflop_no_formula );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
     lapack_int lda_ = to_lapack_int( lda );
@@ -136,6 +142,8 @@ int64_t lagsy(
     std::complex<double>* A, int64_t lda,
     int64_t* iseed )
 {
+    lapack_instrument( "lagsy", 'z', 0, n, k, internal::gflop_no_formula );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
     lapack_int lda_ = to_lapack_int( lda );
@@ -22,6 +22,9 @@ float langb(
     lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
     float const* AB, int64_t ldab )
 {
+    lapack_instrument( "langb", 's', 0, n, 0,
+                       Gflop< float >::langb( norm, n, kl, ku ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -47,6 +50,9 @@ double langb(
     lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
     double const* AB, int64_t ldab )
 {
+    lapack_instrument( "langb", 'd', 0, n, 0,
+                       Gflop< double >::langb( norm, n, kl, ku ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -72,6 +78,9 @@ float langb(
     lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
     std::complex<float> const* AB, int64_t ldab )
 {
+    lapack_instrument( "langb", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::langb( norm, n, kl, ku ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -131,6 +140,10 @@ double langb(
     lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
     std::complex<double> const* AB, int64_t ldab )
 {
+    lapack_instrument( "langb", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::langb( norm, n, kl,
+                                                             ku ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
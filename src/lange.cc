@@ -22,6 +22,9 @@ float lange(
     lapack::Norm norm, int64_t m, int64_t n,
     float const* A, int64_t lda )
 {
+    lapack_instrument( "lange", 's', m, n, 0,
+                       Gflop< float >::lange( norm, m, n ) );
+
     char norm_ = to_char( norm );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -46,6 +49,9 @@ double lange(
     lapack::Norm norm, int64_t m, int64_t n,
     double const* A, int64_t lda )
 {
+    lapack_instrument( "lange", 'd', m, n, 0,
+                       Gflop< double >::lange( norm, m, n ) );
+
     char norm_ = to_char( norm );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -70,6 +76,9 @@ float lange(
     lapack::Norm norm, int64_t m, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    lapack_instrument( "lange", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::lange( norm, m, n ) );
+
     char norm_ = to_char( norm );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -121,6 +130,9 @@ double lange(
     lapack::Norm norm, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    lapack_instrument( "lange", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::lange( norm, m, n ) );
+
     char norm_ = to_char( norm );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
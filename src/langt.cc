@@ -23,6 +23,9 @@ float langt(
     float const* D,
     float const* DU )
 {
+    lapack_instrument( "langt", 's', 0, n, 0,
+                       Gflop< float >::langt( norm, n ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
 
@@ -42,6 +45,9 @@ double langt(
     double const* D,
     double const* DU )
 {
+    lapack_instrument( "langt", 'd', 0, n, 0,
+                       Gflop< double >::langt( norm, n ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
 
@@ -61,6 +67,9 @@ float langt(
     std::complex<float> const* D,
     std::complex<float> const* DU )
 {
+    lapack_instrument( "langt", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::langt( norm, n ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
 
@@ -110,6 +119,9 @@ double langt(
     std::complex<double> const* D,
     std::complex<double> const* DU )
 {
+    lapack_instrument( "langt", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::langt( norm, n ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
 
@@ -22,6 +22,9 @@ float lanhb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float> const* AB, int64_t ldab )
 {
+    lapack_instrument( "lanhb", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::lanhb( norm, n, kd ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -90,6 +93,9 @@ double lanhb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double> const* AB, int64_t ldab )
 {
+    lapack_instrument( "lanhb", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::lanhb( norm, n, kd ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
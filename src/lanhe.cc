@@ -22,6 +22,9 @@ float lanhe(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    lapack_instrument( "lanhe", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::lanhe( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -91,6 +94,9 @@ double lanhe(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    lapack_instrument( "lanhe", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::lanhe( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
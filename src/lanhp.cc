@@ -22,6 +22,9 @@ float lanhp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<float> const* AP )
 {
+    lapack_instrument( "lanhp", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::lanhp( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -81,6 +84,9 @@ double lanhp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<double> const* AP )
 {
+    lapack_instrument( "lanhp", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::lanhp( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -22,6 +22,9 @@ float lanhs(
     lapack::Norm norm, int64_t n,
     float const* A, int64_t lda )
 {
+    lapack_instrument( "lanhs", 's', 0, n, 0,
+                       Gflop< float >::lanhs( norm, n ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -45,6 +48,9 @@ double lanhs(
     lapack::Norm norm, int64_t n,
     double const* A, int64_t lda )
 {
+    lapack_instrument( "lanhs", 'd', 0, n, 0,
+                       Gflop< double >::lanhs( norm, n ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -68,6 +74,9 @@ float lanhs(
     lapack::Norm norm, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    lapack_instrument( "lanhs", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::lanhs( norm, n ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -117,6 +126,9 @@ double lanhs(
     lapack::Norm norm, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    lapack_instrument( "lanhs", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::lanhs( norm, n ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -22,6 +22,9 @@ float lanht(
     float const* D,
     std::complex<float> const* E )
 {
+    lapack_instrument( "lanht", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::lanht( norm, n ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
 
@@ -67,6 +70,9 @@ double lanht(
     double const* D,
     std::complex<double> const* E )
 {
+    lapack_instrument( "lanht", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::lanht( norm, n ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
 
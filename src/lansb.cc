@@ -22,6 +22,9 @@ float lansb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     float const* AB, int64_t ldab )
 {
+    lapack_instrument( "lansb", 's', 0, n, 0,
+                       Gflop< float >::lansb( norm, n, kd ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -47,6 +50,9 @@ double lansb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     double const* AB, int64_t ldab )
 {
+    lapack_instrument( "lansb", 'd', 0, n, 0,
+                       Gflop< double >::lansb( norm, n, kd ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -72,6 +78,9 @@ float lansb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float> const* AB, int64_t ldab )
 {
+    lapack_instrument( "lansb", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::lansb( norm, n, kd ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -138,6 +147,9 @@ double lansb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double> const* AB, int64_t ldab )
 {
+    lapack_instrument( "lansb", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::lansb( norm, n, kd ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
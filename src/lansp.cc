@@ -22,6 +22,9 @@ float lansp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     float const* AP )
 {
+    lapack_instrument( "lansp", 's', 0, n, 0,
+                       Gflop< float >::lansp( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -45,6 +48,9 @@ double lansp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     double const* AP )
 {
+    lapack_instrument( "lansp", 'd', 0, n, 0,
+                       Gflop< double >::lansp( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -68,6 +74,9 @@ float lansp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<float> const* AP )
 {
+    lapack_instrument( "lansp", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::lansp( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -125,6 +134,9 @@ double lansp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<double> const* AP )
 {
+    lapack_instrument( "lansp", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::lansp( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -22,6 +22,9 @@ float lanst(
     float const* D,
     float const* E )
 {
+    lapack_instrument( "lanst", 's', 0, n, 0,
+                       Gflop< float >::lanst( norm, n ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
 
@@ -64,6 +67,9 @@ double lanst(
     double const* D,
     double const* E )
 {
+    lapack_instrument( "lanst", 'd', 0, n, 0,
+                       Gflop< double >::lanst( norm, n ) );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
 
@@ -22,6 +22,9 @@ float lansy(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     float const* A, int64_t lda )
 {
+    lapack_instrument( "lansy", 's', 0, n, 0,
+                       Gflop< float >::lansy( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -46,6 +49,9 @@ double lansy(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     double const* A, int64_t lda )
 {
+    lapack_instrument( "lansy", 'd', 0, n, 0,
+                       Gflop< double >::lansy( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -70,6 +76,9 @@ float lansy(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    lapack_instrument( "lansy", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::lansy( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -136,6 +145,9 @@ double lansy(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    lapack_instrument( "lansy", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::lansy( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
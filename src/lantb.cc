@@ -22,6 +22,9 @@ float lantb(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
     float const* AB, int64_t ldab )
 {
+    lapack_instrument( "lantb", 's', 0, n, k,
+                       Gflop< float >::lantb( norm, n, k ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -48,6 +51,9 @@ double lantb(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
     double const* AB, int64_t ldab )
 {
+    lapack_instrument( "lantb", 'd', 0, n, k,
+                       Gflop< double >::lantb( norm, n, k ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -74,6 +80,9 @@ float lantb(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
     std::complex<float> const* AB, int64_t ldab )
 {
+    lapack_instrument( "lantb", 'c', 0, n, k,
+                       Gflop< std::complex<float> >::lantb( norm, n, k ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -147,6 +156,9 @@ double lantb(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
     std::complex<double> const* AB, int64_t ldab )
 {
+    lapack_instrument( "lantb", 'z', 0, n, k,
+                       Gflop< std::complex<double> >::lantb( norm, n, k ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
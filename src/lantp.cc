@@ -22,6 +22,9 @@ float lantp(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     float const* AP )
 {
+    lapack_instrument( "lantp", 's', 0, n, 0,
+                       Gflop< float >::lantp( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -46,6 +49,9 @@ double lantp(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     double const* AP )
 {
+    lapack_instrument( "lantp", 'd', 0, n, 0,
+                       Gflop< double >::lantp( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -70,6 +76,9 @@ float lantp(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<float> const* AP )
 {
+    lapack_instrument( "lantp", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::lantp( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -133,6 +142,9 @@ double lantp(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<double> const* AP )
 {
+    lapack_instrument( "lantp", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::lantp( norm, n ) );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -22,6 +22,9 @@ float lantr(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
     float const* A, int64_t lda )
 {
+    lapack_instrument( "lantr", 's', m, n, 0,
+                       Gflop< float >::lantr( norm, m, n ) );
+
     lapack_error_if( lda < m );
 
     // Safeguard m, n.
@@ -56,6 +59,9 @@ double lantr(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
     double const* A, int64_t lda )
 {
+    lapack_instrument( "lantr", 'd', m, n, 0,
+                       Gflop< double >::lantr( norm, m, n ) );
+
     lapack_error_if( lda < m );
 
     // Safeguard m, n.
@@ -90,6 +96,9 @@ float lantr(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    lapack_instrument( "lantr", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::lantr( norm, m, n ) );
+
     lapack_error_if( lda < m );
 
     // Safeguard m, n.
@@ -181,6 +190,9 @@ double lantr(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    lapack_instrument( "lantr", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::lantr( norm, m, n ) );
+
     lapack_error_if( lda < m );
 
     // Safeguard m, n.
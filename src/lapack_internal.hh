@@ -7,6 +7,8 @@
 #define LAPACK_INTERNAL_HH
 
 #include "lapack/util.hh"
+#include "lapack/flops.hh"
+#include "lapack/instrument.hh"
 
 namespace lapack {
 
@@ -31,6 +33,116 @@ inline lapack_int to_lapack_int_( int64_t x, const char* x_str )
 ///
 #define to_lapack_int( x ) lapack::to_lapack_int_( x, #x )
 
+//------------------------------------------------------------------------------
+/// Instruments a wrapper: if lapack::instrument is enabled, records the call
+/// in the per-routine statistics; if lapack::trace is enabled, records it
+/// in the trace. Put it first in the wrapper, as the timer stops when the
+/// wrapper returns. Pass 0 for dimensions the routine doesn't have.
+/// gflop is the count from lapack/flops.hh; for routines without one,
+/// pass internal::gflop_none or internal::gflop_data_dependent rather
+/// than 0, to say why. gflop is evaluated only when enabled.
+/// When disabled, this costs the static guard, a relaxed atomic load,
+/// and null checks.
+///
+/// Each exported wrapper must be instrumented; tools/check_instrument.py,
+/// run by `make check`, verifies this.
+///
+/// @see lapack/instrument.hh, lapack/trace.hh
+///
+#define lapack_instrument( routine, precision, m, n, k, gflop ) \
+    static lapack::internal::InstrumentCounter lapack_instrument_counter_( \
+        routine, precision ); \
+    bool const lapack_instrument_on_ = \
+        lapack::internal::instrument_flags.load( std::memory_order_relaxed ) != 0; \
+    lapack::internal::InstrumentTimer lapack_instrument_timer_( \
+        lapack_instrument_on_ ? &lapack_instrument_counter_ : nullptr, \
+        m, n, k, lapack_instrument_on_ ? double( gflop ) : 0.0 )
+
+//------------------------------------------------------------------------------
+/// Sets the Gflop count of the call instrumented by lapack_instrument,
+/// for routines that know it only at the end, e.g., after iterating
+/// to convergence. gflop is evaluated only when enabled.
+///
+#define lapack_instrument_gflop( gflop ) \
+    do { \
+        if (lapack_instrument_on_) \
+            lapack_instrument_timer_.set_gflop( gflop ); \
+    } while (0)
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Gflop count for routines that do no arithmetic worth counting:
+/// data movement (copy, convert, permute, change storage format),
+/// comparisons (e.g., equilibration scale factors), random numbers,
+/// and O(1) scalar operations.
+constexpr double gflop_none = 0;
+
+/// Gflop count for routines whose arithmetic depends on the data, so it
+/// has no closed form: iterative eigenvalue, SVD, and Schur solvers,
+/// condition estimators, iterative refinement, and routines that depend
+/// on deflation, numerical rank, or the structure of quasi-triangular
+/// blocks.
+constexpr double gflop_data_dependent = 0;
+
+/// Gflop count for routines whose arithmetic is deterministic but has no
+/// formula in lapack/flops.hh: the bulge-chasing band reductions gbbrd,
+/// hbgst, and sbgst, and the test matrix generators lagge, laghe, and lagsy.
+constexpr double gflop_no_formula = 0;
+
+//------------------------------------------------------------------------------
+/// @return LAPACK precision character, 's', 'd', 'c', or 'z', of scalar_t,
+/// for instrumenting templated wrappers.
+template <typename scalar_t>
+inline char precision_char();
+
+template <> inline char precision_char< float  >() { return 's'; }
+template <> inline char precision_char< double >() { return 'd'; }
+template <> inline char precision_char< std::complex<float>  >() { return 'c'; }
+template <> inline char precision_char< std::complex<double> >() { return 'z'; }
+
+}  // namespace internal
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Solves the reduced interface system of the SPIKE algorithm and
+// recovers the full solution. Shared by gtsv_spike and gbsv_spike.
+// See src/gbsv_spike.cc.
+template <typename scalar_t>
+int64_t spike_reduced_solve(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    int64_t nparts, int64_t const* offsets,
+    scalar_t const* S, int64_t lds,
+    scalar_t* B, int64_t ldb );
+
+//------------------------------------------------------------------------------
+// Returns the number of partitions to use for a partitioned solver:
+// nparts if nparts > 0, otherwise the number of OpenMP threads,
+// limited so each partition has at least min_size rows.
+int64_t spike_num_parts( int64_t n, int64_t nparts, int64_t min_size );
+
+//------------------------------------------------------------------------------
+// Vector update in the merge step of divide-and-conquer, skipping the zero
+// blocks of the two subproblems. Shared by stedc_mt and bdsdc_mt.
+// See src/stedc_mt.cc.
+template <typename real_t>
+void dc_update_vectors(
+    int64_t m, int64_t rtop, int64_t k,
+    int64_t const* cols, int const* types,
+    real_t const* X, int64_t ldx,
+    real_t const* Qm, int64_t ldqm,
+    real_t* Y, int64_t ldy );
+
+//------------------------------------------------------------------------------
+// Permutes columns of A in place: new column j is old column perm[ j ].
+template <typename scalar_t>
+void dc_permute_columns(
+    int64_t m, int64_t n, int64_t const* perm,
+    scalar_t* A, int64_t lda );
+
+}  // namespace internal
+
 }  // namespace lapack
 
 #endif // LAPACK_INTERNAL_HH
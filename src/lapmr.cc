@@ -24,6 +24,8 @@ void lapmr(
     float* X, int64_t ldx,
     int64_t* K )
 {
+    lapack_instrument( "lapmr", 's', m, n, 0, internal::gflop_none );
+
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -51,6 +53,8 @@ void lapmr(
     double* X, int64_t ldx,
     int64_t* K )
 {
+    lapack_instrument( "lapmr", 'd', m, n, 0, internal::gflop_none );
+
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -78,6 +82,8 @@ void lapmr(
     std::complex<float>* X, int64_t ldx,
     int64_t* K )
 {
+    lapack_instrument( "lapmr", 'c', m, n, 0, internal::gflop_none );
+
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -105,6 +111,8 @@ void lapmr(
     std::complex<double>* X, int64_t ldx,
     int64_t* K )
 {
+    lapack_instrument( "lapmr", 'z', m, n, 0, internal::gflop_none );
+
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -22,6 +22,8 @@ void lapmt(
     float* X, int64_t ldx,
     int64_t* K )
 {
+    lapack_instrument( "lapmt", 's', m, n, 0, internal::gflop_none );
+
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -49,6 +51,8 @@ void lapmt(
     double* X, int64_t ldx,
     int64_t* K )
 {
+    lapack_instrument( "lapmt", 'd', m, n, 0, internal::gflop_none );
+
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -76,6 +80,8 @@ void lapmt(
     std::complex<float>* X, int64_t ldx,
     int64_t* K )
 {
+    lapack_instrument( "lapmt", 'c', m, n, 0, internal::gflop_none );
+
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -103,6 +109,8 @@ void lapmt(
     std::complex<double>* X, int64_t ldx,
     int64_t* K )
 {
+    lapack_instrument( "lapmt", 'z', m, n, 0, internal::gflop_none );
+
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
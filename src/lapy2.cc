@@ -4,6 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
+#include "lapack_internal.hh"
 #include "lapack/fortran.h"
 
 #include <vector>
@@ -19,6 +20,8 @@ using blas::real;
 float lapy2(
     float x, float y )
 {
+    lapack_instrument( "lapy2", 's', 0, 0, 0, internal::gflop_none );
+
     return LAPACK_slapy2( &x, &y );
 }
 
@@ -38,6 +41,8 @@ float lapy2(
 double lapy2(
     double x, double y )
 {
+    lapack_instrument( "lapy2", 'd', 0, 0, 0, internal::gflop_none );
+
     return LAPACK_dlapy2( &x, &y );
 }
 
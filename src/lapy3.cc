@@ -4,6 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
+#include "lapack_internal.hh"
 #include "lapack/fortran.h"
 
 #include <vector>
@@ -19,6 +20,8 @@ using blas::real;
 float lapy3(
     float x, float y, float z )
 {
+    lapack_instrument( "lapy3", 's', 0, 0, 0, internal::gflop_none );
+
     return LAPACK_slapy3( &x, &y, &z );
 }
 
@@ -40,6 +43,8 @@ float lapy3(
 double lapy3(
     double x, double y, double z )
 {
+    lapack_instrument( "lapy3", 'd', 0, 0, 0, internal::gflop_none );
+
     return LAPACK_dlapy3( &x, &y, &z );
 }
 
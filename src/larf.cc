@@ -23,6 +23,9 @@ void larf(
     float const* v, int64_t incv, float tau,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "larf", 's', m, n, 0,
+                       Gflop< float >::larf( side, m, n ) );
+
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -50,6 +53,9 @@ void larf(
     double const* v, int64_t incv, double tau,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "larf", 'd', m, n, 0,
+                       Gflop< double >::larf( side, m, n ) );
+
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -77,6 +83,9 @@ void larf(
     std::complex<float> const* v, int64_t incv, std::complex<float> tau,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "larf", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::larf( side, m, n ) );
+
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -149,6 +158,9 @@ void larf(
     std::complex<double> const* v, int64_t incv, std::complex<double> tau,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "larf", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::larf( side, m, n ) );
+
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -26,6 +26,9 @@ void larfb(
     float const* T, int64_t ldt,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "larfb", 's', m, n, k,
+                       Gflop< float >::larfb( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
@@ -61,6 +64,9 @@ void larfb(
     double const* T, int64_t ldt,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "larfb", 'd', m, n, k,
+                       Gflop< double >::larfb( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
@@ -97,6 +103,9 @@ void larfb(
     std::complex<float> const* T, int64_t ldt,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "larfb", 'c', m, n, k,
+                       Gflop< std::complex<float> >::larfb( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
@@ -229,6 +238,9 @@ void larfb(
     std::complex<double> const* T, int64_t ldt,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "larfb", 'z', m, n, k,
+                       Gflop< std::complex<double> >::larfb( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
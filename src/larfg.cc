@@ -23,6 +23,8 @@ void larfg(
     float* X, int64_t incx,
     float* tau )
 {
+    lapack_instrument( "larfg", 's', 0, n, 0, Gflop< float >::larfg( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
@@ -39,6 +41,8 @@ void larfg(
     double* X, int64_t incx,
     double* tau )
 {
+    lapack_instrument( "larfg", 'd', 0, n, 0, Gflop< double >::larfg( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
@@ -55,6 +59,9 @@ void larfg(
     std::complex<float>* X, int64_t incx,
     std::complex<float>* tau )
 {
+    lapack_instrument( "larfg", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::larfg( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
@@ -127,6 +134,9 @@ void larfg(
     std::complex<double>* X, int64_t incx,
     std::complex<double>* tau )
 {
+    lapack_instrument( "larfg", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::larfg( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
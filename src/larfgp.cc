@@ -25,6 +25,8 @@ void larfgp(
     float* X, int64_t incx,
     float* tau )
 {
+    lapack_instrument( "larfgp", 's', 0, n, 0, Gflop< float >::larfg( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
@@ -41,6 +43,8 @@ void larfgp(
     double* X, int64_t incx,
     double* tau )
 {
+    lapack_instrument( "larfgp", 'd', 0, n, 0, Gflop< double >::larfg( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
@@ -57,6 +61,9 @@ void larfgp(
     std::complex<float>* X, int64_t incx,
     std::complex<float>* tau )
 {
+    lapack_instrument( "larfgp", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::larfg( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
@@ -129,6 +136,9 @@ void larfgp(
     std::complex<double>* X, int64_t incx,
     std::complex<double>* tau )
 {
+    lapack_instrument( "larfgp", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::larfg( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
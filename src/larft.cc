@@ -24,6 +24,8 @@ void larft(
     float const* tau,
     float* T, int64_t ldt )
 {
+    lapack_instrument( "larft", 's', 0, n, k, Gflop< float >::larft( n, k ) );
+
     char direction_ = to_char( direction );
     char storev_ = to_char( storev );
     lapack_int n_ = to_lapack_int( n );
@@ -48,6 +50,8 @@ void larft(
     double const* tau,
     double* T, int64_t ldt )
 {
+    lapack_instrument( "larft", 'd', 0, n, k, Gflop< double >::larft( n, k ) );
+
     char direction_ = to_char( direction );
     char storev_ = to_char( storev );
     lapack_int n_ = to_lapack_int( n );
@@ -72,6 +76,9 @@ void larft(
     std::complex<float> const* tau,
     std::complex<float>* T, int64_t ldt )
 {
+    lapack_instrument( "larft", 'c', 0, n, k,
+                       Gflop< std::complex<float> >::larft( n, k ) );
+
     char direction_ = to_char( direction );
     char storev_ = to_char( storev );
     lapack_int n_ = to_lapack_int( n );
@@ -188,6 +195,9 @@ void larft(
     std::complex<double> const* tau,
     std::complex<double>* T, int64_t ldt )
 {
+    lapack_instrument( "larft", 'z', 0, n, k,
+                       Gflop< std::complex<double> >::larft( n, k ) );
+
     char direction_ = to_char( direction );
     char storev_ = to_char( storev );
     lapack_int n_ = to_lapack_int( n );
@@ -23,6 +23,9 @@ void larfx(
     float const* v, float tau,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "larfx", 's', m, n, 0,
+                       Gflop< float >::larf( side, m, n ) );
+
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -49,6 +52,9 @@ void larfx(
     double const* v, double tau,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "larfx", 'd', m, n, 0,
+                       Gflop< double >::larf( side, m, n ) );
+
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -75,6 +81,9 @@ void larfx(
     std::complex<float> const* v, std::complex<float> tau,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "larfx", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::larf( side, m, n ) );
+
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -142,6 +151,9 @@ void larfx(
     std::complex<double> const* v, std::complex<double> tau,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "larfx", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::larf( side, m, n ) );
+
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
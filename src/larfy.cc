@@ -25,6 +25,8 @@ void larfy(
     float const* V, int64_t incv, float tau,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "larfy", 's', 0, n, 0, Gflop< float >::larfy( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int incv_ = to_lapack_int( incv );
@@ -48,6 +50,8 @@ void larfy(
     double const* V, int64_t incv, double tau,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "larfy", 'd', 0, n, 0, Gflop< double >::larfy( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int incv_ = to_lapack_int( incv );
@@ -71,6 +75,9 @@ void larfy(
     std::complex<float> const* V, int64_t incv, std::complex<float> tau,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "larfy", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::larfy( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int incv_ = to_lapack_int( incv );
@@ -137,6 +144,9 @@ void larfy(
     std::complex<double> const* V, int64_t incv, std::complex<double> tau,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "larfy", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::larfy( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int incv_ = to_lapack_int( incv );
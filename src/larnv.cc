@@ -22,6 +22,8 @@ void larnv(
     int64_t* iseed, int64_t n,
     float* X )
 {
+    lapack_instrument( "larnv", 's', 0, n, 0, internal::gflop_none );
+
     lapack_int idist_ = to_lapack_int( idist );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -48,6 +50,8 @@ void larnv(
     int64_t* iseed, int64_t n,
     double* X )
 {
+    lapack_instrument( "larnv", 'd', 0, n, 0, internal::gflop_none );
+
     lapack_int idist_ = to_lapack_int( idist );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -74,6 +78,8 @@ void larnv(
     int64_t* iseed, int64_t n,
     std::complex<float>* X )
 {
+    lapack_instrument( "larnv", 'c', 0, n, 0, internal::gflop_none );
+
     lapack_int idist_ = to_lapack_int( idist );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -136,6 +142,8 @@ void larnv(
     int64_t* iseed, int64_t n,
     std::complex<double>* X )
 {
+    lapack_instrument( "larnv", 'z', 0, n, 0, internal::gflop_none );
+
     lapack_int idist_ = to_lapack_int( idist );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -3,6 +3,8 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
+#include "lapack.hh"
+#include "lapack_internal.hh"
 #include "lapack/fortran.h"
 
 namespace lapack {
@@ -14,6 +16,7 @@ void lartg(
     float* sn,
     float* r )
 {
+    lapack_instrument( "lartg", 's', 0, 0, 0, internal::gflop_none );
 
     LAPACK_slartg(
         &f, &g, cs, sn, r );
@@ -26,6 +29,7 @@ void lartg(
     double* sn,
     double* r )
 {
+    lapack_instrument( "lartg", 'd', 0, 0, 0, internal::gflop_none );
 
     LAPACK_dlartg(
         &f, &g, cs, sn, r );
@@ -38,6 +42,7 @@ void lartg(
     std::complex<float>* sn,
     std::complex<float>* r )
 {
+    lapack_instrument( "lartg", 'c', 0, 0, 0, internal::gflop_none );
 
     LAPACK_clartg(
         (lapack_complex_float*) &f,
@@ -54,6 +59,7 @@ void lartg(
     std::complex<double>* sn,
     std::complex<double>* r )
 {
+    lapack_instrument( "lartg", 'z', 0, 0, 0, internal::gflop_none );
 
     LAPACK_zlartg(
         (lapack_complex_double*) &f,
@@ -4,6 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
+#include "lapack_internal.hh"
 #include "lapack/fortran.h"
 
 #if LAPACK_VERSION >= 30300  // >= v3.3
@@ -23,6 +24,7 @@ void lartgp(
     float* sn,
     float* r )
 {
+    lapack_instrument( "lartgp", 's', 0, 0, 0, internal::gflop_none );
 
     LAPACK_slartgp(
         &f, &g, cs, sn, r );
@@ -35,6 +37,7 @@ void lartgp(
     double* sn,
     double* r )
 {
+    lapack_instrument( "lartgp", 'd', 0, 0, 0, internal::gflop_none );
 
     LAPACK_dlartgp(
         &f, &g, cs, sn, r );
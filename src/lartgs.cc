@@ -4,6 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
+#include "lapack_internal.hh"
 #include "lapack/fortran.h"
 
 #if LAPACK_VERSION >= 30300  // >= v3.3
@@ -22,6 +23,7 @@ void lartgs(
     float* cs,
     float* sn )
 {
+    lapack_instrument( "lartgs", 's', 0, 0, 0, internal::gflop_none );
 
     LAPACK_slartgs(
         &x, &y, &sigma, cs, sn );
@@ -33,6 +35,7 @@ void lartgs(
     double* cs,
     double* sn )
 {
+    lapack_instrument( "lartgs", 'd', 0, 0, 0, internal::gflop_none );
 
     LAPACK_dlartgs(
         &x, &y, &sigma, cs, sn );
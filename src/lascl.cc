@@ -21,6 +21,8 @@ int64_t lascl(
     lapack::MatrixType matrixtype, int64_t kl, int64_t ku, float cfrom, float cto, int64_t m, int64_t n,
     float* A, int64_t lda )
 {
+    lapack_instrument( "lascl", 's', m, n, 0, Gflop< float >::lascl( m, n ) );
+
     char matrixtype_ = to_char( matrixtype );
     lapack_int kl_ = to_lapack_int( kl );
     lapack_int ku_ = to_lapack_int( ku );
@@ -45,6 +47,8 @@ int64_t lascl(
     lapack::MatrixType matrixtype, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
     double* A, int64_t lda )
 {
+    lapack_instrument( "lascl", 'd', m, n, 0, Gflop< double >::lascl( m, n ) );
+
     char matrixtype_ = to_char( matrixtype );
     lapack_int kl_ = to_lapack_int( kl );
     lapack_int ku_ = to_lapack_int( ku );
@@ -69,6 +73,9 @@ int64_t lascl(
     lapack::MatrixType matrixtype, int64_t kl, int64_t ku, float cfrom, float cto, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
+    lapack_instrument( "lascl", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::lascl( m, n ) );
+
     char matrixtype_ = to_char( matrixtype );
     lapack_int kl_ = to_lapack_int( kl );
     lapack_int ku_ = to_lapack_int( ku );
@@ -166,6 +173,9 @@ int64_t lascl(
     lapack::MatrixType matrixtype, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
+    lapack_instrument( "lascl", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::lascl( m, n ) );
+
     char matrixtype_ = to_char( matrixtype );
     lapack_int kl_ = to_lapack_int( kl );
     lapack_int ku_ = to_lapack_int( ku );
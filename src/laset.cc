@@ -21,6 +21,8 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, float offdiag, float diag,
     float* A, int64_t lda )
 {
+    lapack_instrument( "laset", 's', m, n, 0, internal::gflop_none );
+
     char matrixtype_ = to_char( matrixtype );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -38,6 +40,8 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, double offdiag, double diag,
     double* A, int64_t lda )
 {
+    lapack_instrument( "laset", 'd', m, n, 0, internal::gflop_none );
+
     char matrixtype_ = to_char( matrixtype );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -55,6 +59,8 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, std::complex<float> offdiag, std::complex<float> diag,
     std::complex<float>* A, int64_t lda )
 {
+    lapack_instrument( "laset", 'c', m, n, 0, internal::gflop_none );
+
     char matrixtype_ = to_char( matrixtype );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -111,6 +117,8 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, std::complex<double> offdiag, std::complex<double> diag,
     std::complex<double>* A, int64_t lda )
 {
+    lapack_instrument( "laset", 'z', m, n, 0, internal::gflop_none );
+
     char matrixtype_ = to_char( matrixtype );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -4,6 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
+#include "lapack_internal.hh"
 #include "lapack/fortran.h"
 
 #include <vector>
@@ -23,6 +24,9 @@ void lasr(
     float const* S,
     float* A, int64_t lda )
 {
+    lapack_instrument( "lasr", 's', m, n, 0,
+                       Gflop< float >::lasr( side, m, n ) );
+
     // check for overflow
     if (sizeof( int64_t ) > sizeof( lapack_int )) {
         lapack_error_if( std::abs( m ) > std::numeric_limits<lapack_int>::max() );
@@ -51,6 +55,9 @@ void lasr(
     double const* S,
     double* A, int64_t lda )
 {
+    lapack_instrument( "lasr", 'd', m, n, 0,
+                       Gflop< double >::lasr( side, m, n ) );
+
     // check for overflow
     if (sizeof( int64_t ) > sizeof( lapack_int )) {
         lapack_error_if( std::abs( m ) > std::numeric_limits<lapack_int>::max() );
@@ -79,6 +86,9 @@ void lasr(
     float const* S,
     std::complex<float>* A, int64_t lda )
 {
+    lapack_instrument( "lasr", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::lasr( side, m, n ) );
+
     // check for overflow
     if (sizeof( int64_t ) > sizeof( lapack_int )) {
         lapack_error_if( std::abs( m ) > std::numeric_limits<lapack_int>::max() );
@@ -232,6 +242,9 @@ void lasr(
     double const* S,
     std::complex<double>* A, int64_t lda )
 {
+    lapack_instrument( "lasr", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::lasr( side, m, n ) );
+
     // check for overflow
     if (sizeof( int64_t ) > sizeof( lapack_int )) {
         lapack_error_if( std::abs( m ) > std::numeric_limits<lapack_int>::max() );
@@ -23,6 +23,8 @@ void lassq(
     float* scale,
     float* sumsq )
 {
+    lapack_instrument( "lassq", 's', 0, n, 0, Gflop< float >::lassq( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
@@ -39,6 +41,8 @@ void lassq(
     double* scale,
     double* sumsq )
 {
+    lapack_instrument( "lassq", 'd', 0, n, 0, Gflop< double >::lassq( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
@@ -55,6 +59,9 @@ void lassq(
     float* scale,
     float* sumsq )
 {
+    lapack_instrument( "lassq", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::lassq( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
@@ -112,6 +119,9 @@ void lassq(
     double* scale,
     double* sumsq )
 {
+    lapack_instrument( "lassq", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::lassq( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int incx_ = to_lapack_int( incx );
 
@@ -23,6 +23,8 @@ void laswp(
     float* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
+    lapack_instrument( "laswp", 's', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int k1_ = to_lapack_int( k1 );
@@ -49,6 +51,8 @@ void laswp(
     double* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
+    lapack_instrument( "laswp", 'd', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int k1_ = to_lapack_int( k1 );
@@ -75,6 +79,8 @@ void laswp(
     std::complex<float>* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
+    lapack_instrument( "laswp", 'c', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int k1_ = to_lapack_int( k1 );
@@ -139,6 +145,8 @@ void laswp(
     std::complex<double>* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
+    lapack_instrument( "laswp", 'z', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int k1_ = to_lapack_int( k1 );
@@ -21,6 +21,8 @@ int64_t lauum(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda )
 {
+    lapack_instrument( "lauum", 's', 0, n, 0, Gflop< float >::lauum( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -42,6 +44,8 @@ int64_t lauum(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda )
 {
+    lapack_instrument( "lauum", 'd', 0, n, 0, Gflop< double >::lauum( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -63,6 +67,9 @@ int64_t lauum(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
+    lapack_instrument( "lauum", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::lauum( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -122,6 +129,9 @@ int64_t lauum(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
+    lapack_instrument( "lauum", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::lauum( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -0,0 +1,856 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+using blas::Layout;
+
+// Tile size of the blocked in-place transpose.
+static const int64_t transpose_nb = 32;
+
+// A row-major m-by-n matrix A with leading dimension lda occupies the same
+// memory as the column-major n-by-m matrix A^T. Each routine below applies
+// the column-major routine to A^T, using a transpose identity to read the
+// result in row-major order, without copying:
+//
+//     potrf:  A^T = conj( A ), so swap Upper <=> Lower.
+//     getrf:  A^T = P L U gives A P = U^T L^T, LU with column pivoting.
+//     geqrf:  A^T = L Q (gelqf) gives A = Q^T L^T, with Q^T unitary.
+//     gesvd:  A^T = U S V^H gives A = conj( V ) S U^T; swap U and VT.
+//
+// Solves with row-major right-hand sides use the row-major BLAS trsm.
+// heevd needs conj( Z ) in row-major order, which is the one case using
+// an in-place transpose.
+
+//------------------------------------------------------------------------------
+/// Transposes, or conjugate-transposes, the n-by-n matrix A in place,
+/// swapping 32-by-32 tiles across the diagonal for cache efficiency.
+/// Also converts a square matrix between row-major and column-major.
+///
+/// @param[in] op
+///     - lapack::Op::Trans:     A = A^T;
+///     - lapack::Op::ConjTrans: A = A^H.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @ingroup util
+template <typename scalar_t>
+void transpose_inplace(
+    lapack::Op op, int64_t n,
+    scalar_t* A, int64_t lda )
+{
+    lapack_instrument( "transpose_inplace",
+                       internal::precision_char< scalar_t >(), 0, n, 0,
+                       internal::gflop_none );
+
+    lapack_error_if( op != Op::Trans && op != Op::ConjTrans );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    bool conjugate = (op == Op::ConjTrans);
+    auto cj = [conjugate]( scalar_t x ) {
+        return conjugate ? scalar_t( conj( x ) ) : x;
+    };
+
+    for (int64_t jj = 0; jj < n; jj += transpose_nb) {
+        int64_t jb = min( transpose_nb, n - jj );
+        // diagonal tile
+        for (int64_t j = jj; j < jj + jb; ++j) {
+            A[ j + j*lda ] = cj( A[ j + j*lda ] );
+            for (int64_t i = j + 1; i < jj + jb; ++i) {
+                scalar_t tmp = A[ i + j*lda ];
+                A[ i + j*lda ] = cj( A[ j + i*lda ] );
+                A[ j + i*lda ] = cj( tmp );
+            }
+        }
+        // swap tile (ii, jj) below the diagonal with tile (jj, ii)
+        for (int64_t ii = jj + jb; ii < n; ii += transpose_nb) {
+            int64_t ib = min( transpose_nb, n - ii );
+            for (int64_t j = jj; j < jj + jb; ++j) {
+                for (int64_t i = ii; i < ii + ib; ++i) {
+                    scalar_t tmp = A[ i + j*lda ];
+                    A[ i + j*lda ] = cj( A[ j + i*lda ] );
+                    A[ j + i*lda ] = cj( tmp );
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Layout-aware `lapack::potrf`.
+/// If layout = RowMajor, computes $A = L L^H$ (uplo = Lower) or
+/// $A = U^H U$ (uplo = Upper) of the row-major matrix A, with the factor
+/// stored row-major in the uplo triangle. This calls the column-major
+/// potrf on $A^T = \bar{A}$ with the opposite uplo; no data is copied.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// Other arguments are as for `lapack::potrf`.
+///
+/// @ingroup posv_computational
+template <typename scalar_t>
+int64_t potrf(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda )
+{
+    lapack_instrument( "potrf_layout",
+                       internal::precision_char< scalar_t >(), 0, n, 0,
+                       Gflop< scalar_t >::potrf( n ) );
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+
+    if (layout == Layout::RowMajor) {
+        // swap lower <=> upper
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+    }
+    return lapack::potrf( uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Layout-aware `lapack::potrs`.
+/// Solves $A X = B$ using the Cholesky factor from the layout-aware
+/// `lapack::potrf`. If layout = RowMajor, A and B are row-major, and the
+/// triangular solves use row-major trsm; no data is copied.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// Other arguments are as for `lapack::potrs`;
+/// if layout = RowMajor, ldb >= max(1,nrhs).
+///
+/// @ingroup posv_computational
+template <typename scalar_t>
+int64_t potrs(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    lapack_instrument( "potrs_layout",
+                       internal::precision_char< scalar_t >(), 0, n, nrhs,
+                       Gflop< scalar_t >::potrs( n, nrhs ) );
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+    if (layout == Layout::ColMajor)
+        return lapack::potrs( uplo, n, nrhs, A, lda, B, ldb );
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, nrhs ) );
+
+    const scalar_t one = 1;
+    if (uplo == Uplo::Lower) {
+        // A = L L^H
+        blas::trsm( Layout::RowMajor, Side::Left, Uplo::Lower, Op::NoTrans,
+                    Diag::NonUnit, n, nrhs, one, A, lda, B, ldb );
+        blas::trsm( Layout::RowMajor, Side::Left, Uplo::Lower, Op::ConjTrans,
+                    Diag::NonUnit, n, nrhs, one, A, lda, B, ldb );
+    }
+    else {
+        // A = U^H U
+        blas::trsm( Layout::RowMajor, Side::Left, Uplo::Upper, Op::ConjTrans,
+                    Diag::NonUnit, n, nrhs, one, A, lda, B, ldb );
+        blas::trsm( Layout::RowMajor, Side::Left, Uplo::Upper, Op::NoTrans,
+                    Diag::NonUnit, n, nrhs, one, A, lda, B, ldb );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Layout-aware `lapack::posv`: the layout-aware `lapack::potrf`
+/// followed, if successful, by the layout-aware `lapack::potrs`.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// Other arguments are as for `lapack::posv`;
+/// if layout = RowMajor, ldb >= max(1,nrhs).
+///
+/// @ingroup posv
+template <typename scalar_t>
+int64_t posv(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    lapack_instrument( "posv_layout",
+                       internal::precision_char< scalar_t >(), 0, n, nrhs,
+                       Gflop< scalar_t >::posv( n, nrhs ) );
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+    if (layout == Layout::ColMajor)
+        return lapack::posv( uplo, n, nrhs, A, lda, B, ldb );
+
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, nrhs ) );
+
+    int64_t info = lapack::potrf( layout, uplo, n, A, lda );
+    if (info == 0)
+        lapack::potrs( layout, uplo, n, nrhs, (scalar_t const*) A, lda, B, ldb );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Layout-aware `lapack::getrf`.
+/// If layout = RowMajor, computes an LU factorization of the row-major
+/// m-by-n matrix A using partial pivoting with column interchanges,
+/// $A P = L U,$
+/// where P is a permutation matrix, L is lower triangular (lower
+/// trapezoidal if m < n), and U is upper trapezoidal (triangular if
+/// m > n) with unit diagonal. This calls the column-major getrf on $A^T$,
+/// giving $A^T = P L' U'$, so $L = U'^T$ and $U = L'^T$; no data is copied.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A.
+///     If layout = RowMajor, stored row-major in an m-by-lda array,
+///     and on exit, L, including its diagonal, and U, without its unit
+///     diagonal.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     If layout = RowMajor, lda >= max(1,n).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length min(m,n).
+///     If layout = RowMajor, the pivot indices; for 1 <= j <= min(m,n),
+///     column j of the matrix was interchanged with column ipiv(j).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the diagonal element of L (RowMajor)
+///              or U (ColMajor) is exactly zero; see `lapack::getrf`.
+///
+/// @ingroup gesv_computational
+template <typename scalar_t>
+int64_t getrf(
+    blas::Layout layout, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv )
+{
+    lapack_instrument( "getrf_layout",
+                       internal::precision_char< scalar_t >(), m, n, 0,
+                       Gflop< scalar_t >::getrf( m, n ) );
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::RowMajor)
+        std::swap( m, n );
+    return lapack::getrf( m, n, A, lda, ipiv );
+}
+
+//------------------------------------------------------------------------------
+/// Layout-aware `lapack::getrs`.
+/// Solves $op(A) X = B$ using the LU factorization from the layout-aware
+/// `lapack::getrf`. If layout = RowMajor, A and B are row-major and
+/// $A P = L U$: row interchanges of B are contiguous swaps, and the
+/// triangular solves use row-major trsm; no data is copied.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// Other arguments are as for `lapack::getrs`;
+/// if layout = RowMajor, ldb >= max(1,nrhs).
+///
+/// @ingroup gesv_computational
+template <typename scalar_t>
+int64_t getrs(
+    blas::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    int64_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    lapack_instrument( "getrs_layout",
+                       internal::precision_char< scalar_t >(), 0, n, nrhs,
+                       Gflop< scalar_t >::getrs( n, nrhs ) );
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+    if (layout == Layout::ColMajor)
+        return lapack::getrs( trans, n, nrhs, A, lda, ipiv, B, ldb );
+
+    lapack_error_if( trans != Op::NoTrans &&
+                     trans != Op::Trans &&
+                     trans != Op::ConjTrans );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, nrhs ) );
+
+    const scalar_t one = 1;
+    if (trans == Op::NoTrans) {
+        // A X = B, with A = L U P^T: X = P U^{-1} L^{-1} B.
+        blas::trsm( Layout::RowMajor, Side::Left, Uplo::Lower, Op::NoTrans,
+                    Diag::NonUnit, n, nrhs, one, A, lda, B, ldb );
+        blas::trsm( Layout::RowMajor, Side::Left, Uplo::Upper, Op::NoTrans,
+                    Diag::Unit, n, nrhs, one, A, lda, B, ldb );
+        for (int64_t i = n - 1; i >= 0; --i) {
+            int64_t ip = ipiv[ i ] - 1;
+            if (ip != i)
+                blas::swap( nrhs, &B[ i*ldb ], 1, &B[ ip*ldb ], 1 );
+        }
+    }
+    else {
+        // A^T X = B, with A^T = P U^T L^T: X = L^{-T} U^{-T} P^T B.
+        for (int64_t i = 0; i < n; ++i) {
+            int64_t ip = ipiv[ i ] - 1;
+            if (ip != i)
+                blas::swap( nrhs, &B[ i*ldb ], 1, &B[ ip*ldb ], 1 );
+        }
+        blas::trsm( Layout::RowMajor, Side::Left, Uplo::Upper, trans,
+                    Diag::Unit, n, nrhs, one, A, lda, B, ldb );
+        blas::trsm( Layout::RowMajor, Side::Left, Uplo::Lower, trans,
+                    Diag::NonUnit, n, nrhs, one, A, lda, B, ldb );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Layout-aware `lapack::gesv`: the layout-aware `lapack::getrf`
+/// followed, if successful, by the layout-aware `lapack::getrs`.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// Other arguments are as for `lapack::gesv`;
+/// if layout = RowMajor, ldb >= max(1,nrhs).
+///
+/// @ingroup gesv
+template <typename scalar_t>
+int64_t gesv(
+    blas::Layout layout, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    lapack_instrument( "gesv_layout",
+                       internal::precision_char< scalar_t >(), 0, n, nrhs,
+                       Gflop< scalar_t >::gesv( n, nrhs ) );
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+    if (layout == Layout::ColMajor)
+        return lapack::gesv( n, nrhs, A, lda, ipiv, B, ldb );
+
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, nrhs ) );
+
+    int64_t info = lapack::getrf( layout, n, n, A, lda, ipiv );
+    if (info == 0)
+        lapack::getrs( layout, Op::NoTrans, n, nrhs, (scalar_t const*) A, lda,
+                       (int64_t const*) ipiv, B, ldb );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Layout-aware `lapack::geqrf`.
+/// If layout = RowMajor, computes $A = Q R$ of the row-major matrix A,
+/// with the same Householder representation as `lapack::geqrf`, read in
+/// row-major order. This calls `lapack::gelqf` on $A^T$, giving
+/// $A^T = L \hat{Q}$, so $R = L^T$ and $Q = \hat{Q}^T$, whose reflectors
+/// are the LQ reflectors with conjugated tau; no data is copied.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// Other arguments are as for `lapack::geqrf`;
+/// if layout = RowMajor, lda >= max(1,n).
+///
+/// @ingroup geqrf
+template <typename scalar_t>
+int64_t geqrf(
+    blas::Layout layout, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* tau )
+{
+    lapack_instrument( "geqrf_layout",
+                       internal::precision_char< scalar_t >(), m, n, 0,
+                       Gflop< scalar_t >::geqrf( m, n ) );
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+    if (layout == Layout::ColMajor)
+        return lapack::geqrf( m, n, A, lda, tau );
+
+    int64_t info = lapack::gelqf( n, m, A, lda, tau );
+    for (int64_t i = 0; i < min( m, n ); ++i)
+        tau[ i ] = conj( tau[ i ] );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Layout-aware `lapack::gelqf`.
+/// If layout = RowMajor, computes $A = L Q$ of the row-major matrix A,
+/// with the same Householder representation as `lapack::gelqf`, read in
+/// row-major order. This calls `lapack::geqrf` on $A^T$ and conjugates
+/// tau; no data is copied.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// Other arguments are as for `lapack::gelqf`;
+/// if layout = RowMajor, lda >= max(1,n).
+///
+/// @ingroup gelqf
+template <typename scalar_t>
+int64_t gelqf(
+    blas::Layout layout, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* tau )
+{
+    lapack_instrument( "gelqf_layout",
+                       internal::precision_char< scalar_t >(), m, n, 0,
+                       Gflop< scalar_t >::gelqf( m, n ) );
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+    if (layout == Layout::ColMajor)
+        return lapack::gelqf( m, n, A, lda, tau );
+
+    int64_t info = lapack::geqrf( n, m, A, lda, tau );
+    for (int64_t i = 0; i < min( m, n ); ++i)
+        tau[ i ] = conj( tau[ i ] );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Layout-aware `lapack::gesvd`.
+/// If layout = RowMajor, A, U, and VT are row-major. This calls the
+/// column-major gesvd on $A^T = \hat{U} S \hat{V}^H$ with the roles of
+/// U and VT, and jobu and jobvt, swapped: the row-major U is
+/// $\bar{\hat{V}} = (\hat{V}^H)^T$ and the row-major VT is $\hat{U}^T$;
+/// no data is copied.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// Other arguments are as for `lapack::gesvd`; if layout = RowMajor,
+/// lda >= max(1,n), ldu >= the number of columns of U, and
+/// ldvt >= max(1,n).
+///
+/// @ingroup gesvd
+template <typename scalar_t>
+int64_t gesvd(
+    blas::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt )
+{
+    lapack_instrument( "gesvd_layout",
+                       internal::precision_char< scalar_t >(), m, n, 0,
+                       internal::gflop_data_dependent );
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+    if (layout == Layout::ColMajor)
+        return lapack::gesvd( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt );
+
+    return lapack::gesvd( jobvt, jobu, n, m, A, lda, S, VT, ldvt, U, ldu );
+}
+
+//------------------------------------------------------------------------------
+/// Layout-aware `lapack::gesdd`.
+/// If layout = RowMajor, A, U, and VT are row-major; as for the
+/// layout-aware `lapack::gesvd`, this swaps the roles of U and VT;
+/// no data is copied.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// Other arguments are as for `lapack::gesdd`; if layout = RowMajor,
+/// lda >= max(1,n), ldu >= the number of columns of U, and
+/// ldvt >= max(1,n).
+///
+/// @ingroup gesvd
+template <typename scalar_t>
+int64_t gesdd(
+    blas::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt )
+{
+    lapack_instrument( "gesdd_layout",
+                       internal::precision_char< scalar_t >(), m, n, 0,
+                       internal::gflop_data_dependent );
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+    if (layout == Layout::ColMajor)
+        return lapack::gesdd( jobz, m, n, A, lda, S, U, ldu, VT, ldvt );
+
+    return lapack::gesdd( jobz, n, m, A, lda, S, VT, ldvt, U, ldu );
+}
+
+//------------------------------------------------------------------------------
+/// Layout-aware `lapack::heevd`.
+/// If layout = RowMajor, A is row-major. This calls the column-major
+/// heevd on $A^T = \bar{A} = Z \Lambda Z^H$ with the opposite uplo.
+/// The eigenvectors of A are $\bar{Z}$; if jobz = Vec, they are put in
+/// row-major order by an in-place conjugate transpose of Z, as
+/// there is no transpose identity for this.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// Other arguments are as for `lapack::heevd`.
+///
+/// @ingroup heev
+template <typename scalar_t>
+int64_t heevd(
+    blas::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W )
+{
+    lapack_instrument( "heevd_layout",
+                       internal::precision_char< scalar_t >(), 0, n, 0,
+                       internal::gflop_data_dependent );
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    if (layout == Layout::ColMajor)
+        return lapack::heevd( jobz, uplo, n, A, lda, W );
+
+    // swap lower <=> upper
+    uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+    int64_t info = lapack::heevd( jobz, uplo, n, A, lda, W );
+    if (info == 0 && jobz == Job::Vec)
+        transpose_inplace( Op::ConjTrans, n, A, lda );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void transpose_inplace< float >(
+    lapack::Op op, int64_t n,
+    float* A, int64_t lda );
+
+template
+void transpose_inplace< double >(
+    lapack::Op op, int64_t n,
+    double* A, int64_t lda );
+
+template
+void transpose_inplace< std::complex<float> >(
+    lapack::Op op, int64_t n,
+    std::complex<float>* A, int64_t lda );
+
+template
+void transpose_inplace< std::complex<double> >(
+    lapack::Op op, int64_t n,
+    std::complex<double>* A, int64_t lda );
+
+template
+int64_t gelqf< float >(
+    blas::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau );
+
+template
+int64_t gelqf< double >(
+    blas::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau );
+
+template
+int64_t gelqf< std::complex<float> >(
+    blas::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau );
+
+template
+int64_t gelqf< std::complex<double> >(
+    blas::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau );
+
+template
+int64_t geqrf< float >(
+    blas::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau );
+
+template
+int64_t geqrf< double >(
+    blas::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau );
+
+template
+int64_t geqrf< std::complex<float> >(
+    blas::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau );
+
+template
+int64_t geqrf< std::complex<double> >(
+    blas::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau );
+
+template
+int64_t gesdd< float >(
+    blas::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt );
+
+template
+int64_t gesdd< double >(
+    blas::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt );
+
+template
+int64_t gesdd< std::complex<float> >(
+    blas::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt );
+
+template
+int64_t gesdd< std::complex<double> >(
+    blas::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt );
+
+template
+int64_t gesv< float >(
+    blas::Layout layout, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
+
+template
+int64_t gesv< double >(
+    blas::Layout layout, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb );
+
+template
+int64_t gesv< std::complex<float> >(
+    blas::Layout layout, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+template
+int64_t gesv< std::complex<double> >(
+    blas::Layout layout, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+template
+int64_t gesvd< float >(
+    blas::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt );
+
+template
+int64_t gesvd< double >(
+    blas::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt );
+
+template
+int64_t gesvd< std::complex<float> >(
+    blas::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt );
+
+template
+int64_t gesvd< std::complex<double> >(
+    blas::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt );
+
+template
+int64_t getrf< float >(
+    blas::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv );
+
+template
+int64_t getrf< double >(
+    blas::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv );
+
+template
+int64_t getrf< std::complex<float> >(
+    blas::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv );
+
+template
+int64_t getrf< std::complex<double> >(
+    blas::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv );
+
+template
+int64_t getrs< float >(
+    blas::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int64_t const* ipiv,
+    float* B, int64_t ldb );
+
+template
+int64_t getrs< double >(
+    blas::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int64_t const* ipiv,
+    double* B, int64_t ldb );
+
+template
+int64_t getrs< std::complex<float> >(
+    blas::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+template
+int64_t getrs< std::complex<double> >(
+    blas::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+template
+int64_t heevd< float >(
+    blas::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
+
+template
+int64_t heevd< double >(
+    blas::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
+
+template
+int64_t heevd< std::complex<float> >(
+    blas::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W );
+
+template
+int64_t heevd< std::complex<double> >(
+    blas::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W );
+
+template
+int64_t posv< float >(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb );
+
+template
+int64_t posv< double >(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb );
+
+template
+int64_t posv< std::complex<float> >(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+template
+int64_t posv< std::complex<double> >(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
+
+template
+int64_t potrf< float >(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
+
+template
+int64_t potrf< double >(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
+
+template
+int64_t potrf< std::complex<float> >(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
+
+template
+int64_t potrf< std::complex<double> >(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
+
+template
+int64_t potrs< float >(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb );
+
+template
+int64_t potrs< double >(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb );
+
+template
+int64_t potrs< std::complex<float> >(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+template
+int64_t potrs< std::complex<double> >(
+    blas::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
+
+}  // namespace lapack
@@ -0,0 +1,563 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/matrix_file.hh"
+#include "lapack_internal.hh"
+
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+
+#if defined( _WIN32 ) || defined( _WIN64 )
+    #ifndef NOMINMAX
+        #define NOMINMAX  // keep windows.h from defining min, max
+    #endif
+    #include <fcntl.h>     // _O_RDWR, ...
+    #include <io.h>        // _open, _close, _chsize_s, _get_osfhandle
+    #include <sys/stat.h>  // _fstat64
+    #include <windows.h>   // CreateFileMapping, MapViewOfFile, ...
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace lapack {
+
+using blas::max;
+
+// Size of the file header, in bytes.
+static const int64_t matrix_file_header_size = 64;
+
+static const char     matrix_file_magic[ 8 ] = { 'L','A','P','A','C','K','P','P' };
+static const uint32_t matrix_file_version    = 1;
+
+//------------------------------------------------------------------------------
+// System calls used for matrix files: POSIX, or the Windows equivalents.
+// On failure, these return -1 or nullptr with errno set.
+#if defined( _WIN32 ) || defined( _WIN64 )
+
+static int matrix_file_open( std::string const& filename, bool writable,
+                             bool create=false )
+{
+    int flags = (writable ? _O_RDWR : _O_RDONLY) | _O_BINARY;
+    if (create)
+        flags |= _O_CREAT | _O_TRUNC;
+    return ::_open( filename.c_str(), flags, _S_IREAD | _S_IWRITE );
+}
+
+static void matrix_file_close( int fd )
+{
+    ::_close( fd );
+}
+
+static int64_t matrix_file_size( int fd )
+{
+    struct _stat64 st;
+    if (::_fstat64( fd, &st ) != 0)
+        return -1;
+    return st.st_size;
+}
+
+static int64_t matrix_file_pread( int fd, void* buf, size_t nbytes,
+                                  int64_t offset )
+{
+    OVERLAPPED overlapped = {};
+    overlapped.Offset     = DWORD( offset );
+    overlapped.OffsetHigh = DWORD( offset >> 32 );
+    DWORD count = 0;
+    if (! ReadFile( (HANDLE) _get_osfhandle( fd ), buf, DWORD( nbytes ),
+                    &count, &overlapped )
+        && GetLastError() != ERROR_HANDLE_EOF) {
+        errno = EIO;
+        return -1;
+    }
+    return count;
+}
+
+static int64_t matrix_file_pwrite( int fd, void const* buf, size_t nbytes,
+                                   int64_t offset )
+{
+    OVERLAPPED overlapped = {};
+    overlapped.Offset     = DWORD( offset );
+    overlapped.OffsetHigh = DWORD( offset >> 32 );
+    DWORD count = 0;
+    if (! WriteFile( (HANDLE) _get_osfhandle( fd ), buf, DWORD( nbytes ),
+                     &count, &overlapped )) {
+        errno = EIO;
+        return -1;
+    }
+    return count;
+}
+
+static int matrix_file_resize( int fd, int64_t size )
+{
+    errno = ::_chsize_s( fd, size );
+    return (errno == 0 ? 0 : -1);
+}
+
+// Maps size bytes of fd; shared if writable, else copy-on-write.
+// The view keeps the mapping object open, so its handle is closed here.
+static void* matrix_file_map( int fd, size_t size, bool writable )
+{
+    uint64_t size64 = size;
+    HANDLE mapping = CreateFileMappingA(
+        (HANDLE) _get_osfhandle( fd ), nullptr,
+        writable ? PAGE_READWRITE : PAGE_WRITECOPY,
+        DWORD( size64 >> 32 ), DWORD( size64 ), nullptr );
+    if (mapping == nullptr) {
+        errno = EIO;
+        return nullptr;
+    }
+    void* view = MapViewOfFile(
+        mapping, writable ? FILE_MAP_WRITE : FILE_MAP_COPY, 0, 0, size );
+    CloseHandle( mapping );
+    if (view == nullptr)
+        errno = ENOMEM;
+    return view;
+}
+
+static void matrix_file_unmap( void* map, size_t /* size */ )
+{
+    UnmapViewOfFile( map );
+}
+
+static int matrix_file_sync( int fd, void* map, size_t size )
+{
+    if (! FlushViewOfFile( map, size )
+        || ! FlushFileBuffers( (HANDLE) _get_osfhandle( fd ) )) {
+        errno = EIO;
+        return -1;
+    }
+    return 0;
+}
+
+#else
+
+static int matrix_file_open( std::string const& filename, bool writable,
+                             bool create=false )
+{
+    int flags = (writable ? O_RDWR : O_RDONLY);
+    if (create)
+        flags |= O_CREAT | O_TRUNC;
+    return ::open( filename.c_str(), flags, 0644 );
+}
+
+static void matrix_file_close( int fd )
+{
+    ::close( fd );
+}
+
+static int64_t matrix_file_size( int fd )
+{
+    struct stat st;
+    if (::fstat( fd, &st ) != 0)
+        return -1;
+    return st.st_size;
+}
+
+static int64_t matrix_file_pread( int fd, void* buf, size_t nbytes,
+                                  int64_t offset )
+{
+    return ::pread( fd, buf, nbytes, offset );
+}
+
+static int64_t matrix_file_pwrite( int fd, void const* buf, size_t nbytes,
+                                   int64_t offset )
+{
+    return ::pwrite( fd, buf, nbytes, offset );
+}
+
+static int matrix_file_resize( int fd, int64_t size )
+{
+    return ::ftruncate( fd, size );
+}
+
+// Maps size bytes of fd; shared if writable, else copy-on-write.
+static void* matrix_file_map( int fd, size_t size, bool writable )
+{
+    void* map = ::mmap( nullptr, size, PROT_READ | PROT_WRITE,
+                        writable ? MAP_SHARED : MAP_PRIVATE, fd, 0 );
+    return (map == MAP_FAILED ? nullptr : map);
+}
+
+static void matrix_file_unmap( void* map, size_t size )
+{
+    ::munmap( map, size );
+}
+
+static int matrix_file_sync( [[maybe_unused]] int fd, void* map, size_t size )
+{
+    return ::msync( map, size, MS_SYNC );
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+static uint32_t matrix_file_bswap32( uint32_t x )
+{
+    return (x >> 24) | ((x >> 8) & 0x0000ff00)
+         | ((x << 8) & 0x00ff0000) | (x << 24);
+}
+
+//------------------------------------------------------------------------------
+// Precision character of scalar_t in the header.
+template <typename scalar_t>
+static char matrix_file_precision();
+
+template <> char matrix_file_precision< float  >() { return 's'; }
+template <> char matrix_file_precision< double >() { return 'd'; }
+template <> char matrix_file_precision< std::complex<float>  >() { return 'c'; }
+template <> char matrix_file_precision< std::complex<double> >() { return 'z'; }
+
+//------------------------------------------------------------------------------
+// Bytes per element, or 0 if the precision is invalid.
+static int64_t matrix_file_element_size( char precision )
+{
+    switch (precision) {
+        case 's': return sizeof(float);
+        case 'd': return sizeof(double);
+        case 'c': return sizeof(std::complex<float>);
+        case 'z': return sizeof(std::complex<double>);
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Bytes of data: n columns or m rows of ld elements.
+// Callers first check matrix_file_data_fits, so this doesn't overflow.
+static int64_t matrix_file_data_size( MatrixFileInfo const& info )
+{
+    int64_t nvec = (info.layout == blas::Layout::ColMajor ? info.n : info.m);
+    return matrix_file_element_size( info.precision ) * info.ld * nvec;
+}
+
+//------------------------------------------------------------------------------
+// @return whether the data fits in avail bytes, without overflow.
+// Requires ld >= 1, m, n >= 0, and a valid precision.
+static bool matrix_file_data_fits( MatrixFileInfo const& info, int64_t avail )
+{
+    int64_t nvec = (info.layout == blas::Layout::ColMajor ? info.n : info.m);
+    if (avail < 0)
+        return false;
+    if (nvec == 0)
+        return true;
+    // elem * ld * nvec <= avail  <=>  ld <= floor( floor( avail / elem ) / nvec ).
+    return info.ld <= avail / matrix_file_element_size( info.precision ) / nvec;
+}
+
+//------------------------------------------------------------------------------
+// Throws Error with the system error message, prefixed by what and filename.
+[[noreturn]]
+static void matrix_file_throw(
+    const char* what, std::string const& filename, const char* func )
+{
+    std::string msg = std::string( what ) + " " + filename + ": "
+                    + std::strerror( errno );
+    throw Error( msg.c_str(), func );
+}
+
+//------------------------------------------------------------------------------
+MatrixFileInfo read_matrix_file_info( std::string const& filename )
+{
+    int fd = matrix_file_open( filename, false );
+    if (fd < 0)
+        matrix_file_throw( "cannot open", filename, __func__ );
+
+    char header[ matrix_file_header_size ];
+    int64_t count = matrix_file_pread( fd, header, sizeof(header), 0 );
+    int64_t file_size = matrix_file_size( fd );
+    matrix_file_close( fd );
+    if (count < 0 || file_size < 0)
+        matrix_file_throw( "cannot read", filename, __func__ );
+
+    std::string bad = "invalid matrix file " + filename + ": ";
+    if (count < matrix_file_header_size
+        || std::memcmp( header, matrix_file_magic, 8 ) != 0) {
+        throw Error( (bad + "bad magic").c_str(), __func__ );
+    }
+
+    uint32_t version;
+    std::memcpy( &version, &header[ 8 ], sizeof(version) );
+    if (version == matrix_file_bswap32( matrix_file_version ))
+        throw Error( (bad + "byte order differs").c_str(), __func__ );
+    if (version != matrix_file_version)
+        throw Error( (bad + "unknown version").c_str(), __func__ );
+
+    MatrixFileInfo info;
+    info.precision = header[ 12 ];
+    char layout    = header[ 13 ];
+    char type      = header[ 14 ];
+    std::memcpy( &info.m,         &header[ 16 ], sizeof(int64_t) );
+    std::memcpy( &info.n,         &header[ 24 ], sizeof(int64_t) );
+    std::memcpy( &info.ld,        &header[ 32 ], sizeof(int64_t) );
+    std::memcpy( &info.alignment, &header[ 40 ], sizeof(int64_t) );
+    std::memcpy( &info.offset,    &header[ 48 ], sizeof(int64_t) );
+
+    if (matrix_file_element_size( info.precision ) == 0)
+        throw Error( (bad + "unknown precision").c_str(), __func__ );
+    if (layout != 'C' && layout != 'R')
+        throw Error( (bad + "unknown layout").c_str(), __func__ );
+    info.layout = blas::Layout( layout );
+    try {
+        from_string( std::string( 1, type ), &info.type );
+    }
+    catch (Error const&) {
+        throw Error( (bad + "unknown matrix type").c_str(), __func__ );
+    }
+
+    int64_t ld_min = max( 1, info.layout == blas::Layout::ColMajor
+                             ? info.m : info.n );
+    if (info.m < 0 || info.n < 0 || info.ld < ld_min
+        || info.alignment < 1
+        || info.offset < matrix_file_header_size
+        || info.offset % info.alignment != 0) {
+        throw Error( (bad + "bad dimensions").c_str(), __func__ );
+    }
+    // Check each term against the file size, so a crafted header can't
+    // overflow offset + data size.
+    if (info.offset > file_size
+        || ! matrix_file_data_fits( info, file_size - info.offset ))
+        throw Error( (bad + "file is truncated").c_str(), __func__ );
+
+    return info;
+}
+
+//==============================================================================
+// MatrixFile
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+MatrixFile< scalar_t >::MatrixFile()
+    : info_(),
+      fd_( -1 ),
+      map_( nullptr ),
+      map_size_( 0 ),
+      data_( nullptr )
+{}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+MatrixFile< scalar_t >::MatrixFile( std::string const& filename, bool writable )
+    : MatrixFile()
+{
+    info_ = read_matrix_file_info( filename );
+    if (info_.precision != matrix_file_precision< scalar_t >()) {
+        std::string msg = "matrix file " + filename + " has precision "
+                        + info_.precision + ", expected "
+                        + matrix_file_precision< scalar_t >();
+        throw Error( msg.c_str(), __func__ );
+    }
+
+    fd_ = matrix_file_open( filename, writable );
+    if (fd_ < 0)
+        matrix_file_throw( "cannot open", filename, __func__ );
+    map( writable );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+MatrixFile< scalar_t > MatrixFile< scalar_t >::create(
+    std::string const& filename, int64_t m, int64_t n,
+    lapack::MatrixType type, blas::Layout layout,
+    int64_t ld, int64_t alignment )
+{
+    bool col = (layout == blas::Layout::ColMajor);
+    if (ld == 0)
+        ld = max( 1, col ? m : n );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ld < max( 1, col ? m : n ) );
+    lapack_error_if( alignment < 1 );
+    lapack_error_if( alignment > std::numeric_limits< int64_t >::max()
+                                 - matrix_file_header_size );
+
+    MatrixFile file;
+    file.info_.precision = matrix_file_precision< scalar_t >();
+    file.info_.layout    = layout;
+    file.info_.type      = type;
+    file.info_.m         = m;
+    file.info_.n         = n;
+    file.info_.ld        = ld;
+    file.info_.alignment = alignment;
+    file.info_.offset    = (matrix_file_header_size + alignment - 1)
+                           / alignment * alignment;
+    lapack_error_if_msg(
+        ! matrix_file_data_fits(
+            file.info_,
+            std::numeric_limits< int64_t >::max() - file.info_.offset ),
+        "matrix file size overflows" );
+
+    char header[ matrix_file_header_size ] = {};
+    std::memcpy( &header[ 0 ], matrix_file_magic, 8 );
+    std::memcpy( &header[ 8 ], &matrix_file_version, sizeof(uint32_t) );
+    header[ 12 ] = file.info_.precision;
+    header[ 13 ] = char( layout );
+    header[ 14 ] = to_char( type );
+    std::memcpy( &header[ 16 ], &file.info_.m,         sizeof(int64_t) );
+    std::memcpy( &header[ 24 ], &file.info_.n,         sizeof(int64_t) );
+    std::memcpy( &header[ 32 ], &file.info_.ld,        sizeof(int64_t) );
+    std::memcpy( &header[ 40 ], &file.info_.alignment, sizeof(int64_t) );
+    std::memcpy( &header[ 48 ], &file.info_.offset,    sizeof(int64_t) );
+
+    file.fd_ = matrix_file_open( filename, true, true );
+    if (file.fd_ < 0)
+        matrix_file_throw( "cannot create", filename, __func__ );
+    // Resizing zero fills, without writing the data.
+    if (matrix_file_pwrite( file.fd_, header, sizeof(header), 0 )
+            != int64_t( sizeof(header) )
+        || matrix_file_resize( file.fd_, file.info_.offset
+                               + matrix_file_data_size( file.info_ ) ) != 0) {
+        matrix_file_throw( "cannot write", filename, __func__ );
+    }
+    file.map( true );
+    return file;
+}
+
+//------------------------------------------------------------------------------
+// Maps the whole file; data starts at info_.offset.
+// Without writable, the mapping is private (copy-on-write).
+template <typename scalar_t>
+void MatrixFile< scalar_t >::map( bool writable )
+{
+    int64_t data_size = matrix_file_data_size( info_ );
+    if (data_size == 0)
+        return;
+
+    map_size_ = info_.offset + data_size;
+    map_ = matrix_file_map( fd_, map_size_, writable );
+    if (map_ == nullptr) {
+        std::string msg = std::string( "mmap failed: " ) + std::strerror( errno );
+        close();
+        throw Error( msg.c_str(), __func__ );
+    }
+    data_ = (scalar_t*) ((char*) map_ + info_.offset);
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void MatrixFile< scalar_t >::close()
+{
+    if (map_ != nullptr)
+        matrix_file_unmap( map_, map_size_ );
+    if (fd_ >= 0)
+        matrix_file_close( fd_ );
+    map_  = nullptr;
+    data_ = nullptr;
+    fd_   = -1;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+MatrixFile< scalar_t >::~MatrixFile()
+{
+    close();
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+MatrixFile< scalar_t >::MatrixFile( MatrixFile&& other )
+    : MatrixFile()
+{
+    *this = std::move( other );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+MatrixFile< scalar_t >& MatrixFile< scalar_t >::operator = ( MatrixFile&& other )
+{
+    std::swap( info_,     other.info_     );
+    std::swap( fd_,       other.fd_       );
+    std::swap( map_,      other.map_      );
+    std::swap( map_size_, other.map_size_ );
+    std::swap( data_,     other.data_     );
+    return *this;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+OOCMatrix< scalar_t > MatrixFile< scalar_t >::ooc() const
+{
+    lapack_error_if( info_.layout != blas::Layout::ColMajor );
+    return OOCMatrix< scalar_t >( fd_, info_.offset,
+                                  info_.m, info_.n, info_.ld );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void MatrixFile< scalar_t >::sync()
+{
+    if (map_ != nullptr && matrix_file_sync( fd_, map_, map_size_ ) != 0) {
+        std::string msg = std::string( "msync failed: " ) + std::strerror( errno );
+        throw Error( msg.c_str(), __func__ );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void write_matrix_file(
+    std::string const& filename, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    lapack::MatrixType type, blas::Layout layout,
+    int64_t alignment )
+{
+    lapack_instrument( "write_matrix_file",
+                       internal::precision_char< scalar_t >(), m, n, 0,
+                       internal::gflop_none );
+
+    lapack_error_if( lda < max( 1, m ) );
+
+    auto file = MatrixFile< scalar_t >::create(
+        filename, m, n, type, layout, 0, alignment );
+    scalar_t* B = file.data();
+    int64_t ldb = file.ld();
+    if (layout == blas::Layout::ColMajor) {
+        lapack::lacpy( MatrixType::General, m, n, A, lda, B, ldb );
+    }
+    else {
+        for (int64_t i = 0; i < m; ++i)
+            blas::copy( n, &A[ i ], lda, &B[ i*ldb ], 1 );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class MatrixFile< float >;
+template class MatrixFile< double >;
+template class MatrixFile< std::complex<float> >;
+template class MatrixFile< std::complex<double> >;
+
+template
+void write_matrix_file< float >(
+    std::string const& filename, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    lapack::MatrixType type, blas::Layout layout,
+    int64_t alignment );
+
+template
+void write_matrix_file< double >(
+    std::string const& filename, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    lapack::MatrixType type, blas::Layout layout,
+    int64_t alignment );
+
+template
+void write_matrix_file< std::complex<float> >(
+    std::string const& filename, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    lapack::MatrixType type, blas::Layout layout,
+    int64_t alignment );
+
+template
+void write_matrix_file< std::complex<double> >(
+    std::string const& filename, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    lapack::MatrixType type, blas::Layout layout,
+    int64_t alignment );
+
+}  // namespace lapack
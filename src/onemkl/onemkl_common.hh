@@ -29,6 +29,16 @@ inline const oneapi::mkl::job job2onemkl( lapack::Job job )
     return oneapi::mkl::job::novec;
 }
 
+inline oneapi::mkl::jobsvd job2jobsvd_onemkl( lapack::Job job )
+{
+    switch (job) {
+        case lapack::Job::AllVec:       return oneapi::mkl::jobsvd::vectors;
+        case lapack::Job::SomeVec:      return oneapi::mkl::jobsvd::somevec;
+        case lapack::Job::OverwriteVec: return oneapi::mkl::jobsvd::vectorsina;
+        default:                        return oneapi::mkl::jobsvd::novec;
+    }
+}
+
 } // namespace lapack
 
 #endif // LAPACK_ONEMKL_COMMON_H
@@ -0,0 +1,152 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_SYCL)
+
+#include "onemkl_common.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Wrapper around workspace query.
+template <typename scalar_t>
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    auto solver = queue.stream();
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // query for workspace size
+    int64_t lwork = 0;
+    blas_dev_call(
+        lwork = oneapi::mkl::lapack::gesvd_scratchpad_size<scalar_t>(
+            solver, job2jobsvd_onemkl( jobu ), job2jobsvd_onemkl( jobvt ),
+            m, n, ldda, lddu, lddvt ));
+    *dev_work_size = lwork * sizeof(scalar_t);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around oneMKL.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    auto solver = queue.stream();
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // launch kernel
+    int64_t lwork = dev_work_size / sizeof(scalar_t);
+    blas_dev_call(
+        oneapi::mkl::lapack::gesvd(
+            solver, job2jobsvd_onemkl( jobu ), job2jobsvd_onemkl( jobvt ),
+            m, n, dA, ldda, dS, dU, lddu, dVT, lddvt,
+            (scalar_t*) dev_work, lwork ));
+
+    // todo: default info returned
+    blas::device_memset( dev_info, 0, 1, queue );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* dA, int64_t ldda, float* dS,
+    float* dU, int64_t lddu,
+    float* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* dA, int64_t ldda, double* dS,
+    double* dU, int64_t lddu,
+    double* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dS,
+    std::complex<float>* dU, int64_t lddu,
+    std::complex<float>* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dS,
+    std::complex<double>* dU, int64_t lddu,
+    std::complex<double>* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* dA, int64_t ldda, float* dS,
+    float* dU, int64_t lddu,
+    float* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* dA, int64_t ldda, double* dS,
+    double* dU, int64_t lddu,
+    double* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dS,
+    std::complex<float>* dU, int64_t lddu,
+    std::complex<float>* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dS,
+    std::complex<double>* dU, int64_t lddu,
+    std::complex<double>* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_SYCL
@@ -0,0 +1,96 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_SYCL)
+
+#include "onemkl_common.hh"
+
+//==============================================================================
+// todo: put into BLAS++ header somewhere.
+
+namespace blas {
+namespace internal {
+
+oneapi::mkl::transpose op2onemkl( blas::Op op );
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Wrapper around oneMKL.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    scalar_t* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    auto solver = queue.stream();
+    // For real, ConjTrans is Trans.
+    if (trans == Op::ConjTrans && ! blas::is_complex<scalar_t>::value)
+        trans = Op::Trans;
+    auto trans_ = blas::internal::op2onemkl( trans );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // query for workspace size; alloc workspace in queue
+    int64_t lwork = 0;
+    blas_dev_call(
+        lwork = oneapi::mkl::lapack::getrs_scratchpad_size<scalar_t>(
+            solver, trans_, n, nrhs, ldda, lddb ));
+    queue.work_ensure_size< scalar_t >( lwork );  // syncs if needed
+    scalar_t* dev_work = (scalar_t*) queue.work();
+
+    // launch kernel
+    blas_dev_call(
+        oneapi::mkl::lapack::getrs(
+            solver, trans_, n, nrhs, const_cast< scalar_t* >( dA ), ldda,
+            const_cast< device_pivot_int* >( dev_ipiv ),
+            dB, lddb, dev_work, lwork ));
+
+    // todo: default info returned
+    blas::device_memset( dev_info, 0, 1, queue );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    float* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    double* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    std::complex<float>* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    std::complex<double>* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_SYCL
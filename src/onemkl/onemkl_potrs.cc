@@ -0,0 +1,92 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_SYCL)
+
+#include "onemkl_common.hh"
+
+//==============================================================================
+// todo: put into BLAS++ header somewhere.
+
+namespace blas {
+namespace internal {
+
+oneapi::mkl::uplo uplo2onemkl( blas::Uplo uplo );
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Wrapper around oneMKL.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    auto solver = queue.stream();
+    auto uplo_ = blas::internal::uplo2onemkl( uplo );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // query for workspace size; alloc workspace in queue
+    int64_t lwork = 0;
+    blas_dev_call(
+        lwork = oneapi::mkl::lapack::potrs_scratchpad_size<scalar_t>(
+            solver, uplo_, n, nrhs, ldda, lddb ));
+    queue.work_ensure_size< scalar_t >( lwork );  // syncs if needed
+    scalar_t* dev_work = (scalar_t*) queue.work();
+
+    // launch kernel
+    blas_dev_call(
+        oneapi::mkl::lapack::potrs(
+            solver, uplo_, n, nrhs, const_cast< scalar_t* >( dA ), ldda,
+            dB, lddb, dev_work, lwork ));
+
+    // todo: default info returned
+    blas::device_memset( dev_info, 0, 1, queue );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* dA, int64_t ldda,
+    float* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* dA, int64_t ldda,
+    double* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* dA, int64_t ldda,
+    std::complex<float>* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* dA, int64_t ldda,
+    std::complex<double>* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_SYCL
@@ -0,0 +1,59 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_SYCL)
+
+#include "onemkl_common.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// oneMKL has no sytrs.
+template <typename scalar_t>
+void sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda, device_sytrf_pivot_int const* dev_ipiv,
+    scalar_t* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    throw lapack::Error( "sytrs not available in oneMKL", __func__ );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* dA, int64_t ldda, device_sytrf_pivot_int const* dev_ipiv,
+    float* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* dA, int64_t ldda, device_sytrf_pivot_int const* dev_ipiv,
+    double* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* dA, int64_t ldda, device_sytrf_pivot_int const* dev_ipiv,
+    std::complex<float>* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* dA, int64_t ldda, device_sytrf_pivot_int const* dev_ipiv,
+    std::complex<double>* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_SYCL
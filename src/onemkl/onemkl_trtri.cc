@@ -0,0 +1,105 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_SYCL)
+
+#include "onemkl_common.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// oneMKL has no trtri.
+template <typename scalar_t>
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    *dev_work_size  = 0;
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    throw lapack::Error( "trtri not available in oneMKL", __func__ );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    float* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    double* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<float>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<double>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    float* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    double* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<float>* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<double>* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_SYCL
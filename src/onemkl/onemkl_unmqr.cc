@@ -0,0 +1,252 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_SYCL)
+
+#include "onemkl_common.hh"
+
+//==============================================================================
+// todo: put into BLAS++ header somewhere.
+
+namespace blas {
+namespace internal {
+
+oneapi::mkl::side side2onemkl( blas::Side side );
+oneapi::mkl::transpose op2onemkl( blas::Op op );
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers to call ormqr for real, unmqr for complex.
+int64_t onemkl_unmqr_scratchpad_size(
+    sycl::queue& solver, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+    int64_t m, int64_t n, int64_t k, int64_t ldda, int64_t lddc, float* dummy )
+{
+    return oneapi::mkl::lapack::ormqr_scratchpad_size<float>(
+        solver, side, trans, m, n, k, ldda, lddc );
+}
+
+//----------
+int64_t onemkl_unmqr_scratchpad_size(
+    sycl::queue& solver, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+    int64_t m, int64_t n, int64_t k, int64_t ldda, int64_t lddc, double* dummy )
+{
+    return oneapi::mkl::lapack::ormqr_scratchpad_size<double>(
+        solver, side, trans, m, n, k, ldda, lddc );
+}
+
+//----------
+int64_t onemkl_unmqr_scratchpad_size(
+    sycl::queue& solver, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+    int64_t m, int64_t n, int64_t k, int64_t ldda, int64_t lddc, std::complex<float>* dummy )
+{
+    return oneapi::mkl::lapack::unmqr_scratchpad_size<std::complex<float>>(
+        solver, side, trans, m, n, k, ldda, lddc );
+}
+
+//----------
+int64_t onemkl_unmqr_scratchpad_size(
+    sycl::queue& solver, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+    int64_t m, int64_t n, int64_t k, int64_t ldda, int64_t lddc, std::complex<double>* dummy )
+{
+    return oneapi::mkl::lapack::unmqr_scratchpad_size<std::complex<double>>(
+        solver, side, trans, m, n, k, ldda, lddc );
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers to call ormqr for real, unmqr for complex.
+sycl::event onemkl_unmqr(
+    sycl::queue& solver, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+    int64_t m, int64_t n, int64_t k,
+    float* dA, int64_t ldda, float* dtau,
+    float* dC, int64_t lddc,
+    float* dev_work, int64_t lwork )
+{
+    return oneapi::mkl::lapack::ormqr(
+        solver, side, trans, m, n, k, dA, ldda, dtau, dC, lddc,
+        dev_work, lwork );
+}
+
+//----------
+sycl::event onemkl_unmqr(
+    sycl::queue& solver, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+    int64_t m, int64_t n, int64_t k,
+    double* dA, int64_t ldda, double* dtau,
+    double* dC, int64_t lddc,
+    double* dev_work, int64_t lwork )
+{
+    return oneapi::mkl::lapack::ormqr(
+        solver, side, trans, m, n, k, dA, ldda, dtau, dC, lddc,
+        dev_work, lwork );
+}
+
+//----------
+sycl::event onemkl_unmqr(
+    sycl::queue& solver, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* dA, int64_t ldda, std::complex<float>* dtau,
+    std::complex<float>* dC, int64_t lddc,
+    std::complex<float>* dev_work, int64_t lwork )
+{
+    return oneapi::mkl::lapack::unmqr(
+        solver, side, trans, m, n, k, dA, ldda, dtau, dC, lddc,
+        dev_work, lwork );
+}
+
+//----------
+sycl::event onemkl_unmqr(
+    sycl::queue& solver, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* dA, int64_t ldda, std::complex<double>* dtau,
+    std::complex<double>* dC, int64_t lddc,
+    std::complex<double>* dev_work, int64_t lwork )
+{
+    return oneapi::mkl::lapack::unmqr(
+        solver, side, trans, m, n, k, dA, ldda, dtau, dC, lddc,
+        dev_work, lwork );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around workspace query.
+template <typename scalar_t>
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    auto solver = queue.stream();
+    // For real, ConjTrans is Trans.
+    if (trans == Op::ConjTrans && ! blas::is_complex<scalar_t>::value)
+        trans = Op::Trans;
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // query for workspace size
+    int64_t lwork = 0;
+    blas_dev_call(
+        lwork = onemkl_unmqr_scratchpad_size(
+            solver, blas::internal::side2onemkl( side ),
+            blas::internal::op2onemkl( trans ), m, n, k, ldda, lddc, dC ));
+    *dev_work_size = lwork * sizeof(scalar_t);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around oneMKL.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    auto solver = queue.stream();
+    // For real, ConjTrans is Trans.
+    if (trans == Op::ConjTrans && ! blas::is_complex<scalar_t>::value)
+        trans = Op::Trans;
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // launch kernel
+    int64_t lwork = dev_work_size / sizeof(scalar_t);
+    blas_dev_call(
+        onemkl_unmqr(
+            solver, blas::internal::side2onemkl( side ),
+            blas::internal::op2onemkl( trans ), m, n, k,
+            const_cast< scalar_t* >( dA ), ldda,
+            const_cast< scalar_t* >( dtau ), dC, lddc,
+            (scalar_t*) dev_work, lwork ));
+
+    // todo: default info returned
+    blas::device_memset( dev_info, 0, 1, queue );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* dA, int64_t ldda, float const* dtau,
+    float* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* dA, int64_t ldda, double const* dtau,
+    double* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* dA, int64_t ldda, std::complex<float> const* dtau,
+    std::complex<float>* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* dA, int64_t ldda, std::complex<double> const* dtau,
+    std::complex<double>* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* dA, int64_t ldda, float const* dtau,
+    float* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* dA, int64_t ldda, double const* dtau,
+    double* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* dA, int64_t ldda, std::complex<float> const* dtau,
+    std::complex<float>* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* dA, int64_t ldda, std::complex<double> const* dtau,
+    std::complex<double>* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_SYCL
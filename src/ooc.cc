@@ -0,0 +1,314 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "ooc_internal.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+
+#if defined( _WIN32 ) || defined( _WIN64 )
+    #ifndef NOMINMAX
+        #define NOMINMAX  // keep windows.h from defining min, max
+    #endif
+    #include <io.h>       // _get_osfhandle
+    #include <windows.h>  // ReadFile, WriteFile
+#else
+    #include <unistd.h>   // pread, pwrite
+#endif
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+// OOCMatrix
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+OOCMatrix< scalar_t >::OOCMatrix(
+    int fd, int64_t offset, int64_t m, int64_t n, int64_t ld )
+    : fd_( fd ),
+      offset_( offset ),
+      data_( nullptr ),
+      m_( m ),
+      n_( n ),
+      ld_( ld )
+{
+    lapack_error_if( fd < 0 );
+    lapack_error_if( offset < 0 );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ld < max( 1, m ) );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+OOCMatrix< scalar_t >::OOCMatrix(
+    scalar_t* data, int64_t m, int64_t n, int64_t ld )
+    : fd_( -1 ),
+      offset_( 0 ),
+      data_( data ),
+      m_( m ),
+      n_( n ),
+      ld_( ld )
+{
+    lapack_error_if( data == nullptr && m > 0 && n > 0 );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ld < max( 1, m ) );
+}
+
+//------------------------------------------------------------------------------
+// Reads or writes exactly nbytes at byte offset of fd,
+// retrying partial transfers and interrupts.
+// Windows has no pread/pwrite; ReadFile and WriteFile with an offset in
+// OVERLAPPED are the equivalent, also safe for concurrent calls.
+#if defined( _WIN32 ) || defined( _WIN64 )
+
+static void ooc_pread( int fd, void* buf, size_t nbytes, int64_t offset )
+{
+    HANDLE handle = (HANDLE) _get_osfhandle( fd );
+    char* p = (char*) buf;
+    while (nbytes > 0) {
+        OVERLAPPED overlapped = {};
+        overlapped.Offset     = DWORD( offset );
+        overlapped.OffsetHigh = DWORD( offset >> 32 );
+        DWORD chunk = DWORD( std::min( nbytes, size_t( 1 ) << 30 ) );
+        DWORD count = 0;
+        if (! ReadFile( handle, p, chunk, &count, &overlapped )) {
+            if (GetLastError() == ERROR_HANDLE_EOF)
+                throw Error( "unexpected end of file", __func__ );
+            throw Error( "ReadFile failed", __func__ );
+        }
+        if (count == 0)
+            throw Error( "unexpected end of file", __func__ );
+        p      += count;
+        offset += count;
+        nbytes -= count;
+    }
+}
+
+static void ooc_pwrite( int fd, void const* buf, size_t nbytes, int64_t offset )
+{
+    HANDLE handle = (HANDLE) _get_osfhandle( fd );
+    char const* p = (char const*) buf;
+    while (nbytes > 0) {
+        OVERLAPPED overlapped = {};
+        overlapped.Offset     = DWORD( offset );
+        overlapped.OffsetHigh = DWORD( offset >> 32 );
+        DWORD chunk = DWORD( std::min( nbytes, size_t( 1 ) << 30 ) );
+        DWORD count = 0;
+        if (! WriteFile( handle, p, chunk, &count, &overlapped ))
+            throw Error( "WriteFile failed", __func__ );
+        p      += count;
+        offset += count;
+        nbytes -= count;
+    }
+}
+
+#else
+
+static void ooc_pread( int fd, void* buf, size_t nbytes, int64_t offset )
+{
+    char* p = (char*) buf;
+    while (nbytes > 0) {
+        ssize_t count = ::pread( fd, p, nbytes, offset );
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count < 0)
+            throw Error( std::strerror( errno ), __func__ );
+        if (count == 0)
+            throw Error( "unexpected end of file", __func__ );
+        p      += count;
+        offset += count;
+        nbytes -= count;
+    }
+}
+
+static void ooc_pwrite( int fd, void const* buf, size_t nbytes, int64_t offset )
+{
+    char const* p = (char const*) buf;
+    while (nbytes > 0) {
+        ssize_t count = ::pwrite( fd, p, nbytes, offset );
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count < 0)
+            throw Error( std::strerror( errno ), __func__ );
+        p      += count;
+        offset += count;
+        nbytes -= count;
+    }
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void OOCMatrix< scalar_t >::read(
+    int64_t i, int64_t j, int64_t mb, int64_t nb,
+    scalar_t* B, int64_t ldb ) const
+{
+    lapack_error_if( i < 0 || mb < 0 || i + mb > m_ );
+    lapack_error_if( j < 0 || nb < 0 || j + nb > n_ );
+    lapack_error_if( ldb < max( 1, mb ) );
+
+    if (mb == 0 || nb == 0)
+        return;
+
+    if (data_ != nullptr) {
+        lapack::lacpy( MatrixType::General, mb, nb,
+                       &data_[ i + j*ld_ ], ld_, B, ldb );
+    }
+    else if (mb == ld_ && ldb == ld_) {
+        // Whole columns are contiguous.
+        ooc_pread( fd_, B, sizeof(scalar_t) * mb * nb,
+                   offset_ + sizeof(scalar_t) * (i + j*ld_) );
+    }
+    else {
+        for (int64_t jj = 0; jj < nb; ++jj) {
+            ooc_pread( fd_, &B[ jj*ldb ], sizeof(scalar_t) * mb,
+                       offset_ + sizeof(scalar_t) * (i + (j + jj)*ld_) );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void OOCMatrix< scalar_t >::write(
+    int64_t i, int64_t j, int64_t mb, int64_t nb,
+    scalar_t const* B, int64_t ldb ) const
+{
+    lapack_error_if( i < 0 || mb < 0 || i + mb > m_ );
+    lapack_error_if( j < 0 || nb < 0 || j + nb > n_ );
+    lapack_error_if( ldb < max( 1, mb ) );
+
+    if (mb == 0 || nb == 0)
+        return;
+
+    if (data_ != nullptr) {
+        lapack::lacpy( MatrixType::General, mb, nb,
+                       B, ldb, &data_[ i + j*ld_ ], ld_ );
+    }
+    else if (mb == ld_ && ldb == ld_) {
+        ooc_pwrite( fd_, B, sizeof(scalar_t) * mb * nb,
+                    offset_ + sizeof(scalar_t) * (i + j*ld_) );
+    }
+    else {
+        for (int64_t jj = 0; jj < nb; ++jj) {
+            ooc_pwrite( fd_, &B[ jj*ldb ], sizeof(scalar_t) * mb,
+                        offset_ + sizeof(scalar_t) * (i + (j + jj)*ld_) );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class OOCMatrix< float >;
+template class OOCMatrix< double >;
+template class OOCMatrix< std::complex<float> >;
+template class OOCMatrix< std::complex<double> >;
+
+namespace internal {
+
+//==============================================================================
+// OOCWorker
+
+//------------------------------------------------------------------------------
+double ooc_wtime()
+{
+    using namespace std::chrono;
+    return duration< double >(
+        steady_clock::now().time_since_epoch() ).count();
+}
+
+//------------------------------------------------------------------------------
+OOCWorker::OOCWorker()
+    : stop_( false )
+{
+    thread_ = std::thread( &OOCWorker::run, this );
+}
+
+//------------------------------------------------------------------------------
+// Drains the queue, so no request outlives the buffers it uses,
+// even if the routine exits early with an exception.
+OOCWorker::~OOCWorker()
+{
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        stop_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+}
+
+//------------------------------------------------------------------------------
+void OOCWorker::run()
+{
+    while (true) {
+        std::packaged_task<void ()> request;
+        {
+            std::unique_lock< std::mutex > lock( mutex_ );
+            cv_.wait( lock, [this] { return stop_ || ! queue_.empty(); } );
+            if (queue_.empty())
+                return;  // stop_ and drained
+            request = std::move( queue_.front() );
+            queue_.pop_front();
+        }
+        // Exceptions are stored in the request's future.
+        double t = ooc_wtime();
+        request();
+        t = ooc_wtime() - t;
+
+        std::lock_guard< std::mutex > lock( mutex_ );
+        stats_.io_time += t;
+    }
+}
+
+//------------------------------------------------------------------------------
+std::future<void> OOCWorker::submit(
+    std::function<void ()> request,
+    int64_t bytes_read, int64_t bytes_written )
+{
+    std::packaged_task<void ()> task( std::move( request ) );
+    std::future<void> done = task.get_future();
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        queue_.push_back( std::move( task ) );
+        stats_.bytes_read    += bytes_read;
+        stats_.bytes_written += bytes_written;
+    }
+    cv_.notify_one();
+    return done;
+}
+
+//------------------------------------------------------------------------------
+void OOCWorker::wait( std::future<void>& done )
+{
+    if (! done.valid())
+        return;
+    double t = ooc_wtime();
+    done.wait();
+    stats_.wait_time += ooc_wtime() - t;  // only the caller writes wait_time
+    done.get();
+}
+
+//------------------------------------------------------------------------------
+void OOCWorker::finish( double time, OOCStats* stats )
+{
+    // A marker request; once it is done, all earlier requests are done.
+    std::future<void> done = submit( [] {}, 0, 0 );
+    wait( done );
+    if (stats != nullptr) {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        *stats = stats_;
+        stats->time = time;
+    }
+}
+
+}  // namespace internal
+}  // namespace lapack
@@ -0,0 +1,65 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_OOC_INTERNAL_HH
+#define LAPACK_OOC_INTERNAL_HH
+
+#include "lapack/ooc.hh"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Background thread that executes the reads and writes of an out-of-core
+// routine, so they overlap with computation. Requests run one at a time in
+// the order submitted; hence a read submitted after a write of the same
+// region, or into the same buffer, sees the write's result.
+// Shared by potrf_ooc, potrs_ooc, and getrf_ooc. See src/ooc.cc.
+class OOCWorker {
+public:
+    OOCWorker();
+    ~OOCWorker();
+
+    // Queues request; the returned future is ready when it is done.
+    // bytes_read and bytes_written are added to the statistics.
+    std::future<void> submit(
+        std::function<void ()> request,
+        int64_t bytes_read, int64_t bytes_written );
+
+    // Waits for a request, counting the time as computation waiting on I/O.
+    // Rethrows any exception from the request.
+    void wait( std::future<void>& done );
+
+    // Waits for all requests, then fills in stats, if not null.
+    // time is the routine's total time.
+    void finish( double time, OOCStats* stats );
+
+private:
+    void run();
+
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque< std::packaged_task<void ()> > queue_;
+    bool stop_;
+
+    OOCStats stats_;
+};
+
+//------------------------------------------------------------------------------
+// Returns seconds since an arbitrary start, from a monotonic clock.
+double ooc_wtime();
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_OOC_INTERNAL_HH
@@ -23,6 +23,8 @@ int64_t opgtr(
     float const* tau,
     float* Q, int64_t ldq )
 {
+    lapack_instrument( "opgtr", 's', 0, n, 0, Gflop< float >::orgtr( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldq_ = to_lapack_int( ldq );
@@ -51,6 +53,8 @@ int64_t opgtr(
     double const* tau,
     double* Q, int64_t ldq )
 {
+    lapack_instrument( "opgtr", 'd', 0, n, 0, Gflop< double >::orgtr( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldq_ = to_lapack_int( ldq );
@@ -23,6 +23,9 @@ int64_t opmtr(
     float const* tau,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "opmtr", 's', m, n, 0,
+                       Gflop< float >::ormtr( side, m, n ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -61,6 +64,9 @@ int64_t opmtr(
     double const* tau,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "opmtr", 'd', m, n, 0,
+                       Gflop< double >::ormtr( side, m, n ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -28,6 +28,9 @@ int64_t orcsd2by1(
     float* U2, int64_t ldu2,
     float* V1T, int64_t ldv1t )
 {
+    lapack_instrument( "orcsd2by1", 's', m, 0, 0,
+                       internal::gflop_data_dependent );
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -92,6 +95,9 @@ int64_t orcsd2by1(
     double* U2, int64_t ldu2,
     double* V1T, int64_t ldv1t )
 {
+    lapack_instrument( "orcsd2by1", 'd', m, 0, 0,
+                       internal::gflop_data_dependent );
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -23,6 +23,9 @@ int64_t orgbr(
     float* A, int64_t lda,
     float const* tau )
 {
+    lapack_instrument( "orgbr", 's', m, n, k,
+                       Gflop< float >::orgbr( vect, m, n, k ) );
+
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -67,6 +70,9 @@ int64_t orgbr(
     double* A, int64_t lda,
     double const* tau )
 {
+    lapack_instrument( "orgbr", 'd', m, n, k,
+                       Gflop< double >::orgbr( vect, m, n, k ) );
+
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
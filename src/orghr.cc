@@ -22,6 +22,9 @@ int64_t orghr(
     float* A, int64_t lda,
     float const* tau )
 {
+    lapack_instrument( "orghr", 's', 0, n, 0,
+                       Gflop< float >::orghr( ilo, ihi ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
@@ -61,6 +64,9 @@ int64_t orghr(
     double* A, int64_t lda,
     double const* tau )
 {
+    lapack_instrument( "orghr", 'd', 0, n, 0,
+                       Gflop< double >::orghr( ilo, ihi ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
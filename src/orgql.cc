@@ -23,6 +23,9 @@ int64_t orgql(
     float* A, int64_t lda,
     float const* tau )
 {
+    lapack_instrument( "orgql", 's', m, n, k,
+                       Gflop< float >::orgql( m, n, k ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
@@ -64,6 +67,9 @@ int64_t orgql(
     double* A, int64_t lda,
     double const* tau )
 {
+    lapack_instrument( "orgql", 'd', m, n, k,
+                       Gflop< double >::orgql( m, n, k ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
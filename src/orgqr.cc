@@ -23,6 +23,9 @@ int64_t orgqr(
     float* A, int64_t lda,
     float const* tau )
 {
+    lapack_instrument( "orgqr", 's', m, n, k,
+                       Gflop< float >::orgqr( m, n, k ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
@@ -64,6 +67,9 @@ int64_t orgqr(
     double* A, int64_t lda,
     double const* tau )
 {
+    lapack_instrument( "orgqr", 'd', m, n, k,
+                       Gflop< double >::orgqr( m, n, k ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
@@ -23,6 +23,8 @@ int64_t orgtr(
     float* A, int64_t lda,
     float const* tau )
 {
+    lapack_instrument( "orgtr", 's', 0, n, 0, Gflop< float >::orgtr( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -65,6 +67,8 @@ int64_t orgtr(
     double* A, int64_t lda,
     double const* tau )
 {
+    lapack_instrument( "orgtr", 'd', 0, n, 0, Gflop< double >::orgtr( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
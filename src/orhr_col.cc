@@ -25,6 +25,9 @@ int64_t orhr_col(
     float* T, int64_t ldt,
     float* D )
 {
+    lapack_instrument( "orhr_col", 's', m, n, 0,
+                       Gflop< float >::orhr_col( m, n ) );
+
     lapack_error_if(m < n);
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -140,6 +143,9 @@ int64_t orhr_col(
     double* T, int64_t ldt,
     double* D )
 {
+    lapack_instrument( "orhr_col", 'd', m, n, 0,
+                       Gflop< double >::orhr_col( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nb_ = to_lapack_int( nb );
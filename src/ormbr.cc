@@ -24,6 +24,9 @@ int64_t ormbr(
     float const* tau,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "ormbr", 's', m, n, k,
+                       Gflop< float >::ormbr( vect, side, m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -78,6 +81,9 @@ int64_t ormbr(
     double const* tau,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "ormbr", 'd', m, n, k,
+                       Gflop< double >::ormbr( vect, side, m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
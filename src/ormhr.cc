@@ -23,6 +23,9 @@ int64_t ormhr(
     float const* tau,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "ormhr", 's', m, n, 0,
+                       Gflop< float >::ormhr( side, m, n, ilo, ihi ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -75,6 +78,9 @@ int64_t ormhr(
     double const* tau,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "ormhr", 'd', m, n, 0,
+                       Gflop< double >::ormhr( side, m, n, ilo, ihi ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
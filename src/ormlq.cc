@@ -24,6 +24,9 @@ int64_t ormlq(
     float const* tau,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "ormlq", 's', m, n, k,
+                       Gflop< float >::ormlq( side, m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -77,6 +80,9 @@ int64_t ormlq(
     double const* tau,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "ormlq", 'd', m, n, k,
+                       Gflop< double >::ormlq( side, m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -24,6 +24,9 @@ int64_t ormql(
     float const* tau,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "ormql", 's', m, n, k,
+                       Gflop< float >::ormql( side, m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -77,6 +80,9 @@ int64_t ormql(
     double const* tau,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "ormql", 'd', m, n, k,
+                       Gflop< double >::ormql( side, m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
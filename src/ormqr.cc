@@ -24,6 +24,9 @@ int64_t ormqr(
     float const* tau,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "ormqr", 's', m, n, k,
+                       Gflop< float >::ormqr( side, m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -77,6 +80,9 @@ int64_t ormqr(
     double const* tau,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "ormqr", 'd', m, n, k,
+                       Gflop< double >::ormqr( side, m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -24,6 +24,9 @@ int64_t ormrq(
     float const* tau,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "ormrq", 's', m, n, k,
+                       Gflop< float >::ormrq( side, m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -77,6 +80,9 @@ int64_t ormrq(
     double const* tau,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "ormrq", 'd', m, n, k,
+                       Gflop< double >::ormrq( side, m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -23,6 +23,9 @@ int64_t ormrz(
     float const* tau,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "ormrz", 's', m, n, k,
+                       Gflop< float >::ormrz( side, m, n, k, l ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -75,6 +78,9 @@ int64_t ormrz(
     double const* tau,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "ormrz", 'd', m, n, k,
+                       Gflop< double >::ormrz( side, m, n, k, l ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
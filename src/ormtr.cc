@@ -24,6 +24,9 @@ int64_t ormtr(
     float const* tau,
     float* C, int64_t ldc )
 {
+    lapack_instrument( "ormtr", 's', m, n, 0,
+                       Gflop< float >::ormtr( side, m, n ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -77,6 +80,9 @@ int64_t ormtr(
     double const* tau,
     double* C, int64_t ldc )
 {
+    lapack_instrument( "ormtr", 'd', m, n, 0,
+                       Gflop< double >::ormtr( side, m, n ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
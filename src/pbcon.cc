@@ -23,6 +23,8 @@ int64_t pbcon(
     float const* AB, int64_t ldab, float anorm,
     float* rcond )
 {
+    lapack_instrument( "pbcon", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -52,6 +54,8 @@ int64_t pbcon(
     double const* AB, int64_t ldab, double anorm,
     double* rcond )
 {
+    lapack_instrument( "pbcon", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -81,6 +85,8 @@ int64_t pbcon(
     std::complex<float> const* AB, int64_t ldab, float anorm,
     float* rcond )
 {
+    lapack_instrument( "pbcon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -155,6 +161,8 @@ int64_t pbcon(
     std::complex<double> const* AB, int64_t ldab, double anorm,
     double* rcond )
 {
+    lapack_instrument( "pbcon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
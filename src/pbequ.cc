@@ -24,6 +24,8 @@ int64_t pbequ(
     float* scond,
     float* amax )
 {
+    lapack_instrument( "pbequ", 's', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -50,6 +52,8 @@ int64_t pbequ(
     double* scond,
     double* amax )
 {
+    lapack_instrument( "pbequ", 'd', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -76,6 +80,8 @@ int64_t pbequ(
     float* scond,
     float* amax )
 {
+    lapack_instrument( "pbequ", 'c', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -154,6 +160,8 @@ int64_t pbequ(
     double* scond,
     double* amax )
 {
+    lapack_instrument( "pbequ", 'z', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -27,6 +27,9 @@ int64_t pbrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "pbrfs", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -69,6 +72,9 @@ int64_t pbrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "pbrfs", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -111,6 +117,9 @@ int64_t pbrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "pbrfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -231,6 +240,9 @@ int64_t pbrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "pbrfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -22,6 +22,9 @@ int64_t pbsv(
     float* AB, int64_t ldab,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "pbsv", 's', 0, n, nrhs,
+                       Gflop< float >::pbsv( n, nrhs, kd ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -48,6 +51,9 @@ int64_t pbsv(
     double* AB, int64_t ldab,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "pbsv", 'd', 0, n, nrhs,
+                       Gflop< double >::pbsv( n, nrhs, kd ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -74,6 +80,9 @@ int64_t pbsv(
     std::complex<float>* AB, int64_t ldab,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "pbsv", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::pbsv( n, nrhs, kd ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -188,6 +197,9 @@ int64_t pbsv(
     std::complex<double>* AB, int64_t ldab,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "pbsv", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::pbsv( n, nrhs, kd ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -30,6 +30,9 @@ int64_t pbsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "pbsvx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -80,6 +83,9 @@ int64_t pbsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "pbsvx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -130,6 +136,9 @@ int64_t pbsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "pbsvx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -378,6 +387,9 @@ int64_t pbsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "pbsvx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
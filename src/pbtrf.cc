@@ -21,6 +21,8 @@ int64_t pbtrf(
     lapack::Uplo uplo, int64_t n, int64_t kd,
     float* AB, int64_t ldab )
 {
+    lapack_instrument( "pbtrf", 's', 0, n, 0, Gflop< float >::pbtrf( n, kd ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -43,6 +45,8 @@ int64_t pbtrf(
     lapack::Uplo uplo, int64_t n, int64_t kd,
     double* AB, int64_t ldab )
 {
+    lapack_instrument( "pbtrf", 'd', 0, n, 0, Gflop< double >::pbtrf( n, kd ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -65,6 +69,9 @@ int64_t pbtrf(
     lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float>* AB, int64_t ldab )
 {
+    lapack_instrument( "pbtrf", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::pbtrf( n, kd ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -153,6 +160,9 @@ int64_t pbtrf(
     lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double>* AB, int64_t ldab )
 {
+    lapack_instrument( "pbtrf", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::pbtrf( n, kd ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
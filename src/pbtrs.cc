@@ -22,6 +22,9 @@ int64_t pbtrs(
     float const* AB, int64_t ldab,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "pbtrs", 's', 0, n, nrhs,
+                       Gflop< float >::pbtrs( n, nrhs, kd ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -48,6 +51,9 @@ int64_t pbtrs(
     double const* AB, int64_t ldab,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "pbtrs", 'd', 0, n, nrhs,
+                       Gflop< double >::pbtrs( n, nrhs, kd ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -74,6 +80,9 @@ int64_t pbtrs(
     std::complex<float> const* AB, int64_t ldab,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "pbtrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::pbtrs( n, nrhs, kd ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -145,6 +154,9 @@ int64_t pbtrs(
     std::complex<double> const* AB, int64_t ldab,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "pbtrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::pbtrs( n, nrhs, kd ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -20,6 +20,8 @@ int64_t pftrf(
     lapack::Op transr, lapack::Uplo uplo, int64_t n,
     float* A )
 {
+    lapack_instrument( "pftrf", 's', 0, n, 0, Gflop< float >::potrf( n ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -40,6 +42,8 @@ int64_t pftrf(
     lapack::Op transr, lapack::Uplo uplo, int64_t n,
     double* A )
 {
+    lapack_instrument( "pftrf", 'd', 0, n, 0, Gflop< double >::potrf( n ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -60,6 +64,9 @@ int64_t pftrf(
     lapack::Op transr, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A )
 {
+    lapack_instrument( "pftrf", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::potrf( n ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -80,6 +87,9 @@ int64_t pftrf(
     lapack::Op transr, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A )
 {
+    lapack_instrument( "pftrf", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::potrf( n ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
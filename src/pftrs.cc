@@ -21,6 +21,9 @@ int64_t pftrs(
     float const* A,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "pftrs", 's', 0, n, nrhs,
+                       Gflop< float >::potrs( n, nrhs ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -45,6 +48,9 @@ int64_t pftrs(
     double const* A,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "pftrs", 'd', 0, n, nrhs,
+                       Gflop< double >::potrs( n, nrhs ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -69,6 +75,9 @@ int64_t pftrs(
     std::complex<float> const* A,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "pftrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::potrs( n, nrhs ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -93,6 +102,9 @@ int64_t pftrs(
     std::complex<double> const* A,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "pftrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::potrs( n, nrhs ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
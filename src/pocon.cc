@@ -23,6 +23,8 @@ int64_t pocon(
     float const* A, int64_t lda, float anorm,
     float* rcond )
 {
+    lapack_instrument( "pocon", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -51,6 +53,8 @@ int64_t pocon(
     double const* A, int64_t lda, double anorm,
     double* rcond )
 {
+    lapack_instrument( "pocon", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -79,6 +83,8 @@ int64_t pocon(
     std::complex<float> const* A, int64_t lda, float anorm,
     float* rcond )
 {
+    lapack_instrument( "pocon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -142,6 +148,8 @@ int64_t pocon(
     std::complex<double> const* A, int64_t lda, double anorm,
     double* rcond )
 {
+    lapack_instrument( "pocon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
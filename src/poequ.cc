@@ -24,6 +24,8 @@ int64_t poequ(
     float* scond,
     float* amax )
 {
+    lapack_instrument( "poequ", 's', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
@@ -47,6 +49,8 @@ int64_t poequ(
     double* scond,
     double* amax )
 {
+    lapack_instrument( "poequ", 'd', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
@@ -70,6 +74,8 @@ int64_t poequ(
     float* scond,
     float* amax )
 {
+    lapack_instrument( "poequ", 'c', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
@@ -134,6 +140,8 @@ int64_t poequ(
     double* scond,
     double* amax )
 {
+    lapack_instrument( "poequ", 'z', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
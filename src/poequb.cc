@@ -24,6 +24,8 @@ int64_t poequb(
     float* scond,
     float* amax )
 {
+    lapack_instrument( "poequb", 's', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
@@ -47,6 +49,8 @@ int64_t poequb(
     double* scond,
     double* amax )
 {
+    lapack_instrument( "poequb", 'd', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
@@ -70,6 +74,8 @@ int64_t poequb(
     float* scond,
     float* amax )
 {
+    lapack_instrument( "poequb", 'c', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
@@ -140,6 +146,8 @@ int64_t poequb(
     double* scond,
     double* amax )
 {
+    lapack_instrument( "poequb", 'z', 0, n, 0, internal::gflop_none );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
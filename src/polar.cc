@@ -0,0 +1,234 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+using blas::real;
+
+// Maximum QDWH iterations. In exact arithmetic, 6 suffice for
+// condition numbers up to 1e16.
+static const int64_t qdwh_maxiter = 20;
+
+// Use the QR-based iteration while the weight c exceeds this, then the
+// cheaper Cholesky-based iteration, which is stable once c <= 100.
+static const double qdwh_chol_switch = 100;
+
+//------------------------------------------------------------------------------
+/// Computes the polar decomposition of an m-by-n matrix A, m >= n,
+/// $A = U_p H,$
+/// where $U_p$ is m-by-n with orthonormal columns, and H is n-by-n
+/// Hermitian positive semi-definite.
+///
+/// Uses the QR-based dynamically weighted Halley (QDWH) iteration
+/// [Nakatsukasa, Bai, Gygi, 2010]. Early iterations, while X is ill
+/// conditioned, are done with geqrf and ungqr of a stacked
+/// (m + n)-by-n matrix; once the weight c <= 100, the iteration switches
+/// to a Cholesky-based update with herk, potrf, and trsm. All work is in
+/// BLAS-3 operations, and at most 6 iterations are needed in exact
+/// arithmetic for condition numbers up to 1e16.
+///
+/// This is the building block of `lapack::heev_qdwh` and
+/// `lapack::gesvd_qdwh`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= n.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On exit, the orthonormal polar factor $U_p$.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] H
+///     The n-by-n Hermitian positive semi-definite factor H,
+///     stored in an ldh-by-n array. Both triangles are set.
+///     If H is null, it is not computed.
+///
+/// @param[in] ldh
+///     The leading dimension of the array H.
+///     If H is not null, ldh >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return = 1: the iteration did not converge.
+///
+/// @ingroup gesvd
+template <typename scalar_t>
+int64_t polar(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* H, int64_t ldh )
+{
+    // The number of iterations, hence the Gflop count, depends on the data;
+    // the count is set at the end.
+    lapack_instrument( "polar", internal::precision_char< scalar_t >(),
+                       m, n, 0, internal::gflop_data_dependent );
+
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    using Gf = Gflop< scalar_t >;
+    const scalar_t one = 1, zero = 0;
+
+    // check arguments
+    lapack_error_if( n < 0 );
+    lapack_error_if( m < n );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( H != nullptr && ldh < max( 1, n ) );
+
+    // quick return
+    if (n == 0)
+        return 0;
+
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    real_t alpha = lapack::lange( Norm::Fro, m, n, A, lda );
+    if (alpha == 0) {
+        // A = 0: take U_p = [ I; 0 ] and H = 0.
+        lapack::laset( MatrixType::General, m, n, zero, one, A, lda );
+        if (H != nullptr)
+            lapack::laset( MatrixType::General, n, n, zero, zero, H, ldh );
+        return 0;
+    }
+
+    // X = A / alpha, with alpha = ||A||_F >= ||A||_2.
+    int64_t mb = m + n;
+    std::vector< scalar_t > X( m*n ), Xold( m*n ), B( mb*n ), G( n*n ), tau( n );
+    lapack::lacpy( MatrixType::General, m, n, A, lda, X.data(), m );
+    lapack::lascl( MatrixType::General, 0, 0, alpha, real_t( 1 ), m, n,
+                   X.data(), m );
+
+    // l <= sigma_min( X ), estimated as 1 / (sqrt( n ) || R^{-1} ||_1),
+    // where X = QR.
+    lapack::lacpy( MatrixType::General, m, n, X.data(), m, B.data(), m );
+    lapack::geqrf( m, n, B.data(), m, tau.data() );
+    real_t rcond;
+    lapack::trcon( Norm::One, Uplo::Upper, Diag::NonUnit, n, B.data(), m, &rcond );
+    real_t Rnorm = lapack::lantr( Norm::One, Uplo::Upper, Diag::NonUnit, n, n,
+                                  B.data(), m );
+    real_t l = min( real_t( 1 ), max( eps, rcond * Rnorm / std::sqrt( real_t( n ) ) ) );
+
+    // Excludes the condition estimate, whose count depends on the data.
+    double gflop = Gf::lange( Norm::Fro, m, n ) + Gf::geqrf( m, n );
+
+    bool converged = false;
+    for (int64_t iter = 0; iter < qdwh_maxiter && ! converged; ++iter) {
+        // Dynamic weights a, b, c, and the lower bound l for the next X.
+        real_t l2 = l*l;
+        real_t d = std::cbrt( 4*(1 - l2) / (l2*l2) );
+        real_t sqd = std::sqrt( 1 + d );
+        real_t a = sqd + std::sqrt( 8 - 4*d + 8*(2 - l2) / (l2*sqd) ) / 2;
+        real_t b = (a - 1)*(a - 1) / 4;
+        real_t c = a + b - 1;
+        l = min( real_t( 1 ), l*(a + b*l2) / (1 + c*l2) );
+
+        Xold = X;
+        bool done = false;
+        if (c <= qdwh_chol_switch) {
+            // Z = I + c X^H X = W^H W,
+            // X = (b/c) X + (a - b/c) X W^{-1} W^{-H}.
+            lapack::laset( MatrixType::General, n, n, zero, one, G.data(), n );
+            blas::herk( Layout::ColMajor, Uplo::Upper, Op::ConjTrans, n, m,
+                        c, X.data(), m, 1.0, G.data(), n );
+            gflop += Gf::herk( n, m ) + Gf::potrf( n );
+            if (lapack::potrf( Uplo::Upper, n, G.data(), n ) == 0) {
+                lapack::lacpy( MatrixType::General, m, n, X.data(), m,
+                               B.data(), m );
+                blas::trsm( Layout::ColMajor, Side::Right, Uplo::Upper,
+                            Op::NoTrans, Diag::NonUnit, m, n,
+                            one, G.data(), n, B.data(), m );
+                blas::trsm( Layout::ColMajor, Side::Right, Uplo::Upper,
+                            Op::ConjTrans, Diag::NonUnit, m, n,
+                            one, G.data(), n, B.data(), m );
+                blas::scal( m*n, scalar_t( b/c ), X.data(), 1 );
+                blas::axpy( m*n, scalar_t( a - b/c ), B.data(), 1, X.data(), 1 );
+                gflop += 2*Gf::trsm( Side::Right, m, n );
+                done = true;
+            }
+        }
+        if (! done) {
+            // [ sqrt( c ) X; I ] = [ Q1; Q2 ] R,
+            // X = (b/c) X + (a - b/c) / sqrt( c ) Q1 Q2^H.
+            real_t sqc = std::sqrt( c );
+            lapack::lacpy( MatrixType::General, m, n, X.data(), m, B.data(), mb );
+            lapack::lascl( MatrixType::General, 0, 0, real_t( 1 ), sqc, m, n,
+                           B.data(), mb );
+            lapack::laset( MatrixType::General, n, n, zero, one, &B[ m ], mb );
+            lapack::geqrf( mb, n, B.data(), mb, tau.data() );
+            lapack::ungqr( mb, n, n, B.data(), mb, tau.data() );
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::ConjTrans, m, n, n,
+                        scalar_t( (a - b/c) / sqc ), B.data(), mb, &B[ m ], mb,
+                        scalar_t( b/c ), X.data(), m );
+            gflop += Gf::geqrf( mb, n ) + Gf::ungqr( mb, n, n )
+                   + Gf::gemm( m, n, n );
+        }
+
+        // Converged when l = 1 and || X - Xold ||_F <= (5 eps)^{1/3};
+        // the iteration is cubically convergent.
+        blas::axpy( m*n, -one, X.data(), 1, Xold.data(), 1 );
+        real_t dx = lapack::lange( Norm::Fro, m, n, Xold.data(), m );
+        converged = (1 - l <= 5*eps) && (dx <= std::cbrt( 5*eps ));
+        gflop += Gf::lange( Norm::Fro, m, n );
+    }
+
+    if (H != nullptr) {
+        // H = U_p^H A, symmetrized.
+        blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans, n, n, m,
+                    one, X.data(), m, A, lda, zero, H, ldh );
+        gflop += Gf::gemm( n, n, m );
+        for (int64_t j = 0; j < n; ++j) {
+            H[ j + j*ldh ] = real( H[ j + j*ldh ] );
+            for (int64_t i = 0; i < j; ++i) {
+                scalar_t hij = (H[ i + j*ldh ] + conj( H[ j + i*ldh ] )) / real_t( 2 );
+                H[ i + j*ldh ] = hij;
+                H[ j + i*ldh ] = conj( hij );
+            }
+        }
+    }
+    lapack::lacpy( MatrixType::General, m, n, X.data(), m, A, lda );
+    lapack_instrument_gflop( gflop );
+
+    return converged ? 0 : 1;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t polar< float >(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* H, int64_t ldh );
+
+template
+int64_t polar< double >(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* H, int64_t ldh );
+
+template
+int64_t polar< std::complex<float> >(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* H, int64_t ldh );
+
+template
+int64_t polar< std::complex<double> >(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* H, int64_t ldh );
+
+}  // namespace lapack
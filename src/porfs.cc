@@ -27,6 +27,9 @@ int64_t porfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "porfs", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -68,6 +71,9 @@ int64_t porfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "porfs", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -109,6 +115,9 @@ int64_t porfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "porfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -227,6 +236,9 @@ int64_t porfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "porfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -33,6 +33,9 @@ int64_t porfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    lapack_instrument( "porfsx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -84,6 +87,9 @@ int64_t porfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    lapack_instrument( "porfsx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -135,6 +141,9 @@ int64_t porfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    lapack_instrument( "porfsx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -446,6 +455,9 @@ int64_t porfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    lapack_instrument( "porfsx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -23,6 +23,9 @@ int64_t posv(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "posv", 's', 0, n, nrhs,
+                       Gflop< float >::posv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -48,6 +51,9 @@ int64_t posv(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "posv", 'd', 0, n, nrhs,
+                       Gflop< double >::posv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -73,6 +79,9 @@ int64_t posv(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "posv", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::posv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -157,6 +166,9 @@ int64_t posv(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "posv", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::posv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -183,6 +195,9 @@ int64_t posv(
     double* X, int64_t ldx,
     int64_t* iter )
 {
+    lapack_instrument( "posv", 'd', 0, n, nrhs,
+                       Gflop< double >::posv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -219,6 +234,9 @@ int64_t posv(
     std::complex<double>* X, int64_t ldx,
     int64_t* iter )
 {
+    lapack_instrument( "posv", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::posv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
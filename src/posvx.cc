@@ -30,6 +30,9 @@ int64_t posvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "posvx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -79,6 +82,9 @@ int64_t posvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "posvx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -128,6 +134,9 @@ int64_t posvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "posvx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -346,6 +355,9 @@ int64_t posvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "posvx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -21,6 +21,8 @@ int64_t potf2(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda )
 {
+    lapack_instrument( "potf2", 's', 0, n, 0, Gflop< float >::potrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -42,6 +44,8 @@ int64_t potf2(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda )
 {
+    lapack_instrument( "potf2", 'd', 0, n, 0, Gflop< double >::potrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -63,6 +67,9 @@ int64_t potf2(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
+    lapack_instrument( "potf2", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::potrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -129,6 +136,9 @@ int64_t potf2(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
+    lapack_instrument( "potf2", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::potrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -23,6 +23,8 @@ int64_t potrf2(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda )
 {
+    lapack_instrument( "potrf2", 's', 0, n, 0, Gflop< float >::potrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -44,6 +46,8 @@ int64_t potrf2(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda )
 {
+    lapack_instrument( "potrf2", 'd', 0, n, 0, Gflop< double >::potrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -65,6 +69,9 @@ int64_t potrf2(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
+    lapack_instrument( "potrf2", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::potrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -143,6 +150,9 @@ int64_t potrf2(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
+    lapack_instrument( "potrf2", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::potrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
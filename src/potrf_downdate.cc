@@ -0,0 +1,197 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "chol_update_internal.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::conj;
+
+//------------------------------------------------------------------------------
+// Downdates by one column of V at a time. For each column v, solves
+// U^H a = v (or L conj(a) = v), then applies rotations to the factor.
+template <typename scalar_t>
+static int64_t potrf_downdate_work(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* V, int64_t ldv,
+    bool parallel )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldv < max( 1, n ) );
+
+    if (n == 0)
+        return 0;
+
+    std::vector< scalar_t > a( n );
+    std::vector< real_t > c( n );
+    auto upper = [lda]( int64_t i, int64_t j ) { return i + j*lda; };
+    auto lower = [lda]( int64_t i, int64_t j ) { return j + i*lda; };
+
+    for (int64_t j = 0; j < k; ++j) {
+        blas::copy( n, &V[ j*ldv ], 1, a.data(), 1 );
+        bool okay;
+        if (uplo == Uplo::Upper) {
+            blas::trsv( Layout::ColMajor, Uplo::Upper, Op::ConjTrans,
+                        Diag::NonUnit, n, A, lda, a.data(), 1 );
+            okay = internal::chol_downdate1(
+                n, A, upper, a.data(), c.data(), parallel );
+        }
+        else {
+            blas::trsv( Layout::ColMajor, Uplo::Lower, Op::NoTrans,
+                        Diag::NonUnit, n, A, lda, a.data(), 1 );
+            for (auto& ai : a)
+                ai = conj( ai );
+            okay = internal::chol_downdate1(
+                n, A, lower, a.data(), c.data(), parallel );
+        }
+        if (! okay)
+            return j + 1;
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Downdates the Cholesky factorization of a Hermitian positive definite
+/// matrix A, as computed by `lapack::potrf`, to the factorization of
+/// \[
+///     \tilde{A} = A - V V^H,
+/// \]
+/// where V is n-by-k, in $O(k n^2)$ operations instead of $O(n^3)$ to
+/// refactor $\tilde{A}$. For a rank-1 downdate, k = 1 and V is a vector.
+///
+/// Columns of V are removed one at a time with the LINPACK algorithm
+/// (xCHDD) of Saunders: solve $U^H a = v$; if $||a|| < 1$, Givens
+/// rotations reducing $[ a; \sqrt{1 - ||a||^2} ]$ to $e_{n+1}$ are
+/// applied to $[ U; 0 ]$. If $||a|| \ge 1$, then $U^H U - v v^H$ is not
+/// positive definite, which is reported without modifying the factor.
+/// For a multithreaded version, see `lapack::potrf_downdate_mt`;
+/// for packed storage, see `lapack::pptrf_downdate`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: A = U^H U, with U stored in the upper triangle;
+///     - lapack::Uplo::Lower: A = L L^H, with L stored in the lower triangle.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of V. k >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the Cholesky factor U or L of A, from potrf.
+///     On successful exit, the Cholesky factor of $A - V V^H$.
+///     The other triangle is not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] V
+///     The n-by-k matrix V, stored in an ldv-by-k array.
+///
+/// @param[in] ldv
+///     The leading dimension of the array V. ldv >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = j, removing column j of V would make
+///     the matrix not positive definite (to working precision).
+///     On exit, A is the factor of $A - V(:, 1:j-1) V(:, 1:j-1)^H$.
+///
+/// @ingroup posv_computational
+template <typename scalar_t>
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* V, int64_t ldv )
+{
+    lapack_instrument( "potrf_downdate", internal::precision_char< scalar_t >(),
+                       0, n, k, Gflop< scalar_t >::potrf_downdate( n, k ) );
+
+    return potrf_downdate_work( uplo, n, k, A, lda, V, ldv, false );
+}
+
+//------------------------------------------------------------------------------
+/// Multithreaded version of `lapack::potrf_downdate`, for large n.
+/// The rotations for each column of V are applied to columns of the factor
+/// by OpenMP threads.
+///
+/// @ingroup posv_computational
+template <typename scalar_t>
+int64_t potrf_downdate_mt(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* V, int64_t ldv )
+{
+    lapack_instrument( "potrf_downdate_mt",
+                       internal::precision_char< scalar_t >(), 0, n, k,
+                       Gflop< scalar_t >::potrf_downdate( n, k ) );
+
+    return potrf_downdate_work( uplo, n, k, A, lda, V, ldv, true );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t potrf_downdate< float >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* V, int64_t ldv );
+
+template
+int64_t potrf_downdate< double >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* V, int64_t ldv );
+
+template
+int64_t potrf_downdate< std::complex<float> >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* V, int64_t ldv );
+
+template
+int64_t potrf_downdate< std::complex<double> >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* V, int64_t ldv );
+
+template
+int64_t potrf_downdate_mt< float >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* V, int64_t ldv );
+
+template
+int64_t potrf_downdate_mt< double >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* V, int64_t ldv );
+
+template
+int64_t potrf_downdate_mt< std::complex<float> >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* V, int64_t ldv );
+
+template
+int64_t potrf_downdate_mt< std::complex<double> >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* V, int64_t ldv );
+
+}  // namespace lapack
@@ -0,0 +1,263 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "ooc_internal.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//------------------------------------------------------------------------------
+/// Computes the Cholesky factorization of a Hermitian positive definite
+/// matrix A stored out of core, in a file or memory-mapped region, that
+/// may be larger than main memory:
+/// \[
+///     A = L L^H, \text{ if uplo = Lower, or}
+///     A = U^H U, \text{ if uplo = Upper.}
+/// \]
+/// This uses a left-looking algorithm on column panels. Each panel is read
+/// once, updated by streaming in the previously factored panels, factored
+/// in memory with `lapack::potrf` and `blas::trsm`, and written back.
+///
+/// Memory use is bounded by window, which holds 5 column panels of n rows:
+/// three for the current panel, the next one being read, and the previous
+/// one being written (and used directly for the next update), and two to
+/// double-buffer the streamed panels. All reads and writes run
+/// asynchronously on a background I/O thread, overlapped with computation.
+/// The I/O volume is about $n^3 / (3 nb)$ elements for panel width nb,
+/// so a larger window reduces I/O.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The n-by-n matrix A, out of core. On exit, if return value = 0,
+///     the factor U or L from the Cholesky factorization $A = U^H U$
+///     or $A = L L^H$. The other triangle is not referenced.
+///
+/// @param[in] window
+///     Bytes of memory to use for panels. The panel width is
+///     window / (5 n sizeof(scalar_t)), at least 1.
+///
+/// @param[out] stats
+///     If not null, on exit, bytes read and written, I/O time,
+///     and the time computation waited on I/O.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i is not
+///     positive definite, and the factorization could not be completed.
+///
+/// @ingroup posv_computational
+template <typename scalar_t>
+int64_t potrf_ooc(
+    lapack::Uplo uplo, int64_t n,
+    OOCMatrix< scalar_t > const& A,
+    size_t window, OOCStats* stats )
+{
+    lapack_instrument( "potrf_ooc", internal::precision_char< scalar_t >(),
+                       0, n, 0, Gflop< scalar_t >::potrf( n ) );
+
+    using internal::OOCWorker;
+    using blas::Layout;
+    using blas::Side;
+    using blas::Op;
+    using blas::Diag;
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower &&
+                     uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( A.m() < n || A.n() < n );
+
+    if (n == 0) {
+        if (stats != nullptr)
+            *stats = OOCStats();
+        return 0;
+    }
+    double time = internal::ooc_wtime();
+
+    const scalar_t one = 1;
+    const int64_t nb = min( n, max( 1, int64_t(
+                                window / (5 * n * sizeof(scalar_t)) ) ) );
+    const int64_t nt = (n + nb - 1) / nb;
+    const int64_t ld = n;
+    const bool lower = (uplo == Uplo::Lower);
+
+    std::vector< scalar_t > panel[ 3 ], stream[ 2 ];
+    for (auto& buf : panel)
+        buf.resize( ld * nb );
+    for (auto& buf : stream)
+        buf.resize( ld * nb );
+    std::future<void> panel_done[ 3 ], stream_done[ 2 ];
+
+    // Declared after the buffers, so it drains before they are freed.
+    OOCWorker io;
+
+    // Rows of panel k kept in memory and on disk: for Lower, the diagonal
+    // block and below, k*nb : n; for Upper, above and the diagonal block,
+    // 0 : k*nb + kb. For streamed panel j used by panel k, for Lower,
+    // k*nb : n; for Upper, all of panel j's rows.
+    auto read_panel = [&]( int64_t k, scalar_t* buf, int64_t row ) {
+        int64_t k0 = k*nb;
+        int64_t kb = min( nb, n - k0 );
+        int64_t i0 = lower ? row : 0;
+        int64_t mb = lower ? n - row : k0 + kb;
+        return io.submit(
+            [&A, buf, ld, i0, k0, mb, kb] {
+                A.read( i0, k0, mb, kb, buf, ld );
+            },
+            sizeof(scalar_t) * mb * kb, 0 );
+    };
+
+    int64_t info = 0;
+    panel_done[ 0 ] = read_panel( 0, panel[ 0 ].data(), 0 );
+    for (int64_t k = 0; k < nt; ++k) {
+        int64_t k0 = k*nb;
+        int64_t kb = min( nb, n - k0 );
+        scalar_t* Ak = panel[ k % 3 ].data();
+        io.wait( panel_done[ k % 3 ] );
+
+        // Prefetch panel k+1 once the stream reads for panel k are queued.
+        // Its buffer last held panel k-2, whose write is queued before.
+        bool prefetched = false;
+        auto prefetch = [&] {
+            if (! prefetched && k + 1 < nt) {
+                panel_done[ (k+1) % 3 ] = read_panel(
+                    k + 1, panel[ (k+1) % 3 ].data(), (k+1)*nb );
+            }
+            prefetched = true;
+        };
+
+        // Update panel k with panels 0, ..., k-1. Panels 0, ..., k-2 are
+        // streamed from storage; panel k-1 is still in memory.
+        if (k >= 2)
+            stream_done[ 0 ] = read_panel( 0, stream[ 0 ].data(), k0 );
+        else
+            prefetch();
+        for (int64_t j = 0; j < k; ++j) {
+            int64_t j0 = j*nb;
+            scalar_t const* Aj;
+            if (j < k - 1) {
+                io.wait( stream_done[ j % 2 ] );
+                if (j + 1 < k - 1) {
+                    stream_done[ (j+1) % 2 ] = read_panel(
+                        j + 1, stream[ (j+1) % 2 ].data(), k0 );
+                }
+                else {
+                    prefetch();
+                }
+                Aj = stream[ j % 2 ].data();
+            }
+            else {
+                // Panel k-1 in memory starts at row (k-1)*nb.
+                Aj = panel[ (k-1) % 3 ].data();
+                if (lower)
+                    Aj += nb;
+            }
+
+            if (lower) {
+                // A(k0:n, k) -= A(k0:n, j) A(k0:k0+kb, j)^H
+                blas::herk( Layout::ColMajor, Uplo::Lower, Op::NoTrans,
+                            kb, nb, real_t( -1 ), Aj, ld, real_t( 1 ), Ak, ld );
+                if (n - k0 > kb) {
+                    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::ConjTrans,
+                                n - k0 - kb, kb, nb,
+                                -one, &Aj[ kb ], ld,
+                                      Aj, ld,
+                                 one, &Ak[ kb ], ld );
+                }
+            }
+            else {
+                // A(j0:j0+nb, k) = U(j, j)^{-H}
+                //     ( A(j0:j0+nb, k) - A(0:j0, j)^H A(0:j0, k) )
+                if (j0 > 0) {
+                    blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                                nb, kb, j0,
+                                -one, Aj, ld,
+                                      Ak, ld,
+                                 one, &Ak[ j0 ], ld );
+                }
+                blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper,
+                            Op::ConjTrans, Diag::NonUnit, nb, kb,
+                            one, &Aj[ j0 ], ld, &Ak[ j0 ], ld );
+            }
+        }
+
+        // Factor the diagonal block, and solve for the rest of the panel.
+        if (lower) {
+            int64_t iinfo = lapack::potrf( Uplo::Lower, kb, Ak, ld );
+            if (iinfo > 0) {
+                info = k0 + iinfo;
+                break;
+            }
+            if (n - k0 > kb) {
+                blas::trsm( Layout::ColMajor, Side::Right, Uplo::Lower,
+                            Op::ConjTrans, Diag::NonUnit, n - k0 - kb, kb,
+                            one, Ak, ld, &Ak[ kb ], ld );
+            }
+        }
+        else {
+            if (k0 > 0) {
+                blas::herk( Layout::ColMajor, Uplo::Upper, Op::ConjTrans,
+                            kb, k0, real_t( -1 ), Ak, ld,
+                            real_t( 1 ), &Ak[ k0 ], ld );
+            }
+            int64_t iinfo = lapack::potrf( Uplo::Upper, kb, &Ak[ k0 ], ld );
+            if (iinfo > 0) {
+                info = k0 + iinfo;
+                break;
+            }
+        }
+
+        int64_t i0 = lower ? k0 : 0;
+        int64_t mb = lower ? n - k0 : k0 + kb;
+        panel_done[ k % 3 ] = io.submit(
+            [&A, Ak, ld, i0, k0, mb, kb] {
+                A.write( i0, k0, mb, kb, Ak, ld );
+            },
+            0, sizeof(scalar_t) * mb * kb );
+    }
+
+    io.finish( internal::ooc_wtime() - time, stats );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t potrf_ooc< float >(
+    lapack::Uplo uplo, int64_t n,
+    OOCMatrix< float > const& A,
+    size_t window, OOCStats* stats );
+
+template
+int64_t potrf_ooc< double >(
+    lapack::Uplo uplo, int64_t n,
+    OOCMatrix< double > const& A,
+    size_t window, OOCStats* stats );
+
+template
+int64_t potrf_ooc< std::complex<float> >(
+    lapack::Uplo uplo, int64_t n,
+    OOCMatrix< std::complex<float> > const& A,
+    size_t window, OOCStats* stats );
+
+template
+int64_t potrf_ooc< std::complex<double> >(
+    lapack::Uplo uplo, int64_t n,
+    OOCMatrix< std::complex<double> > const& A,
+    size_t window, OOCStats* stats );
+
+}  // namespace lapack
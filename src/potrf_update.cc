@@ -0,0 +1,253 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#if LAPACK_VERSION >= 30400  // >= 3.4, for tpqrt
+
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+
+// Block size of panels.
+static const int64_t potrf_update_nb = 64;
+
+// Minimum columns per thread in the trailing update of potrf_update_mt.
+static const int64_t potrf_update_min_cols = 32;
+
+//------------------------------------------------------------------------------
+// Computes the QR factorization of [ U; V^H ], with U the upper triangular
+// factor (A = U^H U), one panel of nb rows of U at a time: tpqrt factors
+// the panel's diagonal block with the panel's columns of V^H, and tpmqrt
+// applies it to the rest of the panel and of V^H. If parallel, the
+// trailing columns are split among threads.
+// For lower, each panel of L is copied conjugate-transposed to a panel of U.
+template <typename scalar_t>
+static void potrf_update_work(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* V, int64_t ldv,
+    bool parallel )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldv < max( 1, n ) );
+
+    if (n == 0 || k == 0)
+        return;
+
+    const int64_t nb = min( n, potrf_update_nb );
+    bool lower = (uplo == Uplo::Lower);
+
+    // W = V^H, k-by-n.
+    std::vector< scalar_t > W( k * n ), T( nb * nb ), panel;
+    for (int64_t j = 0; j < n; ++j)
+        for (int64_t i = 0; i < k; ++i)
+            W[ i + j*k ] = conj( V[ j + i*ldv ] );
+    if (lower)
+        panel.resize( nb * n );
+
+    int64_t nthreads = 1;
+    #ifdef _OPENMP
+        if (parallel)
+            nthreads = omp_get_max_threads();
+    #endif
+
+    for (int64_t i0 = 0; i0 < n; i0 += nb) {
+        int64_t ib = min( nb, n - i0 );
+        int64_t nt = n - i0 - ib;
+
+        // P = U( i0 : i0+ib, i0 : n ), ib-by-(n - i0).
+        scalar_t* P;
+        int64_t ldp;
+        if (lower) {
+            P = panel.data();
+            ldp = ib;
+            for (int64_t j = i0; j < n; ++j)
+                for (int64_t i = i0; i < min( j + 1, i0 + ib ); ++i)
+                    P[ (i - i0) + (j - i0)*ldp ] = conj( A[ j + i*lda ] );
+        }
+        else {
+            P = &A[ i0 + i0*lda ];
+            ldp = lda;
+        }
+
+        lapack::tpqrt( k, ib, 0, ib, P, ldp, &W[ i0*k ], k, T.data(), ib );
+
+        if (nt > 0) {
+            int64_t nchunks = max( 1, min( nthreads, nt / potrf_update_min_cols ) );
+            int64_t chunk = (nt + nchunks - 1) / nchunks;
+            #pragma omp parallel for schedule( static ) if (nchunks > 1)
+            for (int64_t c = 0; c < nchunks; ++c) {
+                int64_t j0 = ib + c*chunk;  // column in P
+                int64_t jb = min( chunk, ib + nt - j0 );
+                if (jb > 0) {
+                    lapack::tpmqrt( Side::Left, Op::ConjTrans, k, jb, ib, 0, ib,
+                                    &W[ i0*k ], k, T.data(), ib,
+                                    &P[ j0*ldp ], ldp,
+                                    &W[ (i0 + j0)*k ], k );
+                }
+            }
+        }
+
+        // Scale rows so the diagonal is real and positive, as from potrf.
+        for (int64_t i = 0; i < ib; ++i) {
+            scalar_t d = P[ i + i*ldp ];
+            real_t absd = std::abs( d );
+            if (absd != 0 && d != scalar_t( absd )) {
+                scalar_t phase = conj( d ) / absd;
+                blas::scal( n - i0 - i, phase, &P[ i + i*ldp ], ldp );
+                P[ i + i*ldp ] = absd;
+            }
+        }
+
+        if (lower) {
+            for (int64_t j = i0; j < n; ++j)
+                for (int64_t i = i0; i < min( j + 1, i0 + ib ); ++i)
+                    A[ j + i*lda ] = conj( P[ (i - i0) + (j - i0)*ldp ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Updates the Cholesky factorization of a Hermitian positive definite
+/// matrix A, as computed by `lapack::potrf`, to the factorization of
+/// \[
+///     \tilde{A} = A + V V^H,
+/// \]
+/// where V is n-by-k, in $O(k n^2)$ operations instead of $O(n^3)$ to
+/// refactor $\tilde{A}$. For a rank-1 update, k = 1 and V is a vector.
+///
+/// The upper factor of $\tilde{A}$ is the R factor of the QR factorization
+/// of $[ U; V^H ]$, computed with the blocked triangular-pentagonal
+/// routines `lapack::tpqrt` and `lapack::tpmqrt`. The diagonal of the
+/// updated factor is real and positive, as from potrf.
+/// For a multithreaded version, see `lapack::potrf_update_mt`;
+/// for packed storage, see `lapack::pptrf_update`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: A = U^H U, with U stored in the upper triangle;
+///     - lapack::Uplo::Lower: A = L L^H, with L stored in the lower triangle.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of V. k >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the Cholesky factor U or L of A, from potrf.
+///     On exit, the Cholesky factor of $A + V V^H$.
+///     The other triangle is not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] V
+///     The n-by-k matrix V, stored in an ldv-by-k array.
+///
+/// @param[in] ldv
+///     The leading dimension of the array V. ldv >= max(1,n).
+///
+/// @ingroup posv_computational
+template <typename scalar_t>
+void potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* V, int64_t ldv )
+{
+    lapack_instrument( "potrf_update", internal::precision_char< scalar_t >(),
+                       0, n, k, Gflop< scalar_t >::potrf_update( n, k ) );
+
+    potrf_update_work( uplo, n, k, A, lda, V, ldv, false );
+}
+
+//------------------------------------------------------------------------------
+/// Multithreaded version of `lapack::potrf_update`, for large n.
+/// In each panel, the update of the trailing columns is split among
+/// OpenMP threads.
+///
+/// @ingroup posv_computational
+template <typename scalar_t>
+void potrf_update_mt(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* V, int64_t ldv )
+{
+    lapack_instrument( "potrf_update_mt",
+                       internal::precision_char< scalar_t >(), 0, n, k,
+                       Gflop< scalar_t >::potrf_update( n, k ) );
+
+    potrf_update_work( uplo, n, k, A, lda, V, ldv, true );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potrf_update< float >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* V, int64_t ldv );
+
+template
+void potrf_update< double >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* V, int64_t ldv );
+
+template
+void potrf_update< std::complex<float> >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* V, int64_t ldv );
+
+template
+void potrf_update< std::complex<double> >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* V, int64_t ldv );
+
+template
+void potrf_update_mt< float >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* V, int64_t ldv );
+
+template
+void potrf_update_mt< double >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* V, int64_t ldv );
+
+template
+void potrf_update_mt< std::complex<float> >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* V, int64_t ldv );
+
+template
+void potrf_update_mt< std::complex<double> >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* V, int64_t ldv );
+
+}  // namespace lapack
+
+#endif  // LAPACK >= 3.4
@@ -22,6 +22,9 @@ int64_t potrs(
     float const* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "potrs", 's', 0, n, nrhs,
+                       Gflop< float >::potrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -47,6 +50,9 @@ int64_t potrs(
     double const* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "potrs", 'd', 0, n, nrhs,
+                       Gflop< double >::potrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -72,6 +78,9 @@ int64_t potrs(
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "potrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::potrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -133,6 +142,9 @@ int64_t potrs(
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "potrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::potrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -0,0 +1,234 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "ooc_internal.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//------------------------------------------------------------------------------
+/// Solves a system of linear equations $A X = B$ with a Hermitian
+/// positive definite matrix A using the Cholesky factorization
+/// $A = U^H U$ or $A = L L^H$ computed by `lapack::potrf_ooc`,
+/// with the factor stored out of core. B is in memory.
+///
+/// The factor is streamed through memory twice, in column panels, once for
+/// each triangular solve; the panel at the turn is reused. Reads are
+/// double-buffered on a background I/O thread, overlapped with computation.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in] A
+///     The triangular factor U or L from the Cholesky factorization
+///     $A = U^H U$ or $A = L L^H$, as computed by `lapack::potrf_ooc`,
+///     out of core.
+///
+/// @param[in,out] B
+///     The n-by-nrhs array B, stored in an ldb-by-nrhs array.
+///     On entry, the right hand side matrix B.
+///     On exit, the solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[in] window
+///     Bytes of memory to use for panels, which holds 2 column panels
+///     of n rows. The panel width is window / (2 n sizeof(scalar_t)),
+///     at least 1.
+///
+/// @param[out] stats
+///     If not null, on exit, bytes read, I/O time,
+///     and the time computation waited on I/O.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup posv_computational
+template <typename scalar_t>
+int64_t potrs_ooc(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    OOCMatrix< scalar_t > const& A,
+    scalar_t* B, int64_t ldb,
+    size_t window, OOCStats* stats )
+{
+    lapack_instrument( "potrs_ooc", internal::precision_char< scalar_t >(),
+                       0, n, nrhs, Gflop< scalar_t >::potrs( n, nrhs ) );
+
+    using internal::OOCWorker;
+    using blas::Layout;
+    using blas::Side;
+    using blas::Op;
+    using blas::Diag;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower &&
+                     uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( A.m() < n || A.n() < n );
+    lapack_error_if( ldb < max( 1, n ) );
+
+    if (n == 0 || nrhs == 0) {
+        if (stats != nullptr)
+            *stats = OOCStats();
+        return 0;
+    }
+    double time = internal::ooc_wtime();
+
+    const scalar_t one = 1;
+    const int64_t nb = min( n, max( 1, int64_t(
+                                window / (2 * n * sizeof(scalar_t)) ) ) );
+    const int64_t nt = (n + nb - 1) / nb;
+    const int64_t ld = n;
+    const bool lower = (uplo == Uplo::Lower);
+
+    std::vector< scalar_t > stream[ 2 ];
+    for (auto& buf : stream)
+        buf.resize( ld * nb );
+    std::future<void> stream_done[ 2 ];
+
+    // Declared after the buffers, so it drains before they are freed.
+    OOCWorker io;
+
+    // Reads the triangular part of panel j: for Lower, rows j0 : n;
+    // for Upper, rows 0 : j0 + jb.
+    auto read_panel = [&]( int64_t j ) {
+        int64_t j0 = j*nb;
+        int64_t jb = min( nb, n - j0 );
+        int64_t i0 = lower ? j0 : 0;
+        int64_t mb = lower ? n - j0 : j0 + jb;
+        scalar_t* buf = stream[ j % 2 ].data();
+        stream_done[ j % 2 ] = io.submit(
+            [&A, buf, ld, i0, j0, mb, jb] {
+                A.read( i0, j0, mb, jb, buf, ld );
+            },
+            sizeof(scalar_t) * mb * jb, 0 );
+    };
+
+    // Forward solve, L Y = B or U^H Y = B, panels 0, ..., nt-1.
+    read_panel( 0 );
+    for (int64_t j = 0; j < nt; ++j) {
+        int64_t j0 = j*nb;
+        int64_t jb = min( nb, n - j0 );
+        io.wait( stream_done[ j % 2 ] );
+        if (j + 1 < nt)
+            read_panel( j + 1 );
+        else if (nt > 1)
+            read_panel( nt - 2 );  // first panel of the backward solve
+        scalar_t const* Aj = stream[ j % 2 ].data();
+
+        if (lower) {
+            blas::trsm( Layout::ColMajor, Side::Left, Uplo::Lower,
+                        Op::NoTrans, Diag::NonUnit, jb, nrhs,
+                        one, Aj, ld, &B[ j0 ], ldb );
+            if (n - j0 > jb) {
+                blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                            n - j0 - jb, nrhs, jb,
+                            -one, &Aj[ jb ], ld,
+                                  &B[ j0 ], ldb,
+                             one, &B[ j0 + jb ], ldb );
+            }
+        }
+        else {
+            if (j0 > 0) {
+                blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                            jb, nrhs, j0,
+                            -one, Aj, ld,
+                                  B, ldb,
+                             one, &B[ j0 ], ldb );
+            }
+            blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper,
+                        Op::ConjTrans, Diag::NonUnit, jb, nrhs,
+                        one, &Aj[ j0 ], ld, &B[ j0 ], ldb );
+        }
+    }
+
+    // Backward solve, L^H X = Y or U X = Y, panels nt-1, ..., 0.
+    // Panel nt-1 is still in memory.
+    for (int64_t j = nt - 1; j >= 0; --j) {
+        int64_t j0 = j*nb;
+        int64_t jb = min( nb, n - j0 );
+        if (j < nt - 1) {
+            io.wait( stream_done[ j % 2 ] );
+            if (j > 0)
+                read_panel( j - 1 );
+        }
+        scalar_t const* Aj = stream[ j % 2 ].data();
+
+        if (lower) {
+            if (n - j0 > jb) {
+                blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                            jb, nrhs, n - j0 - jb,
+                            -one, &Aj[ jb ], ld,
+                                  &B[ j0 + jb ], ldb,
+                             one, &B[ j0 ], ldb );
+            }
+            blas::trsm( Layout::ColMajor, Side::Left, Uplo::Lower,
+                        Op::ConjTrans, Diag::NonUnit, jb, nrhs,
+                        one, Aj, ld, &B[ j0 ], ldb );
+        }
+        else {
+            blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper,
+                        Op::NoTrans, Diag::NonUnit, jb, nrhs,
+                        one, &Aj[ j0 ], ld, &B[ j0 ], ldb );
+            if (j0 > 0) {
+                blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                            j0, nrhs, jb,
+                            -one, Aj, ld,
+                                  &B[ j0 ], ldb,
+                             one, B, ldb );
+            }
+        }
+    }
+
+    io.finish( internal::ooc_wtime() - time, stats );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t potrs_ooc< float >(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    OOCMatrix< float > const& A,
+    float* B, int64_t ldb,
+    size_t window, OOCStats* stats );
+
+template
+int64_t potrs_ooc< double >(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    OOCMatrix< double > const& A,
+    double* B, int64_t ldb,
+    size_t window, OOCStats* stats );
+
+template
+int64_t potrs_ooc< std::complex<float> >(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    OOCMatrix< std::complex<float> > const& A,
+    std::complex<float>* B, int64_t ldb,
+    size_t window, OOCStats* stats );
+
+template
+int64_t potrs_ooc< std::complex<double> >(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    OOCMatrix< std::complex<double> > const& A,
+    std::complex<double>* B, int64_t ldb,
+    size_t window, OOCStats* stats );
+
+}  // namespace lapack
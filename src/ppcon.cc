@@ -23,6 +23,8 @@ int64_t ppcon(
     float const* AP, float anorm,
     float* rcond )
 {
+    lapack_instrument( "ppcon", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -50,6 +52,8 @@ int64_t ppcon(
     double const* AP, double anorm,
     double* rcond )
 {
+    lapack_instrument( "ppcon", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -77,6 +81,8 @@ int64_t ppcon(
     std::complex<float> const* AP, float anorm,
     float* rcond )
 {
+    lapack_instrument( "ppcon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -141,6 +147,8 @@ int64_t ppcon(
     std::complex<double> const* AP, double anorm,
     double* rcond )
 {
+    lapack_instrument( "ppcon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -24,6 +24,8 @@ int64_t ppequ(
     float* scond,
     float* amax )
 {
+    lapack_instrument( "ppequ", 's', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -48,6 +50,8 @@ int64_t ppequ(
     double* scond,
     double* amax )
 {
+    lapack_instrument( "ppequ", 'd', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -72,6 +76,8 @@ int64_t ppequ(
     float* scond,
     float* amax )
 {
+    lapack_instrument( "ppequ", 'c', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -140,6 +146,8 @@ int64_t ppequ(
     double* scond,
     double* amax )
 {
+    lapack_instrument( "ppequ", 'z', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
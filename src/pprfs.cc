@@ -27,6 +27,9 @@ int64_t pprfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "pprfs", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -66,6 +69,9 @@ int64_t pprfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "pprfs", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -105,6 +111,9 @@ int64_t pprfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "pprfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -212,6 +221,9 @@ int64_t pprfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "pprfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
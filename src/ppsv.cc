@@ -22,6 +22,9 @@ int64_t ppsv(
     float* AP,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "ppsv", 's', 0, n, nrhs,
+                       Gflop< float >::posv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -46,6 +49,9 @@ int64_t ppsv(
     double* AP,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "ppsv", 'd', 0, n, nrhs,
+                       Gflop< double >::posv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -70,6 +76,9 @@ int64_t ppsv(
     std::complex<float>* AP,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "ppsv", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::posv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -167,6 +176,9 @@ int64_t ppsv(
     std::complex<double>* AP,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "ppsv", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::posv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -30,6 +30,9 @@ int64_t ppsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "ppsvx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -77,6 +80,9 @@ int64_t ppsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "ppsvx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -124,6 +130,9 @@ int64_t ppsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "ppsvx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -348,6 +357,9 @@ int64_t ppsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "ppsvx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -21,6 +21,8 @@ int64_t pptrf(
     lapack::Uplo uplo, int64_t n,
     float* AP )
 {
+    lapack_instrument( "pptrf", 's', 0, n, 0, Gflop< float >::potrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -41,6 +43,8 @@ int64_t pptrf(
     lapack::Uplo uplo, int64_t n,
     double* AP )
 {
+    lapack_instrument( "pptrf", 'd', 0, n, 0, Gflop< double >::potrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -61,6 +65,9 @@ int64_t pptrf(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* AP )
 {
+    lapack_instrument( "pptrf", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::potrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -135,6 +142,9 @@ int64_t pptrf(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* AP )
 {
+    lapack_instrument( "pptrf", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::potrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -0,0 +1,147 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "chol_update_internal.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::conj;
+
+//------------------------------------------------------------------------------
+// Solves R^H a = b by forward substitution, with R upper triangular,
+// element (i, j) at R[ idx( i, j ) ]. b is overwritten by a.
+template <typename scalar_t, typename index_t>
+static void pptrf_downdate_solve(
+    int64_t n, scalar_t const* R, index_t idx, scalar_t* b )
+{
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t sum = b[ j ];
+        for (int64_t i = 0; i < j; ++i)
+            sum -= conj( R[ idx( i, j ) ] ) * b[ i ];
+        b[ j ] = sum / conj( R[ idx( j, j ) ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Downdates the Cholesky factorization of a Hermitian positive definite
+/// matrix A in packed storage, as computed by `lapack::pptrf`,
+/// to the factorization of
+/// \[
+///     \tilde{A} = A - V V^H,
+/// \]
+/// where V is n-by-k, in $O(k n^2)$ operations.
+///
+/// Columns of V are removed one at a time with the LINPACK algorithm
+/// (xCHDD); see `lapack::potrf_downdate` for details and full storage.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: A = U^H U, with U stored in AP;
+///     - lapack::Uplo::Lower: A = L L^H, with L stored in AP.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of V. k >= 0.
+///
+/// @param[in,out] AP
+///     The vector AP of length n*(n+1)/2.
+///     On entry, the Cholesky factor U or L of A, packed columnwise,
+///     from pptrf.
+///     On successful exit, the Cholesky factor of $A - V V^H$,
+///     in the same format.
+///
+/// @param[in] V
+///     The n-by-k matrix V, stored in an ldv-by-k array.
+///
+/// @param[in] ldv
+///     The leading dimension of the array V. ldv >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = j, removing column j of V would make
+///     the matrix not positive definite (to working precision).
+///     On exit, AP is the factor of $A - V(:, 1:j-1) V(:, 1:j-1)^H$.
+///
+/// @ingroup ppsv_computational
+template <typename scalar_t>
+int64_t pptrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* AP,
+    scalar_t const* V, int64_t ldv )
+{
+    lapack_instrument( "pptrf_downdate", internal::precision_char< scalar_t >(),
+                       0, n, k, Gflop< scalar_t >::pptrf_downdate( n, k ) );
+
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( ldv < blas::max( 1, n ) );
+
+    if (n == 0)
+        return 0;
+
+    std::vector< scalar_t > a( n );
+    std::vector< real_t > c( n );
+
+    // Position of element (i, j), i <= j, of R = U, or R = L^T.
+    auto upper = []( int64_t i, int64_t j ) { return i + j*(j + 1)/2; };
+    auto lower = [n]( int64_t i, int64_t j ) { return j + i*(2*n - i - 1)/2; };
+
+    for (int64_t j = 0; j < k; ++j) {
+        // Solve R^H a = conj( x ), with x = v^H for U, or x = v^T for L^T.
+        bool okay;
+        if (uplo == Uplo::Upper) {
+            blas::copy( n, &V[ j*ldv ], 1, a.data(), 1 );
+            pptrf_downdate_solve( n, AP, upper, a.data() );
+            okay = internal::chol_downdate1(
+                n, AP, upper, a.data(), c.data(), false );
+        }
+        else {
+            for (int64_t i = 0; i < n; ++i)
+                a[ i ] = conj( V[ i + j*ldv ] );
+            pptrf_downdate_solve( n, AP, lower, a.data() );
+            okay = internal::chol_downdate1(
+                n, AP, lower, a.data(), c.data(), false );
+        }
+        if (! okay)
+            return j + 1;
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t pptrf_downdate< float >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* AP,
+    float const* V, int64_t ldv );
+
+template
+int64_t pptrf_downdate< double >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* AP,
+    double const* V, int64_t ldv );
+
+template
+int64_t pptrf_downdate< std::complex<float> >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* AP,
+    std::complex<float> const* V, int64_t ldv );
+
+template
+int64_t pptrf_downdate< std::complex<double> >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* AP,
+    std::complex<double> const* V, int64_t ldv );
+
+}  // namespace lapack
@@ -0,0 +1,118 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "chol_update_internal.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::conj;
+
+//------------------------------------------------------------------------------
+/// Updates the Cholesky factorization of a Hermitian positive definite
+/// matrix A in packed storage, as computed by `lapack::pptrf`,
+/// to the factorization of
+/// \[
+///     \tilde{A} = A + V V^H,
+/// \]
+/// where V is n-by-k, in $O(k n^2)$ operations.
+///
+/// Columns of V are added one at a time with Givens rotations,
+/// as in LINPACK xCHUD. The diagonal of the updated factor is real and
+/// positive, as from pptrf.
+/// For full storage, see `lapack::potrf_update`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: A = U^H U, with U stored in AP;
+///     - lapack::Uplo::Lower: A = L L^H, with L stored in AP.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of V. k >= 0.
+///
+/// @param[in,out] AP
+///     The vector AP of length n*(n+1)/2.
+///     On entry, the Cholesky factor U or L of A, packed columnwise,
+///     from pptrf.
+///     On exit, the Cholesky factor of $A + V V^H$, in the same format.
+///
+/// @param[in] V
+///     The n-by-k matrix V, stored in an ldv-by-k array.
+///
+/// @param[in] ldv
+///     The leading dimension of the array V. ldv >= max(1,n).
+///
+/// @ingroup ppsv_computational
+template <typename scalar_t>
+void pptrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* AP,
+    scalar_t const* V, int64_t ldv )
+{
+    lapack_instrument( "pptrf_update", internal::precision_char< scalar_t >(),
+                       0, n, k, Gflop< scalar_t >::pptrf_update( n, k ) );
+
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( ldv < blas::max( 1, n ) );
+
+    std::vector< scalar_t > x( n ), s( n ), phase( n );
+    std::vector< real_t > c( n );
+
+    // Position of element (i, j), i <= j, of R = U, or R = L^T.
+    auto upper = []( int64_t i, int64_t j ) { return i + j*(j + 1)/2; };
+    auto lower = [n]( int64_t i, int64_t j ) { return j + i*(2*n - i - 1)/2; };
+
+    for (int64_t j = 0; j < k; ++j) {
+        // Row x = v^H for U, or x = v^T for L^T.
+        for (int64_t i = 0; i < n; ++i) {
+            x[ i ] = (uplo == Uplo::Upper ? conj( V[ i + j*ldv ] )
+                                          : V[ i + j*ldv ]);
+        }
+        if (uplo == Uplo::Upper)
+            internal::chol_update1( n, AP, upper, x.data(),
+                                    c.data(), s.data(), phase.data() );
+        else
+            internal::chol_update1( n, AP, lower, x.data(),
+                                    c.data(), s.data(), phase.data() );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void pptrf_update< float >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* AP,
+    float const* V, int64_t ldv );
+
+template
+void pptrf_update< double >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* AP,
+    double const* V, int64_t ldv );
+
+template
+void pptrf_update< std::complex<float> >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* AP,
+    std::complex<float> const* V, int64_t ldv );
+
+template
+void pptrf_update< std::complex<double> >(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* AP,
+    std::complex<double> const* V, int64_t ldv );
+
+}  // namespace lapack
@@ -21,6 +21,8 @@ int64_t pptri(
     lapack::Uplo uplo, int64_t n,
     float* AP )
 {
+    lapack_instrument( "pptri", 's', 0, n, 0, Gflop< float >::potri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -41,6 +43,8 @@ int64_t pptri(
     lapack::Uplo uplo, int64_t n,
     double* AP )
 {
+    lapack_instrument( "pptri", 'd', 0, n, 0, Gflop< double >::potri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -61,6 +65,9 @@ int64_t pptri(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* AP )
 {
+    lapack_instrument( "pptri", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::potri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -111,6 +118,9 @@ int64_t pptri(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* AP )
 {
+    lapack_instrument( "pptri", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::potri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
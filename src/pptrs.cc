@@ -22,6 +22,9 @@ int64_t pptrs(
     float const* AP,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "pptrs", 's', 0, n, nrhs,
+                       Gflop< float >::potrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -46,6 +49,9 @@ int64_t pptrs(
     double const* AP,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "pptrs", 'd', 0, n, nrhs,
+                       Gflop< double >::potrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -70,6 +76,9 @@ int64_t pptrs(
     std::complex<float> const* AP,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "pptrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::potrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -131,6 +140,9 @@ int64_t pptrs(
     std::complex<double> const* AP,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "pptrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::potrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
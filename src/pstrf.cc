@@ -23,6 +23,8 @@ int64_t pstrf(
     int64_t* piv,
     int64_t* rank, float tol )
 {
+    lapack_instrument( "pstrf", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -62,6 +64,8 @@ int64_t pstrf(
     int64_t* piv,
     int64_t* rank, double tol )
 {
+    lapack_instrument( "pstrf", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -101,6 +105,8 @@ int64_t pstrf(
     int64_t* piv,
     int64_t* rank, float tol )
 {
+    lapack_instrument( "pstrf", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -140,6 +146,8 @@ int64_t pstrf(
     int64_t* piv,
     int64_t* rank, double tol )
 {
+    lapack_instrument( "pstrf", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -24,6 +24,8 @@ int64_t ptcon(
     float const* E, float anorm,
     float* rcond )
 {
+    lapack_instrument( "ptcon", 's', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
@@ -49,6 +51,8 @@ int64_t ptcon(
     double const* E, double anorm,
     double* rcond )
 {
+    lapack_instrument( "ptcon", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
@@ -74,6 +78,8 @@ int64_t ptcon(
     std::complex<float> const* E, float anorm,
     float* rcond )
 {
+    lapack_instrument( "ptcon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
@@ -143,6 +149,8 @@ int64_t ptcon(
     std::complex<double> const* E, double anorm,
     double* rcond )
 {
+    lapack_instrument( "ptcon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
@@ -23,6 +23,8 @@ int64_t pteqr(
     float* E,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "pteqr", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -51,6 +53,8 @@ int64_t pteqr(
     double* E,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "pteqr", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -79,6 +83,8 @@ int64_t pteqr(
     float* E,
     std::complex<float>* Z, int64_t ldz )
 {
+    lapack_instrument( "pteqr", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -107,6 +113,8 @@ int64_t pteqr(
     double* E,
     std::complex<double>* Z, int64_t ldz )
 {
+    lapack_instrument( "pteqr", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -29,6 +29,9 @@ int64_t ptrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "ptrfs", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
@@ -68,6 +71,9 @@ int64_t ptrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "ptrfs", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
@@ -107,6 +113,9 @@ int64_t ptrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "ptrfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -226,6 +235,9 @@ int64_t ptrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "ptrfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -23,6 +23,9 @@ int64_t ptsv(
     float* E,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "ptsv", 's', 0, n, nrhs,
+                       Gflop< float >::ptsv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
@@ -47,6 +50,9 @@ int64_t ptsv(
     double* E,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "ptsv", 'd', 0, n, nrhs,
+                       Gflop< double >::ptsv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
@@ -71,6 +77,9 @@ int64_t ptsv(
     std::complex<float>* E,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "ptsv", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::ptsv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
@@ -140,6 +149,9 @@ int64_t ptsv(
     std::complex<double>* E,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "ptsv", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::ptsv( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
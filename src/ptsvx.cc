@@ -30,6 +30,9 @@ int64_t ptsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "ptsvx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -72,6 +75,9 @@ int64_t ptsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "ptsvx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -114,6 +120,9 @@ int64_t ptsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "ptsvx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -261,6 +270,9 @@ int64_t ptsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "ptsvx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
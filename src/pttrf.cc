@@ -22,6 +22,8 @@ int64_t pttrf(
     float* D,
     float* E )
 {
+    lapack_instrument( "pttrf", 's', 0, n, 0, Gflop< float >::pttrf( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
@@ -42,6 +44,8 @@ int64_t pttrf(
     double* D,
     double* E )
 {
+    lapack_instrument( "pttrf", 'd', 0, n, 0, Gflop< double >::pttrf( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
@@ -62,6 +66,9 @@ int64_t pttrf(
     float* D,
     std::complex<float>* E )
 {
+    lapack_instrument( "pttrf", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::pttrf( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
@@ -112,6 +119,9 @@ int64_t pttrf(
     double* D,
     std::complex<double>* E )
 {
+    lapack_instrument( "pttrf", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::pttrf( n ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
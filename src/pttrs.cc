@@ -23,6 +23,9 @@ int64_t pttrs(
     float const* E,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "pttrs", 's', 0, n, nrhs,
+                       Gflop< float >::pttrs( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
@@ -47,6 +50,9 @@ int64_t pttrs(
     double const* E,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "pttrs", 'd', 0, n, nrhs,
+                       Gflop< double >::pttrs( n, nrhs ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
@@ -71,6 +77,9 @@ int64_t pttrs(
     std::complex<float> const* E,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "pttrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::pttrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -147,6 +156,9 @@ int64_t pttrs(
     std::complex<double> const* E,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "pttrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::pttrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -0,0 +1,228 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+namespace lapack {
+
+using blas::conj;
+using blas::max;
+
+//------------------------------------------------------------------------------
+// Deletes column j of the n-by-n R, shifting columns j+1, ..., n-1 left,
+// then reduces the subdiagonal R(k+1, k) top down, with rotations in rows
+// (k, k+1), applied to R(:, k+1:n-2). For each rotation, calls
+// rotate( k, c, s ) to apply it also to Q or C.
+template <typename scalar_t, typename Rotate>
+static void qr_delete_col_rotate(
+    int64_t n, int64_t j,
+    scalar_t* R, int64_t ldr, Rotate rotate )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Shift columns j+1, ..., n-1 of R left.
+    for (int64_t k = j; k < n - 1; ++k)
+        blas::copy( k + 2, &R[ (k+1)*ldr ], 1, &R[ k*ldr ], 1 );
+
+    for (int64_t k = j; k < n - 1; ++k) {
+        real_t c;
+        scalar_t s, r;
+        lapack::lartg( R[ k + k*ldr ], R[ (k+1) + k*ldr ], &c, &s, &r );
+        R[ k + k*ldr ] = r;
+        R[ (k+1) + k*ldr ] = 0;
+        blas::rot( n - k - 2, &R[ k     + (k+1)*ldr ], ldr,
+                              &R[ (k+1) + (k+1)*ldr ], ldr, c, s );
+        rotate( k, c, s );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Updates the economy QR factorization $A = Q R$ of an m-by-n matrix A
+/// when column j is deleted, giving the QR factorization of the
+/// m-by-(n-1) matrix
+/// \[
+///     \tilde{A} = [ A(:, 0:j-1), A(:, j+1:n-1) ] = \tilde{Q} \tilde{R}.
+/// \]
+///
+/// Deleting column j of R leaves it upper Hessenberg in columns j, ..., n-2.
+/// The subdiagonal is reduced by Givens rotations (`lapack::lartg`) that
+/// are also applied to Q, and the last column of Q is dropped.
+/// This takes $O(m n)$ operations, instead of $O(m n^2)$ to refactor
+/// $\tilde{A}$. This overload needs Q stored explicitly; for the compact
+/// WY representation from `lapack::geqrt`, use the overload that takes C.
+///
+/// @param[in] m
+///     The number of rows of A. m >= n.
+///
+/// @param[in] n
+///     The number of columns of A. n >= 1.
+///
+/// @param[in] j
+///     Index of the column to delete, 0 <= j < n (0-based).
+///
+/// @param[in,out] Q
+///     The m-by-n matrix Q, stored in an ldq-by-n array, with orthonormal
+///     columns. See qr_insert_col for generating Q from geqrf or geqrt.
+///     On exit, the first n-1 columns are $\tilde{Q}$.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= max(1, m).
+///
+/// @param[in,out] R
+///     The n-by-n upper triangular matrix R, stored in an ldr-by-n array.
+///     On exit, the leading (n-1)-by-(n-1) upper triangle is $\tilde{R}$.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= max(1, n).
+///
+/// @ingroup geqrf
+template <typename scalar_t>
+void qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr )
+{
+    lapack_instrument( "qr_delete_col", internal::precision_char< scalar_t >(),
+                       m, n, 0, Gflop< scalar_t >::qr_delete_col( m, n, j ) );
+
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( n < 1 );
+    lapack_error_if( m < n );
+    lapack_error_if( j < 0 || j >= n );
+    lapack_error_if( ldq < m );
+    lapack_error_if( ldr < n );
+
+    // Delete column j of R and reduce it, applying the rotations to
+    // columns (k, k+1) of Q.
+    qr_delete_col_rotate( n, j, R, ldr,
+        [&]( int64_t k, real_t c, scalar_t s ) {
+            blas::rot( m, &Q[ k*ldq ], 1, &Q[ (k+1)*ldq ], 1, c, conj( s ) );
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Updates the QR factorization $A = Q R$ of an m-by-n matrix A, with Q not
+/// stored, when column j is deleted. This suits the compact WY
+/// representation from `lapack::geqrt`, or a Q already updated by
+/// qr_insert_col or this routine.
+///
+/// As in the overload with explicit Q, column j of R is deleted and the
+/// subdiagonal reduced by Givens rotations G, so $\tilde{Q} = Q G^H$.
+/// Q itself is not needed; G is applied to the m-by-ncol matrix C, which
+/// holds $Q^H B$ for other data B, such as right-hand sides of a least
+/// squares problem, or columns that may be inserted later. On exit, C
+/// holds $\tilde{Q}^H B$. This takes $O(n^2 + n \cdot ncol)$ operations.
+///
+/// @param[in] m
+///     The number of rows of A. m >= n.
+///
+/// @param[in] n
+///     The number of columns of A. n >= 1.
+///
+/// @param[in] j
+///     Index of the column to delete, 0 <= j < n (0-based).
+///
+/// @param[in,out] R
+///     The n-by-n upper triangular matrix R, stored in an ldr-by-n array.
+///     On exit, the leading (n-1)-by-(n-1) upper triangle is $\tilde{R}$.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= max(1, n).
+///
+/// @param[in] ncol
+///     The number of columns of C. ncol >= 0.
+///
+/// @param[in,out] C
+///     The m-by-ncol matrix C, stored in an ldc-by-ncol array.
+///     On entry, $Q^H B$, e.g., from gemqrt. On exit, $\tilde{Q}^H B$.
+///
+/// @param[in] ldc
+///     The leading dimension of the array C. ldc >= max(1, m).
+///
+/// @ingroup geqrf
+template <typename scalar_t>
+void qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    scalar_t* R, int64_t ldr,
+    int64_t ncol, scalar_t* C, int64_t ldc )
+{
+    lapack_instrument( "qr_delete_col_implicit",
+                       internal::precision_char< scalar_t >(), m, n, ncol,
+                       Gflop< scalar_t >::qr_delete_col_implicit(
+                           n, j, ncol ) );
+
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( n < 1 );
+    lapack_error_if( m < n );
+    lapack_error_if( j < 0 || j >= n );
+    lapack_error_if( ldr < n );
+    lapack_error_if( ncol < 0 );
+    lapack_error_if( ldc < max( 1, m ) );
+
+    // Delete column j of R and reduce it, applying the rotations to
+    // rows (k, k+1) of C.
+    qr_delete_col_rotate( n, j, R, ldr,
+        [&]( int64_t k, real_t c, scalar_t s ) {
+            blas::rot( ncol, &C[ k ], ldc, &C[ k+1 ], ldc, c, s );
+        } );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void qr_delete_col< float >(
+    int64_t m, int64_t n, int64_t j,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr );
+
+template
+void qr_delete_col< double >(
+    int64_t m, int64_t n, int64_t j,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr );
+
+template
+void qr_delete_col< std::complex<float> >(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr );
+
+template
+void qr_delete_col< std::complex<double> >(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr );
+
+//--------------------
+template
+void qr_delete_col< float >(
+    int64_t m, int64_t n, int64_t j,
+    float* R, int64_t ldr,
+    int64_t ncol, float* C, int64_t ldc );
+
+template
+void qr_delete_col< double >(
+    int64_t m, int64_t n, int64_t j,
+    double* R, int64_t ldr,
+    int64_t ncol, double* C, int64_t ldc );
+
+template
+void qr_delete_col< std::complex<float> >(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<float>* R, int64_t ldr,
+    int64_t ncol, std::complex<float>* C, int64_t ldc );
+
+template
+void qr_delete_col< std::complex<double> >(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<double>* R, int64_t ldr,
+    int64_t ncol, std::complex<double>* C, int64_t ldc );
+
+}  // namespace lapack
@@ -0,0 +1,462 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <vector>
+#include <limits>
+
+namespace lapack {
+
+using blas::conj;
+using blas::max;
+
+//------------------------------------------------------------------------------
+// Inserts w(0:n) as column j of the (n+1)-by-(n+1) R, shifting columns
+// j, ..., n-1 right, then reduces R(j+1:n, j) bottom up, with rotations in
+// rows (i-1, i), applied to R(:, j+1:n). For each rotation, calls
+// rotate( i, c, s ) to apply it also to Q or C.
+template <typename scalar_t, typename Rotate>
+static void qr_insert_col_rotate(
+    int64_t n, int64_t j,
+    scalar_t* R, int64_t ldr,
+    scalar_t const* w, Rotate rotate )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    const scalar_t zero = 0;
+
+    // Shift columns j, ..., n-1 of R right; the new row n is zero.
+    for (int64_t k = n; k > j; --k) {
+        blas::copy( k, &R[ (k-1)*ldr ], 1, &R[ k*ldr ], 1 );
+        R[ k + k*ldr ] = zero;
+    }
+    for (int64_t k = 0; k < j; ++k)
+        R[ n + k*ldr ] = zero;
+    blas::copy( n + 1, w, 1, &R[ j*ldr ], 1 );
+
+    for (int64_t i = n; i > j; --i) {
+        real_t c;
+        scalar_t s, r;
+        lapack::lartg( R[ (i-1) + j*ldr ], R[ i + j*ldr ], &c, &s, &r );
+        R[ (i-1) + j*ldr ] = r;
+        R[ i + j*ldr ] = zero;
+        // Besides column j, rows (i-1, i) are nonzero only in
+        // columns i, ..., n; this fills in the diagonal R(i, i).
+        blas::rot( n - i + 1, &R[ (i-1) + i*ldr ], ldr,
+                              &R[ i     + i*ldr ], ldr, c, s );
+        rotate( i, c, s );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Updates the economy QR factorization $A = Q R$ of an m-by-n matrix A
+/// when a column x is inserted before column j, giving the QR factorization
+/// of the m-by-(n+1) matrix
+/// \[
+///     \tilde{A} = [ A(:, 0:j-1), x, A(:, j:n-1) ] = \tilde{Q} \tilde{R}.
+/// \]
+///
+/// x is orthogonalized against Q (classical Gram-Schmidt with one
+/// reorthogonalization) to give the new column of Q; then column j of R,
+/// which has nonzeros below the diagonal, is reduced by Givens rotations
+/// (`lapack::lartg`) that are also applied to Q. This takes $O(m n)$
+/// operations, instead of $O(m n^2)$ to refactor $\tilde{A}$.
+///
+/// This overload needs Q stored explicitly, as m-by-(n+1) memory, since the
+/// Givens rotations are accumulated into it. To update the compact WY
+/// representation from `lapack::geqrt` without forming Q, use the overload
+/// that takes V and T, then the overload that takes $w = Q^H x$.
+///
+/// Active-set and stepwise regression methods use this with
+/// qr_delete_col to change one column at a time.
+///
+/// @param[in] m
+///     The number of rows of A. m > n.
+///
+/// @param[in] n
+///     The number of columns of A. n >= 0.
+///
+/// @param[in] j
+///     Index where x is inserted, 0 <= j <= n (0-based).
+///
+/// @param[in,out] Q
+///     The m-by-(n+1) array Q, stored in an ldq-by-(n+1) array.
+///     On entry, the first n columns are Q, with orthonormal columns.
+///     Q can be generated from `lapack::geqrf` with `lapack::ungqr`,
+///     or from `lapack::geqrt` by applying its compact WY representation
+///     with `lapack::gemqrt` to the first n columns of the identity.
+///     On exit, the m-by-(n+1) matrix $\tilde{Q}$.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= m.
+///
+/// @param[in,out] R
+///     The (n+1)-by-(n+1) array R, stored in an ldr-by-(n+1) array.
+///     On entry, the n-by-n upper triangular matrix R, as returned by
+///     geqrf or geqrt. On exit, the upper triangular matrix $\tilde{R}$.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= n+1.
+///
+/// @param[in] x
+///     The vector x of length m.
+///
+/// @return = 0: successful exit.
+/// @return = 1: x is in the range of Q to working precision, i.e.,
+///     $|| (I - Q Q^H) x || \le m \epsilon || x ||$ (including x = 0);
+///     R and the first n columns of Q are unchanged.
+///
+/// @ingroup geqrf
+template <typename scalar_t>
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    scalar_t const* x )
+{
+    lapack_instrument( "qr_insert_col", internal::precision_char< scalar_t >(),
+                       m, n, 0, Gflop< scalar_t >::qr_insert_col( m, n, j ) );
+
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    using blas::Op;
+
+    // check arguments
+    lapack_error_if( n < 0 );
+    lapack_error_if( m <= n );
+    lapack_error_if( j < 0 || j > n );
+    lapack_error_if( ldq < m );
+    lapack_error_if( ldr < n + 1 );
+
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    // w = Q^H x, q = x - Q w, twice for orthogonality.
+    std::vector< scalar_t > w( n + 1 ), w2( n );
+    scalar_t* q = &Q[ n*ldq ];
+    blas::copy( m, x, 1, q, 1 );
+    real_t xnorm = blas::nrm2( m, q, 1 );
+    if (n > 0) {
+        blas::gemv( Layout::ColMajor, Op::ConjTrans, m, n,
+                    one, Q, ldq, q, 1, zero, &w[ 0 ], 1 );
+        blas::gemv( Layout::ColMajor, Op::NoTrans, m, n,
+                    -one, Q, ldq, &w[ 0 ], 1, one, q, 1 );
+        blas::gemv( Layout::ColMajor, Op::ConjTrans, m, n,
+                    one, Q, ldq, q, 1, zero, &w2[ 0 ], 1 );
+        blas::gemv( Layout::ColMajor, Op::NoTrans, m, n,
+                    -one, Q, ldq, &w2[ 0 ], 1, one, q, 1 );
+        blas::axpy( n, one, &w2[ 0 ], 1, &w[ 0 ], 1 );
+    }
+    real_t rho = blas::nrm2( m, q, 1 );
+    if (rho <= m * eps * xnorm)
+        return 1;
+    blas::scal( m, real_t( 1 ) / rho, q, 1 );
+    w[ n ] = rho;
+
+    // Insert w into R and reduce it, applying the rotations to
+    // columns (i-1, i) of Q.
+    qr_insert_col_rotate( n, j, R, ldr, &w[ 0 ],
+        [&]( int64_t i, real_t c, scalar_t s ) {
+            blas::rot( m, &Q[ (i-1)*ldq ], 1, &Q[ i*ldq ], 1, c, conj( s ) );
+        } );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Updates the full QR factorization $A = Q [ R; 0 ]$ of an m-by-n matrix
+/// A, with Q not stored, when a column x is inserted before column j.
+/// Instead of x, this takes $w = Q^H x$, which with the compact WY
+/// representation from `lapack::geqrt` costs $O(m n)$ with `lapack::gemqrt`;
+/// see the overload that takes V and T.
+///
+/// The part $w(n:m-1)$ below R is reduced to a multiple of $e_0$ by a
+/// Householder reflector H, then column j of R by Givens rotations G, as in
+/// the overload with explicit Q, so $\tilde{Q} = Q \text{diag}(I, H) G^H$.
+/// H and G are applied to the m-by-ncol matrix C, which holds
+/// $Q^H B$ for other data B, such as right-hand sides of a least squares
+/// problem, or columns that may be inserted later. On exit, C holds
+/// $\tilde{Q}^H B$, so a column of C is w for a later insert.
+/// This takes $O(m \cdot ncol + n^2)$ operations, instead of $O(m n^2)$ to
+/// refactor $\tilde{A}$.
+///
+/// @param[in] m
+///     The number of rows of A. m > n.
+///
+/// @param[in] n
+///     The number of columns of A. n >= 0.
+///
+/// @param[in] j
+///     Index where x is inserted, 0 <= j <= n (0-based).
+///
+/// @param[in,out] R
+///     The (n+1)-by-(n+1) array R, stored in an ldr-by-(n+1) array.
+///     On entry, the n-by-n upper triangular matrix R.
+///     On exit, the upper triangular matrix $\tilde{R}$.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= n+1.
+///
+/// @param[in,out] w
+///     The vector $w = Q^H x$ of length m. It must not overlap C.
+///     On exit, overwritten by the Householder vector.
+///
+/// @param[in] ncol
+///     The number of columns of C. ncol >= 0.
+///
+/// @param[in,out] C
+///     The m-by-ncol matrix C, stored in an ldc-by-ncol array.
+///     On entry, $Q^H B$. On exit, $\tilde{Q}^H B$.
+///
+/// @param[in] ldc
+///     The leading dimension of the array C. ldc >= max(1, m).
+///
+/// @return = 0: successful exit.
+/// @return = 1: x is in the range of Q(:, 0:n-1) to working precision,
+///     i.e., $|| w(n:m-1) || \le m \epsilon || w ||$ (including x = 0);
+///     R, w, and C are unchanged.
+///
+/// @ingroup geqrf
+template <typename scalar_t>
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    scalar_t* R, int64_t ldr,
+    scalar_t* w,
+    int64_t ncol, scalar_t* C, int64_t ldc )
+{
+    lapack_instrument( "qr_insert_col_implicit",
+                       internal::precision_char< scalar_t >(), m, n, ncol,
+                       Gflop< scalar_t >::qr_insert_col_implicit(
+                           m, n, j, ncol ) );
+
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( n < 0 );
+    lapack_error_if( m <= n );
+    lapack_error_if( j < 0 || j > n );
+    lapack_error_if( ldr < n + 1 );
+    lapack_error_if( ncol < 0 );
+    lapack_error_if( ldc < max( 1, m ) );
+
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    real_t wnorm = blas::nrm2( m, w, 1 );
+    real_t rho = blas::nrm2( m - n, &w[ n ], 1 );
+    if (rho <= m * eps * wnorm)
+        return 1;
+
+    // H^H w(n:m-1) = beta e_0, applied to C(n:m-1, :) as H^H.
+    scalar_t tau;
+    lapack::larfg( m - n, &w[ n ], &w[ n+1 ], 1, &tau );
+    if (ncol > 0) {
+        scalar_t beta = w[ n ];
+        w[ n ] = 1;
+        lapack::larf( Side::Left, m - n, ncol, &w[ n ], 1, conj( tau ),
+                      &C[ n ], ldc );
+        w[ n ] = beta;
+    }
+
+    // Insert w(0:n) into R and reduce it, applying the rotations to
+    // rows (i-1, i) of C.
+    qr_insert_col_rotate( n, j, R, ldr, w,
+        [&]( int64_t i, real_t c, scalar_t s ) {
+            blas::rot( ncol, &C[ i-1 ], ldc, &C[ i ], ldc, c, s );
+        } );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Updates the QR factorization $A = Q R$ of an m-by-n matrix A, as computed
+/// by `lapack::geqrt`, when a column x is inserted before column j.
+/// Q is applied in its compact WY representation (V, T):
+/// $w = Q^H x$ is computed by `lapack::gemqrt` in $O(m n)$ operations,
+/// then R and C are updated as in the overload that takes w.
+///
+/// The updated $\tilde{Q} = Q \text{diag}(I, H) G^H$ is no longer
+/// represented by V and T. For a sequence of updates, apply Q^H to the
+/// candidate columns and right-hand sides once, as C, and use the
+/// overload that takes w, with w copied from a column of C.
+///
+/// @param[in] m
+///     The number of rows of A. m > n.
+///
+/// @param[in] n
+///     The number of columns of A. n >= 0.
+///
+/// @param[in] j
+///     Index where x is inserted, 0 <= j <= n (0-based).
+///
+/// @param[in] nb
+///     The block size used by geqrt. n >= nb >= 1 if n > 0.
+///
+/// @param[in] V
+///     The m-by-n matrix V, stored in an ldv-by-n array, as returned
+///     by geqrt below the diagonal of A.
+///
+/// @param[in] ldv
+///     The leading dimension of the array V. ldv >= max(1, m).
+///
+/// @param[in] T
+///     The nb-by-n matrix T, stored in an ldt-by-n array, as returned
+///     by geqrt.
+///
+/// @param[in] ldt
+///     The leading dimension of the array T. ldt >= nb.
+///
+/// @param[in,out] R
+///     The (n+1)-by-(n+1) array R, stored in an ldr-by-(n+1) array.
+///     On entry, the n-by-n upper triangular matrix R, as returned by
+///     geqrt. On exit, the upper triangular matrix $\tilde{R}$.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= n+1.
+///
+/// @param[in] x
+///     The vector x of length m.
+///
+/// @param[in] ncol
+///     The number of columns of C. ncol >= 0.
+///
+/// @param[in,out] C
+///     The m-by-ncol matrix C, stored in an ldc-by-ncol array.
+///     On entry, $Q^H B$, e.g., from gemqrt. On exit, $\tilde{Q}^H B$.
+///
+/// @param[in] ldc
+///     The leading dimension of the array C. ldc >= max(1, m).
+///
+/// @return = 0: successful exit.
+/// @return = 1: x is in the range of Q(:, 0:n-1) to working precision;
+///     R and C are unchanged.
+///
+/// @ingroup geqrf
+template <typename scalar_t>
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j, int64_t nb,
+    scalar_t const* V, int64_t ldv,
+    scalar_t const* T, int64_t ldt,
+    scalar_t* R, int64_t ldr,
+    scalar_t const* x,
+    int64_t ncol, scalar_t* C, int64_t ldc )
+{
+    lapack_instrument( "qr_insert_col_geqrt",
+                       internal::precision_char< scalar_t >(), m, n, ncol,
+                       Gflop< scalar_t >::unmqr( Side::Left, m, 1, n )
+                       + Gflop< scalar_t >::qr_insert_col_implicit(
+                           m, n, j, ncol ) );
+
+    // check arguments; the rest are checked by gemqrt and the overload
+    lapack_error_if( n < 0 );
+    lapack_error_if( m <= n );
+
+    // w = Q^H x
+    std::vector< scalar_t > w( x, x + m );
+    if (n > 0) {
+        lapack::gemqrt( Side::Left, Op::ConjTrans, m, 1, n, nb,
+                        V, ldv, T, ldt, &w[ 0 ], m );
+    }
+    return qr_insert_col( m, n, j, R, ldr, &w[ 0 ], ncol, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t qr_insert_col< float >(
+    int64_t m, int64_t n, int64_t j,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    float const* x );
+
+template
+int64_t qr_insert_col< double >(
+    int64_t m, int64_t n, int64_t j,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    double const* x );
+
+template
+int64_t qr_insert_col< std::complex<float> >(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    std::complex<float> const* x );
+
+template
+int64_t qr_insert_col< std::complex<double> >(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    std::complex<double> const* x );
+
+//--------------------
+template
+int64_t qr_insert_col< float >(
+    int64_t m, int64_t n, int64_t j,
+    float* R, int64_t ldr,
+    float* w,
+    int64_t ncol, float* C, int64_t ldc );
+
+template
+int64_t qr_insert_col< double >(
+    int64_t m, int64_t n, int64_t j,
+    double* R, int64_t ldr,
+    double* w,
+    int64_t ncol, double* C, int64_t ldc );
+
+template
+int64_t qr_insert_col< std::complex<float> >(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<float>* R, int64_t ldr,
+    std::complex<float>* w,
+    int64_t ncol, std::complex<float>* C, int64_t ldc );
+
+template
+int64_t qr_insert_col< std::complex<double> >(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<double>* R, int64_t ldr,
+    std::complex<double>* w,
+    int64_t ncol, std::complex<double>* C, int64_t ldc );
+
+//--------------------
+template
+int64_t qr_insert_col< float >(
+    int64_t m, int64_t n, int64_t j, int64_t nb,
+    float const* V, int64_t ldv,
+    float const* T, int64_t ldt,
+    float* R, int64_t ldr,
+    float const* x,
+    int64_t ncol, float* C, int64_t ldc );
+
+template
+int64_t qr_insert_col< double >(
+    int64_t m, int64_t n, int64_t j, int64_t nb,
+    double const* V, int64_t ldv,
+    double const* T, int64_t ldt,
+    double* R, int64_t ldr,
+    double const* x,
+    int64_t ncol, double* C, int64_t ldc );
+
+template
+int64_t qr_insert_col< std::complex<float> >(
+    int64_t m, int64_t n, int64_t j, int64_t nb,
+    std::complex<float> const* V, int64_t ldv,
+    std::complex<float> const* T, int64_t ldt,
+    std::complex<float>* R, int64_t ldr,
+    std::complex<float> const* x,
+    int64_t ncol, std::complex<float>* C, int64_t ldc );
+
+template
+int64_t qr_insert_col< std::complex<double> >(
+    int64_t m, int64_t n, int64_t j, int64_t nb,
+    std::complex<double> const* V, int64_t ldv,
+    std::complex<double> const* T, int64_t ldt,
+    std::complex<double>* R, int64_t ldr,
+    std::complex<double> const* x,
+    int64_t ncol, std::complex<double>* C, int64_t ldc );
+
+}  // namespace lapack
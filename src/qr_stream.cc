@@ -0,0 +1,244 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/qr_stream.hh"
+#include "lapack_internal.hh"
+
+#if LAPACK_VERSION >= 30400  // >= 3.4, for tpqrt
+
+#include <cmath>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+QRStream< scalar_t >::QRStream(
+    int64_t n, int64_t nrhs, real_t forget, int64_t nb )
+    : n_( n ),
+      nrhs_( nrhs ),
+      nb_( nb ),
+      m_( 0 ),
+      forget_( 1 )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( nb < 0 );
+
+    if (nb_ == 0)
+        nb_ = 32;
+    nb_ = max( 1, min( nb_, n_ ) );
+    this->forget( forget );
+
+    R_.resize( n_ * n_ );
+    Z_.resize( n_ * nrhs_ );
+    rnorm_.resize( nrhs_ );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void QRStream< scalar_t >::forget( real_t forget )
+{
+    lapack_error_if( ! (0 < forget && forget <= 1) );
+    forget_ = forget;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void QRStream< scalar_t >::reset()
+{
+    std::fill( R_.begin(), R_.end(), scalar_t( 0 ) );
+    std::fill( Z_.begin(), Z_.end(), scalar_t( 0 ) );
+    std::fill( rnorm_.begin(), rnorm_.end(), real_t( 0 ) );
+    m_ = 0;
+}
+
+//------------------------------------------------------------------------------
+// The rows [ R; V ] are reduced by tpqrt to [ R_new; 0 ],
+// applying the same reflectors to [ Z; C ] with tpmqrt.
+// The residual of the new rows, left in C, adds to the residual norms.
+template <typename scalar_t>
+void QRStream< scalar_t >::update(
+    int64_t k, scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb )
+{
+    lapack_instrument( "qr_stream_update",
+                       internal::precision_char< scalar_t >(), k, n_, nrhs_,
+                       Gflop< scalar_t >::tpqrt( k, n_ )
+                       + Gflop< scalar_t >::tpmqrt( k, nrhs_, n_ ) );
+
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, k ) );
+    lapack_error_if( nrhs_ > 0 && ldb < max( 1, k ) );
+
+    if (k == 0)
+        return;
+
+    if (forget_ != 1) {
+        real_t s = std::sqrt( forget_ );
+        for (int64_t j = 0; j < n_; ++j)
+            blas::scal( j + 1, s, &R_[ j*n_ ], 1 );
+        if (n_ > 0 && nrhs_ > 0)
+            blas::scal( n_ * nrhs_, s, Z_.data(), 1 );
+        for (auto& rnorm : rnorm_)
+            rnorm *= s;
+    }
+
+    // Copy new rows, which tpqrt and tpmqrt overwrite.
+    V_.resize( k * n_ );
+    C_.resize( k * nrhs_ );
+    T_.resize( nb_ * n_ );
+    lapack::lacpy( MatrixType::General, k, n_, A, lda, V_.data(), k );
+    if (nrhs_ > 0)
+        lapack::lacpy( MatrixType::General, k, nrhs_, B, ldb, C_.data(), k );
+
+    if (n_ > 0) {
+        lapack::tpqrt( k, n_, 0, nb_, R_.data(), n_, V_.data(), k,
+                       T_.data(), nb_ );
+        if (nrhs_ > 0) {
+            lapack::tpmqrt( Side::Left, Op::ConjTrans, k, nrhs_, n_, 0, nb_,
+                            V_.data(), k, T_.data(), nb_,
+                            Z_.data(), n_, C_.data(), k );
+        }
+    }
+    for (int64_t j = 0; j < nrhs_; ++j) {
+        rnorm_[ j ] = std::hypot( rnorm_[ j ],
+                                  blas::nrm2( k, &C_[ j*k ], 1 ) );
+    }
+    m_ += k;
+}
+
+//------------------------------------------------------------------------------
+// For each row x, solves R^H a = conj(x); if ||a|| < 1, determines
+// rotations that reduce [ a; sqrt(1 - ||a||^2) ] to [ 0; 1 ], and
+// applies them to [ R; 0 ] and [ Z; y ], giving R_new^H R_new = R^H R - x^H x.
+// See LINPACK zchdd. Whether row r can be removed depends on removing rows
+// 0 : r-1 first, so R, Z, and the residual norms are saved, and restored
+// if any row fails.
+template <typename scalar_t>
+int64_t QRStream< scalar_t >::downdate(
+    int64_t k, scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb )
+{
+    // Per row, a solve with R, then rotations applied to R and Z.
+    lapack_instrument( "qr_stream_downdate",
+                       internal::precision_char< scalar_t >(), k, n_, nrhs_,
+                       Gflop< scalar_t >::potrf_downdate( n_, k )
+                       + k * Gflop< scalar_t >::lasr( Side::Left, n_ + 1,
+                                                      nrhs_ ) );
+
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, k ) );
+    lapack_error_if( nrhs_ > 0 && ldb < max( 1, k ) );
+
+    const real_t one = 1;
+    const scalar_t zero = 0;
+
+    V_.resize( n_ );
+    cs_.resize( n_ );
+    scalar_t* s = V_.data();
+    real_t*   c = cs_.data();
+
+    if (k == 0)
+        return 0;
+
+    std::vector< scalar_t > R_save( R_ ), Z_save( Z_ );
+    std::vector< real_t > rnorm_save( rnorm_ );
+    int64_t m_save = m_;
+    auto restore = [&]( int64_t info ) {
+        R_.swap( R_save );
+        Z_.swap( Z_save );
+        rnorm_.swap( rnorm_save );
+        m_ = m_save;
+        return info;
+    };
+
+    for (int64_t r = 0; r < k; ++r) {
+        // Solve R^H s = conj( x ); R must be nonsingular.
+        for (int64_t i = 0; i < n_; ++i) {
+            if (R_[ i + i*n_ ] == zero)
+                return restore( r + 1 );
+            s[ i ] = conj( A[ r + i*lda ] );
+        }
+        blas::trsv( Layout::ColMajor, Uplo::Upper, Op::ConjTrans, Diag::NonUnit,
+                    n_, R_.data(), n_, s, 1 );
+        real_t norm = blas::nrm2( n_, s, 1 );
+        if (! (norm < one))
+            return restore( r + 1 );
+
+        // Determine the rotations.
+        real_t alpha = std::sqrt( (one - norm) * (one + norm) );
+        for (int64_t i = n_ - 1; i >= 0; --i) {
+            real_t scale = alpha + std::abs( s[ i ] );
+            real_t a = alpha / scale;
+            scalar_t b = s[ i ] / scale;
+            norm = std::hypot( a, std::abs( b ) );
+            c[ i ] = a / norm;
+            s[ i ] = conj( b ) / norm;
+            alpha = scale * norm;
+        }
+
+        // Apply the rotations to R.
+        for (int64_t j = 0; j < n_; ++j) {
+            scalar_t xx = zero;
+            for (int64_t i = j; i >= 0; --i) {
+                scalar_t& Rij = R_[ i + j*n_ ];
+                scalar_t t = c[ i ]*xx + s[ i ]*Rij;
+                Rij = c[ i ]*Rij - conj( s[ i ] )*xx;
+                xx = t;
+            }
+        }
+
+        // Apply the rotations to Z, and downdate the residual norms.
+        for (int64_t j = 0; j < nrhs_; ++j) {
+            scalar_t zeta = B[ r + j*ldb ];
+            for (int64_t i = 0; i < n_; ++i) {
+                scalar_t& Zij = Z_[ i + j*n_ ];
+                Zij = (Zij - conj( s[ i ] )*zeta) / c[ i ];
+                zeta = c[ i ]*zeta - s[ i ]*Zij;
+            }
+            // Clamp at zero: the residual norm can be lost to rounding.
+            real_t azeta = std::abs( zeta );
+            real_t& rnorm = rnorm_[ j ];
+            if (azeta < rnorm)
+                rnorm *= std::sqrt( (one - azeta/rnorm) * (one + azeta/rnorm) );
+            else
+                rnorm = 0;
+        }
+        m_ -= 1;
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t QRStream< scalar_t >::solve( scalar_t* X, int64_t ldx ) const
+{
+    lapack_instrument( "qr_stream_solve",
+                       internal::precision_char< scalar_t >(), 0, n_, nrhs_,
+                       Gflop< scalar_t >::trtrs( n_, nrhs_ ) );
+
+    lapack_error_if( ldx < max( 1, n_ ) );
+
+    lapack::lacpy( MatrixType::General, n_, nrhs_, Z_.data(), max( 1, n_ ),
+                   X, ldx );
+    return lapack::trtrs( Uplo::Upper, Op::NoTrans, Diag::NonUnit,
+                          n_, nrhs_, R_.data(), max( 1, n_ ), X, ldx );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class QRStream< float >;
+template class QRStream< double >;
+template class QRStream< std::complex<float> >;
+template class QRStream< std::complex<double> >;
+
+}  // namespace lapack
+
+#endif  // LAPACK >= 3.4
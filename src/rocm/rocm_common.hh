@@ -26,6 +26,16 @@ inline const rocblas_evect  job2eigmode_rocsolver(lapack::Job jobz) {
     return rocblas_evect_none;
 }
 
+inline rocblas_svect job2svect_rocsolver( lapack::Job job )
+{
+    switch (job) {
+        case lapack::Job::AllVec:       return rocblas_svect_all;
+        case lapack::Job::SomeVec:      return rocblas_svect_singular;
+        case lapack::Job::OverwriteVec: return rocblas_svect_overwrite;
+        default:                        return rocblas_svect_none;
+    }
+}
+
 } // namespace lapack
 
 #endif // LAPACK_ROCM_COMMON_H
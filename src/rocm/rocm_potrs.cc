@@ -0,0 +1,134 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_ROCBLAS)
+
+#include "rocm_common.hh"
+
+//==============================================================================
+namespace blas {
+namespace internal {
+
+rocblas_fill uplo2rocblas( blas::Uplo uplo );
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around rocSolver to deal with precisions.
+rocblas_status rocsolver_potrs(
+    rocblas_handle solver, rocblas_fill uplo,
+    rocblas_int n, rocblas_int nrhs,
+    float* dA, rocblas_int ldda,
+    float* dB, rocblas_int lddb )
+{
+    return rocsolver_spotrs(
+        solver, uplo, n, nrhs,
+        dA, ldda,
+        dB, lddb );
+}
+
+//----------
+rocblas_status rocsolver_potrs(
+    rocblas_handle solver, rocblas_fill uplo,
+    rocblas_int n, rocblas_int nrhs,
+    double* dA, rocblas_int ldda,
+    double* dB, rocblas_int lddb )
+{
+    return rocsolver_dpotrs(
+        solver, uplo, n, nrhs,
+        dA, ldda,
+        dB, lddb );
+}
+
+//----------
+rocblas_status rocsolver_potrs(
+    rocblas_handle solver, rocblas_fill uplo,
+    rocblas_int n, rocblas_int nrhs,
+    std::complex<float>* dA, rocblas_int ldda,
+    std::complex<float>* dB, rocblas_int lddb )
+{
+    return rocsolver_cpotrs(
+        solver, uplo, n, nrhs,
+        (rocblas_float_complex*) dA, ldda,
+        (rocblas_float_complex*) dB, lddb );
+}
+
+//----------
+rocblas_status rocsolver_potrs(
+    rocblas_handle solver, rocblas_fill uplo,
+    rocblas_int n, rocblas_int nrhs,
+    std::complex<double>* dA, rocblas_int ldda,
+    std::complex<double>* dB, rocblas_int lddb )
+{
+    return rocsolver_zpotrs(
+        solver, uplo, n, nrhs,
+        (rocblas_double_complex*) dA, ldda,
+        (rocblas_double_complex*) dB, lddb );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around rocSolver.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    // todo: check for overflow
+    auto solver = queue.handle();
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    blas_dev_call(
+        rocsolver_potrs(
+            solver, blas::internal::uplo2rocblas( uplo ), n, nrhs,
+            const_cast< scalar_t* >( dA ), ldda, dB, lddb ));
+
+    // rocSolver doesn't return info.
+    blas::device_memset( dev_info, 0, 1, queue );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* dA, int64_t ldda,
+    float* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* dA, int64_t ldda,
+    double* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* dA, int64_t ldda,
+    std::complex<float>* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* dA, int64_t ldda,
+    std::complex<double>* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_ROCBLAS
@@ -0,0 +1,171 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_ROCBLAS)
+
+#include "rocm_common.hh"
+
+//==============================================================================
+namespace blas {
+namespace internal {
+
+rocblas_fill uplo2rocblas( blas::Uplo uplo );
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Wrapper around rocSolver workspace query.
+// rocSolver allocates its workspace in the handle, so none is needed.
+template <typename scalar_t>
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    *dev_work_size  = 0;
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around rocSolver to deal with precisions.
+rocblas_status rocsolver_sytrf(
+    rocblas_handle solver, rocblas_fill uplo, rocblas_int n,
+    float* dA, rocblas_int ldda, rocblas_int* dipiv,
+    rocblas_int* info )
+{
+    return rocsolver_ssytrf(
+        solver, uplo, n,
+        dA, ldda, dipiv, info );
+}
+
+//----------
+rocblas_status rocsolver_sytrf(
+    rocblas_handle solver, rocblas_fill uplo, rocblas_int n,
+    double* dA, rocblas_int ldda, rocblas_int* dipiv,
+    rocblas_int* info )
+{
+    return rocsolver_dsytrf(
+        solver, uplo, n,
+        dA, ldda, dipiv, info );
+}
+
+//----------
+rocblas_status rocsolver_sytrf(
+    rocblas_handle solver, rocblas_fill uplo, rocblas_int n,
+    std::complex<float>* dA, rocblas_int ldda, rocblas_int* dipiv,
+    rocblas_int* info )
+{
+    return rocsolver_csytrf(
+        solver, uplo, n,
+        (rocblas_float_complex*) dA, ldda, dipiv, info );
+}
+
+//----------
+rocblas_status rocsolver_sytrf(
+    rocblas_handle solver, rocblas_fill uplo, rocblas_int n,
+    std::complex<double>* dA, rocblas_int ldda, rocblas_int* dipiv,
+    rocblas_int* info )
+{
+    return rocsolver_zsytrf(
+        solver, uplo, n,
+        (rocblas_double_complex*) dA, ldda, dipiv, info );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around rocSolver.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    // todo: check for overflow
+    auto solver = queue.handle();
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    blas_dev_call(
+        rocsolver_sytrf(
+            solver, blas::internal::uplo2rocblas( uplo ), n,
+            dA, ldda, dev_ipiv, dev_info ));
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_ROCBLAS
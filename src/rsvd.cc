@@ -0,0 +1,505 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+// larnv distribution of the random sketch: normal (0, 1).
+static const int64_t rsvd_idist = 3;
+
+//------------------------------------------------------------------------------
+// Overwrites the m-by-l matrix Y with an orthonormal basis of its range.
+// Workspace tau of length l. Requires l <= m.
+template <typename scalar_t>
+static void rsvd_orth(
+    int64_t m, int64_t l, scalar_t* Y, int64_t ldy, scalar_t* tau )
+{
+    lapack::geqrf( m, l, Y, ldy, tau );
+    lapack::ungqr( m, l, l, Y, ldy, tau );
+}
+
+//------------------------------------------------------------------------------
+// Gflop count of rsvd_orth.
+template <typename scalar_t>
+static double rsvd_orth_gflop( int64_t m, int64_t l )
+{
+    using G = Gflop< scalar_t >;
+    return G::geqrf( m, l ) + G::ungqr( m, l, l );
+}
+
+//------------------------------------------------------------------------------
+// Gflop count of rsvd_range.
+template <typename scalar_t>
+static double rsvd_range_gflop(
+    int64_t m, int64_t n, int64_t l, int64_t q, int64_t l0 )
+{
+    using G = Gflop< scalar_t >;
+    double orth_m  = rsvd_orth_gflop< scalar_t >( m, l );
+    double orth_n  = rsvd_orth_gflop< scalar_t >( n, l );
+    double project = 0;
+    if (l0 > 0)
+        project = 2*(G::gemm( l0, l, m ) + G::gemm( m, l, l0 ));
+
+    double range = G::gemm( m, l, n ) + project + orth_m;
+    double iter  = G::gemm( n, l, m ) + orth_n
+                 + G::gemm( m, l, n ) + project + orth_m;
+    return range + q*iter;
+}
+
+//------------------------------------------------------------------------------
+// Gflop count of rsvd. Excludes the SVD of the small l-by-n projected
+// matrix, whose count depends on the data.
+template <typename scalar_t>
+static double rsvd_gflop(
+    int64_t m, int64_t n, int64_t k, int64_t p, int64_t q )
+{
+    using G = Gflop< scalar_t >;
+    int64_t l = min( k + p, min( m, n ) );
+    return rsvd_range_gflop< scalar_t >( m, n, l, q, 0 )
+           + G::gemm( l, n, m ) + G::gemm( m, k, l );
+}
+
+//------------------------------------------------------------------------------
+// Computes an m-by-l orthonormal basis Y of the range of (A A^H)^q A Omega,
+// with Omega an n-by-l Gaussian random matrix, orthonormalizing after each
+// product with A or A^H. If l0 > 0, Y is also made orthogonal to the
+// m-by-l0 orthonormal Q0, projecting twice before each orthonormalization.
+// Workspace W, n-by-l; Z, l0-by-l; tau, length l. Requires l <= min( m, n ).
+template <typename scalar_t>
+static void rsvd_range(
+    int64_t m, int64_t n, int64_t l, int64_t q,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* Q0, int64_t l0,
+    scalar_t* Y, scalar_t* W, scalar_t* Z, scalar_t* tau,
+    int64_t* iseed )
+{
+    using blas::Layout;
+    using blas::Op;
+    const scalar_t one = 1, zero = 0;
+
+    auto project = [&]() {
+        for (int pass = 0; pass < 2 && l0 > 0; ++pass) {
+            // Y -= Q0 (Q0^H Y)
+            blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                        l0, l, m, one, Q0, m, Y, m, zero, Z, l0 );
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                        m, l, l0, -one, Q0, m, Z, l0, one, Y, m );
+        }
+    };
+
+    // Y = A Omega
+    lapack::larnv( rsvd_idist, iseed, n*l, W );
+    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                m, l, n, one, A, lda, W, n, zero, Y, m );
+    project();
+    rsvd_orth( m, l, Y, m, tau );
+
+    for (int64_t iter = 0; iter < q; ++iter) {
+        // W = orth( A^H Y ), Y = orth( A W )
+        blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                    n, l, m, one, A, lda, Y, m, zero, W, n );
+        rsvd_orth( n, l, W, n, tau );
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                    m, l, n, one, A, lda, W, n, zero, Y, m );
+        project();
+        rsvd_orth( m, l, Y, m, tau );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Computes a rank-k approximation of the m-by-n matrix A,
+/// \[
+///     A \approx U \Sigma V^H,
+/// \]
+/// where U is m-by-k and V is n-by-k with orthonormal columns, and
+/// $\Sigma$ holds approximations of the k largest singular values of A,
+/// using a randomized algorithm [Halko, Martinsson, Tropp, 2011].
+///
+/// The range of A is sampled by $Y = (A A^H)^q A \Omega$, with $\Omega$
+/// an n-by-(k + p) Gaussian random matrix from `lapack::larnv`,
+/// orthonormalizing with `lapack::geqrf` and `lapack::ungqr` after each
+/// product. With Q an orthonormal basis of Y, the small matrix $Q^H A$ is
+/// factored with `lapack::gesdd`. This takes $O(m n (k + p) (2q + 2))$
+/// operations, mostly in gemm, compared to $O(m n \min(m, n))$ for a full
+/// SVD, so is much faster when k is small.
+///
+/// The error is close to optimal when the singular values of A decay
+/// quickly. Oversampling p = 10 and q = 1 or 2 power iterations are
+/// usually sufficient; more power iterations improve accuracy when the
+/// singular values decay slowly. For a given tolerance instead of rank,
+/// see `lapack::rsvd_adaptive`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The rank of the approximation. 0 <= k <= min(m,n).
+///
+/// @param[in] p
+///     The oversampling. p >= 0. The sketch has min( k + p, min(m,n) )
+///     columns.
+///
+/// @param[in] q
+///     The number of power iterations. q >= 0.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] S
+///     The vector S of length k.
+///     The approximate singular values, sorted so that S(i) >= S(i+1).
+///
+/// @param[out] U
+///     The m-by-k matrix U, stored in an ldu-by-k array.
+///     The approximate left singular vectors.
+///
+/// @param[in] ldu
+///     The leading dimension of the array U. ldu >= max(1,m).
+///
+/// @param[out] VT
+///     The k-by-n matrix V^H, stored in an ldvt-by-n array.
+///     The approximate right singular vectors, as rows.
+///
+/// @param[in] ldvt
+///     The leading dimension of the array VT. ldvt >= max(1,k).
+///
+/// @param[in,out] iseed
+///     The vector iseed of length 4.
+///     On entry, the seed of the random number generator; see
+///     `lapack::larnv`. On exit, the seed is updated.
+///
+/// @return = 0: successful exit
+/// @return > 0: the SVD of the projected matrix did not converge;
+///     see `lapack::gesdd`.
+///
+/// @ingroup gesvd
+template <typename scalar_t>
+int64_t rsvd(
+    int64_t m, int64_t n, int64_t k, int64_t p, int64_t q,
+    scalar_t const* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt,
+    int64_t* iseed )
+{
+    lapack_instrument( "rsvd", internal::precision_char< scalar_t >(), m, n, k,
+                       rsvd_gflop< scalar_t >( m, n, k, p, q ) );
+
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    using blas::Op;
+    const scalar_t one = 1, zero = 0;
+
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 || k > min( m, n ) );
+    lapack_error_if( p < 0 );
+    lapack_error_if( q < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldu < max( 1, m ) );
+    lapack_error_if( ldvt < max( 1, k ) );
+
+    if (k == 0)
+        return 0;
+
+    int64_t l = min( k + p, min( m, n ) );
+    std::vector< scalar_t > Q( m*l ), W( n*l ), B( l*n ), Ub( l*l ), tau( l );
+    std::vector< real_t > Sb( l );
+
+    rsvd_range( m, n, l, q, A, lda, (scalar_t const*) nullptr, 0,
+                Q.data(), W.data(), (scalar_t*) nullptr, tau.data(), iseed );
+
+    // B = Q^H A = Ub Sb Vb^H, with Vb^H in W.
+    blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                l, n, m, one, Q.data(), m, A, lda, zero, B.data(), l );
+    int64_t info = lapack::gesdd( Job::SomeVec, l, n, B.data(), l, Sb.data(),
+                                  Ub.data(), l, W.data(), l );
+    if (info != 0)
+        return info;
+
+    // U = Q Ub( :, 0:k-1 )
+    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                m, k, l, one, Q.data(), m, Ub.data(), l, zero, U, ldu );
+    std::copy( Sb.begin(), Sb.begin() + k, S );
+    lapack::lacpy( MatrixType::General, k, n, W.data(), l, VT, ldvt );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes a low-rank approximation of the m-by-n matrix A to a given
+/// relative accuracy,
+/// \[
+///     || A - U \Sigma V^H ||_F \le tol \, || A ||_F,
+/// \]
+/// choosing the rank k adaptively, using a randomized algorithm.
+///
+/// Like `lapack::rsvd`, but the basis Q of the range of A is built nb
+/// columns at a time, each block orthogonal to the previous ones
+/// [Martinsson, Voronin, 2016]. Since Q is orthonormal,
+/// $|| A - Q Q^H A ||_F^2 = || A ||_F^2 - || Q^H A ||_F^2$, so the error
+/// is tracked without forming the residual, and blocks are added until it
+/// is below tol, or the rank reaches kmax. Then $Q^H A$ is factored with
+/// `lapack::gesdd`, and its smallest singular values are dropped while the
+/// error stays below tol. Due to cancellation, the error estimate is
+/// reliable only for tol larger than about the square root of
+/// machine epsilon.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] tol
+///     The relative tolerance, in the Frobenius norm. tol >= 0.
+///
+/// @param[in] kmax
+///     The maximum rank. 0 <= kmax <= min(m,n).
+///
+/// @param[in] nb
+///     The number of columns added to the basis at a time. nb >= 1.
+///
+/// @param[in] q
+///     The number of power iterations for each block. q >= 0.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] k
+///     The rank of the approximation, k <= kmax.
+///
+/// @param[out] S
+///     The vector S of length kmax.
+///     The k approximate singular values, sorted so that S(i) >= S(i+1).
+///
+/// @param[out] U
+///     The m-by-kmax matrix U, stored in an ldu-by-kmax array.
+///     The first k columns are the approximate left singular vectors.
+///
+/// @param[in] ldu
+///     The leading dimension of the array U. ldu >= max(1,m).
+///
+/// @param[out] VT
+///     The kmax-by-n matrix V^H, stored in an ldvt-by-n array.
+///     The first k rows are the approximate right singular vectors.
+///
+/// @param[in] ldvt
+///     The leading dimension of the array VT. ldvt >= max(1,kmax).
+///
+/// @param[out] error
+///     The estimated relative error, $|| A - U \Sigma V^H ||_F / || A ||_F$.
+///     If error > tol, the tolerance was not reached with rank kmax.
+///
+/// @param[in,out] iseed
+///     The vector iseed of length 4.
+///     On entry, the seed of the random number generator; see
+///     `lapack::larnv`. On exit, the seed is updated.
+///
+/// @return = 0: successful exit
+/// @return > 0: the SVD of the projected matrix did not converge;
+///     see `lapack::gesdd`.
+///
+/// @ingroup gesvd
+template <typename scalar_t>
+int64_t rsvd_adaptive(
+    int64_t m, int64_t n, blas::real_type< scalar_t > tol,
+    int64_t kmax, int64_t nb, int64_t q,
+    scalar_t const* A, int64_t lda,
+    int64_t* k,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt,
+    blas::real_type< scalar_t >* error,
+    int64_t* iseed )
+{
+    // The rank, hence the Gflop count, depends on the data;
+    // the count is set as blocks are added.
+    lapack_instrument( "rsvd_adaptive", internal::precision_char< scalar_t >(),
+                       m, n, kmax, internal::gflop_data_dependent );
+
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    using blas::Op;
+    using G = Gflop< scalar_t >;
+    const scalar_t one = 1, zero = 0;
+
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( tol < 0 );
+    lapack_error_if( kmax < 0 || kmax > min( m, n ) );
+    lapack_error_if( nb < 1 );
+    lapack_error_if( q < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldu < max( 1, m ) );
+    lapack_error_if( ldvt < max( 1, kmax ) );
+
+    *k = 0;
+    *error = 0;
+    real_t Anorm = lapack::lange( Norm::Fro, m, n, A, lda );
+    double gflop = G::lange( Norm::Fro, m, n );
+    lapack_instrument_gflop( gflop );
+    if (Anorm == 0) {
+        return 0;
+    }
+    real_t thresh2 = (tol * Anorm) * (tol * Anorm);
+
+    // Build Q (m-by-l) and B = Q^H A (l-by-n, stored with ld kmax)
+    // one block at a time; err2 = || A - Q B ||_F^2.
+    nb = min( nb, max( 1, kmax ) );
+    std::vector< scalar_t > Q( m*kmax ), B( kmax*n ),
+                            W( n*nb ), Z( kmax*nb ), tau( nb );
+    real_t err2 = Anorm * Anorm;
+    int64_t l = 0;
+    while (l < kmax && err2 > thresh2) {
+        int64_t ib = min( nb, kmax - l );
+        scalar_t* Qi = &Q[ l*m ];
+        rsvd_range( m, n, ib, q, A, lda, Q.data(), l,
+                    Qi, W.data(), Z.data(), tau.data(), iseed );
+        blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                    ib, n, m, one, Qi, m, A, lda, zero, &B[ l ], kmax );
+        real_t Bnorm = lapack::lange( Norm::Fro, ib, n, &B[ l ], kmax );
+        err2 -= Bnorm * Bnorm;
+        gflop += rsvd_range_gflop< scalar_t >( m, n, ib, q, l )
+               + G::gemm( ib, n, m ) + G::lange( Norm::Fro, ib, n );
+        l += ib;
+    }
+    err2 = max( err2, real_t( 0 ) );
+    lapack_instrument_gflop( gflop );
+
+    if (l > 0) {
+        // B = Ub Sb Vb^H
+        std::vector< scalar_t > Ub( l*l ), Vb( l*n );
+        std::vector< real_t > Sb( l );
+        int64_t info = lapack::gesdd( Job::SomeVec, l, n, B.data(), kmax,
+                                      Sb.data(), Ub.data(), l, Vb.data(), l );
+        if (info != 0)
+            return info;
+
+        // Drop the smallest singular values while the error is below tol.
+        int64_t r = l;
+        while (r > 0 && err2 + Sb[ r-1 ] * Sb[ r-1 ] <= thresh2) {
+            err2 += Sb[ r-1 ] * Sb[ r-1 ];
+            --r;
+        }
+
+        // U = Q Ub( :, 0:r-1 )
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                    m, r, l, one, Q.data(), m, Ub.data(), l, zero, U, ldu );
+        lapack_instrument_gflop( gflop + G::gemm( m, r, l ) );
+        std::copy( Sb.begin(), Sb.begin() + r, S );
+        lapack::lacpy( MatrixType::General, r, n, Vb.data(), l, VT, ldvt );
+        *k = r;
+    }
+    *error = std::sqrt( err2 ) / Anorm;
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t rsvd< float >(
+    int64_t m, int64_t n, int64_t k, int64_t p, int64_t q,
+    float const* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    int64_t* iseed );
+
+template
+int64_t rsvd< double >(
+    int64_t m, int64_t n, int64_t k, int64_t p, int64_t q,
+    double const* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    int64_t* iseed );
+
+template
+int64_t rsvd< std::complex<float> >(
+    int64_t m, int64_t n, int64_t k, int64_t p, int64_t q,
+    std::complex<float> const* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    int64_t* iseed );
+
+template
+int64_t rsvd< std::complex<double> >(
+    int64_t m, int64_t n, int64_t k, int64_t p, int64_t q,
+    std::complex<double> const* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    int64_t* iseed );
+
+template
+int64_t rsvd_adaptive< float >(
+    int64_t m, int64_t n, float tol,
+    int64_t kmax, int64_t nb, int64_t q,
+    float const* A, int64_t lda,
+    int64_t* k,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* error,
+    int64_t* iseed );
+
+template
+int64_t rsvd_adaptive< double >(
+    int64_t m, int64_t n, double tol,
+    int64_t kmax, int64_t nb, int64_t q,
+    double const* A, int64_t lda,
+    int64_t* k,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* error,
+    int64_t* iseed );
+
+template
+int64_t rsvd_adaptive< std::complex<float> >(
+    int64_t m, int64_t n, float tol,
+    int64_t kmax, int64_t nb, int64_t q,
+    std::complex<float> const* A, int64_t lda,
+    int64_t* k,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    float* error,
+    int64_t* iseed );
+
+template
+int64_t rsvd_adaptive< std::complex<double> >(
+    int64_t m, int64_t n, double tol,
+    int64_t kmax, int64_t nb, int64_t q,
+    std::complex<double> const* A, int64_t lda,
+    int64_t* k,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    double* error,
+    int64_t* iseed );
+
+}  // namespace lapack
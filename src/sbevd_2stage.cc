@@ -25,6 +25,9 @@ int64_t sbevd_2stage(
     float* W,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "sbevd_2stage", 's', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -76,6 +79,9 @@ int64_t sbevd_2stage(
     double* W,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "sbevd_2stage", 'd', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -26,6 +26,8 @@ int64_t sbevx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "sbevx", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -82,6 +84,8 @@ int64_t sbevx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "sbevx", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
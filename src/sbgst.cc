@@ -23,6 +23,8 @@ int64_t sbgst(
     float const* BB, int64_t ldbb,
     float* X, int64_t ldx )
 {
+    lapack_instrument( "sbgst", 's', 0, n, 0, internal::gflop_no_formula );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -56,6 +58,8 @@ int64_t sbgst(
     double const* BB, int64_t ldbb,
     double* X, int64_t ldx )
 {
+    lapack_instrument( "sbgst", 'd', 0, n, 0, internal::gflop_no_formula );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -24,6 +24,8 @@ int64_t sbgv(
     float* W,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "sbgv", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -59,6 +61,8 @@ int64_t sbgv(
     double* W,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "sbgv", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -24,6 +24,8 @@ int64_t sbgvd(
     float* W,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "sbgvd", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -83,6 +85,8 @@ int64_t sbgvd(
     double* W,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "sbgvd", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
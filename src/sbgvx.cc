@@ -27,6 +27,8 @@ int64_t sbgvx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "sbgvx", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -87,6 +89,8 @@ int64_t sbgvx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "sbgvx", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
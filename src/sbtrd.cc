@@ -24,6 +24,9 @@ int64_t sbtrd(
     float* E,
     float* Q, int64_t ldq )
 {
+    lapack_instrument( "sbtrd", 's', 0, n, 0,
+                       Gflop< float >::sbtrd( jobz, n, kd ) );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -57,6 +60,9 @@ int64_t sbtrd(
     double* E,
     double* Q, int64_t ldq )
 {
+    lapack_instrument( "sbtrd", 'd', 0, n, 0,
+                       Gflop< double >::sbtrd( jobz, n, kd ) );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -21,6 +21,8 @@ void sfrk(
     float const* A, int64_t lda, float beta,
     float* C )
 {
+    lapack_instrument( "sfrk", 's', 0, n, k, Gflop< float >::syrk( n, k ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
@@ -41,6 +43,8 @@ void sfrk(
     double const* A, int64_t lda, double beta,
     double* C )
 {
+    lapack_instrument( "sfrk", 'd', 0, n, k, Gflop< double >::syrk( n, k ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
@@ -23,6 +23,8 @@ int64_t spcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "spcon", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -58,6 +60,8 @@ int64_t spcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "spcon", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -93,6 +97,8 @@ int64_t spcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "spcon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -126,6 +132,8 @@ int64_t spcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "spcon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
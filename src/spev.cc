@@ -23,6 +23,8 @@ int64_t spev(
     float* W,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "spev", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -52,6 +54,8 @@ int64_t spev(
     double* W,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "spev", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
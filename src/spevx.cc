@@ -25,6 +25,8 @@ int64_t spevx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "spevx", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -76,6 +78,8 @@ int64_t spevx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "spevx", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -21,6 +21,8 @@ int64_t spgst(
     float* AP,
     float const* BP )
 {
+    lapack_instrument( "spgst", 's', 0, n, 0, Gflop< float >::sygst( n ) );
+
     lapack_int itype_ = to_lapack_int( itype );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -43,6 +45,8 @@ int64_t spgst(
     double* AP,
     double const* BP )
 {
+    lapack_instrument( "spgst", 'd', 0, n, 0, Gflop< double >::sygst( n ) );
+
     lapack_int itype_ = to_lapack_int( itype );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -24,6 +24,8 @@ int64_t spgv(
     float* W,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "spgv", 's', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -56,6 +58,8 @@ int64_t spgv(
     double* W,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "spgv", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
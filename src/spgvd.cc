@@ -24,6 +24,8 @@ int64_t spgvd(
     float* W,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "spgvd", 's', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -77,6 +79,8 @@ int64_t spgvd(
     double* W,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "spgvd", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -26,6 +26,8 @@ int64_t spgvx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "spgvx", 's', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -80,6 +82,8 @@ int64_t spgvx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "spgvx", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
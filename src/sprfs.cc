@@ -27,6 +27,9 @@ int64_t sprfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "sprfs", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -74,6 +77,9 @@ int64_t sprfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "sprfs", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -121,6 +127,9 @@ int64_t sprfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "sprfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -168,6 +177,9 @@ int64_t sprfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "sprfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -23,6 +23,9 @@ int64_t spsv(
     int64_t* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "spsv", 's', 0, n, nrhs,
+                       Gflop< float >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -58,6 +61,9 @@ int64_t spsv(
     int64_t* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "spsv", 'd', 0, n, nrhs,
+                       Gflop< double >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -93,6 +99,9 @@ int64_t spsv(
     int64_t* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "spsv", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -128,6 +137,9 @@ int64_t spsv(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "spsv", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -28,6 +28,9 @@ int64_t spsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "spsvx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -80,6 +83,9 @@ int64_t spsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "spsvx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -132,6 +138,9 @@ int64_t spsvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "spsvx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -184,6 +193,9 @@ int64_t spsvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "spsvx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -23,6 +23,8 @@ int64_t sptrd(
     float* E,
     float* tau )
 {
+    lapack_instrument( "sptrd", 's', 0, n, 0, Gflop< float >::sytrd( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -48,6 +50,8 @@ int64_t sptrd(
     double* E,
     double* tau )
 {
+    lapack_instrument( "sptrd", 'd', 0, n, 0, Gflop< double >::sytrd( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -22,6 +22,8 @@ int64_t sptrf(
     float* AP,
     int64_t* ipiv )
 {
+    lapack_instrument( "sptrf", 's', 0, n, 0, Gflop< float >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -53,6 +55,8 @@ int64_t sptrf(
     double* AP,
     int64_t* ipiv )
 {
+    lapack_instrument( "sptrf", 'd', 0, n, 0, Gflop< double >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -84,6 +88,9 @@ int64_t sptrf(
     std::complex<float>* AP,
     int64_t* ipiv )
 {
+    lapack_instrument( "sptrf", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -115,6 +122,9 @@ int64_t sptrf(
     std::complex<double>* AP,
     int64_t* ipiv )
 {
+    lapack_instrument( "sptrf", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
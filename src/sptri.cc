@@ -22,6 +22,8 @@ int64_t sptri(
     float* AP,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sptri", 's', 0, n, 0, Gflop< float >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -54,6 +56,8 @@ int64_t sptri(
     double* AP,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sptri", 'd', 0, n, 0, Gflop< double >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -86,6 +90,9 @@ int64_t sptri(
     std::complex<float>* AP,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sptri", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -118,6 +125,9 @@ int64_t sptri(
     std::complex<double>* AP,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sptri", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
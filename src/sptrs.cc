@@ -23,6 +23,9 @@ int64_t sptrs(
     int64_t const* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "sptrs", 's', 0, n, nrhs,
+                       Gflop< float >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -55,6 +58,9 @@ int64_t sptrs(
     int64_t const* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "sptrs", 'd', 0, n, nrhs,
+                       Gflop< double >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -87,6 +93,9 @@ int64_t sptrs(
     int64_t const* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "sptrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -119,6 +128,9 @@ int64_t sptrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "sptrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -23,6 +23,8 @@ int64_t stedc(
     float* E,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "stedc", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -71,6 +73,8 @@ int64_t stedc(
     double* E,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "stedc", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -119,6 +123,8 @@ int64_t stedc(
     float* E,
     std::complex<float>* Z, int64_t ldz )
 {
+    lapack_instrument( "stedc", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -172,6 +178,8 @@ int64_t stedc(
     double* E,
     std::complex<double>* Z, int64_t ldz )
 {
+    lapack_instrument( "stedc", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -0,0 +1,668 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Computes Y = X( :, cols ) * Qm, the vector update in the merge step of
+/// divide-and-conquer. X is m-by-*, Qm is k-by-k, Y is m-by-k.
+/// Column cols[ i ] of X has structure types[ i ]:
+///     0: zero below row rtop (from the top subproblem),
+///     1: dense (rotated between subproblems),
+///     2: zero above row rtop (from the bottom subproblem),
+///    -1: excluded, i.e., treated as zero.
+/// Columns are grouped by type so the top and bottom rows of Y are each
+/// computed by a single gemm that skips the known zero blocks.
+///
+template <typename real_t>
+void dc_update_vectors(
+    int64_t m, int64_t rtop, int64_t k,
+    int64_t const* cols, int const* types,
+    real_t const* X, int64_t ldx,
+    real_t const* Qm, int64_t ldqm,
+    real_t* Y, int64_t ldy )
+{
+    const real_t zero = 0;
+    const real_t one  = 1;
+
+    // Order columns as [ top only, dense, bottom only ].
+    std::vector< int64_t > perm;
+    perm.reserve( k );
+    int64_t cnt[ 3 ] = { 0, 0, 0 };
+    for (int t = 0; t < 3; ++t) {
+        for (int64_t i = 0; i < k; ++i) {
+            if (types[ i ] == t) {
+                perm.push_back( i );
+                ++cnt[ t ];
+            }
+        }
+    }
+    int64_t kk = perm.size();
+    int64_t ldxc = max( 1, m );
+    int64_t ldqc = max( 1, kk );
+    std::vector< real_t > Xc( ldxc * max( 1, kk ) );
+    std::vector< real_t > Qc( ldqc * max( 1, k ) );
+    for (int64_t g = 0; g < kk; ++g) {
+        blas::copy( m, &X[ cols[ perm[ g ] ]*ldx ], 1, &Xc[ g*ldxc ], 1 );
+        blas::copy( k, &Qm[ perm[ g ] ], ldqm, &Qc[ g ], ldqc );
+    }
+
+    int64_t mbot = m - rtop;
+    int64_t ktop = cnt[ 0 ] + cnt[ 1 ];
+    int64_t kbot = cnt[ 1 ] + cnt[ 2 ];
+    if (rtop > 0) {
+        if (ktop > 0) {
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                        rtop, k, ktop,
+                        one,  &Xc[ 0 ], ldxc,
+                              &Qc[ 0 ], ldqc,
+                        zero, Y, ldy );
+        }
+        else {
+            lapack::laset( MatrixType::General, rtop, k, zero, zero, Y, ldy );
+        }
+    }
+    if (mbot > 0) {
+        if (kbot > 0) {
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                        mbot, k, kbot,
+                        one,  &Xc[ rtop + cnt[ 0 ]*ldxc ], ldxc,
+                              &Qc[ cnt[ 0 ] ], ldqc,
+                        zero, &Y[ rtop ], ldy );
+        }
+        else {
+            lapack::laset( MatrixType::General, mbot, k, zero, zero,
+                           &Y[ rtop ], ldy );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Permutes columns of the m-by-n matrix A in place so that new column j
+/// is old column perm[ j ], following the cycles of the permutation.
+///
+template <typename scalar_t>
+void dc_permute_columns(
+    int64_t m, int64_t n, int64_t const* perm,
+    scalar_t* A, int64_t lda )
+{
+    std::vector< bool > done( n, false );
+    std::vector< scalar_t > tmp( m );
+    for (int64_t j = 0; j < n; ++j) {
+        if (done[ j ] || perm[ j ] == j) {
+            done[ j ] = true;
+            continue;
+        }
+        blas::copy( m, &A[ j*lda ], 1, &tmp[ 0 ], 1 );
+        int64_t dst = j;
+        int64_t src = perm[ j ];
+        while (src != j) {
+            blas::copy( m, &A[ src*lda ], 1, &A[ dst*lda ], 1 );
+            done[ dst ] = true;
+            dst = src;
+            src = perm[ src ];
+        }
+        blas::copy( m, &tmp[ 0 ], 1, &A[ dst*lda ], 1 );
+        done[ dst ] = true;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void dc_update_vectors< float >(
+    int64_t m, int64_t rtop, int64_t k,
+    int64_t const* cols, int const* types,
+    float const* X, int64_t ldx,
+    float const* Qm, int64_t ldqm,
+    float* Y, int64_t ldy );
+
+template
+void dc_update_vectors< double >(
+    int64_t m, int64_t rtop, int64_t k,
+    int64_t const* cols, int const* types,
+    double const* X, int64_t ldx,
+    double const* Qm, int64_t ldqm,
+    double* Y, int64_t ldy );
+
+template
+void dc_permute_columns< float >(
+    int64_t m, int64_t n, int64_t const* perm,
+    float* A, int64_t lda );
+
+template
+void dc_permute_columns< double >(
+    int64_t m, int64_t n, int64_t const* perm,
+    double* A, int64_t lda );
+
+}  // namespace internal
+
+// Subproblems of at most this size are solved directly by steqr.
+static const int64_t stedc_mt_leaf_size = 32;
+
+//------------------------------------------------------------------------------
+// Node of the divide-and-conquer tree, covering rows and columns
+// [ offset, offset + n ). Internal nodes are split after row n1 - 1;
+// leaves have n1 = 0. height is 0 for leaves.
+struct StedcNode {
+    int64_t offset, n, n1, height;
+};
+
+//------------------------------------------------------------------------------
+// Recursively splits [ offset, offset + n ) into leaves of size at most
+// leaf_size, appending internal nodes to merges. Returns the node height.
+static int64_t stedc_mt_split(
+    int64_t offset, int64_t n,
+    std::vector< StedcNode >& leaves,
+    std::vector< StedcNode >& merges )
+{
+    if (n <= stedc_mt_leaf_size) {
+        leaves.push_back( { offset, n, 0, 0 } );
+        return 0;
+    }
+    int64_t n1 = n / 2;
+    int64_t h1 = stedc_mt_split( offset,      n1,     leaves, merges );
+    int64_t h2 = stedc_mt_split( offset + n1, n - n1, leaves, merges );
+    int64_t height = max( h1, h2 ) + 1;
+    merges.push_back( { offset, n, n1, height } );
+    return height;
+}
+
+//------------------------------------------------------------------------------
+// Merges the eigen-decompositions of the two halves of an n-by-n
+// subproblem, split after row n1 - 1 with coupling beta = E( n1 - 1 ).
+// On entry, D( 0:n1-1 ) and D( n1:n-1 ) are the eigenvalues of each half,
+// in ascending order, and Q is block diagonal with their eigenvectors.
+// On exit, D and Q are the eigenvalues, in ascending order, and
+// eigenvectors of the whole subproblem.
+// Same algorithm as LAPACK's laed1: deflation (laed2), then the secular
+// equation and Gu-Eisenstat eigenvectors (laed3).
+// If parallel, OpenMP threads are used inside the merge; otherwise the
+// caller is expected to run several merges concurrently.
+// Returns 0, or > 0 if laed4 failed.
+template <typename real_t>
+static int64_t stedc_mt_merge(
+    int64_t n, int64_t n1, real_t beta,
+    real_t* D, real_t* Q, int64_t ldq, bool parallel )
+{
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    int64_t n2 = n - n1;
+
+    // z = [ last row of Q1, sign( beta ) first row of Q2 ] / sqrt( 2 )
+    // has unit norm; with rho = 2 |beta|, the merged matrix is
+    // diag( D ) + rho z z^T.
+    std::vector< real_t > z( n );
+    blas::copy( n1, &Q[ n1 - 1 ], ldq, &z[ 0 ], 1 );
+    blas::copy( n2, &Q[ n1 + n1*ldq ], ldq, &z[ n1 ], 1 );
+    if (beta < 0)
+        blas::scal( n2, real_t( -1 ), &z[ n1 ], 1 );
+    blas::scal( n, 1 / std::sqrt( real_t( 2 ) ), &z[ 0 ], 1 );
+    real_t rho = std::abs( 2*beta );
+
+    // Merge the two ascending lists of eigenvalues.
+    std::vector< int64_t > indx( n );
+    for (int64_t i = 0, j = n1, c = 0; c < n; ++c) {
+        if (j >= n || (i < n1 && D[ i ] <= D[ j ]))
+            indx[ c ] = i++;
+        else
+            indx[ c ] = j++;
+    }
+
+    real_t dmax = 0, zmax = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        dmax = max( dmax, std::abs( D[ i ] ) );
+        zmax = max( zmax, std::abs( z[ i ] ) );
+    }
+    real_t tol = 8 * eps * max( dmax, zmax );
+
+    // Deflate eigenvalues with small z components, and pairs of close
+    // eigenvalues by a Givens rotation that zeros one z component.
+    // coltyp tracks the structure of each column of Q, see
+    // internal::dc_update_vectors.
+    std::vector< int > coltyp( n );
+    for (int64_t i = 0; i < n; ++i)
+        coltyp[ i ] = (i < n1 ? 0 : 2);
+
+    std::vector< int64_t > nondefl, defl;
+    nondefl.reserve( n );
+    defl.reserve( n );
+    int64_t pj = -1;
+    for (int64_t j = 0; j < n; ++j) {
+        int64_t nj = indx[ j ];
+        if (rho * std::abs( z[ nj ] ) <= tol) {
+            defl.push_back( nj );
+        }
+        else if (pj < 0) {
+            pj = nj;
+        }
+        else {
+            real_t s = z[ pj ];
+            real_t c = z[ nj ];
+            real_t tau = std::hypot( c, s );
+            real_t t = D[ nj ] - D[ pj ];
+            c /= tau;
+            s = -s / tau;
+            if (std::abs( t*c*s ) <= tol) {
+                z[ nj ] = tau;
+                z[ pj ] = 0;
+                if (coltyp[ nj ] != coltyp[ pj ])
+                    coltyp[ nj ] = 1;
+                blas::rot( n, &Q[ pj*ldq ], 1, &Q[ nj*ldq ], 1, c, s );
+                t       = D[ pj ]*c*c + D[ nj ]*s*s;
+                D[ nj ] = D[ pj ]*s*s + D[ nj ]*c*c;
+                D[ pj ] = t;
+                defl.push_back( pj );
+            }
+            else {
+                nondefl.push_back( pj );
+            }
+            pj = nj;
+        }
+    }
+    if (pj >= 0)
+        nondefl.push_back( pj );
+
+    // Solve the secular equation for the k non-deflated eigenvalues.
+    int64_t k = nondefl.size();
+    int64_t lds = max( 1, k );
+    std::vector< real_t > dlamda( k ), w( k ), lambda( k );
+    std::vector< real_t > S( lds * k );
+    for (int64_t i = 0; i < k; ++i) {
+        dlamda[ i ] = D[ nondefl[ i ] ];
+        w[ i ] = z[ nondefl[ i ] ];
+    }
+    if (k > 0) {
+        int64_t info = laed4_all( k, &dlamda[ 0 ], &w[ 0 ], &S[ 0 ], lds,
+                                  rho, &lambda[ 0 ] );
+        if (info != 0)
+            return info;
+    }
+
+    // For k <= 2, laed4 returns the eigenvectors in S. Otherwise, recompute
+    // z using the Gu-Eisenstat formula so the eigenvectors are numerically
+    // orthogonal, then form eigenvectors of diag( dlamda ) + rho z z^T.
+    if (k >= 3) {
+        std::vector< real_t > what( k );
+        #pragma omp parallel for schedule( static ) if (parallel)
+        for (int64_t i = 0; i < k; ++i) {
+            real_t wi = S[ i + i*lds ];
+            for (int64_t j = 0; j < k; ++j) {
+                if (j != i)
+                    wi *= S[ i + j*lds ] / (dlamda[ i ] - dlamda[ j ]);
+            }
+            what[ i ] = std::copysign( std::sqrt( -wi ), w[ i ] );
+        }
+
+        #pragma omp parallel for schedule( static ) if (parallel)
+        for (int64_t j = 0; j < k; ++j) {
+            real_t* Sj = &S[ j*lds ];
+            for (int64_t i = 0; i < k; ++i)
+                Sj[ i ] = what[ i ] / Sj[ i ];
+            real_t nrm = blas::nrm2( k, Sj, 1 );
+            blas::scal( k, 1 / nrm, Sj, 1 );
+        }
+    }
+
+    // Qk = Q( :, nondefl ) * S.
+    std::vector< int > types( k );
+    for (int64_t i = 0; i < k; ++i)
+        types[ i ] = coltyp[ nondefl[ i ] ];
+    std::vector< real_t > Qk( n * max( 1, k ) );
+    if (k > 0) {
+        internal::dc_update_vectors(
+            n, n1, k, &nondefl[ 0 ], &types[ 0 ], Q, ldq,
+            &S[ 0 ], lds, &Qk[ 0 ], n );
+    }
+
+    // Merge the new and deflated eigenpairs into ascending order.
+    std::stable_sort( defl.begin(), defl.end(),
+                      [D]( int64_t a, int64_t b ) { return D[ a ] < D[ b ]; } );
+    int64_t nd = defl.size();
+    std::vector< real_t > Qd( n * max( 1, nd ) ), dd( nd );
+    for (int64_t j = 0; j < nd; ++j) {
+        dd[ j ] = D[ defl[ j ] ];
+        blas::copy( n, &Q[ defl[ j ]*ldq ], 1, &Qd[ j*n ], 1 );
+    }
+
+    std::vector< real_t const* > src( n );
+    for (int64_t i = 0, j = 0, c = 0; c < n; ++c) {
+        if (j >= nd || (i < k && lambda[ i ] <= dd[ j ])) {
+            D[ c ] = lambda[ i ];
+            src[ c ] = &Qk[ i*n ];
+            ++i;
+        }
+        else {
+            D[ c ] = dd[ j ];
+            src[ c ] = &Qd[ j*n ];
+            ++j;
+        }
+    }
+    #pragma omp parallel for schedule( static ) if (parallel)
+    for (int64_t c = 0; c < n; ++c)
+        blas::copy( n, src[ c ], 1, &Q[ c*ldq ], 1 );
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Computes all eigenvalues and eigenvectors of the n-by-n tridiagonal
+// matrix (D, E) into Q, ldq >= n, in ascending order.
+template <typename real_t>
+static int64_t stedc_mt_solve(
+    int64_t n, real_t* D, real_t* E, real_t* Q, int64_t ldq )
+{
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    const real_t zero = 0;
+    const real_t one  = 1;
+
+    lapack::laset( MatrixType::General, n, n, zero, zero, Q, ldq );
+
+    // Split into unreduced blocks at negligible off-diagonals, scale each
+    // block to unit max norm, and build its divide-and-conquer tree.
+    std::vector< int64_t > block_start, block_size;
+    std::vector< real_t > block_norm;
+    std::vector< StedcNode > leaves, merges;
+    int64_t max_height = 0;
+    for (int64_t start = 0; start < n; ) {
+        int64_t end = start;
+        while (end < n - 1) {
+            real_t tiny = eps * std::sqrt( std::abs( D[ end ] ) )
+                              * std::sqrt( std::abs( D[ end + 1 ] ) );
+            if (std::abs( E[ end ] ) <= tiny)
+                break;
+            ++end;
+        }
+        int64_t nb = end - start + 1;
+        real_t orgnrm = lapack::lanst( Norm::Max, nb, &D[ start ], &E[ start ] );
+        if (orgnrm > 0) {
+            lapack::lascl( MatrixType::General, 0, 0, orgnrm, one, nb, 1,
+                           &D[ start ], nb );
+            if (nb > 1) {
+                lapack::lascl( MatrixType::General, 0, 0, orgnrm, one, nb - 1, 1,
+                               &E[ start ], nb - 1 );
+            }
+        }
+        block_start.push_back( start );
+        block_size.push_back( nb );
+        block_norm.push_back( orgnrm );
+        max_height = max( max_height,
+                          stedc_mt_split( start, nb, leaves, merges ) );
+        start = end + 1;
+    }
+
+    // Tear: T = diag( T1, T2 ) + |beta| u u^T, u = e_{n1} + sign( beta ) e_{n1+1}.
+    for (auto const& node : merges) {
+        int64_t cut = node.offset + node.n1;
+        real_t beta = std::abs( E[ cut - 1 ] );
+        D[ cut - 1 ] -= beta;
+        D[ cut ]     -= beta;
+    }
+
+    // Solve leaves. steqr returns eigenvalues in ascending order.
+    int64_t nleaves = leaves.size();
+    std::vector< int64_t > info_leaf( nleaves, 0 );
+    #pragma omp parallel for schedule( dynamic )
+    for (int64_t i = 0; i < nleaves; ++i) {
+        int64_t o = leaves[ i ].offset;
+        info_leaf[ i ] = lapack::steqr( Job::Vec, leaves[ i ].n,
+                                        &D[ o ], &E[ o ], &Q[ o + o*ldq ], ldq );
+    }
+    for (int64_t i = 0; i < nleaves; ++i) {
+        if (info_leaf[ i ] != 0) {
+            int64_t o = leaves[ i ].offset;
+            return (o + 1)*(n + 1) + (o + leaves[ i ].n);
+        }
+    }
+
+    // Merge level by level. All merges at one height are independent.
+    // With at least as many merges as threads, run merges concurrently;
+    // near the root, run merges one at a time, each multithreaded.
+    #ifdef _OPENMP
+        int64_t nthreads = omp_get_max_threads();
+    #else
+        int64_t nthreads = 1;
+    #endif
+    for (int64_t height = 1; height <= max_height; ++height) {
+        std::vector< StedcNode > level;
+        for (auto const& node : merges) {
+            if (node.height == height)
+                level.push_back( node );
+        }
+        int64_t nlevel = level.size();
+        bool concurrent = nlevel >= nthreads;
+        std::vector< int64_t > info_merge( nlevel, 0 );
+        #pragma omp parallel for schedule( dynamic ) if (concurrent)
+        for (int64_t i = 0; i < nlevel; ++i) {
+            int64_t o = level[ i ].offset;
+            info_merge[ i ] = stedc_mt_merge(
+                level[ i ].n, level[ i ].n1, E[ o + level[ i ].n1 - 1 ],
+                &D[ o ], &Q[ o + o*ldq ], ldq, ! concurrent );
+        }
+        for (int64_t i = 0; i < nlevel; ++i) {
+            if (info_merge[ i ] != 0) {
+                int64_t o = level[ i ].offset;
+                return (o + 1)*(n + 1) + (o + level[ i ].n);
+            }
+        }
+    }
+
+    // Undo scaling.
+    int64_t nblocks = block_start.size();
+    for (int64_t b = 0; b < nblocks; ++b) {
+        if (block_norm[ b ] > 0) {
+            lapack::lascl( MatrixType::General, 0, 0, one, block_norm[ b ],
+                           block_size[ b ], 1, &D[ block_start[ b ] ],
+                           block_size[ b ] );
+        }
+    }
+
+    // Blocks are sorted individually; sort all eigenvalues.
+    if (nblocks > 1) {
+        std::vector< int64_t > perm( n );
+        for (int64_t i = 0; i < n; ++i)
+            perm[ i ] = i;
+        std::stable_sort( perm.begin(), perm.end(),
+                          [D]( int64_t a, int64_t b ) { return D[ a ] < D[ b ]; } );
+        std::vector< real_t > Dsort( n );
+        for (int64_t i = 0; i < n; ++i)
+            Dsort[ i ] = D[ perm[ i ] ];
+        std::copy( Dsort.begin(), Dsort.end(), D );
+        internal::dc_permute_columns( n, n, &perm[ 0 ], Q, ldq );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes all eigenvalues and, optionally, eigenvectors of a
+/// symmetric tridiagonal matrix using a native, multithreaded
+/// divide and conquer method.
+///
+/// Like `lapack::stedc`, the tridiagonal matrix is split into unreduced
+/// blocks, then each block is recursively torn into halves by rank-one
+/// modifications, down to subproblems of size 32. Unlike LAPACK, where
+/// only the BLAS in the final merges are multithreaded, here the whole
+/// tree is run in parallel using OpenMP: the leaves are solved
+/// concurrently using `lapack::steqr`, and merges at each level of the
+/// tree are run concurrently while there are enough of them for all the
+/// threads. Near the root, each merge is itself multithreaded: the
+/// secular equation is solved by `lapack::laed4_all`, and the eigenvector
+/// updates use gemm. Each merge follows LAPACK's laed1: deflation of
+/// small z components and close eigenvalues, then the Gu-Eisenstat
+/// formula for numerically orthogonal eigenvectors.
+///
+/// With compz = UpdateVec, this can replace `lapack::stedc` in
+/// heevd-style drivers: reduce A to tridiagonal using `lapack::hetrd`,
+/// form Q using `lapack::ungtr`, then call stedc_mt to compute the
+/// eigenvectors of A.
+///
+/// Workspace of about 3 n^2 reals is allocated.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] compz
+///     - lapack::Job::NoVec:
+///         Compute eigenvalues only, using `lapack::sterf`.
+///     - lapack::Job::Vec:
+///         Compute eigenvectors of tridiagonal matrix also.
+///     - lapack::Job::UpdateVec:
+///         Compute eigenvalues and eigenvectors of original
+///         Hermitian matrix. On entry, Z contains the unitary
+///         matrix used to reduce the original matrix to tridiagonal form.
+///
+/// @param[in] n
+///     The dimension of the symmetric tridiagonal matrix. n >= 0.
+///
+/// @param[in,out] D
+///     The vector D of length n.
+///     On entry, the diagonal elements of the tridiagonal matrix.
+///     On exit, if successful, the eigenvalues in ascending order.
+///
+/// @param[in,out] E
+///     The vector E of length n-1.
+///     On entry, the subdiagonal elements of the tridiagonal matrix.
+///     On exit, E has been destroyed.
+///
+/// @param[in,out] Z
+///     The n-by-n matrix Z, stored in an ldz-by-n array.
+///     - On entry, if compz = UpdateVec, then Z contains the unitary
+///     matrix used in the reduction to tridiagonal form.
+///     - On exit, if successful, and compz = Vec, Z contains the
+///     orthonormal eigenvectors of the symmetric tridiagonal matrix,
+///     and if compz = UpdateVec, Z contains the orthonormal eigenvectors
+///     of the original Hermitian matrix.
+///     - If compz = NoVec, then Z is not referenced.
+///
+/// @param[in] ldz
+///     The leading dimension of the array Z. ldz >= 1.
+///     If eigenvectors are desired, then ldz >= max(1,n).
+///
+/// @return = 0: successful exit.
+/// @return > 0: The algorithm failed to compute an eigenvalue while
+///     working on the submatrix lying in rows and columns
+///     info/(n+1) through mod(info,n+1).
+///
+/// @ingroup heev_computational
+template <typename scalar_t>
+int64_t stedc_mt(
+    lapack::Job compz, int64_t n,
+    blas::real_type< scalar_t >* D,
+    blas::real_type< scalar_t >* E,
+    scalar_t* Z, int64_t ldz )
+{
+    lapack_instrument( "stedc_mt", internal::precision_char< scalar_t >(),
+                       0, n, 0, internal::gflop_data_dependent );
+
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( compz != Job::NoVec &&
+                     compz != Job::Vec &&
+                     compz != Job::UpdateVec );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldz < 1 || (compz != Job::NoVec && ldz < n) );
+
+    if (n == 0)
+        return 0;
+
+    if (compz == Job::NoVec)
+        return lapack::sterf( n, D, E );
+
+    if (n == 1) {
+        if (compz == Job::Vec)
+            Z[ 0 ] = 1;
+        return 0;
+    }
+
+    // For real Z and compz = Vec, compute eigenvectors in place.
+    bool in_place = (compz == Job::Vec && ! blas::is_complex< scalar_t >::value);
+    std::vector< real_t > Qwork;
+    real_t* Q;
+    int64_t ldq;
+    if (in_place) {
+        Q = reinterpret_cast< real_t* >( Z );
+        ldq = ldz;
+    }
+    else {
+        Qwork.resize( n*n );
+        Q = &Qwork[ 0 ];
+        ldq = n;
+    }
+
+    int64_t info = stedc_mt_solve( n, D, E, Q, ldq );
+    if (info != 0)
+        return info;
+
+    if (compz == Job::Vec) {
+        if (! in_place) {
+            for (int64_t j = 0; j < n; ++j)
+                for (int64_t i = 0; i < n; ++i)
+                    Z[ i + j*ldz ] = Q[ i + j*ldq ];
+        }
+    }
+    else {
+        // Z = Z Q. A complex Z is viewed as a real (2n)-by-n matrix.
+        const real_t zero = 0;
+        const real_t one  = 1;
+        int64_t r = sizeof( scalar_t ) / sizeof( real_t );
+        real_t* Zr = reinterpret_cast< real_t* >( Z );
+        std::vector< real_t > W( r*n * n );
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                    r*n, n, n,
+                    one,  Zr, r*ldz,
+                          Q, ldq,
+                    zero, &W[ 0 ], r*n );
+        lapack::lacpy( MatrixType::General, r*n, n, &W[ 0 ], r*n, Zr, r*ldz );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t stedc_mt< float >(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz );
+
+template
+int64_t stedc_mt< double >(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz );
+
+template
+int64_t stedc_mt< std::complex<float> >(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    std::complex<float>* Z, int64_t ldz );
+
+template
+int64_t stedc_mt< std::complex<double> >(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    std::complex<double>* Z, int64_t ldz );
+
+}  // namespace lapack
@@ -26,6 +26,8 @@ int64_t stegr(
     float* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "stegr", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
@@ -96,6 +98,8 @@ int64_t stegr(
     double* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "stegr", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
@@ -166,6 +170,8 @@ int64_t stegr(
     std::complex<float>* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "stegr", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
@@ -236,6 +242,8 @@ int64_t stegr(
     std::complex<double>* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "stegr", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
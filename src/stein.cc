@@ -27,6 +27,8 @@ int64_t stein(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "stein", 's', m, n, 0, internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     #ifndef LAPACK_ILP64
@@ -88,6 +90,8 @@ int64_t stein(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "stein", 'd', m, n, 0, internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     #ifndef LAPACK_ILP64
@@ -149,6 +153,8 @@ int64_t stein(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "stein", 'c', m, n, 0, internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     #ifndef LAPACK_ILP64
@@ -210,6 +216,8 @@ int64_t stein(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "stein", 'z', m, n, 0, internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     #ifndef LAPACK_ILP64
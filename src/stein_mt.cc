@@ -0,0 +1,492 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+// Target number of tasks per thread, for load balance.
+static const int64_t stein_mt_tasks_per_thread = 4;
+
+// Same as LAPACK's stein: max iterations, and extra iterations after the
+// stopping criterion is met.
+static const int stein_mt_maxits = 5;
+static const int stein_mt_extra  = 2;
+
+// A group of nearly equal eigenvalues shares one shift if no other
+// eigenvalue is within this many times the shift's distance to the group.
+static const int stein_mt_isolation = 100;
+
+//------------------------------------------------------------------------------
+// Overloads to select the LAPACK lagtf and lagts precisions.
+static void lagtf_fortran(
+    lapack_int const* n, float* a, float const* lambda,
+    float* b, float* c, float const* tol,
+    float* d, lapack_int* in, lapack_int* info )
+{
+    LAPACK_slagtf( n, a, lambda, b, c, tol, d, in, info );
+}
+
+static void lagtf_fortran(
+    lapack_int const* n, double* a, double const* lambda,
+    double* b, double* c, double const* tol,
+    double* d, lapack_int* in, lapack_int* info )
+{
+    LAPACK_dlagtf( n, a, lambda, b, c, tol, d, in, info );
+}
+
+static void lagts_fortran(
+    lapack_int const* job, lapack_int const* n,
+    float const* a, float const* b, float const* c, float const* d,
+    lapack_int const* in, float* y, float* tol, lapack_int* info )
+{
+    LAPACK_slagts( job, n, a, b, c, d, in, y, tol, info );
+}
+
+static void lagts_fortran(
+    lapack_int const* job, lapack_int const* n,
+    double const* a, double const* b, double const* c, double const* d,
+    lapack_int const* in, double* y, double* tol, lapack_int* info )
+{
+    LAPACK_dlagts( job, n, a, b, c, d, in, y, tol, info );
+}
+
+//------------------------------------------------------------------------------
+// Group of eigenvalues, positions [ begin, end ) in the sorted order,
+// all in the same block, rows [ row, row + nb ).
+// Either a cluster, or a run of well separated eigenvalues.
+struct SteinTask {
+    int64_t begin, end;
+    int64_t row, nb;
+    bool cluster;
+};
+
+//------------------------------------------------------------------------------
+// Eigenvectors of a cluster of k close eigenvalues w of the nb-by-nb
+// tridiagonal block (d, e), by block inverse iteration.
+// Each column is iterated with its own shift as in stein, but the block is
+// orthonormalized with a BLAS-3 QR instead of Gram-Schmidt, then a
+// Rayleigh-Ritz step on the converged subspace separates the vectors.
+// Sets conv[ j ] = 0 for columns not converged in maxits iterations.
+template <typename real_t>
+static void stein_mt_cluster(
+    int64_t nb, real_t const* d, real_t const* e, real_t onenrm,
+    int64_t k, real_t const* w,
+    real_t* X, int64_t ldx, char* conv )
+{
+    const real_t zero = 0;
+    const real_t one  = 1;
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    const real_t dtpcrt = std::sqrt( real_t( 0.1 ) / nb );
+
+    lapack_int nb_ = to_lapack_int( nb );
+
+    // Shifts. Eigenvalues closer than tight, e.g., equal to working
+    // precision, cannot be told apart by their own shifts: the iterates
+    // collapse onto the same vectors and QR then amplifies rounding errors.
+    // Instead, each group of such eigenvalues gets one shift just below
+    // the group, at a distance equal to its width, so its iterates span
+    // the group's invariant subspace and stay well conditioned.
+    // Rayleigh-Ritz at the end separates the vectors.
+    // This requires that no other eigenvalue of T, requested or not, is
+    // near the shift, which is checked by Sturm counts. Otherwise, equal
+    // eigenvalues are perturbed as in stein.
+    const real_t tight = std::sqrt( eps ) * onenrm;
+    std::vector< real_t > shift( k );
+    for (int64_t j = 0; j < k; ) {
+        int64_t j2 = j + 1;
+        while (j2 < k && w[ j2 ] - w[ j2-1 ] <= tight)
+            ++j2;
+
+        bool isolated = false;
+        if (j2 - j > 1) {
+            real_t width = w[ j2-1 ] - w[ j ];
+            real_t pertol = 10 * eps * max( std::abs( w[ j ] ), onenrm );
+            real_t s = w[ j ] - max( width, pertol );
+            real_t r = stein_mt_isolation * (w[ j2-1 ] - s);
+            isolated = sturm( nb, d, e, w[ j2-1 ] + r )
+                     - sturm( nb, d, e, s - r ) == j2 - j;
+            if (isolated) {
+                for (int64_t i = j; i < j2; ++i)
+                    shift[ i ] = s;
+            }
+        }
+        if (! isolated) {
+            for (int64_t i = j; i < j2; ++i) {
+                shift[ i ] = w[ i ];
+                real_t pertol = 10 * std::abs( eps * w[ i ] );
+                if (i > 0 && shift[ i ] - shift[ i-1 ] < pertol)
+                    shift[ i ] = shift[ i-1 ] + pertol;
+            }
+        }
+        j = j2;
+    }
+
+    // LU factors of T - shift_j I are recomputed as needed, in O(nb),
+    // rather than stored for the whole cluster.
+    std::vector< real_t > a( nb ), b( nb ), c( nb ), dd( nb );
+    std::vector< lapack_int > in( nb );
+
+    // Random starting vectors, as in stein.
+    int64_t iseed[4] = { 1, 1, 1, 1 };
+    for (int64_t j = 0; j < k; ++j)
+        lapack::larnv( 2, iseed, nb, &X[ j*ldx ] );
+
+    std::vector< int > nrmchk( k, 0 );
+    std::vector< real_t > tau( k ), rdiag( k );
+    for (int its = 0; its < stein_mt_maxits; ++its) {
+        // Solve (T - shift_j I) x_j = scaled x_j.
+        for (int64_t j = 0; j < k; ++j) {
+            real_t tol = 0;
+            lapack_int info_ = 0;
+            std::copy( d, d + nb, a.begin() );
+            std::copy( e, e + nb - 1, b.begin() );
+            std::copy( e, e + nb - 1, c.begin() );
+            lagtf_fortran( &nb_, &a[ 0 ], &shift[ j ], &b[ 0 ], &c[ 0 ], &tol,
+                           &dd[ 0 ], &in[ 0 ], &info_ );
+
+            real_t* xj = &X[ j*ldx ];
+            int64_t jmax = blas::iamax( nb, xj, 1 );
+            real_t scl = nb * onenrm * max( eps, std::abs( a[ nb - 1 ] ) )
+                       / std::abs( xj[ jmax ] );
+            blas::scal( nb, scl, xj, 1 );
+            lapack_int job = -1;
+            lagts_fortran( &job, &nb_, &a[ 0 ], &b[ 0 ], &c[ 0 ],
+                           &dd[ 0 ], &in[ 0 ], xj, &tol, &info_ );
+        }
+
+        // Orthonormalize the block, using BLAS-3 Householder QR.
+        // As in stein, the growth is checked after orthogonalization:
+        // the part of x_j orthogonal to x_1, ..., x_{j-1} is r_jj q_j.
+        lapack::geqrf( nb, k, X, ldx, &tau[ 0 ] );
+        for (int64_t j = 0; j < k; ++j)
+            rdiag[ j ] = std::abs( X[ j + j*ldx ] );
+        lapack::ungqr( nb, k, k, X, ldx, &tau[ 0 ] );
+
+        bool done = true;
+        for (int64_t j = 0; j < k; ++j) {
+            real_t const* xj = &X[ j*ldx ];
+            int64_t jmax = blas::iamax( nb, xj, 1 );
+            if (rdiag[ j ] * std::abs( xj[ jmax ] ) >= dtpcrt)
+                ++nrmchk[ j ];
+            if (nrmchk[ j ] < stein_mt_extra + 1)
+                done = false;
+        }
+
+        if (done)
+            break;
+    }
+    for (int64_t j = 0; j < k; ++j)
+        conv[ j ] = nrmchk[ j ] >= stein_mt_extra + 1;
+
+    // Rayleigh-Ritz: H = X^T T X, H = V Lambda V^T, X = X V.
+    std::vector< real_t > Y( nb*k ), H( k*k ), theta( k ), Xv( nb*k );
+    for (int64_t j = 0; j < k; ++j) {
+        real_t const* xj = &X[ j*ldx ];
+        real_t* yj = &Y[ j*nb ];
+        for (int64_t i = 0; i < nb; ++i) {
+            real_t yi = d[ i ] * xj[ i ];
+            if (i > 0)
+                yi += e[ i-1 ] * xj[ i-1 ];
+            if (i < nb - 1)
+                yi += e[ i ] * xj[ i+1 ];
+            yj[ i ] = yi;
+        }
+    }
+    blas::gemm( blas::Layout::ColMajor, blas::Op::Trans, blas::Op::NoTrans,
+                k, k, nb, one, X, ldx, &Y[ 0 ], nb, zero, &H[ 0 ], k );
+    lapack::heevd( Job::Vec, Uplo::Lower, k, &H[ 0 ], k, &theta[ 0 ] );
+    blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                nb, k, k, one, X, ldx, &H[ 0 ], k, zero, &Xv[ 0 ], nb );
+    lapack::lacpy( MatrixType::General, nb, k, &Xv[ 0 ], nb, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the eigenvectors of a real symmetric tridiagonal matrix T
+/// corresponding to specified eigenvalues, using inverse iteration,
+/// in parallel.
+///
+/// This is a multithreaded variant of `lapack::stein`. Eigenvalues are
+/// grouped by block and, within each block, into clusters as in stein:
+/// consecutive eigenvalues closer than $10^{-3} \|T_b\|_1$ are in the same
+/// cluster. Runs of well separated eigenvalues are independent and are
+/// computed with `lapack::stein` on the block. Each cluster is computed by
+/// block inverse iteration, orthonormalizing with Householder QR
+/// (`lapack::geqrf`, `lapack::ungqr`) instead of Gram-Schmidt, followed by
+/// a Rayleigh-Ritz step, so its cost is dominated by BLAS-3 operations.
+/// Runs and clusters are distributed over OpenMP threads.
+///
+/// The eigenvalues can come from bisection, e.g., `lapack::stemr_mt`
+/// with jobz = NoVec, or LAPACK's stebz. Unlike stein, they need not be
+/// ordered by block; eigenvector j corresponds to W(j) for any order.
+/// If block information is unavailable, use iblock(j) = 1 and
+/// isplit(1) = n.
+///
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+///
+/// @param[in] n
+///     The order of the matrix. n >= 0.
+///
+/// @param[in] D
+///     The vector D of length n.
+///     The n diagonal elements of the tridiagonal matrix T.
+///
+/// @param[in] E
+///     The vector E of length n-1.
+///     The (n-1) subdiagonal elements of the tridiagonal matrix T.
+///
+/// @param[in] m
+///     The number of eigenvectors to be found. 0 <= m <= n.
+///
+/// @param[in] W
+///     The vector W of length m.
+///     The eigenvalues for which eigenvectors are to be computed.
+///
+/// @param[in] iblock
+///     The vector iblock of length m.
+///     The submatrix indices associated with the corresponding
+///     eigenvalues in W; iblock(i)=1 if eigenvalue W(i) belongs to
+///     the first submatrix from the top, =2 if W(i) belongs to
+///     the second submatrix, etc.
+///
+/// @param[in] isplit
+///     The vector isplit of length n.
+///     The splitting points, at which T breaks up into submatrices.
+///     The first submatrix consists of rows/columns 1 to isplit(1),
+///     the second of rows/columns isplit(1)+1 through isplit(2), etc.,
+///     as returned by stebz.
+///
+/// @param[out] Z
+///     The n-by-m matrix Z, stored in an ldz-by-m array.
+///     The computed eigenvectors. The eigenvector associated
+///     with the eigenvalue W(i) is stored in the i-th column of Z.
+///     Any vector which fails to converge is set to its current
+///     iterate after maxits iterations.
+///
+/// @param[in] ldz
+///     The leading dimension of the array Z. ldz >= max(1,n).
+///
+/// @param[out] ifail
+///     The vector ifail of length m.
+///     On normal exit, all elements of ifail are zero.
+///     If one or more eigenvectors fail to converge after
+///     maxits iterations, then their indices are stored in
+///     array ifail, in increasing order.
+///
+/// @return = 0: successful exit.
+/// @return > 0: if return value = i, then i eigenvectors failed to converge
+///              in maxits iterations. Their indices are stored in
+///              array ifail.
+///
+/// @ingroup heev_computational
+template <typename scalar_t>
+int64_t stein_mt(
+    int64_t n,
+    blas::real_type< scalar_t > const* D,
+    blas::real_type< scalar_t > const* E, int64_t m,
+    blas::real_type< scalar_t > const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    scalar_t* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    lapack_instrument( "stein_mt", internal::precision_char< scalar_t >(),
+                       0, n, m, internal::gflop_data_dependent );
+
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( n < 0 );
+    lapack_error_if( m < 0 || m > n );
+    lapack_error_if( ldz < max( 1, n ) );
+
+    for (int64_t j = 0; j < m; ++j)
+        ifail[ j ] = 0;
+    if (m == 0)
+        return 0;
+
+    const real_t zero = 0;
+
+    // Sort by block, then by eigenvalue.
+    std::vector< int64_t > order( m );
+    for (int64_t j = 0; j < m; ++j)
+        order[ j ] = j;
+    std::stable_sort( order.begin(), order.end(),
+        [&]( int64_t x, int64_t y ) {
+            return iblock[ x ] < iblock[ y ]
+                   || (iblock[ x ] == iblock[ y ] && W[ x ] < W[ y ]);
+        } );
+
+    #ifdef _OPENMP
+        int64_t nthreads = omp_get_max_threads();
+    #else
+        int64_t nthreads = 1;
+    #endif
+    int64_t ntarget = max( int64_t( 1 ), nthreads * stein_mt_tasks_per_thread );
+    int64_t task_size = (m + ntarget - 1) / ntarget;
+
+    // Split into clusters, as in stein, and runs of separated eigenvalues.
+    std::vector< SteinTask > tasks;
+    std::vector< real_t > onenrm;
+    for (int64_t j = 0; j < m; ) {
+        int64_t blk = iblock[ order[ j ] ];
+        int64_t row = (blk > 1 ? isplit[ blk - 2 ] : 0);
+        int64_t nb = isplit[ blk - 1 ] - row;
+        real_t nrm = std::abs( D[ row ] );
+        if (nb > 1) {
+            nrm = max( std::abs( D[ row ] ) + std::abs( E[ row ] ),
+                       std::abs( D[ row + nb - 1 ] )
+                       + std::abs( E[ row + nb - 2 ] ) );
+            for (int64_t i = row + 1; i < row + nb - 1; ++i) {
+                nrm = max( nrm, std::abs( D[ i ] ) + std::abs( E[ i-1 ] )
+                                + std::abs( E[ i ] ) );
+            }
+        }
+        real_t ortol = real_t( 1.e-3 ) * nrm;
+
+        int64_t end = j + 1;
+        while (end < m && iblock[ order[ end ] ] == blk)
+            ++end;
+        for (int64_t i = j; i < end; ) {
+            int64_t k = i + 1;
+            while (k < end && W[ order[ k ] ] - W[ order[ k-1 ] ] <= ortol)
+                ++k;
+            if (k - i > 1) {
+                tasks.push_back( { i, k, row, nb, true } );
+                onenrm.push_back( nrm );
+            }
+            else if (! tasks.empty() && ! tasks.back().cluster
+                     && tasks.back().end == i && tasks.back().row == row
+                     && i - tasks.back().begin < task_size) {
+                tasks.back().end = k;
+            }
+            else {
+                tasks.push_back( { i, k, row, nb, false } );
+                onenrm.push_back( nrm );
+            }
+            i = k;
+        }
+        j = end;
+    }
+
+    // Compute eigenvectors of each task in parallel, into a real buffer,
+    // then scatter them to their columns of Z.
+    int64_t ntasks = tasks.size();
+    std::vector< char > failed( m, 0 );
+    #pragma omp parallel for schedule( dynamic, 1 )
+    for (int64_t t = 0; t < ntasks; ++t) {
+        SteinTask const& task = tasks[ t ];
+        int64_t nb = task.nb;
+        int64_t mt = task.end - task.begin;
+        real_t const* d = &D[ task.row ];
+        real_t const* e = &E[ task.row ];
+
+        std::vector< real_t > wt( mt );
+        for (int64_t j = 0; j < mt; ++j)
+            wt[ j ] = W[ order[ task.begin + j ] ];
+
+        std::vector< real_t > Zt( nb*mt );
+        if (task.cluster) {
+            std::vector< char > conv( mt );
+            stein_mt_cluster( nb, d, e, onenrm[ t ], mt, &wt[ 0 ],
+                              &Zt[ 0 ], nb, &conv[ 0 ] );
+            for (int64_t j = 0; j < mt; ++j) {
+                if (! conv[ j ])
+                    failed[ order[ task.begin + j ] ] = 1;
+            }
+        }
+        else {
+            std::vector< int64_t > iblock_t( nb, 1 ), isplit_t( nb, nb );
+            std::vector< int64_t > ifail_t( mt );
+            int64_t info_t = lapack::stein(
+                nb, d, e, mt, &wt[ 0 ], &iblock_t[ 0 ], &isplit_t[ 0 ],
+                &Zt[ 0 ], nb, &ifail_t[ 0 ] );
+            for (int64_t i = 0; i < info_t; ++i)
+                failed[ order[ task.begin + ifail_t[ i ] - 1 ] ] = 1;
+        }
+
+        for (int64_t j = 0; j < mt; ++j) {
+            real_t* zj = &Zt[ j*nb ];
+            // Make the largest component positive, as in stein.
+            int64_t jmax = blas::iamax( nb, zj, 1 );
+            if (zj[ jmax ] < zero)
+                blas::scal( nb, real_t( -1 ), zj, 1 );
+
+            scalar_t* Zj = &Z[ order[ task.begin + j ] * ldz ];
+            std::fill( Zj, Zj + n, scalar_t( 0 ) );
+            for (int64_t i = 0; i < nb; ++i)
+                Zj[ task.row + i ] = zj[ i ];
+        }
+    }
+
+    int64_t info = 0;
+    for (int64_t j = 0; j < m; ++j) {
+        if (failed[ j ])
+            ifail[ info++ ] = j + 1;
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t stein_mt< float >(
+    int64_t n,
+    float const* D,
+    float const* E, int64_t m,
+    float const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+template
+int64_t stein_mt< double >(
+    int64_t n,
+    double const* D,
+    double const* E, int64_t m,
+    double const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+template
+int64_t stein_mt< std::complex<float> >(
+    int64_t n,
+    float const* D,
+    float const* E, int64_t m,
+    float const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
+
+template
+int64_t stein_mt< std::complex<double> >(
+    int64_t n,
+    double const* D,
+    double const* E, int64_t m,
+    double const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
+
+}  // namespace lapack
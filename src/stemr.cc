@@ -27,6 +27,8 @@ int64_t stemr(
     int64_t* isuppz,
     bool* tryrac )
 {
+    lapack_instrument( "stemr", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
@@ -101,6 +103,8 @@ int64_t stemr(
     int64_t* isuppz,
     bool* tryrac )
 {
+    lapack_instrument( "stemr", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
@@ -175,6 +179,8 @@ int64_t stemr(
     int64_t* isuppz,
     bool* tryrac )
 {
+    lapack_instrument( "stemr", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
@@ -249,6 +255,8 @@ int64_t stemr(
     int64_t* isuppz,
     bool* tryrac )
 {
+    lapack_instrument( "stemr", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
@@ -0,0 +1,739 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+// Target number of eigenvector tasks per thread, for load balance.
+static const int64_t stemr_mt_tasks_per_thread = 4;
+
+// Same as LAPACK's stemr: relative gap separating clusters at the root.
+static const double stemr_mt_minrgp = 1.e-3;
+
+//------------------------------------------------------------------------------
+// Overloads to select the LAPACK larrv precision.
+static void larrv_fortran(
+    lapack_int const* n, float const* vl, float const* vu,
+    float* d, float* l, float const* pivmin,
+    lapack_int const* isplit, lapack_int const* m,
+    lapack_int const* dol, lapack_int const* dou,
+    float const* minrgp, float const* rtol1, float const* rtol2,
+    float* w, float* werr, float* wgap,
+    lapack_int const* iblock, lapack_int const* indexw,
+    float const* gers, float* Z, lapack_int const* ldz,
+    lapack_int* isuppz, float* work, lapack_int* iwork,
+    lapack_int* info )
+{
+    LAPACK_slarrv( n, vl, vu, d, l, pivmin, isplit, m, dol, dou,
+                   minrgp, rtol1, rtol2, w, werr, wgap, iblock, indexw,
+                   gers, Z, ldz, isuppz, work, iwork, info );
+}
+
+static void larrv_fortran(
+    lapack_int const* n, double const* vl, double const* vu,
+    double* d, double* l, double const* pivmin,
+    lapack_int const* isplit, lapack_int const* m,
+    lapack_int const* dol, lapack_int const* dou,
+    double const* minrgp, double const* rtol1, double const* rtol2,
+    double* w, double* werr, double* wgap,
+    lapack_int const* iblock, lapack_int const* indexw,
+    double const* gers, double* Z, lapack_int const* ldz,
+    lapack_int* isuppz, double* work, lapack_int* iwork,
+    lapack_int* info )
+{
+    LAPACK_dlarrv( n, vl, vu, d, l, pivmin, isplit, m, dol, dou,
+                   minrgp, rtol1, rtol2, w, werr, wgap, iblock, indexw,
+                   gers, Z, ldz, isuppz, work, iwork, info );
+}
+
+//------------------------------------------------------------------------------
+// Overloads to select the LAPACK larrb precision.
+static void larrb_fortran(
+    lapack_int const* n, float const* d, float const* lld,
+    lapack_int const* ifirst, lapack_int const* ilast,
+    float const* rtol1, float const* rtol2, lapack_int const* offset,
+    float* w, float* wgap, float* werr,
+    float* work, lapack_int* iwork,
+    float const* pivmin, float const* spdiam, lapack_int const* twist,
+    lapack_int* info )
+{
+    LAPACK_slarrb( n, d, lld, ifirst, ilast, rtol1, rtol2, offset,
+                   w, wgap, werr, work, iwork, pivmin, spdiam, twist, info );
+}
+
+static void larrb_fortran(
+    lapack_int const* n, double const* d, double const* lld,
+    lapack_int const* ifirst, lapack_int const* ilast,
+    double const* rtol1, double const* rtol2, lapack_int const* offset,
+    double* w, double* wgap, double* werr,
+    double* work, lapack_int* iwork,
+    double const* pivmin, double const* spdiam, lapack_int const* twist,
+    lapack_int* info )
+{
+    LAPACK_dlarrb( n, d, lld, ifirst, ilast, rtol1, rtol2, offset,
+                   w, wgap, werr, work, iwork, pivmin, spdiam, twist, info );
+}
+
+//------------------------------------------------------------------------------
+// Unreduced block of the tridiagonal matrix, rows [ begin, end ).
+template <typename real_t>
+struct StemrBlock {
+    int64_t begin, end;
+    real_t gl, gu;  // Gershgorin bounds
+};
+
+//------------------------------------------------------------------------------
+// Number of eigenvalues of T less than u, summing Sturm counts of blocks.
+template <typename real_t>
+static int64_t stemr_mt_count(
+    std::vector< StemrBlock< real_t > > const& blocks,
+    real_t const* d, real_t const* e, real_t u )
+{
+    int64_t count = 0;
+    for (auto const& blk : blocks)
+        count += sturm( blk.end - blk.begin, &d[ blk.begin ], &e[ blk.begin ], u );
+    return count;
+}
+
+//------------------------------------------------------------------------------
+// Bisection for eigenvalue j (1-based) of a block.
+// On entry, sturm( lo ) <= j - 1 and sturm( hi ) >= j.
+// On exit, [lo, hi] still brackets it,
+// with hi - lo <= tol + rtol max( |lo|, |hi| ).
+template <typename real_t>
+static void stemr_mt_bisect(
+    int64_t n, real_t const* d, real_t const* e, int64_t j,
+    real_t tol, real_t rtol,
+    real_t& lo, real_t& hi )
+{
+    using std::abs;
+    for (int iter = 0;
+         iter < 128 && hi - lo > tol + rtol * max( abs( lo ), abs( hi ) );
+         ++iter) {
+        real_t mid = lo + (hi - lo) / 2;
+        if (mid <= lo || mid >= hi)
+            break;
+        if (sturm( n, d, e, mid ) >= j)
+            hi = mid;
+        else
+            lo = mid;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Same bisection for eigenvalue j of the whole matrix.
+template <typename real_t>
+static void stemr_mt_bisect(
+    std::vector< StemrBlock< real_t > > const& blocks,
+    real_t const* d, real_t const* e, int64_t j, real_t tol,
+    real_t& lo, real_t& hi )
+{
+    for (int iter = 0; iter < 128 && hi - lo > tol; ++iter) {
+        real_t mid = lo + (hi - lo) / 2;
+        if (mid <= lo || mid >= hi)
+            break;
+        if (stemr_mt_count( blocks, d, e, mid ) >= j)
+            hi = mid;
+        else
+            lo = mid;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Computes selected eigenvalues and, optionally, eigenvectors of a real
+/// symmetric tridiagonal matrix T, using a multithreaded MRRR algorithm.
+/// Any subset of eigenvalues can be computed, by index or by value,
+/// at a cost proportional to the size of the subset.
+///
+/// Eigenvalues are computed by bisection using the scaled Sturm counts
+/// of `lapack::sturm`, independently and in parallel. Each unreduced
+/// block gets a positive definite root representation $L D L^T$, then the
+/// wanted eigenvalues are grouped into clusters and singletons by their
+/// relative gaps, as in LAPACK's stemr, and the groups are distributed
+/// over OpenMP threads, each computing its eigenvectors with LAPACK's
+/// larrv called on just that group. Eigenvalues in different groups
+/// are well separated, so each group is an independent task.
+///
+/// This can replace `lapack::stemr` in heevr-style drivers for a subset of
+/// the spectrum: reduce A to tridiagonal using `lapack::hetrd`, call
+/// stemr_mt with range Index or Value, then apply Q using `lapack::unmtr`.
+///
+/// Unlike `lapack::stemr`, D and E are not overwritten, and
+/// high relative accuracy (tryrac) is not attempted.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For complex Z, the real eigenvectors are stored as complex.
+///
+/// @param[in] jobz
+///     - lapack::Job::NoVec: Compute eigenvalues only;
+///     - lapack::Job::Vec: Compute eigenvalues and eigenvectors.
+///
+/// @param[in] range
+///     - lapack::Range::All:
+///             all eigenvalues will be found.
+///     - lapack::Range::Value:
+///             all eigenvalues in the half-open interval (vl,vu]
+///             will be found.
+///     - lapack::Range::Index:
+///             the il-th through iu-th eigenvalues will be found.
+///
+/// @param[in] n
+///     The order of the matrix. n >= 0.
+///
+/// @param[in] D
+///     The vector D of length n.
+///     The n diagonal elements of the tridiagonal matrix T.
+///
+/// @param[in] E
+///     The vector E of length n-1.
+///     The (n-1) subdiagonal elements of the tridiagonal matrix T.
+///
+/// @param[in] vl
+///     If range=Value, the lower bound of the interval to
+///     be searched for eigenvalues. vl < vu.
+///     Not referenced if range = All or Index.
+///
+/// @param[in] vu
+///     If range=Value, the upper bound of the interval to
+///     be searched for eigenvalues. vl < vu.
+///     Not referenced if range = All or Index.
+///
+/// @param[in] il
+///     If range=Index, the index of the
+///     smallest eigenvalue to be returned.
+///     1 <= il <= iu <= n, if n > 0.
+///     Not referenced if range = All or Value.
+///
+/// @param[in] iu
+///     If range=Index, the index of the
+///     largest eigenvalue to be returned.
+///     1 <= il <= iu <= n, if n > 0.
+///     Not referenced if range = All or Value.
+///
+/// @param[out] nfound
+///     The total number of eigenvalues found. 0 <= nfound <= n.
+///     If range = All, nfound = n, and if range = Index, nfound = iu-il+1.
+///
+/// @param[out] W
+///     The vector W of length n.
+///     The first nfound elements contain the selected eigenvalues in
+///     ascending order.
+///
+/// @param[out] Z
+///     The n-by-nfound matrix Z, stored in an ldz-by-nfound array.
+///     If jobz = Vec, and if successful, the first nfound columns of Z
+///     contain the orthonormal eigenvectors of T
+///     corresponding to the selected eigenvalues, with the i-th
+///     column of Z holding the eigenvector associated with W(i).
+///     If jobz = NoVec, then Z is not referenced.
+///     Note: the user must ensure that enough columns
+///     are supplied in the array Z; if range = Value, the exact value
+///     of nfound is not known in advance and an upper bound must be used.
+///
+/// @param[in] ldz
+///     The leading dimension of the array Z. ldz >= 1, and if
+///     jobz = Vec, then ldz >= max(1,n).
+///
+/// @param[out] isuppz
+///     The vector isuppz of length 2*max(1,nfound), or null.
+///     The support of the eigenvectors in Z, i.e., the indices
+///     indicating the nonzero elements in Z. The i-th computed eigenvector
+///     is nonzero only in elements isuppz( 2*i-1 ) through
+///     isuppz( 2*i ), 1-based, as in `lapack::stemr`.
+///     Only referenced if jobz = Vec.
+///
+/// @return = 0: successful exit
+/// @return = 12: no positive definite root representation L D L^T
+///               = T - sigma I of some block was found, as with larre's
+///               info = 2 in `lapack::stemr`. Z is not computed, but W
+///               holds the eigenvalues.
+/// @return > 0: if return value = 20 + i, larrv failed with internal
+///               error i, as in `lapack::stemr`. Like stemr, this can
+///               happen for tight clusters where no relatively robust
+///               child representation is found.
+///
+/// @ingroup heev_computational
+template <typename scalar_t>
+int64_t stemr_mt(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    blas::real_type< scalar_t > const* D,
+    blas::real_type< scalar_t > const* E,
+    blas::real_type< scalar_t > vl, blas::real_type< scalar_t > vu,
+    int64_t il, int64_t iu,
+    int64_t* nfound,
+    blas::real_type< scalar_t >* W,
+    scalar_t* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    lapack_instrument( "stemr_mt", internal::precision_char< scalar_t >(),
+                       0, n, 0, internal::gflop_data_dependent );
+
+    using real_t = blas::real_type< scalar_t >;
+
+    bool wantz = (jobz == Job::Vec);
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( range != Range::All && range != Range::Value
+                     && range != Range::Index );
+    lapack_error_if( n < 0 );
+    lapack_error_if( range == Range::Value && n > 0 && vl >= vu );
+    lapack_error_if( range == Range::Index
+                     && (il < 1 || il > max( 1, n )
+                         || iu < min( n, il ) || iu > n) );
+    lapack_error_if( ldz < 1 || (wantz && ldz < n) );
+
+    *nfound = 0;
+    if (n == 0)
+        return 0;
+
+    const real_t zero = 0;
+    const real_t one  = 1;
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    const real_t safmin = std::numeric_limits< real_t >::min();
+
+    // Scale matrix to allowable range, as in stemr.
+    std::vector< real_t > d( D, D + n ), e( n, zero );
+    std::copy( E, E + n - 1, e.begin() );
+    const real_t smlnum = safmin / eps;
+    const real_t rmin = std::sqrt( smlnum );
+    const real_t rmax = min( std::sqrt( one / smlnum ),
+                             one / std::sqrt( std::sqrt( safmin ) ) );
+    real_t scale = one;
+    real_t tnrm = lapack::lanst( Norm::Max, n, &d[ 0 ], &e[ 0 ] );
+    if (tnrm > zero && tnrm < rmin)
+        scale = rmin / tnrm;
+    else if (tnrm > rmax)
+        scale = rmax / tnrm;
+    if (scale != one) {
+        blas::scal( n, scale, &d[ 0 ], 1 );
+        blas::scal( n - 1, scale, &e[ 0 ], 1 );
+        tnrm *= scale;
+        vl *= scale;
+        vu *= scale;
+    }
+
+    // Split into unreduced blocks, as in larra, and get Gershgorin
+    // intervals of the unshifted matrix.
+    real_t emax = zero;
+    for (int64_t i = 0; i < n - 1; ++i) {
+        if (std::abs( e[ i ] ) <= eps * std::sqrt( std::abs( d[ i ] ) )
+                                      * std::sqrt( std::abs( d[ i+1 ] ) ))
+            e[ i ] = zero;
+        emax = max( emax, std::abs( e[ i ] ) );
+    }
+    const real_t pivmin = safmin * max( one, emax*emax );
+
+    std::vector< real_t > gers( 2*n );
+    for (int64_t i = 0; i < n; ++i) {
+        real_t r = (i > 0 ? std::abs( e[ i-1 ] ) : zero)
+                 + (i < n - 1 ? std::abs( e[ i ] ) : zero);
+        gers[ 2*i ]   = d[ i ] - r;
+        gers[ 2*i+1 ] = d[ i ] + r;
+    }
+
+    std::vector< StemrBlock< real_t > > blocks;
+    for (int64_t begin = 0; begin < n; ) {
+        int64_t end = begin + 1;
+        while (end < n && e[ end-1 ] != zero)
+            ++end;
+        real_t gl = gers[ 2*begin ], gu = gers[ 2*begin+1 ];
+        for (int64_t i = begin + 1; i < end; ++i) {
+            gl = min( gl, gers[ 2*i ] );
+            gu = max( gu, gers[ 2*i+1 ] );
+        }
+        // Widen, as in larre.
+        real_t fudge = 2 * eps * (end - begin) * max( gu - gl, tnrm )
+                     + 4 * pivmin;
+        blocks.push_back( { begin, end, gl - fudge, gu + fudge } );
+        begin = end;
+    }
+    real_t glob_gl = blocks[ 0 ].gl, glob_gu = blocks[ 0 ].gu;
+    for (auto const& blk : blocks) {
+        glob_gl = min( glob_gl, blk.gl );
+        glob_gu = max( glob_gu, blk.gu );
+    }
+
+    // Bisection tolerance: the absolute accuracy of Sturm counts.
+    const real_t tol = max( eps * tnrm, 2 * pivmin );
+
+    // Find [a, c) containing the wanted eigenvalues, and their first index.
+    // [wl, wu] also excludes the neighboring eigenvalues; larrv uses wl
+    // for the gap left of the first wanted eigenvalue.
+    real_t a = glob_gl, c = glob_gu;
+    real_t wl = glob_gl, wu = glob_gu;
+    int64_t first = 1, last = n;
+    if (range == Range::Value) {
+        a = std::nextafter( vl, std::numeric_limits< real_t >::max() );
+        c = std::nextafter( vu, std::numeric_limits< real_t >::max() );
+        wl = vl;
+        wu = vu;
+        first = stemr_mt_count( blocks, &d[ 0 ], &e[ 0 ], a ) + 1;
+        last  = stemr_mt_count( blocks, &d[ 0 ], &e[ 0 ], c );
+    }
+    else if (range == Range::Index) {
+        real_t lo = glob_gl, hi = glob_gu;
+        stemr_mt_bisect( blocks, &d[ 0 ], &e[ 0 ], il, tol, a, hi );
+        stemr_mt_bisect( blocks, &d[ 0 ], &e[ 0 ], iu, tol, lo, c );
+        if (il > 1) {
+            lo = glob_gl;
+            stemr_mt_bisect( blocks, &d[ 0 ], &e[ 0 ], il - 1, tol, lo, wl );
+        }
+        if (iu < n) {
+            hi = glob_gu;
+            stemr_mt_bisect( blocks, &d[ 0 ], &e[ 0 ], iu + 1, tol, wu, hi );
+        }
+        first = il;
+        last = iu;
+    }
+    if (last < first)
+        return 0;
+
+    // Candidate eigenvalues of each block in [a, c), counted from a.
+    int64_t nblocks = blocks.size();
+    std::vector< int64_t > cand_block, cand_index;
+    int64_t count_a = 0;
+    for (int64_t b = 0; b < nblocks; ++b) {
+        int64_t nb = blocks[ b ].end - blocks[ b ].begin;
+        real_t const* db = &d[ blocks[ b ].begin ];
+        real_t const* eb = &e[ blocks[ b ].begin ];
+        int64_t lo_b = sturm( nb, db, eb, a );
+        int64_t hi_b = sturm( nb, db, eb, c );
+        count_a += lo_b;
+        for (int64_t j = lo_b + 1; j <= hi_b; ++j) {
+            cand_block.push_back( b );
+            cand_index.push_back( j );
+        }
+    }
+
+    // Refine all candidates in parallel. For eigenvectors, they are later
+    // refined w.r.t. the root representations, so coarse accuracy suffices.
+    const real_t cand_rtol = (wantz ? std::sqrt( eps ) : zero);
+    int64_t ncand = cand_block.size();
+    std::vector< real_t > cand_lo( ncand, a ), cand_hi( ncand, c );
+    #pragma omp parallel for schedule( dynamic, 16 )
+    for (int64_t i = 0; i < ncand; ++i) {
+        auto const& blk = blocks[ cand_block[ i ] ];
+        cand_lo[ i ] = max( a, blk.gl );
+        cand_hi[ i ] = min( c, blk.gu );
+        stemr_mt_bisect( blk.end - blk.begin, &d[ blk.begin ], &e[ blk.begin ],
+                         cand_index[ i ], tol, cand_rtol,
+                         cand_lo[ i ], cand_hi[ i ] );
+    }
+
+    // Select global indices first, ..., last among the sorted candidates,
+    // then order them by block and index within block, as larrv expects.
+    std::vector< int64_t > order( ncand );
+    for (int64_t i = 0; i < ncand; ++i)
+        order[ i ] = i;
+    std::stable_sort( order.begin(), order.end(),
+        [&]( int64_t x, int64_t y ) {
+            return cand_lo[ x ] + cand_hi[ x ] < cand_lo[ y ] + cand_hi[ y ];
+        } );
+    int64_t sel_begin = min( ncand, max( int64_t( 0 ), first - 1 - count_a ) );
+    int64_t sel_end   = min( ncand, max( sel_begin, last - count_a ) );
+    std::vector< int64_t > sel( order.begin() + sel_begin,
+                                order.begin() + sel_end );
+    std::sort( sel.begin(), sel.end() );  // candidates are in block order
+    int64_t m = sel.size();
+    *nfound = m;
+
+    // Eigenvalues from bisection, sorted, when no vectors are computed.
+    auto bisection_eigenvalues = [&]() {
+        for (int64_t i = 0; i < m; ++i)
+            W[ i ] = (cand_lo[ sel[ i ] ] + cand_hi[ sel[ i ] ]) / 2;
+        std::sort( W, W + m );
+        if (scale != one)
+            blas::scal( m, one / scale, W, 1 );
+    };
+
+    if (! wantz) {
+        bisection_eigenvalues();
+        return 0;
+    }
+
+    // Root representation L D L^T = T - sigma I of each block. With sigma
+    // below the smallest eigenvalue, it is positive definite, hence
+    // relatively robust.
+    std::vector< real_t > Dr( n ), Lr( n );
+    std::vector< real_t > sigma( nblocks, zero );
+    std::vector< char > rep_okay( nblocks, true );
+    #pragma omp parallel for schedule( dynamic )
+    for (int64_t b = 0; b < nblocks; ++b) {
+        int64_t begin = blocks[ b ].begin;
+        int64_t nb = blocks[ b ].end - begin;
+        if (nb == 1) {
+            Dr[ begin ] = d[ begin ];
+            Lr[ begin ] = zero;
+            continue;
+        }
+        real_t lo = blocks[ b ].gl, hi = blocks[ b ].gu;
+        stemr_mt_bisect( nb, &d[ begin ], &e[ begin ], 1, tol, zero, lo, hi );
+        real_t margin = max( hi - lo, eps * (blocks[ b ].gu - blocks[ b ].gl) );
+        bool okay = false;
+        for (int attempt = 0; attempt < 20 && ! okay; ++attempt) {
+            real_t s = lo - margin;
+            okay = true;
+            Dr[ begin ] = d[ begin ] - s;
+            for (int64_t i = begin; i < begin + nb - 1 && okay; ++i) {
+                okay = Dr[ i ] > zero;
+                Lr[ i ] = e[ i ] / Dr[ i ];
+                Dr[ i+1 ] = (d[ i+1 ] - s) - Lr[ i ] * e[ i ];
+            }
+            okay = okay && Dr[ begin + nb - 1 ] > zero;
+            sigma[ b ] = s;
+            margin *= 2;
+        }
+        if (! okay) {
+            rep_okay[ b ] = false;
+            continue;
+        }
+
+        // As in larre, perturb the representation by a few ulps, to break
+        // up (numerically) identical eigenvalues, which larrv cannot treat.
+        std::vector< real_t > pert( 2*nb - 1 );
+        int64_t iseed[4] = { 1, 1, 1, 1 };
+        lapack::larnv( 2, iseed, 2*nb - 1, &pert[ 0 ] );
+        for (int64_t i = 0; i < nb - 1; ++i) {
+            Dr[ begin + i ] *= one + 8 * eps * pert[ i ];
+            Lr[ begin + i ] *= one + 8 * eps * pert[ nb + i ];
+        }
+        Dr[ begin + nb - 1 ] *= one + 4 * eps * pert[ nb - 1 ];
+        Lr[ begin + nb - 1 ] = sigma[ b ];  // larrv stores shift at end
+    }
+
+    for (int64_t b = 0; b < nblocks; ++b) {
+        if (! rep_okay[ b ]) {
+            bisection_eigenvalues();
+            return 12;
+        }
+    }
+
+    // Approximate eigenvalues of the root representations, with
+    // error bounds and gaps, in larrv's format (1-based indices).
+    std::vector< real_t > w( n, zero ), werr( n, zero ), wgap( n, zero );
+    std::vector< lapack_int > iblock( n, 0 ), indexw( n, 0 );
+    std::vector< lapack_int > isplit( nblocks );
+    for (int64_t b = 0; b < nblocks; ++b)
+        isplit[ b ] = lapack_int( blocks[ b ].end );
+    for (int64_t i = 0; i < m; ++i) {
+        int64_t b = cand_block[ sel[ i ] ];
+        w[ i ] = (cand_lo[ sel[ i ] ] + cand_hi[ sel[ i ] ]) / 2 - sigma[ b ];
+        werr[ i ] = (cand_hi[ sel[ i ] ] - cand_lo[ sel[ i ] ]) / 2 + tol;
+        iblock[ i ] = lapack_int( b + 1 );
+        indexw[ i ] = lapack_int( cand_index[ sel[ i ] ] );
+    }
+    auto update_gaps = [&]() {
+        for (int64_t i = 0; i < m; ++i) {
+            if (i < m - 1 && iblock[ i+1 ] == iblock[ i ])
+                wgap[ i ] = max( zero, (w[ i+1 ] - werr[ i+1 ])
+                                       - (w[ i ] + werr[ i ]) );
+            else
+                wgap[ i ] = max( zero, (wu - sigma[ iblock[ i ] - 1 ])
+                                       - (w[ i ] + werr[ i ]) );
+        }
+    };
+    update_gaps();
+
+    #ifdef _OPENMP
+        int64_t nthreads = omp_get_max_threads();
+    #else
+        int64_t nthreads = 1;
+    #endif
+    int64_t ntarget = max( int64_t( 1 ), nthreads * stemr_mt_tasks_per_thread );
+    int64_t task_size = (m + ntarget - 1) / ntarget;
+
+    // Refine the eigenvalues to relative accuracy w.r.t. the root
+    // representations, as in larre, using larrb on independent chunks.
+    // Each chunk touches only its own entries of w, werr, wgap.
+    const real_t rtol1 = std::sqrt( eps );
+    const real_t rtol2 = max( std::sqrt( eps ) * real_t( 5.e-3 ), 4 * eps );
+    std::vector< real_t > lld( n, zero );
+    for (int64_t b = 0; b < nblocks; ++b) {
+        for (int64_t i = blocks[ b ].begin; i < blocks[ b ].end - 1; ++i)
+            lld[ i ] = Lr[ i ] * Lr[ i ] * Dr[ i ];
+    }
+    std::vector< int64_t > chunk_begin( 1, 0 );
+    for (int64_t i = 1; i < m; ++i) {
+        if (iblock[ i ] != iblock[ i-1 ] || i - chunk_begin.back() >= task_size)
+            chunk_begin.push_back( i );
+    }
+    chunk_begin.push_back( m );
+    int64_t nchunks = chunk_begin.size() - 1;
+    #pragma omp parallel for schedule( dynamic, 1 )
+    for (int64_t k = 0; k < nchunks; ++k) {
+        int64_t i0 = chunk_begin[ k ];
+        auto const& blk = blocks[ iblock[ i0 ] - 1 ];
+        lapack_int nb = lapack_int( blk.end - blk.begin );
+        if (nb == 1)
+            continue;
+        lapack_int ifirst = indexw[ i0 ];
+        lapack_int ilast  = indexw[ chunk_begin[ k+1 ] - 1 ];
+        lapack_int offset = ifirst - 1;
+        real_t spdiam = blk.gu - blk.gl;
+        std::vector< real_t > work( 2*nb );
+        std::vector< lapack_int > iwork( 2*nb );
+        lapack_int info_ = 0;
+        larrb_fortran( &nb, &Dr[ blk.begin ], &lld[ blk.begin ],
+                       &ifirst, &ilast, &rtol1, &rtol2, &offset,
+                       &w[ i0 ], &wgap[ i0 ], &werr[ i0 ],
+                       &work[ 0 ], &iwork[ 0 ], &pivmin, &spdiam, &nb,
+                       &info_ );
+    }
+    update_gaps();
+
+    // Split eigenvalues into tasks of about equal size at block or
+    // cluster boundaries, where the relative gap is at least minrgp.
+    const real_t minrgp = stemr_mt_minrgp;
+    std::vector< int64_t > task_begin( 1, 0 );
+    for (int64_t i = 0; i < m - 1; ++i) {
+        bool boundary = iblock[ i+1 ] != iblock[ i ]
+                        || wgap[ i ] >= minrgp * std::abs( w[ i ] );
+        if (boundary && i + 1 - task_begin.back() >= task_size)
+            task_begin.push_back( i + 1 );
+    }
+    task_begin.push_back( m );
+    int64_t ntasks = task_begin.size() - 1;
+
+    // Compute eigenvectors of each task in parallel. Each task passes
+    // larrv only its own eigenvalues, with bounds on the neighboring
+    // eigenvalues as vl, vu, so larrv sees the gaps outside the task.
+    // (Using larrv's dol, dou instead would refine all the eigenvalues of
+    // the root representation again in every task.) larrv overwrites its
+    // representation and eigenvalue arrays, so each task has copies.
+    lapack_int n_ = to_lapack_int( n );
+    std::vector< real_t > w_out( m );
+    std::vector< lapack_int > isuppz_out( 2*m );
+    std::vector< lapack_int > info_task( ntasks, 0 );
+    #pragma omp parallel for schedule( dynamic, 1 )
+    for (int64_t t = 0; t < ntasks; ++t) {
+        int64_t i0 = task_begin[ t ];
+        int64_t i1 = task_begin[ t+1 ];
+        lapack_int mt = lapack_int( i1 - i0 );
+        lapack_int dol = 1;
+        lapack_int dou = mt;
+        real_t vlt = wl, vut = wu;
+        if (i0 > 0 && iblock[ i0-1 ] == iblock[ i0 ]) {
+            vlt = w[ i0-1 ] + werr[ i0-1 ] + sigma[ iblock[ i0 ] - 1 ];
+        }
+        if (i1 < m && iblock[ i1 ] == iblock[ i1-1 ]) {
+            vut = w[ i1 ] - werr[ i1 ] + sigma[ iblock[ i1 ] - 1 ];
+        }
+
+        std::vector< real_t > Dt( Dr ), Lt( Lr );
+        std::vector< real_t > wt( &w[ i0 ], &w[ i1 ] );
+        std::vector< real_t > werrt( &werr[ i0 ], &werr[ i1 ] );
+        std::vector< real_t > wgapt( &wgap[ i0 ], &wgap[ i1 ] );
+        std::vector< lapack_int > iblockt( &iblock[ i0 ], &iblock[ i1 ] );
+        std::vector< lapack_int > indexwt( &indexw[ i0 ], &indexw[ i1 ] );
+        std::vector< real_t > Zt( n * mt );
+        std::vector< real_t > work( 12*n );
+        std::vector< lapack_int > iwork( 7*n );
+        lapack_int info_ = 0;
+        larrv_fortran( &n_, &vlt, &vut, &Dt[ 0 ], &Lt[ 0 ], &pivmin,
+                       &isplit[ 0 ], &mt, &dol, &dou,
+                       &minrgp, &rtol1, &rtol2,
+                       &wt[ 0 ], &werrt[ 0 ], &wgapt[ 0 ],
+                       &iblockt[ 0 ], &indexwt[ 0 ], &gers[ 0 ],
+                       &Zt[ 0 ], &n_, &isuppz_out[ 2*i0 ],
+                       &work[ 0 ], &iwork[ 0 ], &info_ );
+        info_task[ t ] = info_;
+
+        for (int64_t j = 0; j < mt; ++j) {
+            w_out[ i0 + j ] = wt[ j ];
+            real_t const* zj = &Zt[ j * n ];
+            for (int64_t i = 0; i < n; ++i)
+                Z[ i + (i0 + j)*ldz ] = zj[ i ];
+        }
+    }
+    for (int64_t t = 0; t < ntasks; ++t) {
+        if (info_task[ t ] != 0)
+            return 20 + std::abs( info_task[ t ] );
+    }
+
+    // Sort eigenvalues into ascending order across blocks.
+    std::vector< int64_t > perm( m );
+    for (int64_t i = 0; i < m; ++i)
+        perm[ i ] = i;
+    std::stable_sort( perm.begin(), perm.end(),
+        [&w_out]( int64_t x, int64_t y ) { return w_out[ x ] < w_out[ y ]; } );
+    for (int64_t i = 0; i < m; ++i) {
+        W[ i ] = w_out[ perm[ i ] ];
+        if (isuppz != nullptr) {
+            isuppz[ 2*i   ] = isuppz_out[ 2*perm[ i ]   ];
+            isuppz[ 2*i+1 ] = isuppz_out[ 2*perm[ i ]+1 ];
+        }
+    }
+    // lapmt takes 1-based indices.
+    for (int64_t i = 0; i < m; ++i)
+        ++perm[ i ];
+    lapack::lapmt( true, n, m, Z, ldz, &perm[ 0 ] );
+
+    if (scale != one)
+        blas::scal( m, one / scale, W, 1 );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t stemr_mt< float >(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float const* D,
+    float const* E,
+    float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz );
+
+template
+int64_t stemr_mt< double >(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double const* D,
+    double const* E,
+    double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz );
+
+template
+int64_t stemr_mt< std::complex<float> >(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float const* D,
+    float const* E,
+    float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+template
+int64_t stemr_mt< std::complex<double> >(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double const* D,
+    double const* E,
+    double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+}  // namespace lapack
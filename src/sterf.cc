@@ -21,6 +21,8 @@ int64_t sterf(
     float* D,
     float* E )
 {
+    lapack_instrument( "sterf", 's', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
@@ -40,6 +42,8 @@ int64_t sterf(
     double* D,
     double* E )
 {
+    lapack_instrument( "sterf", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
@@ -23,6 +23,8 @@ int64_t stev(
     float* E,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "stev", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -51,6 +53,8 @@ int64_t stev(
     double* E,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "stev", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
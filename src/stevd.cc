@@ -23,6 +23,8 @@ int64_t stevd(
     float* E,
     float* Z, int64_t ldz )
 {
+    lapack_instrument( "stevd", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -71,6 +73,8 @@ int64_t stevd(
     double* E,
     double* Z, int64_t ldz )
 {
+    lapack_instrument( "stevd", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
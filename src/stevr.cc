@@ -26,6 +26,8 @@ int64_t stevr(
     float* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "stevr", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
@@ -97,6 +99,8 @@ int64_t stevr(
     double* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "stevr", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
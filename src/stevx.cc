@@ -26,6 +26,8 @@ int64_t stevx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "stevx", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
@@ -78,6 +80,8 @@ int64_t stevx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "stevx", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
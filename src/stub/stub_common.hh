@@ -0,0 +1,380 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_STUB_COMMON_HH
+#define LAPACK_STUB_COMMON_HH
+
+#include "lapack/device.hh"
+#include "lapack/fortran.h"
+#include "../lapack_internal.hh"
+
+#include <complex>
+
+//==============================================================================
+// Overloads of the Fortran LAPACK routines for the host backend of the
+// device routines. Unlike the host wrappers, these take the workspace as
+// arguments, so the device routines can run in the workspace from
+// *_work_size_bytes, which the Queue's pool provides.
+// lwork = -1 queries the workspace size, as in LAPACK.
+// @return info from LAPACK; throws Error if info < 0.
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return bytes rounded up to a multiple of 16, so a workspace can be split
+/// into aligned arrays of different types.
+inline size_t stub_align( size_t bytes )
+{
+    return (bytes + 15) / 16 * 16;
+}
+
+//------------------------------------------------------------------------------
+inline lapack_int stub_check( lapack_int info )
+{
+    if (info < 0)
+        throw Error();
+    return info;
+}
+
+//------------------------------------------------------------------------------
+inline lapack_int stub_getrf(
+    lapack_int m, lapack_int n, float* A, lapack_int lda, lapack_int* ipiv )
+{
+    lapack_int info = 0;
+    LAPACK_sgetrf( &m, &n, A, &lda, ipiv, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_getrf(
+    lapack_int m, lapack_int n, double* A, lapack_int lda, lapack_int* ipiv )
+{
+    lapack_int info = 0;
+    LAPACK_dgetrf( &m, &n, A, &lda, ipiv, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_getrf(
+    lapack_int m, lapack_int n, std::complex<float>* A, lapack_int lda,
+    lapack_int* ipiv )
+{
+    lapack_int info = 0;
+    LAPACK_cgetrf( &m, &n, (lapack_complex_float*) A, &lda, ipiv, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_getrf(
+    lapack_int m, lapack_int n, std::complex<double>* A, lapack_int lda,
+    lapack_int* ipiv )
+{
+    lapack_int info = 0;
+    LAPACK_zgetrf( &m, &n, (lapack_complex_double*) A, &lda, ipiv, &info );
+    return stub_check( info );
+}
+
+//------------------------------------------------------------------------------
+inline lapack_int stub_geqrf(
+    lapack_int m, lapack_int n, float* A, lapack_int lda, float* tau,
+    float* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_sgeqrf( &m, &n, A, &lda, tau, work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_geqrf(
+    lapack_int m, lapack_int n, double* A, lapack_int lda, double* tau,
+    double* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_dgeqrf( &m, &n, A, &lda, tau, work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_geqrf(
+    lapack_int m, lapack_int n, std::complex<float>* A, lapack_int lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_cgeqrf( &m, &n, (lapack_complex_float*) A, &lda,
+                   (lapack_complex_float*) tau,
+                   (lapack_complex_float*) work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_geqrf(
+    lapack_int m, lapack_int n, std::complex<double>* A, lapack_int lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_zgeqrf( &m, &n, (lapack_complex_double*) A, &lda,
+                   (lapack_complex_double*) tau,
+                   (lapack_complex_double*) work, &lwork, &info );
+    return stub_check( info );
+}
+
+//------------------------------------------------------------------------------
+// For real, rwork is not used.
+inline lapack_int stub_heevd(
+    char jobz, char uplo, lapack_int n, float* A, lapack_int lda, float* W,
+    float* work, lapack_int lwork,
+    float* rwork, lapack_int lrwork,
+    lapack_int* iwork, lapack_int liwork )
+{
+    lapack_int info = 0;
+    LAPACK_ssyevd( &jobz, &uplo, &n, A, &lda, W,
+                   work, &lwork, iwork, &liwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_heevd(
+    char jobz, char uplo, lapack_int n, double* A, lapack_int lda, double* W,
+    double* work, lapack_int lwork,
+    double* rwork, lapack_int lrwork,
+    lapack_int* iwork, lapack_int liwork )
+{
+    lapack_int info = 0;
+    LAPACK_dsyevd( &jobz, &uplo, &n, A, &lda, W,
+                   work, &lwork, iwork, &liwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_heevd(
+    char jobz, char uplo, lapack_int n,
+    std::complex<float>* A, lapack_int lda, float* W,
+    std::complex<float>* work, lapack_int lwork,
+    float* rwork, lapack_int lrwork,
+    lapack_int* iwork, lapack_int liwork )
+{
+    lapack_int info = 0;
+    LAPACK_cheevd( &jobz, &uplo, &n, (lapack_complex_float*) A, &lda, W,
+                   (lapack_complex_float*) work, &lwork,
+                   rwork, &lrwork, iwork, &liwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_heevd(
+    char jobz, char uplo, lapack_int n,
+    std::complex<double>* A, lapack_int lda, double* W,
+    std::complex<double>* work, lapack_int lwork,
+    double* rwork, lapack_int lrwork,
+    lapack_int* iwork, lapack_int liwork )
+{
+    lapack_int info = 0;
+    LAPACK_zheevd( &jobz, &uplo, &n, (lapack_complex_double*) A, &lda, W,
+                   (lapack_complex_double*) work, &lwork,
+                   rwork, &lrwork, iwork, &liwork, &info );
+    return stub_check( info );
+}
+
+//------------------------------------------------------------------------------
+// For real, rwork is not used; for complex, it has 5 min( m, n ) entries.
+inline lapack_int stub_gesvd(
+    char jobu, char jobvt, lapack_int m, lapack_int n,
+    float* A, lapack_int lda, float* S,
+    float* U, lapack_int ldu, float* VT, lapack_int ldvt,
+    float* work, lapack_int lwork, float* rwork )
+{
+    lapack_int info = 0;
+    LAPACK_sgesvd( &jobu, &jobvt, &m, &n, A, &lda, S,
+                   U, &ldu, VT, &ldvt, work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_gesvd(
+    char jobu, char jobvt, lapack_int m, lapack_int n,
+    double* A, lapack_int lda, double* S,
+    double* U, lapack_int ldu, double* VT, lapack_int ldvt,
+    double* work, lapack_int lwork, double* rwork )
+{
+    lapack_int info = 0;
+    LAPACK_dgesvd( &jobu, &jobvt, &m, &n, A, &lda, S,
+                   U, &ldu, VT, &ldvt, work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_gesvd(
+    char jobu, char jobvt, lapack_int m, lapack_int n,
+    std::complex<float>* A, lapack_int lda, float* S,
+    std::complex<float>* U, lapack_int ldu,
+    std::complex<float>* VT, lapack_int ldvt,
+    std::complex<float>* work, lapack_int lwork, float* rwork )
+{
+    lapack_int info = 0;
+    LAPACK_cgesvd( &jobu, &jobvt, &m, &n, (lapack_complex_float*) A, &lda, S,
+                   (lapack_complex_float*) U, &ldu,
+                   (lapack_complex_float*) VT, &ldvt,
+                   (lapack_complex_float*) work, &lwork, rwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_gesvd(
+    char jobu, char jobvt, lapack_int m, lapack_int n,
+    std::complex<double>* A, lapack_int lda, double* S,
+    std::complex<double>* U, lapack_int ldu,
+    std::complex<double>* VT, lapack_int ldvt,
+    std::complex<double>* work, lapack_int lwork, double* rwork )
+{
+    lapack_int info = 0;
+    LAPACK_zgesvd( &jobu, &jobvt, &m, &n, (lapack_complex_double*) A, &lda, S,
+                   (lapack_complex_double*) U, &ldu,
+                   (lapack_complex_double*) VT, &ldvt,
+                   (lapack_complex_double*) work, &lwork, rwork, &info );
+    return stub_check( info );
+}
+
+//------------------------------------------------------------------------------
+// Symmetric (not Hermitian) factorization, also for complex.
+inline lapack_int stub_sytrf(
+    char uplo, lapack_int n, float* A, lapack_int lda, lapack_int* ipiv,
+    float* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_ssytrf( &uplo, &n, A, &lda, ipiv, work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_sytrf(
+    char uplo, lapack_int n, double* A, lapack_int lda, lapack_int* ipiv,
+    double* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_dsytrf( &uplo, &n, A, &lda, ipiv, work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_sytrf(
+    char uplo, lapack_int n, std::complex<float>* A, lapack_int lda,
+    lapack_int* ipiv, std::complex<float>* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_csytrf( &uplo, &n, (lapack_complex_float*) A, &lda, ipiv,
+                   (lapack_complex_float*) work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_sytrf(
+    char uplo, lapack_int n, std::complex<double>* A, lapack_int lda,
+    lapack_int* ipiv, std::complex<double>* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_zsytrf( &uplo, &n, (lapack_complex_double*) A, &lda, ipiv,
+                   (lapack_complex_double*) work, &lwork, &info );
+    return stub_check( info );
+}
+
+//------------------------------------------------------------------------------
+inline lapack_int stub_ungqr(
+    lapack_int m, lapack_int n, lapack_int k,
+    float* A, lapack_int lda, float const* tau,
+    float* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_sorgqr( &m, &n, &k, A, &lda, tau, work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_ungqr(
+    lapack_int m, lapack_int n, lapack_int k,
+    double* A, lapack_int lda, double const* tau,
+    double* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_dorgqr( &m, &n, &k, A, &lda, tau, work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_ungqr(
+    lapack_int m, lapack_int n, lapack_int k,
+    std::complex<float>* A, lapack_int lda, std::complex<float> const* tau,
+    std::complex<float>* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_cungqr( &m, &n, &k, (lapack_complex_float*) A, &lda,
+                   (lapack_complex_float const*) tau,
+                   (lapack_complex_float*) work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_ungqr(
+    lapack_int m, lapack_int n, lapack_int k,
+    std::complex<double>* A, lapack_int lda, std::complex<double> const* tau,
+    std::complex<double>* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_zungqr( &m, &n, &k, (lapack_complex_double*) A, &lda,
+                   (lapack_complex_double const*) tau,
+                   (lapack_complex_double*) work, &lwork, &info );
+    return stub_check( info );
+}
+
+//------------------------------------------------------------------------------
+// For real, trans = 'C' is passed to ormqr as 'T'.
+inline lapack_int stub_unmqr(
+    char side, char trans, lapack_int m, lapack_int n, lapack_int k,
+    float const* A, lapack_int lda, float const* tau,
+    float* C, lapack_int ldc,
+    float* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    if (trans == 'C')
+        trans = 'T';
+    LAPACK_sormqr( &side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc,
+                   work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_unmqr(
+    char side, char trans, lapack_int m, lapack_int n, lapack_int k,
+    double const* A, lapack_int lda, double const* tau,
+    double* C, lapack_int ldc,
+    double* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    if (trans == 'C')
+        trans = 'T';
+    LAPACK_dormqr( &side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc,
+                   work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_unmqr(
+    char side, char trans, lapack_int m, lapack_int n, lapack_int k,
+    std::complex<float> const* A, lapack_int lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, lapack_int ldc,
+    std::complex<float>* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_cunmqr( &side, &trans, &m, &n, &k,
+                   (lapack_complex_float const*) A, &lda,
+                   (lapack_complex_float const*) tau,
+                   (lapack_complex_float*) C, &ldc,
+                   (lapack_complex_float*) work, &lwork, &info );
+    return stub_check( info );
+}
+
+inline lapack_int stub_unmqr(
+    char side, char trans, lapack_int m, lapack_int n, lapack_int k,
+    std::complex<double> const* A, lapack_int lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, lapack_int ldc,
+    std::complex<double>* work, lapack_int lwork )
+{
+    lapack_int info = 0;
+    LAPACK_zunmqr( &side, &trans, &m, &n, &k,
+                   (lapack_complex_double const*) A, &lda,
+                   (lapack_complex_double const*) tau,
+                   (lapack_complex_double*) C, &ldc,
+                   (lapack_complex_double*) work, &lwork, &info );
+    return stub_check( info );
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_STUB_COMMON_HH
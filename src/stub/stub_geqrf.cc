@@ -7,14 +7,29 @@
 
 #if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
 
-#include "lapack/device.hh"
+#include "stub_common.hh"
 
 //==============================================================================
 namespace lapack {
 
+//------------------------------------------------------------------------------
+// Workspace query for LAPACK geqrf.
+// @return lwork, in elements of scalar_t.
+template <typename scalar_t>
+static lapack_int geqrf_lwork(
+    int64_t m, int64_t n, scalar_t* dA, int64_t ldda )
+{
+    scalar_t qry_tau[ 1 ], qry_work[ 1 ];
+    internal::stub_geqrf( to_lapack_int( m ), to_lapack_int( n ),
+                          dA, to_lapack_int( ldda ),
+                          qry_tau, qry_work, -1 );
+    return lapack_int( blas::real( qry_work[ 0 ] ) );
+}
+
 //------------------------------------------------------------------------------
 // Wrapper around workspace query.
 // dA is only for templating scalar_t; it isn't referenced.
+// As with cuSolver, the workspace is in device memory.
 template <typename scalar_t>
 void geqrf_work_size_bytes(
     int64_t m, int64_t n,
@@ -22,13 +37,14 @@ void geqrf_work_size_bytes(
     size_t* dev_work_size, size_t* host_work_size,
     lapack::Queue& queue )
 {
-    *dev_work_size  = 0;
+    *dev_work_size  = sizeof(scalar_t) * geqrf_lwork( m, n, dA, ldda );
     *host_work_size = 0;
 }
 
 //------------------------------------------------------------------------------
-// Wrapper stub.
-// This is async. Once finished, the return info is in dev_info on the device.
+// Host backend: runs LAPACK on the queue's host stream,
+// with dA, etc. in host memory.
+// This is async. Once finished, the return info is in dev_info.
 template <typename scalar_t>
 void geqrf(
     int64_t m, int64_t n,
@@ -37,7 +53,21 @@ void geqrf(
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue )
 {
-    throw lapack::Error( "device LAPACK not available", __func__ );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, m ) );
+
+    lapack_int lwork = geqrf_lwork( m, n, dA, ldda );
+    lapack_error_if( dev_work_size < sizeof(scalar_t) * lwork );
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldda_ = to_lapack_int( ldda );
+    scalar_t* work = (scalar_t*) dev_work;
+    queue.enqueue( [=]() {
+        *dev_info = internal::stub_geqrf( m_, n_, dA, ldda_, dtau,
+                                          work, lwork );
+    } );
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,191 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
+
+#include "stub_common.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Workspace query for LAPACK gesvd. The workspace holds work, then
+// rwork (complex only) of 5 min( m, n ).
+// @return bytes of workspace, and sets lwork, lrwork.
+template <typename scalar_t>
+static size_t gesvd_work(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    lapack_int* lwork, lapack_int* lrwork )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    scalar_t qry_work[ 1 ];
+    real_t qry_rwork[ 1 ];
+    internal::stub_gesvd( to_char( jobu ), to_char( jobvt ),
+                          to_lapack_int( m ), to_lapack_int( n ),
+                          dA, to_lapack_int( ldda ), dS,
+                          dU, to_lapack_int( lddu ),
+                          dVT, to_lapack_int( lddvt ),
+                          qry_work, -1, qry_rwork );
+    *lwork  = lapack_int( blas::real( qry_work[ 0 ] ) );
+    *lrwork = (blas::is_complex< scalar_t >::value
+               ? to_lapack_int( 5*blas::min( m, n ) ) : 0);
+    return internal::stub_align( sizeof(scalar_t) * *lwork )
+         + sizeof(real_t) * *lrwork;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around workspace query.
+// dA, etc. are only for templating scalar_t; they aren't referenced.
+// As with cuSolver, the workspace is in device memory.
+template <typename scalar_t>
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    lapack_int lwork, lrwork;
+    *dev_work_size  = gesvd_work( jobu, jobvt, m, n, dA, ldda, dS,
+                                  dU, lddu, dVT, lddvt, &lwork, &lrwork );
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Host backend: runs LAPACK on the queue's host stream,
+// with dA, etc. in host memory.
+// This is async. Once finished, the return info is in dev_info.
+template <typename scalar_t>
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( jobu != Job::AllVec && jobu != Job::SomeVec
+                     && jobu != Job::OverwriteVec && jobu != Job::NoVec );
+    lapack_error_if( jobvt != Job::AllVec && jobvt != Job::SomeVec
+                     && jobvt != Job::OverwriteVec && jobvt != Job::NoVec );
+    lapack_error_if( jobu == Job::OverwriteVec && jobvt == Job::OverwriteVec );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, m ) );
+
+    lapack_int lwork, lrwork;
+    size_t bytes = gesvd_work( jobu, jobvt, m, n, dA, ldda, dS,
+                               dU, lddu, dVT, lddvt, &lwork, &lrwork );
+    lapack_error_if( dev_work_size < bytes );
+
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldda_ = to_lapack_int( ldda );
+    lapack_int lddu_ = to_lapack_int( lddu );
+    lapack_int lddvt_ = to_lapack_int( lddvt );
+    scalar_t* work = (scalar_t*) dev_work;
+    real_t* rwork = (real_t*) ((char*) dev_work
+                        + internal::stub_align( sizeof(scalar_t) * lwork ));
+    queue.enqueue( [=]() {
+        *dev_info = internal::stub_gesvd( jobu_, jobvt_, m_, n_,
+                                          dA, ldda_, dS, dU, lddu_,
+                                          dVT, lddvt_, work, lwork, rwork );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* dA, int64_t ldda, float* dS,
+    float* dU, int64_t lddu,
+    float* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* dA, int64_t ldda, double* dS,
+    double* dU, int64_t lddu,
+    double* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dS,
+    std::complex<float>* dU, int64_t lddu,
+    std::complex<float>* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dS,
+    std::complex<double>* dU, int64_t lddu,
+    std::complex<double>* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* dA, int64_t ldda, float* dS,
+    float* dU, int64_t lddu,
+    float* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* dA, int64_t ldda, double* dS,
+    double* dU, int64_t lddu,
+    double* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dS,
+    std::complex<float>* dU, int64_t lddu,
+    std::complex<float>* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dS,
+    std::complex<double>* dU, int64_t lddu,
+    std::complex<double>* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
@@ -7,7 +7,9 @@
 
 #if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
 
-#include "lapack/device.hh"
+#include "stub_common.hh"
+
+#include <algorithm>
 
 //==============================================================================
 namespace lapack {
@@ -15,6 +17,8 @@ namespace lapack {
 //------------------------------------------------------------------------------
 // Wrapper around workspace query.
 // dA is only for templating scalar_t; it isn't referenced.
+// LAPACK getrf needs no workspace. If lapack_int is 32-bit, the pivots are
+// computed in the device workspace, then copied to dipiv.
 template <typename scalar_t>
 void getrf_work_size_bytes(
     int64_t m, int64_t n,
@@ -22,13 +26,18 @@ void getrf_work_size_bytes(
     size_t* dev_work_size, size_t* host_work_size,
     lapack::Queue& queue )
 {
-    *dev_work_size  = 0;
+    #ifdef LAPACK_ILP64
+        *dev_work_size  = 0;
+    #else
+        *dev_work_size  = sizeof(lapack_int) * blas::max( 0, blas::min( m, n ) );
+    #endif
     *host_work_size = 0;
 }
 
 //------------------------------------------------------------------------------
-// Wrapper stub.
-// This is async. Once finished, the return info is in dev_info on the device.
+// Host backend: runs LAPACK on the queue's host stream,
+// with dA, etc. in host memory.
+// This is async. Once finished, the return info is in dev_info.
 template <typename scalar_t>
 void getrf(
     int64_t m, int64_t n,
@@ -37,7 +46,27 @@ void getrf(
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue )
 {
-    throw lapack::Error( "device LAPACK not available", __func__ );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, m ) );
+
+    size_t dev_bytes, host_bytes;
+    getrf_work_size_bytes( m, n, dA, ldda, &dev_bytes, &host_bytes, queue );
+    lapack_error_if( dev_work_size < dev_bytes );
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldda_ = to_lapack_int( ldda );
+    queue.enqueue( [=]() {
+        #ifdef LAPACK_ILP64
+            // device_pivot_int is int64_t, so pivots are written directly.
+            *dev_info = internal::stub_getrf( m_, n_, dA, ldda_, dipiv );
+        #else
+            lapack_int* ipiv = (lapack_int*) dev_work;
+            *dev_info = internal::stub_getrf( m_, n_, dA, ldda_, ipiv );
+            std::copy( ipiv, ipiv + blas::min( m, n ), dipiv );
+        #endif
+    } );
 }
 
 //------------------------------------------------------------------------------
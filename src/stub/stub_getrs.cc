@@ -0,0 +1,74 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
+
+#include "lapack/device.hh"
+#include "lapack/wrappers.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Host backend: runs the host LAPACK routine on the queue's host stream,
+// with dA, etc. in host memory.
+// This is async. Once finished, the return info is in dev_info.
+template <typename scalar_t>
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    scalar_t* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    lapack_error_if( trans != Op::NoTrans
+                     && trans != Op::Trans
+                     && trans != Op::ConjTrans );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldda < blas::max( 1, n ) );
+    lapack_error_if( lddb < blas::max( 1, n ) );
+
+    // device_pivot_int is int64_t, so pivots are read directly.
+    queue.enqueue( [=]() {
+        *dev_info = lapack::getrs( trans, n, nrhs, dA, ldda, dev_ipiv,
+                                   dB, lddb );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    float* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    double* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    std::complex<float>* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    std::complex<double>* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
@@ -7,15 +7,43 @@
 
 #if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
 
-#include "lapack/device.hh"
+#include "stub_common.hh"
 
 
 //==============================================================================
 namespace lapack {
 
+//------------------------------------------------------------------------------
+// Workspace query for LAPACK heevd (syevd for real). The workspace holds
+// work, rwork (complex only), and iwork, in that order.
+// @return bytes of workspace, and sets lwork, lrwork, liwork.
+template <typename scalar_t>
+static size_t heevd_work(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    lapack_int* lwork, lapack_int* lrwork, lapack_int* liwork )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    scalar_t qry_work[ 1 ];
+    real_t qry_rwork[ 1 ];
+    lapack_int qry_iwork[ 1 ];
+    internal::stub_heevd( to_char( jobz ), to_char( uplo ), to_lapack_int( n ),
+                          dA, to_lapack_int( ldda ), dW,
+                          qry_work, -1, qry_rwork, -1, qry_iwork, -1 );
+    *lwork  = lapack_int( blas::real( qry_work[ 0 ] ) );
+    *lrwork = (blas::is_complex< scalar_t >::value
+               ? lapack_int( qry_rwork[ 0 ] ) : 0);
+    *liwork = qry_iwork[ 0 ];
+    return internal::stub_align( sizeof(scalar_t) * *lwork )
+         + internal::stub_align( sizeof(real_t) * *lrwork )
+         + sizeof(lapack_int) * *liwork;
+}
+
 //------------------------------------------------------------------------------
 // Wrapper around workspace query.
 // dA is only for templating scalar_t; it isn't referenced.
+// As with cuSolver, the workspace is in device memory.
 template <typename scalar_t>
 void heevd_work_size_bytes(
     lapack::Job jobz, lapack::Uplo uplo,
@@ -23,13 +51,16 @@ void heevd_work_size_bytes(
     size_t* dev_work_size, size_t* host_work_size,
     lapack::Queue& queue )
 {
-    *dev_work_size  = 0;
+    lapack_int lwork, lrwork, liwork;
+    *dev_work_size  = heevd_work( jobz, uplo, n, dA, ldda, dW,
+                                  &lwork, &lrwork, &liwork );
     *host_work_size = 0;
 }
 
 //------------------------------------------------------------------------------
-// Wrapper stub.
-// This is async. Once finished, the return info is in dev_info on the device.
+// Host backend: runs LAPACK on the queue's host stream,
+// with dA, etc. in host memory.
+// This is async. Once finished, the return info is in dev_info.
 template <typename scalar_t>
 void heevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -38,7 +69,33 @@ void heevd(
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue )
 {
-    throw lapack::Error( "device LAPACK not available", __func__ );
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, n ) );
+
+    lapack_int lwork, lrwork, liwork;
+    size_t bytes = heevd_work( jobz, uplo, n, dA, ldda, dW,
+                               &lwork, &lrwork, &liwork );
+    lapack_error_if( dev_work_size < bytes );
+
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldda_ = to_lapack_int( ldda );
+    char* ptr = (char*) dev_work;
+    scalar_t* work = (scalar_t*) ptr;
+    ptr += internal::stub_align( sizeof(scalar_t) * lwork );
+    real_t* rwork = (real_t*) ptr;
+    ptr += internal::stub_align( sizeof(real_t) * lrwork );
+    lapack_int* iwork = (lapack_int*) ptr;
+    queue.enqueue( [=]() {
+        *dev_info = internal::stub_heevd( jobz_, uplo_, n_, dA, ldda_, dW,
+                                          work, lwork, rwork, lrwork,
+                                          iwork, liwork );
+    } );
 }
 
 //------------------------------------------------------------------------------
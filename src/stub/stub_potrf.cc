@@ -8,20 +8,28 @@
 #if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
 
 #include "lapack/device.hh"
+#include "lapack/wrappers.hh"
 
 //==============================================================================
 namespace lapack {
 
 //------------------------------------------------------------------------------
-// Wrapper stub.
-// This is async. Once finished, the return info is in dev_info on the device.
+// Host backend: runs the host LAPACK routine on the queue's host stream,
+// with dA, etc. in host memory.
+// This is async. Once finished, the return info is in dev_info.
 template <typename scalar_t>
 void potrf(
     lapack::Uplo uplo, int64_t n,
     scalar_t* dA, int64_t ldda,
     device_info_int* dev_info, lapack::Queue& queue )
 {
-    throw lapack::Error( "device LAPACK not available", __func__ );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, n ) );
+
+    queue.enqueue( [=]() {
+        *dev_info = lapack::potrf( uplo, n, dA, ldda );
+    } );
 }
 
 //------------------------------------------------------------------------------
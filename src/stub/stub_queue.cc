@@ -0,0 +1,93 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
+
+#include "lapack/device.hh"
+#include "lapack/trace.hh"
+
+//==============================================================================
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+HostStream::HostStream()
+    : busy_( false ),
+      stop_( false )
+{}
+
+//------------------------------------------------------------------------------
+// Drains the queue, so no task outlives the stream.
+HostStream::~HostStream()
+{
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (thread_.joinable())
+        thread_.join();
+}
+
+//------------------------------------------------------------------------------
+void HostStream::run()
+{
+    while (true) {
+        std::function<void ()> task;
+        {
+            std::unique_lock< std::mutex > lock( mutex_ );
+            busy_ = false;
+            if (queue_.empty())
+                idle_cv_.notify_all();
+            cv_.wait( lock, [this] { return stop_ || ! queue_.empty(); } );
+            if (queue_.empty())
+                return;  // stop_ and drained
+            task = std::move( queue_.front() );
+            queue_.pop_front();
+            busy_ = true;
+        }
+        try {
+            task();
+        }
+        catch (...) {
+            std::lock_guard< std::mutex > lock( mutex_ );
+            if (! error_)
+                error_ = std::current_exception();
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+void HostStream::enqueue( std::function<void ()> task )
+{
+    task = trace_task( "queue", std::move( task ) );
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        queue_.push_back( std::move( task ) );
+        if (! thread_.joinable())
+            thread_ = std::thread( &HostStream::run, this );
+    }
+    cv_.notify_one();
+}
+
+//------------------------------------------------------------------------------
+void HostStream::sync()
+{
+    std::exception_ptr error;
+    {
+        std::unique_lock< std::mutex > lock( mutex_ );
+        idle_cv_.wait( lock, [this] { return ! busy_ && queue_.empty(); } );
+        error.swap( error_ );
+    }
+    if (error)
+        std::rethrow_exception( error );
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
@@ -0,0 +1,160 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
+
+#include "stub_common.hh"
+
+#include <algorithm>
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Workspace query for LAPACK sytrf. The workspace holds work, then,
+// if lapack_int is 32-bit, n pivots that are copied to dev_ipiv.
+// @return bytes of workspace, and sets lwork.
+template <typename scalar_t>
+static size_t sytrf_work(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    lapack_int* lwork )
+{
+    scalar_t qry_work[ 1 ];
+    lapack_int qry_ipiv[ 1 ];
+    internal::stub_sytrf( to_char( uplo ), to_lapack_int( n ),
+                          dA, to_lapack_int( ldda ), qry_ipiv,
+                          qry_work, -1 );
+    *lwork = lapack_int( blas::real( qry_work[ 0 ] ) );
+    size_t bytes = sizeof(scalar_t) * *lwork;
+    #ifndef LAPACK_ILP64
+        bytes = internal::stub_align( bytes ) + sizeof(lapack_int) * n;
+    #endif
+    return bytes;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around workspace query.
+// dA is only for templating scalar_t; it isn't referenced.
+// As with cuSolver, the workspace is in device memory.
+template <typename scalar_t>
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    lapack_int lwork;
+    *dev_work_size  = sytrf_work( uplo, n, dA, ldda, &lwork );
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Host backend: runs LAPACK on the queue's host stream,
+// with dA, etc. in host memory.
+// This is async. Once finished, the return info is in dev_info.
+template <typename scalar_t>
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, n ) );
+
+    lapack_int lwork;
+    size_t bytes = sytrf_work( uplo, n, dA, ldda, &lwork );
+    lapack_error_if( dev_work_size < bytes );
+
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldda_ = to_lapack_int( ldda );
+    scalar_t* work = (scalar_t*) dev_work;
+    queue.enqueue( [=]() {
+        #ifdef LAPACK_ILP64
+            // device_sytrf_pivot_int is int64_t, so pivots are written directly.
+            *dev_info = internal::stub_sytrf( uplo_, n_, dA, ldda_, dev_ipiv,
+                                              work, lwork );
+        #else
+            lapack_int* ipiv = (lapack_int*) ((char*) dev_work
+                + internal::stub_align( sizeof(scalar_t) * lwork ));
+            *dev_info = internal::stub_sytrf( uplo_, n_, dA, ldda_, ipiv,
+                                              work, lwork );
+            std::copy( ipiv, ipiv + n, dev_ipiv );
+        #endif
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda, device_sytrf_pivot_int* dev_ipiv,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
@@ -0,0 +1,118 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
+
+#include "lapack/device.hh"
+#include "lapack/wrappers.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Wrapper around workspace query.
+// dA is only for templating scalar_t; it isn't referenced.
+// LAPACK trtri needs no workspace.
+template <typename scalar_t>
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    *dev_work_size  = 0;
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Host backend: runs the host LAPACK routine on the queue's host stream,
+// with dA, etc. in host memory.
+// This is async. Once finished, the return info is in dev_info.
+template <typename scalar_t>
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( diag != Diag::NonUnit && diag != Diag::Unit );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, n ) );
+
+    queue.enqueue( [=]() {
+        *dev_info = lapack::trtri( uplo, diag, n, dA, ldda );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    float* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    double* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<float>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void trtri_work_size_bytes(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<double>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    float* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    double* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<float>* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void trtri(
+    lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<double>* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
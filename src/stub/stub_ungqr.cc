@@ -0,0 +1,141 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
+
+#include "stub_common.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Workspace query for LAPACK ungqr (orgqr for real).
+// @return lwork, in elements of scalar_t.
+template <typename scalar_t>
+static lapack_int ungqr_lwork(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau )
+{
+    scalar_t qry_work[ 1 ];
+    internal::stub_ungqr( to_lapack_int( m ), to_lapack_int( n ),
+                          to_lapack_int( k ), dA, to_lapack_int( ldda ),
+                          dtau, qry_work, -1 );
+    return lapack_int( blas::real( qry_work[ 0 ] ) );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around workspace query.
+// dA and dtau are only for templating scalar_t; they aren't referenced.
+// As with cuSolver, the workspace is in device memory.
+template <typename scalar_t>
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    *dev_work_size  = sizeof(scalar_t) * ungqr_lwork( m, n, k, dA, ldda, dtau );
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Host backend: runs LAPACK on the queue's host stream,
+// with dA, etc. in host memory.
+// This is async. Once finished, the return info is in dev_info.
+template <typename scalar_t>
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 || n > m );
+    lapack_error_if( k < 0 || k > n );
+    lapack_error_if( ldda < blas::max( 1, m ) );
+
+    lapack_int lwork = ungqr_lwork( m, n, k, dA, ldda, dtau );
+    lapack_error_if( dev_work_size < sizeof(scalar_t) * lwork );
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int ldda_ = to_lapack_int( ldda );
+    scalar_t* work = (scalar_t*) dev_work;
+    queue.enqueue( [=]() {
+        *dev_info = internal::stub_ungqr( m_, n_, k_, dA, ldda_, dtau,
+                                          work, lwork );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    float* dA, int64_t ldda, float const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    double* dA, int64_t ldda, double const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* dA, int64_t ldda, std::complex<float> const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* dA, int64_t ldda, std::complex<double> const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    float* dA, int64_t ldda, float const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    double* dA, int64_t ldda, double const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* dA, int64_t ldda, std::complex<float> const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* dA, int64_t ldda, std::complex<double> const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
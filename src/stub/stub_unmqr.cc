@@ -0,0 +1,167 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
+
+#include "stub_common.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Workspace query for LAPACK unmqr (ormqr for real).
+// @return lwork, in elements of scalar_t.
+template <typename scalar_t>
+static lapack_int unmqr_lwork(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc )
+{
+    scalar_t qry_work[ 1 ];
+    internal::stub_unmqr( to_char( side ), to_char( trans ),
+                          to_lapack_int( m ), to_lapack_int( n ),
+                          to_lapack_int( k ), dA, to_lapack_int( ldda ), dtau,
+                          dC, to_lapack_int( lddc ), qry_work, -1 );
+    return lapack_int( blas::real( qry_work[ 0 ] ) );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around workspace query.
+// dA, etc. are only for templating scalar_t; they aren't referenced.
+// As with cuSolver, the workspace is in device memory.
+template <typename scalar_t>
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    *dev_work_size  = sizeof(scalar_t)
+                    * unmqr_lwork( side, trans, m, n, k, dA, ldda, dtau,
+                                   dC, lddc );
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Host backend: runs LAPACK on the queue's host stream,
+// with dA, etc. in host memory.
+// This is async. Once finished, the return info is in dev_info.
+template <typename scalar_t>
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    int64_t nq = (side == Side::Left ? m : n);
+    lapack_error_if( side != Side::Left && side != Side::Right );
+    // Trans is allowed only for real, where it equals ConjTrans.
+    lapack_error_if( trans != Op::NoTrans && trans != Op::ConjTrans
+                     && (trans != Op::Trans
+                         || blas::is_complex<scalar_t>::value) );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 || k > nq );
+    lapack_error_if( ldda < blas::max( 1, nq ) );
+    lapack_error_if( lddc < blas::max( 1, m ) );
+
+    lapack_int lwork = unmqr_lwork( side, trans, m, n, k, dA, ldda, dtau,
+                                    dC, lddc );
+    lapack_error_if( dev_work_size < sizeof(scalar_t) * lwork );
+
+    char side_ = to_char( side );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int ldda_ = to_lapack_int( ldda );
+    lapack_int lddc_ = to_lapack_int( lddc );
+    scalar_t* work = (scalar_t*) dev_work;
+    queue.enqueue( [=]() {
+        *dev_info = internal::stub_unmqr( side_, trans_, m_, n_, k_,
+                                          dA, ldda_, dtau, dC, lddc_,
+                                          work, lwork );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* dA, int64_t ldda, float const* dtau,
+    float* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* dA, int64_t ldda, double const* dtau,
+    double* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* dA, int64_t ldda, std::complex<float> const* dtau,
+    std::complex<float>* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* dA, int64_t ldda, std::complex<double> const* dtau,
+    std::complex<double>* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* dA, int64_t ldda, float const* dtau,
+    float* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* dA, int64_t ldda, double const* dtau,
+    double* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* dA, int64_t ldda, std::complex<float> const* dtau,
+    std::complex<float>* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* dA, int64_t ldda, std::complex<double> const* dtau,
+    std::complex<double>* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
@@ -4,6 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
+#include "lapack_internal.hh"
 #include "lapack/fortran.h"
 
 #include <vector>
@@ -100,6 +101,9 @@ template <typename scalar_t>
 int64_t sturm(
     int64_t n, scalar_t const* diag, scalar_t const* offd, scalar_t u )
 {
+    lapack_instrument( "sturm", internal::precision_char< scalar_t >(), 0, n, 0,
+                       Gflop< scalar_t >::sturm( n ) );
+
     int64_t i, isneg=0;
     scalar_t s, w, v0, v1, Pm1_0, Pm1_1, phi, upsilon;
     if (n == 0)
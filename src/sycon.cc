@@ -24,6 +24,8 @@ int64_t sycon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "sycon", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -61,6 +63,8 @@ int64_t sycon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "sycon", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -98,6 +102,8 @@ int64_t sycon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "sycon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -177,6 +183,8 @@ int64_t sycon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "sycon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -27,6 +27,9 @@ int64_t sycon_rk(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "sycon_rk", 's', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -66,6 +69,9 @@ int64_t sycon_rk(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "sycon_rk", 'd', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -105,6 +111,9 @@ int64_t sycon_rk(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    lapack_instrument( "sycon_rk", 'c', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -219,6 +228,9 @@ int64_t sycon_rk(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    lapack_instrument( "sycon_rk", 'z', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
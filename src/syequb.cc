@@ -25,6 +25,8 @@ int64_t syequb(
     float* scond,
     float* amax )
 {
+    lapack_instrument( "syequb", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -54,6 +56,8 @@ int64_t syequb(
     double* scond,
     double* amax )
 {
+    lapack_instrument( "syequb", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -83,6 +87,8 @@ int64_t syequb(
     float* scond,
     float* amax )
 {
+    lapack_instrument( "syequb", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -157,6 +163,8 @@ int64_t syequb(
     double* scond,
     double* amax )
 {
+    lapack_instrument( "syequb", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
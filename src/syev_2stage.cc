@@ -25,6 +25,9 @@ int64_t syev_2stage(
     float* A, int64_t lda,
     float* W )
 {
+    lapack_instrument( "syev_2stage", 's', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -68,6 +71,9 @@ int64_t syev_2stage(
     double* A, int64_t lda,
     double* W )
 {
+    lapack_instrument( "syev_2stage", 'd', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
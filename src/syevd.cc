@@ -23,6 +23,8 @@ int64_t syevd(
     float* A, int64_t lda,
     float* W )
 {
+    lapack_instrument( "syevd", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -71,6 +73,8 @@ int64_t syevd(
     double* A, int64_t lda,
     double* W )
 {
+    lapack_instrument( "syevd", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -26,6 +26,8 @@ int64_t syevr(
     float* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "syevr", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -97,6 +99,8 @@ int64_t syevr(
     double* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "syevr", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -28,6 +28,9 @@ int64_t syevr_2stage(
     float* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "syevr_2stage", 's', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -99,6 +102,9 @@ int64_t syevr_2stage(
     double* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    lapack_instrument( "syevr_2stage", 'd', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -26,6 +26,8 @@ int64_t syevx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "syevx", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -98,6 +100,8 @@ int64_t syevx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "syevx", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
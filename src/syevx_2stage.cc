@@ -28,6 +28,9 @@ int64_t syevx_2stage(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "syevx_2stage", 's', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -100,6 +103,9 @@ int64_t syevx_2stage(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "syevx_2stage", 'd', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -21,6 +21,8 @@ int64_t sygst(
     float* A, int64_t lda,
     float const* B, int64_t ldb )
 {
+    lapack_instrument( "sygst", 's', 0, n, 0, Gflop< float >::sygst( n ) );
+
     lapack_int itype_ = to_lapack_int( itype );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -45,6 +47,8 @@ int64_t sygst(
     double* A, int64_t lda,
     double const* B, int64_t ldb )
 {
+    lapack_instrument( "sygst", 'd', 0, n, 0, Gflop< double >::sygst( n ) );
+
     lapack_int itype_ = to_lapack_int( itype );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
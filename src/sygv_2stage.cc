@@ -25,6 +25,9 @@ int64_t sygv_2stage(
     float* B, int64_t ldb,
     float* W )
 {
+    lapack_instrument( "sygv_2stage", 's', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -71,6 +74,9 @@ int64_t sygv_2stage(
     double* B, int64_t ldb,
     double* W )
 {
+    lapack_instrument( "sygv_2stage", 'd', 0, n, 0,
+                       internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -23,6 +23,8 @@ int64_t sygvd(
     float* B, int64_t ldb,
     float* W )
 {
+    lapack_instrument( "sygvd", 's', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -74,6 +76,8 @@ int64_t sygvd(
     double* B, int64_t ldb,
     double* W )
 {
+    lapack_instrument( "sygvd", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -26,6 +26,8 @@ int64_t sygvx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "sygvx", 's', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -101,6 +103,8 @@ int64_t sygvx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    lapack_instrument( "sygvx", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
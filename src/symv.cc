@@ -29,6 +29,9 @@ void symv(
         std::complex<float> beta,
         std::complex<float>       *y, int64_t incy )
 {
+    lapack_instrument( "symv", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::symv( n ) );
+
     // check arguments
     lapack_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -71,6 +74,9 @@ void symv(
         std::complex<double> beta,
         std::complex<double>       *y, int64_t incy )
 {
+    lapack_instrument( "symv", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::symv( n ) );
+
     // check arguments
     lapack_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -25,6 +25,9 @@ void syr(
     std::complex<float> const *x, int64_t incx,
     std::complex<float>       *A, int64_t lda )
 {
+    lapack_instrument( "syr", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::syr( n ) );
+
     // check arguments
     lapack_error_if( layout != Layout::ColMajor &&
                layout != Layout::RowMajor );
@@ -61,6 +64,9 @@ void syr(
     std::complex<double> const *x, int64_t incx,
     std::complex<double>       *A, int64_t lda )
 {
+    lapack_instrument( "syr", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::syr( n ) );
+
     // check arguments
     lapack_error_if( layout != Layout::ColMajor &&
                layout != Layout::RowMajor );
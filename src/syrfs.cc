@@ -28,6 +28,9 @@ int64_t syrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "syrfs", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -78,6 +81,9 @@ int64_t syrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "syrfs", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -128,6 +134,9 @@ int64_t syrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "syrfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -262,6 +271,9 @@ int64_t syrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "syrfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -34,6 +34,9 @@ int64_t syrfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    lapack_instrument( "syrfsx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -94,6 +97,9 @@ int64_t syrfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    lapack_instrument( "syrfsx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -154,6 +160,9 @@ int64_t syrfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    lapack_instrument( "syrfsx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -486,6 +495,9 @@ int64_t syrfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    lapack_instrument( "syrfsx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
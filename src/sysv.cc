@@ -24,6 +24,9 @@ int64_t sysv(
     int64_t* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "sysv", 's', 0, n, nrhs,
+                       Gflop< float >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -80,6 +83,9 @@ int64_t sysv(
     int64_t* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "sysv", 'd', 0, n, nrhs,
+                       Gflop< double >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -136,6 +142,9 @@ int64_t sysv(
     int64_t* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "sysv", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -271,6 +280,9 @@ int64_t sysv(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "sysv", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
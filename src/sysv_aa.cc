@@ -26,6 +26,9 @@ int64_t sysv_aa(
     int64_t* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "sysv_aa", 's', 0, n, nrhs,
+                       Gflop< float >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -108,6 +111,9 @@ int64_t sysv_aa(
     int64_t* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "sysv_aa", 'd', 0, n, nrhs,
+                       Gflop< double >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -191,6 +197,9 @@ int64_t sysv_aa(
     int64_t* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "sysv_aa", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -342,6 +351,9 @@ int64_t sysv_aa(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "sysv_aa", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -27,6 +27,9 @@ int64_t sysv_rk(
     int64_t* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "sysv_rk", 's', 0, n, nrhs,
+                       Gflop< float >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -86,6 +89,9 @@ int64_t sysv_rk(
     int64_t* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "sysv_rk", 'd', 0, n, nrhs,
+                       Gflop< double >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -145,6 +151,9 @@ int64_t sysv_rk(
     int64_t* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "sysv_rk", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -317,6 +326,9 @@ int64_t sysv_rk(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "sysv_rk", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
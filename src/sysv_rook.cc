@@ -26,6 +26,9 @@ int64_t sysv_rook(
     int64_t* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "sysv_rook", 's', 0, n, nrhs,
+                       Gflop< float >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -82,6 +85,9 @@ int64_t sysv_rook(
     int64_t* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "sysv_rook", 'd', 0, n, nrhs,
+                       Gflop< double >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -138,6 +144,9 @@ int64_t sysv_rook(
     int64_t* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "sysv_rook", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -196,6 +205,9 @@ int64_t sysv_rook(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "sysv_rook", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::sysv( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -29,6 +29,9 @@ int64_t sysvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "sysvx", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -105,6 +108,9 @@ int64_t sysvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "sysvx", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -181,6 +187,9 @@ int64_t sysvx(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "sysvx", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -392,6 +401,9 @@ int64_t sysvx(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "sysvx", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -23,6 +23,8 @@ void syswapr(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda, int64_t i1, int64_t i2 )
 {
+    lapack_instrument( "syswapr", 's', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -41,6 +43,8 @@ void syswapr(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda, int64_t i1, int64_t i2 )
 {
+    lapack_instrument( "syswapr", 'd', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -59,6 +63,8 @@ void syswapr(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda, int64_t i1, int64_t i2 )
 {
+    lapack_instrument( "syswapr", 'c', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -107,6 +113,8 @@ void syswapr(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda, int64_t i1, int64_t i2 )
 {
+    lapack_instrument( "syswapr", 'z', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
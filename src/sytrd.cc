@@ -25,6 +25,8 @@ int64_t sytrd(
     float* E,
     float* tau )
 {
+    lapack_instrument( "sytrd", 's', 0, n, 0, Gflop< float >::sytrd( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -73,6 +75,8 @@ int64_t sytrd(
     double* E,
     double* tau )
 {
+    lapack_instrument( "sytrd", 'd', 0, n, 0, Gflop< double >::sytrd( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
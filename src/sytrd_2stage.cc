@@ -28,6 +28,9 @@ int64_t sytrd_2stage(
     float* tau,
     float* hous2, int64_t lhous2 )
 {
+    lapack_instrument( "sytrd_2stage", 's', 0, n, 0,
+                       Gflop< float >::sytrd( n ) );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -81,6 +84,9 @@ int64_t sytrd_2stage(
     double* tau,
     double* hous2, int64_t lhous2 )
 {
+    lapack_instrument( "sytrd_2stage", 'd', 0, n, 0,
+                       Gflop< double >::sytrd( n ) );
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -23,6 +23,8 @@ int64_t sytrf(
     float* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf", 's', 0, n, 0, Gflop< float >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -74,6 +76,8 @@ int64_t sytrf(
     double* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf", 'd', 0, n, 0, Gflop< double >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -125,6 +129,9 @@ int64_t sytrf(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -285,6 +292,9 @@ int64_t sytrf(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -25,6 +25,8 @@ int64_t sytrf_aa(
     float* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf_aa", 's', 0, n, 0, Gflop< float >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -76,6 +78,8 @@ int64_t sytrf_aa(
     double* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf_aa", 'd', 0, n, 0, Gflop< double >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -127,6 +131,9 @@ int64_t sytrf_aa(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf_aa", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -229,6 +236,9 @@ int64_t sytrf_aa(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf_aa", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -26,6 +26,8 @@ int64_t sytrf_rk(
     float* E,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf_rk", 's', 0, n, 0, Gflop< float >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -80,6 +82,8 @@ int64_t sytrf_rk(
     double* E,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf_rk", 'd', 0, n, 0, Gflop< double >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -134,6 +138,9 @@ int64_t sytrf_rk(
     std::complex<float>* E,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf_rk", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -345,6 +352,9 @@ int64_t sytrf_rk(
     std::complex<double>* E,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf_rk", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -25,6 +25,8 @@ int64_t sytrf_rook(
     float* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf_rook", 's', 0, n, 0, Gflop< float >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -76,6 +78,9 @@ int64_t sytrf_rook(
     double* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf_rook", 'd', 0, n, 0,
+                       Gflop< double >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -127,6 +132,9 @@ int64_t sytrf_rook(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf_rook", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -180,6 +188,9 @@ int64_t sytrf_rook(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv )
 {
+    lapack_instrument( "sytrf_rook", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::sytrf( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -23,6 +23,8 @@ int64_t sytri(
     float* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sytri", 's', 0, n, 0, Gflop< float >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -57,6 +59,8 @@ int64_t sytri(
     double* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sytri", 'd', 0, n, 0, Gflop< double >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -91,6 +95,9 @@ int64_t sytri(
     std::complex<float>* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sytri", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -170,6 +177,9 @@ int64_t sytri(
     std::complex<double>* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sytri", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
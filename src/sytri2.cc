@@ -25,6 +25,8 @@ int64_t sytri2(
     float* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sytri2", 's', 0, n, 0, Gflop< float >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -73,6 +75,8 @@ int64_t sytri2(
     double* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sytri2", 'd', 0, n, 0, Gflop< double >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -120,6 +124,9 @@ int64_t sytri2(
     std::complex<float>* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sytri2", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -214,6 +221,9 @@ int64_t sytri2(
     std::complex<double>* A, int64_t lda,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sytri2", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -26,6 +26,8 @@ int64_t sytri_rk(
     float const* E,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sytri_rk", 's', 0, n, 0, Gflop< float >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -77,6 +79,8 @@ int64_t sytri_rk(
     double const* E,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sytri_rk", 'd', 0, n, 0, Gflop< double >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -128,6 +132,9 @@ int64_t sytri_rk(
     std::complex<float> const* E,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sytri_rk", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -265,6 +272,9 @@ int64_t sytri_rk(
     std::complex<double> const* E,
     int64_t const* ipiv )
 {
+    lapack_instrument( "sytri_rk", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::sytri( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
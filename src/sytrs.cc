@@ -24,6 +24,9 @@ int64_t sytrs(
     int64_t const* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs", 's', 0, n, nrhs,
+                       Gflop< float >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -58,6 +61,9 @@ int64_t sytrs(
     int64_t const* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs", 'd', 0, n, nrhs,
+                       Gflop< double >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -92,6 +98,9 @@ int64_t sytrs(
     int64_t const* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -173,6 +182,9 @@ int64_t sytrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -26,6 +26,9 @@ int64_t sytrs2(
     int64_t const* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs2", 's', 0, n, nrhs,
+                       Gflop< float >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -64,6 +67,9 @@ int64_t sytrs2(
     int64_t const* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs2", 'd', 0, n, nrhs,
+                       Gflop< double >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -102,6 +108,9 @@ int64_t sytrs2(
     int64_t const* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs2", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -192,6 +201,9 @@ int64_t sytrs2(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs2", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -26,6 +26,9 @@ int64_t sytrs_aa(
     int64_t const* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs_aa", 's', 0, n, nrhs,
+                       Gflop< float >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -65,6 +68,9 @@ int64_t sytrs_aa(
     int64_t const* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs_aa", 'd', 0, n, nrhs,
+                       Gflop< double >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -104,6 +110,9 @@ int64_t sytrs_aa(
     int64_t const* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs_aa", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -186,6 +195,9 @@ int64_t sytrs_aa(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs_aa", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -27,6 +27,9 @@ int64_t sytrs_rk(
     int64_t const* ipiv,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs_rk", 's', 0, n, nrhs,
+                       Gflop< float >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -63,6 +66,9 @@ int64_t sytrs_rk(
     int64_t const* ipiv,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs_rk", 'd', 0, n, nrhs,
+                       Gflop< double >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -99,6 +105,9 @@ int64_t sytrs_rk(
     int64_t const* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs_rk", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -219,6 +228,9 @@ int64_t sytrs_rk(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "sytrs_rk", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::sytrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
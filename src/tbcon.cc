@@ -22,6 +22,8 @@ int64_t tbcon(
     float const* AB, int64_t ldab,
     float* rcond )
 {
+    lapack_instrument( "tbcon", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -52,6 +54,8 @@ int64_t tbcon(
     double const* AB, int64_t ldab,
     double* rcond )
 {
+    lapack_instrument( "tbcon", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -82,6 +86,8 @@ int64_t tbcon(
     std::complex<float> const* AB, int64_t ldab,
     float* rcond )
 {
+    lapack_instrument( "tbcon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -112,6 +118,8 @@ int64_t tbcon(
     std::complex<double> const* AB, int64_t ldab,
     double* rcond )
 {
+    lapack_instrument( "tbcon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
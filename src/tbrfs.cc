@@ -25,6 +25,9 @@ int64_t tbrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "tbrfs", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -65,6 +68,9 @@ int64_t tbrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "tbrfs", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -105,6 +111,9 @@ int64_t tbrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "tbrfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -145,6 +154,9 @@ int64_t tbrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "tbrfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -21,6 +21,9 @@ int64_t tbtrs(
     float const* AB, int64_t ldab,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "tbtrs", 's', 0, n, nrhs,
+                       Gflop< float >::tbtrs( n, kd, nrhs ) );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -48,6 +51,9 @@ int64_t tbtrs(
     double const* AB, int64_t ldab,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "tbtrs", 'd', 0, n, nrhs,
+                       Gflop< double >::tbtrs( n, kd, nrhs ) );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -75,6 +81,9 @@ int64_t tbtrs(
     std::complex<float> const* AB, int64_t ldab,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "tbtrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::tbtrs( n, kd, nrhs ) );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -102,6 +111,9 @@ int64_t tbtrs(
     std::complex<double> const* AB, int64_t ldab,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "tbtrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::tbtrs( n, kd, nrhs ) );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -21,6 +21,9 @@ void tfsm(
     float const* A,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "tfsm", 's', m, n, 0,
+                       Gflop< float >::trsm( side, m, n ) );
+
     char transr_ = to_char( transr );
     char side_ = to_char( side );
     char uplo_ = to_char( uplo );
@@ -43,6 +46,9 @@ void tfsm(
     double const* A,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "tfsm", 'd', m, n, 0,
+                       Gflop< double >::trsm( side, m, n ) );
+
     char transr_ = to_char( transr );
     char side_ = to_char( side );
     char uplo_ = to_char( uplo );
@@ -65,6 +71,9 @@ void tfsm(
     std::complex<float> const* A,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "tfsm", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::trsm( side, m, n ) );
+
     char transr_ = to_char( transr );
     char side_ = to_char( side );
     char uplo_ = to_char( uplo );
@@ -88,6 +97,9 @@ void tfsm(
     std::complex<double> const* A,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "tfsm", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::trsm( side, m, n ) );
+
     char transr_ = to_char( transr );
     char side_ = to_char( side );
     char uplo_ = to_char( uplo );
@@ -20,6 +20,8 @@ int64_t tftri(
     lapack::Op transr, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     float* A )
 {
+    lapack_instrument( "tftri", 's', 0, n, 0, Gflop< float >::trtri( n ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -41,6 +43,8 @@ int64_t tftri(
     lapack::Op transr, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     double* A )
 {
+    lapack_instrument( "tftri", 'd', 0, n, 0, Gflop< double >::trtri( n ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -62,6 +66,9 @@ int64_t tftri(
     lapack::Op transr, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<float>* A )
 {
+    lapack_instrument( "tftri", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::trtri( n ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -83,6 +90,9 @@ int64_t tftri(
     lapack::Op transr, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<double>* A )
 {
+    lapack_instrument( "tftri", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::trtri( n ) );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
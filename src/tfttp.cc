@@ -21,6 +21,8 @@ int64_t tfttp(
     float const* ARF,
     float* AP )
 {
+    lapack_instrument( "tfttp", 's', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -43,6 +45,8 @@ int64_t tfttp(
     double const* ARF,
     double* AP )
 {
+    lapack_instrument( "tfttp", 'd', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -65,6 +69,8 @@ int64_t tfttp(
     std::complex<float> const* ARF,
     std::complex<float>* AP )
 {
+    lapack_instrument( "tfttp", 'c', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -87,6 +93,8 @@ int64_t tfttp(
     std::complex<double> const* ARF,
     std::complex<double>* AP )
 {
+    lapack_instrument( "tfttp", 'z', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
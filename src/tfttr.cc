@@ -21,6 +21,8 @@ int64_t tfttr(
     float const* ARF,
     float* A, int64_t lda )
 {
+    lapack_instrument( "tfttr", 's', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -44,6 +46,8 @@ int64_t tfttr(
     double const* ARF,
     double* A, int64_t lda )
 {
+    lapack_instrument( "tfttr", 'd', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -67,6 +71,8 @@ int64_t tfttr(
     std::complex<float> const* ARF,
     std::complex<float>* A, int64_t lda )
 {
+    lapack_instrument( "tfttr", 'c', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -90,6 +96,8 @@ int64_t tfttr(
     std::complex<double> const* ARF,
     std::complex<double>* A, int64_t lda )
 {
+    lapack_instrument( "tfttr", 'z', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
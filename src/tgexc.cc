@@ -270,6 +270,8 @@ int64_t tgexc(
     float* Z, int64_t ldz,
     int64_t* ifst, int64_t* ilst )
 {
+    lapack_instrument( "tgexc", 's', 0, n, 0, internal::gflop_data_dependent );
+
     return impl::tgexc(
         wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst );
 }
@@ -286,6 +288,8 @@ int64_t tgexc(
     int64_t* ifst,
     int64_t* ilst )
 {
+    lapack_instrument( "tgexc", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     return impl::tgexc(
         wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst );
 }
@@ -301,6 +305,8 @@ int64_t tgexc(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifst, int64_t* ilst )
 {
+    lapack_instrument( "tgexc", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     return impl::tgexc(
         wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst );
 }
@@ -316,6 +322,8 @@ int64_t tgexc(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifst, int64_t* ilst )
 {
+    lapack_instrument( "tgexc", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     return impl::tgexc(
         wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst );
 }
@@ -500,6 +500,8 @@ int64_t tgsen(
     float* pl, float* pr,
     float* dif )
 {
+    lapack_instrument( "tgsen", 's', 0, n, 0, internal::gflop_data_dependent );
+
     return impl::tgsen(
         ijob, wantq, wantz, select, n,
         A, lda, B, ldb, alpha, beta,
@@ -522,6 +524,8 @@ int64_t tgsen(
     double* pl, double* pr,
     double* dif )
 {
+    lapack_instrument( "tgsen", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     return impl::tgsen(
         ijob, wantq, wantz, select, n,
         A, lda, B, ldb, alpha, beta,
@@ -544,6 +548,8 @@ int64_t tgsen(
     float* pl, float* pr,
     float* dif )
 {
+    lapack_instrument( "tgsen", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     return impl::tgsen(
         ijob, wantq, wantz, select, n,
         A, lda, B, ldb, alpha, beta,
@@ -566,6 +572,8 @@ int64_t tgsen(
     double* pl, double* pr,
     double* dif )
 {
+    lapack_instrument( "tgsen", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     return impl::tgsen(
         ijob, wantq, wantz, select, n,
         A, lda, B, ldb, alpha, beta,
@@ -28,6 +28,8 @@ int64_t tgsja(
     float* Q, int64_t ldq,
     int64_t* ncycle )
 {
+    lapack_instrument( "tgsja", 's', m, n, k, internal::gflop_data_dependent );
+
     char jobu_ = to_char_compu( jobu );
     char jobv_ = to_char_comp( jobv );
     char jobq_ = to_char_compq( jobq );
@@ -77,6 +79,8 @@ int64_t tgsja(
     double* Q, int64_t ldq,
     int64_t* ncycle )
 {
+    lapack_instrument( "tgsja", 'd', m, n, k, internal::gflop_data_dependent );
+
     char jobu_ = to_char_compu( jobu );
     char jobv_ = to_char_comp( jobv );
     char jobq_ = to_char_compq( jobq );
@@ -126,6 +130,8 @@ int64_t tgsja(
     std::complex<float>* Q, int64_t ldq,
     int64_t* ncycle )
 {
+    lapack_instrument( "tgsja", 'c', m, n, k, internal::gflop_data_dependent );
+
     char jobu_ = to_char_compu( jobu );
     char jobv_ = to_char_comp( jobv );
     char jobq_ = to_char_compq( jobq );
@@ -175,6 +181,8 @@ int64_t tgsja(
     std::complex<double>* Q, int64_t ldq,
     int64_t* ncycle )
 {
+    lapack_instrument( "tgsja", 'z', m, n, k, internal::gflop_data_dependent );
+
     char jobu_ = to_char_compu( jobu );
     char jobv_ = to_char_comp( jobv );
     char jobq_ = to_char_compq( jobq );
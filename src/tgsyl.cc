@@ -28,6 +28,8 @@ int64_t tgsyl(
     float* dif,
     float* scale )
 {
+    lapack_instrument( "tgsyl", 's', m, n, 0, internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int m_ = to_lapack_int( m );
@@ -93,6 +95,8 @@ int64_t tgsyl(
     double* dif,
     double* scale )
 {
+    lapack_instrument( "tgsyl", 'd', m, n, 0, internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int m_ = to_lapack_int( m );
@@ -158,6 +162,8 @@ int64_t tgsyl(
     float* dif,
     float* scale )
 {
+    lapack_instrument( "tgsyl", 'c', m, n, 0, internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int m_ = to_lapack_int( m );
@@ -223,6 +229,8 @@ int64_t tgsyl(
     double* dif,
     double* scale )
 {
+    lapack_instrument( "tgsyl", 'z', m, n, 0, internal::gflop_data_dependent );
+
     char trans_ = to_char( trans );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int m_ = to_lapack_int( m );
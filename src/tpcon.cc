@@ -22,6 +22,8 @@ int64_t tpcon(
     float const* AP,
     float* rcond )
 {
+    lapack_instrument( "tpcon", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -50,6 +52,8 @@ int64_t tpcon(
     double const* AP,
     double* rcond )
 {
+    lapack_instrument( "tpcon", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -78,6 +82,8 @@ int64_t tpcon(
     std::complex<float> const* AP,
     float* rcond )
 {
+    lapack_instrument( "tpcon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -106,6 +112,8 @@ int64_t tpcon(
     std::complex<double> const* AP,
     double* rcond )
 {
+    lapack_instrument( "tpcon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
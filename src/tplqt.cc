@@ -26,6 +26,8 @@ int64_t tplqt(
     float* B, int64_t ldb,
     float* T, int64_t ldt )
 {
+    lapack_instrument( "tplqt", 's', m, n, 0, Gflop< float >::tplqt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -58,6 +60,8 @@ int64_t tplqt(
     double* B, int64_t ldb,
     double* T, int64_t ldt )
 {
+    lapack_instrument( "tplqt", 'd', m, n, 0, Gflop< double >::tplqt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -90,6 +94,9 @@ int64_t tplqt(
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* T, int64_t ldt )
 {
+    lapack_instrument( "tplqt", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::tplqt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -218,6 +225,9 @@ int64_t tplqt(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* T, int64_t ldt )
 {
+    lapack_instrument( "tplqt", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::tplqt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -25,6 +25,8 @@ int64_t tplqt2(
     float* B, int64_t ldb,
     float* T, int64_t ldt )
 {
+    lapack_instrument( "tplqt2", 's', m, n, 0, Gflop< float >::tplqt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -52,6 +54,8 @@ int64_t tplqt2(
     double* B, int64_t ldb,
     double* T, int64_t ldt )
 {
+    lapack_instrument( "tplqt2", 'd', m, n, 0, Gflop< double >::tplqt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -79,6 +83,9 @@ int64_t tplqt2(
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* T, int64_t ldt )
 {
+    lapack_instrument( "tplqt2", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::tplqt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -195,6 +202,9 @@ int64_t tplqt2(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* T, int64_t ldt )
 {
+    lapack_instrument( "tplqt2", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::tplqt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -27,6 +27,9 @@ int64_t tpmlqt(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "tpmlqt", 's', m, n, k,
+                       Gflop< float >::tpmlqt( m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -71,6 +74,9 @@ int64_t tpmlqt(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "tpmlqt", 'd', m, n, k,
+                       Gflop< double >::tpmlqt( m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -115,6 +121,9 @@ int64_t tpmlqt(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "tpmlqt", 'c', m, n, k,
+                       Gflop< std::complex<float> >::tpmlqt( m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -270,6 +279,9 @@ int64_t tpmlqt(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "tpmlqt", 'z', m, n, k,
+                       Gflop< std::complex<double> >::tpmlqt( m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -27,6 +27,9 @@ int64_t tpmqrt(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "tpmqrt", 's', m, n, k,
+                       Gflop< float >::tpmqrt( m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -71,6 +74,9 @@ int64_t tpmqrt(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "tpmqrt", 'd', m, n, k,
+                       Gflop< double >::tpmqrt( m, n, k ) );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -115,6 +121,9 @@ int64_t tpmqrt(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "tpmqrt", 'c', m, n, k,
+                       Gflop< std::complex<float> >::tpmqrt( m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -273,6 +282,9 @@ int64_t tpmqrt(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "tpmqrt", 'z', m, n, k,
+                       Gflop< std::complex<double> >::tpmqrt( m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -26,6 +26,8 @@ int64_t tpqrt(
     float* B, int64_t ldb,
     float* T, int64_t ldt )
 {
+    lapack_instrument( "tpqrt", 's', m, n, 0, Gflop< float >::tpqrt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -58,6 +60,8 @@ int64_t tpqrt(
     double* B, int64_t ldb,
     double* T, int64_t ldt )
 {
+    lapack_instrument( "tpqrt", 'd', m, n, 0, Gflop< double >::tpqrt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -90,6 +94,9 @@ int64_t tpqrt(
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* T, int64_t ldt )
 {
+    lapack_instrument( "tpqrt", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::tpqrt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -122,6 +129,9 @@ int64_t tpqrt(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* T, int64_t ldt )
 {
+    lapack_instrument( "tpqrt", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::tpqrt( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
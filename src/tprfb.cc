@@ -29,6 +29,9 @@ void tprfb(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "tprfb", 's', m, n, k,
+                       Gflop< float >::tprfb( m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
@@ -68,6 +71,9 @@ void tprfb(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "tprfb", 'd', m, n, k,
+                       Gflop< double >::tprfb( m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
@@ -107,6 +113,9 @@ void tprfb(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "tprfb", 'c', m, n, k,
+                       Gflop< std::complex<float> >::tprfb( m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
@@ -312,6 +321,9 @@ void tprfb(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "tprfb", 'z', m, n, k,
+                       Gflop< std::complex<double> >::tprfb( m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
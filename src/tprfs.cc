@@ -25,6 +25,9 @@ int64_t tprfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "tprfs", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -63,6 +66,9 @@ int64_t tprfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "tprfs", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -101,6 +107,9 @@ int64_t tprfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "tprfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -139,6 +148,9 @@ int64_t tprfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "tprfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -20,6 +20,8 @@ int64_t tptri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     float* AP )
 {
+    lapack_instrument( "tptri", 's', 0, n, 0, Gflop< float >::trtri( n ) );
+
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
@@ -40,6 +42,8 @@ int64_t tptri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     double* AP )
 {
+    lapack_instrument( "tptri", 'd', 0, n, 0, Gflop< double >::trtri( n ) );
+
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
@@ -60,6 +64,9 @@ int64_t tptri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<float>* AP )
 {
+    lapack_instrument( "tptri", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::trtri( n ) );
+
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
@@ -80,6 +87,9 @@ int64_t tptri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<double>* AP )
 {
+    lapack_instrument( "tptri", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::trtri( n ) );
+
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
@@ -21,6 +21,9 @@ int64_t tptrs(
     float const* AP,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "tptrs", 's', 0, n, nrhs,
+                       Gflop< float >::trtrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -46,6 +49,9 @@ int64_t tptrs(
     double const* AP,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "tptrs", 'd', 0, n, nrhs,
+                       Gflop< double >::trtrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -71,6 +77,9 @@ int64_t tptrs(
     std::complex<float> const* AP,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "tptrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::trtrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -96,6 +105,9 @@ int64_t tptrs(
     std::complex<double> const* AP,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "tptrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::trtrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
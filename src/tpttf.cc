@@ -21,6 +21,8 @@ int64_t tpttf(
     float const* AP,
     float* ARF )
 {
+    lapack_instrument( "tpttf", 's', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -43,6 +45,8 @@ int64_t tpttf(
     double const* AP,
     double* ARF )
 {
+    lapack_instrument( "tpttf", 'd', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -65,6 +69,8 @@ int64_t tpttf(
     std::complex<float> const* AP,
     std::complex<float>* ARF )
 {
+    lapack_instrument( "tpttf", 'c', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -87,6 +93,8 @@ int64_t tpttf(
     std::complex<double> const* AP,
     std::complex<double>* ARF )
 {
+    lapack_instrument( "tpttf", 'z', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -21,6 +21,8 @@ int64_t tpttr(
     float const* AP,
     float* A, int64_t lda )
 {
+    lapack_instrument( "tpttr", 's', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -43,6 +45,8 @@ int64_t tpttr(
     double const* AP,
     double* A, int64_t lda )
 {
+    lapack_instrument( "tpttr", 'd', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -65,6 +69,8 @@ int64_t tpttr(
     std::complex<float> const* AP,
     std::complex<float>* A, int64_t lda )
 {
+    lapack_instrument( "tpttr", 'c', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -87,6 +93,8 @@ int64_t tpttr(
     std::complex<double> const* AP,
     std::complex<double>* A, int64_t lda )
 {
+    lapack_instrument( "tpttr", 'z', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -0,0 +1,411 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/trace.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+
+#if defined( _WIN32 ) || defined( _WIN64 )
+    #include <process.h>  // _getpid
+#else
+    #include <unistd.h>   // getpid
+#endif
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Events per thread. When full, the oldest events are overwritten.
+const int64_t trace_buffer_size = 16384;
+
+//------------------------------------------------------------------------------
+// Single-producer ring buffer of one thread's events. Only the owning thread
+// writes; readers copy the slots, then discard any the owner may have
+// overwritten meanwhile. Fields are relaxed atomics, so a concurrent read
+// is not a data race, and cost plain stores to write.
+// When its thread exits, the buffer is reused by a new thread; each slot
+// records its thread, so the events of the exited thread keep their thread.
+class TraceBuffer {
+public:
+    explicit TraceBuffer( int64_t thread )
+        : thread_( thread ),
+          head_( 0 ),
+          tail_( 0 ),
+          slots_( new Slot[ trace_buffer_size ] )
+    {}
+
+    // Sets the thread of new events. Called by the new owning thread,
+    // with the registry locked.
+    void set_thread( int64_t thread )
+    {
+        thread_ = thread;
+    }
+
+    void push( char const* routine, char precision, char const* category,
+               int64_t m, int64_t n, int64_t k, int64_t work_bytes,
+               double queued, double start, double end )
+    {
+        const auto relaxed = std::memory_order_relaxed;
+        int64_t i = head_.load( relaxed );
+        Slot& slot = slots_[ i % trace_buffer_size ];
+        slot.thread    .store( thread_,    relaxed );
+        slot.routine   .store( routine,    relaxed );
+        slot.precision .store( precision,  relaxed );
+        slot.category  .store( category,   relaxed );
+        slot.m         .store( m,          relaxed );
+        slot.n         .store( n,          relaxed );
+        slot.k         .store( k,          relaxed );
+        slot.work_bytes.store( work_bytes, relaxed );
+        slot.queued    .store( queued,     relaxed );
+        slot.start     .store( start,      relaxed );
+        slot.end       .store( end,        relaxed );
+        head_.store( i + 1, std::memory_order_release );
+    }
+
+    // Appends this thread's events to events, with times relative to origin.
+    void read( double origin, std::vector< trace::Event >& events )
+    {
+        const auto relaxed = std::memory_order_relaxed;
+        int64_t head = head_.load( std::memory_order_acquire );
+        int64_t tail = std::max( tail_.load( relaxed ),
+                                 head - trace_buffer_size );
+        size_t first = events.size();
+        for (int64_t i = tail; i < head; ++i) {
+            Slot& slot = slots_[ i % trace_buffer_size ];
+            std::string name;
+            char precision = slot.precision.load( relaxed );
+            if (precision != ' ')
+                name += precision;
+            name += slot.routine.load( relaxed );
+            events.push_back( trace::Event {
+                name, slot.category.load( relaxed ), slot.thread.load( relaxed ),
+                slot.m.load( relaxed ), slot.n.load( relaxed ),
+                slot.k.load( relaxed ), slot.work_bytes.load( relaxed ),
+                slot.queued.load( relaxed ) - origin,
+                slot.start .load( relaxed ) - origin,
+                slot.end   .load( relaxed ) - origin } );
+        }
+
+        // Discard slots overwritten during the copy: up to the new head,
+        // plus the one being written.
+        int64_t head2 = head_.load( std::memory_order_acquire );
+        int64_t overwritten = head2 + 1 - trace_buffer_size - tail;
+        if (overwritten > 0) {
+            auto begin = events.begin() + first;
+            events.erase( begin,
+                          begin + std::min( overwritten, head - tail ) );
+        }
+    }
+
+    // Discards events before head. Events pushed concurrently may be kept.
+    void clear()
+    {
+        tail_.store( head_.load( std::memory_order_acquire ),
+                     std::memory_order_relaxed );
+    }
+
+private:
+    struct Slot {
+        std::atomic< int64_t > thread;
+        std::atomic< char const* > routine;
+        std::atomic< char > precision;
+        std::atomic< char const* > category;
+        std::atomic< int64_t > m, n, k, work_bytes;
+        std::atomic< double > queued, start, end;
+    };
+
+    int64_t thread_;
+    std::atomic< int64_t > head_;
+    std::atomic< int64_t > tail_;
+    std::unique_ptr< Slot[] > slots_;
+};
+
+//------------------------------------------------------------------------------
+// Buffers of all threads that have recorded events, and the free list of
+// buffers whose threads have exited. Never destroyed, so buffers outlive
+// their threads, and the trace can be dumped at exit.
+struct TraceRegistry {
+    std::mutex mutex;
+    std::vector< std::unique_ptr< TraceBuffer > > buffers;
+    std::vector< TraceBuffer* > free_buffers;
+    int64_t threads = 0;
+    double origin = instrument_time();
+};
+
+TraceRegistry& trace_registry()
+{
+    static TraceRegistry* r = new TraceRegistry;
+    return *r;
+}
+
+//------------------------------------------------------------------------------
+// Owns a thread's buffer; when the thread exits, returns the buffer to the
+// free list, keeping its events.
+struct TraceBufferOwner {
+    TraceBuffer* buffer = nullptr;
+
+    ~TraceBufferOwner()
+    {
+        if (buffer != nullptr) {
+            TraceRegistry& r = trace_registry();
+            std::lock_guard< std::mutex > lock( r.mutex );
+            r.free_buffers.push_back( buffer );
+        }
+    }
+};
+
+//------------------------------------------------------------------------------
+// This thread's buffer, taken from the free list, or created, on its first
+// event. Events are recorded only while tracing is enabled, so threads that
+// never trace allocate nothing.
+TraceBuffer& trace_buffer()
+{
+    thread_local TraceBufferOwner owner;
+    if (owner.buffer == nullptr) {
+        TraceRegistry& r = trace_registry();
+        std::lock_guard< std::mutex > lock( r.mutex );
+        int64_t thread = ++r.threads;
+        if (! r.free_buffers.empty()) {
+            owner.buffer = r.free_buffers.back();
+            r.free_buffers.pop_back();
+            owner.buffer->set_thread( thread );
+        }
+        else {
+            r.buffers.emplace_back( new TraceBuffer( thread ) );
+            owner.buffer = r.buffers.back().get();
+        }
+    }
+    return *owner.buffer;
+}
+
+//------------------------------------------------------------------------------
+// Enables tracing if LAPACKPP_TRACE is set, and dumps to it at exit.
+// This is in the same file as trace_event, which every instrumented
+// wrapper references, so it is linked from a static library.
+std::string* trace_filename = nullptr;
+
+void trace_dump_at_exit()
+{
+    try {
+        trace::dump( *trace_filename );
+    }
+    catch (Error& err) {
+        fprintf( stderr, "LAPACKPP_TRACE: %s\n", err.what() );
+    }
+}
+
+struct TraceEnvironment {
+    TraceEnvironment()
+    {
+        char const* filename = std::getenv( "LAPACKPP_TRACE" );
+        if (filename != nullptr && filename[0] != '\0') {
+            trace_filename = new std::string( filename );
+            trace_registry();  // construct before registering atexit
+            std::atexit( trace_dump_at_exit );
+            trace::enable();
+        }
+    }
+};
+
+TraceEnvironment trace_environment;
+
+//------------------------------------------------------------------------------
+// Writes s as a JSON string. Names are identifiers, but escape quotes
+// and backslashes anyway.
+void write_json_string( FILE* file, std::string const& s )
+{
+    fputc( '"', file );
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            fputc( '\\', file );
+        fputc( c, file );
+    }
+    fputc( '"', file );
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+void trace_event(
+    char const* routine, char precision, char const* category,
+    int64_t m, int64_t n, int64_t k, int64_t work_bytes,
+    double queued, double start, double end )
+{
+    trace_buffer().push( routine, precision, category, m, n, k, work_bytes,
+                         queued, start, end );
+}
+
+//------------------------------------------------------------------------------
+double trace_time()
+{
+    int flags = instrument_flags.load( std::memory_order_relaxed );
+    return (flags & InstrumentTrace) ? instrument_time() : 0.0;
+}
+
+//------------------------------------------------------------------------------
+TraceScope::TraceScope( char const* category, double queued )
+    : category_( category ),
+      queued_( queued ),
+      start_( 0 ),
+      work_( 0 )
+{
+    int flags = instrument_flags.load( std::memory_order_relaxed );
+    on_ = (flags & InstrumentTrace) != 0;
+    if (on_) {
+        start_ = instrument_time();
+        work_ = instrument_work_bytes;
+        if (queued_ == 0)
+            queued_ = start_;
+    }
+}
+
+//------------------------------------------------------------------------------
+TraceScope::~TraceScope()
+{
+    if (on_) {
+        trace_event( category_, ' ', category_, 0, 0, 0,
+                     instrument_work_bytes - work_,
+                     queued_, start_, instrument_time() );
+    }
+}
+
+//------------------------------------------------------------------------------
+std::function<void ()> trace_task(
+    char const* category, std::function<void ()> task )
+{
+    double queued = trace_time();
+    if (queued == 0)
+        return task;
+
+    return [category, task, queued]() {
+        TraceScope scope( category, queued );
+        task();
+    };
+}
+
+}  // namespace internal
+
+namespace trace {
+
+//------------------------------------------------------------------------------
+void enable( bool on )
+{
+    internal::trace_registry();  // sets the origin of times
+    if (on)
+        internal::instrument_flags.fetch_or( internal::InstrumentTrace );
+    else
+        internal::instrument_flags.fetch_and( ~internal::InstrumentTrace );
+}
+
+//------------------------------------------------------------------------------
+bool enabled()
+{
+    int flags = internal::instrument_flags.load( std::memory_order_relaxed );
+    return (flags & internal::InstrumentTrace) != 0;
+}
+
+//------------------------------------------------------------------------------
+std::vector< Event > events()
+{
+    std::vector< Event > result;
+    internal::TraceRegistry& r = internal::trace_registry();
+    {
+        std::lock_guard< std::mutex > lock( r.mutex );
+        for (auto& buffer : r.buffers) {
+            buffer->read( r.origin, result );
+        }
+    }
+    std::stable_sort( result.begin(), result.end(),
+        [] (Event const& a, Event const& b) { return a.start < b.start; } );
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Also frees the buffers of exited threads, which are then empty.
+void clear()
+{
+    internal::TraceRegistry& r = internal::trace_registry();
+    std::lock_guard< std::mutex > lock( r.mutex );
+    for (auto& buffer : r.buffers) {
+        buffer->clear();
+    }
+    for (auto buffer : r.free_buffers) {
+        auto iter = std::find_if( r.buffers.begin(), r.buffers.end(),
+            [buffer] (std::unique_ptr< internal::TraceBuffer > const& b) {
+                return b.get() == buffer;
+            } );
+        r.buffers.erase( iter );
+    }
+    r.free_buffers.clear();
+}
+
+//------------------------------------------------------------------------------
+// Writes complete ("X") events, with times in microseconds, and names the
+// threads. wait_us is the time a task waited to start; 0 for wrappers.
+void dump( FILE* file )
+{
+    std::vector< Event > list = events();
+
+    #if defined( _WIN32 ) || defined( _WIN64 )
+        long long pid = _getpid();
+    #else
+        long long pid = getpid();
+    #endif
+
+    fprintf( file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n" );
+    int64_t threads = 0;
+    for (auto const& e : list) {
+        threads = std::max( threads, e.thread );
+        fprintf( file, "{\"name\": " );
+        internal::write_json_string( file, e.name );
+        fprintf( file, ", \"cat\": " );
+        internal::write_json_string( file, e.category );
+        fprintf( file, ", \"ph\": \"X\", \"pid\": %lld, \"tid\": %lld, "
+                 "\"ts\": %.3f, \"dur\": %.3f, \"args\": {"
+                 "\"m\": %lld, \"n\": %lld, \"k\": %lld, "
+                 "\"work_bytes\": %lld, \"wait_us\": %.3f}},\n",
+                 pid, llong( e.thread ),
+                 1e6 * e.start, 1e6 * (e.end - e.start),
+                 llong( e.m ), llong( e.n ), llong( e.k ),
+                 llong( e.work_bytes ), 1e6 * (e.start - e.queued) );
+    }
+    for (int64_t t = 1; t <= threads; ++t) {
+        fprintf( file, "{\"name\": \"thread_name\", \"ph\": \"M\", "
+                 "\"pid\": %lld, \"tid\": %lld, "
+                 "\"args\": {\"name\": \"lapackpp thread %lld\"}},\n",
+                 pid, llong( t ), llong( t ) );
+    }
+    fprintf( file, "{\"name\": \"process_name\", \"ph\": \"M\", "
+             "\"pid\": %lld, \"args\": {\"name\": \"lapackpp\"}}\n"
+             "]}\n", pid );
+}
+
+//------------------------------------------------------------------------------
+void dump( std::string const& filename )
+{
+    FILE* file = fopen( filename.c_str(), "w" );
+    if (file == nullptr) {
+        std::string msg = "cannot open " + filename;
+        throw Error( msg.c_str(), __func__ );
+    }
+
+    dump( file );
+
+    bool okay = (ferror( file ) == 0);
+    okay = (fclose( file ) == 0) && okay;
+    if (! okay) {
+        std::string msg = "cannot write " + filename;
+        throw Error( msg.c_str(), __func__ );
+    }
+}
+
+}  // namespace trace
+}  // namespace lapack
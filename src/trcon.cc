@@ -22,6 +22,8 @@ int64_t trcon(
     float const* A, int64_t lda,
     float* rcond )
 {
+    lapack_instrument( "trcon", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -51,6 +53,8 @@ int64_t trcon(
     double const* A, int64_t lda,
     double* rcond )
 {
+    lapack_instrument( "trcon", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -80,6 +84,8 @@ int64_t trcon(
     std::complex<float> const* A, int64_t lda,
     float* rcond )
 {
+    lapack_instrument( "trcon", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -109,6 +115,8 @@ int64_t trcon(
     std::complex<double> const* A, int64_t lda,
     double* rcond )
 {
+    lapack_instrument( "trcon", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
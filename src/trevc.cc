@@ -26,6 +26,8 @@ int64_t trevc(
     float* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    lapack_instrument( "trevc", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
@@ -71,6 +73,8 @@ int64_t trevc(
     double* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    lapack_instrument( "trevc", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
@@ -116,6 +120,8 @@ int64_t trevc(
     std::complex<float>* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    lapack_instrument( "trevc", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
@@ -283,6 +289,8 @@ int64_t trevc(
     std::complex<double>* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    lapack_instrument( "trevc", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
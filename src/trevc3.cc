@@ -29,6 +29,8 @@ int64_t trevc3(
     float* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    lapack_instrument( "trevc3", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
@@ -90,6 +92,8 @@ int64_t trevc3(
     double* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    lapack_instrument( "trevc3", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
@@ -151,6 +155,8 @@ int64_t trevc3(
     std::complex<float>* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    lapack_instrument( "trevc3", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
@@ -339,6 +345,8 @@ int64_t trevc3(
     std::complex<double>* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    lapack_instrument( "trevc3", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
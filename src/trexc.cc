@@ -24,6 +24,8 @@ int64_t trexc(
     int64_t* ifst,
     int64_t* ilst )
 {
+    lapack_instrument( "trexc", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char compq_ = to_char_comp( compq );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldt_ = to_lapack_int( ldt );
@@ -57,6 +59,8 @@ int64_t trexc(
     int64_t* ifst,
     int64_t* ilst )
 {
+    lapack_instrument( "trexc", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char compq_ = to_char_comp( compq );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldt_ = to_lapack_int( ldt );
@@ -88,6 +92,8 @@ int64_t trexc(
     std::complex<float>* T, int64_t ldt,
     std::complex<float>* Q, int64_t ldq, int64_t ifst, int64_t ilst )
 {
+    lapack_instrument( "trexc", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char compq_ = to_char_comp( compq );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldt_ = to_lapack_int( ldt );
@@ -114,6 +120,8 @@ int64_t trexc(
     std::complex<double>* T, int64_t ldt,
     std::complex<double>* Q, int64_t ldq, int64_t ifst, int64_t ilst )
 {
+    lapack_instrument( "trexc", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char compq_ = to_char_comp( compq );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldt_ = to_lapack_int( ldt );
@@ -25,6 +25,9 @@ int64_t trrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "trrfs", 's', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -64,6 +67,9 @@ int64_t trrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "trrfs", 'd', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -103,6 +109,9 @@ int64_t trrfs(
     float* ferr,
     float* berr )
 {
+    lapack_instrument( "trrfs", 'c', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -142,6 +151,9 @@ int64_t trrfs(
     double* ferr,
     double* berr )
 {
+    lapack_instrument( "trrfs", 'z', 0, n, nrhs,
+                       internal::gflop_data_dependent );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -27,6 +27,8 @@ int64_t trsen(
     float* s,
     float* sep )
 {
+    lapack_instrument( "trsen", 's', 0, n, 0, internal::gflop_data_dependent );
+
     char sense_ = to_char( sense );
     char compq_ = to_char_comp( compq );
 
@@ -102,6 +104,8 @@ int64_t trsen(
     double* s,
     double* sep )
 {
+    lapack_instrument( "trsen", 'd', 0, n, 0, internal::gflop_data_dependent );
+
     char sense_ = to_char( sense );
     char compq_ = to_char_comp( compq );
 
@@ -177,6 +181,8 @@ int64_t trsen(
     float* s,
     float* sep )
 {
+    lapack_instrument( "trsen", 'c', 0, n, 0, internal::gflop_data_dependent );
+
     char sense_ = to_char( sense );
     char compq_ = to_char_comp( compq );
 
@@ -235,6 +241,8 @@ int64_t trsen(
     double* s,
     double* sep )
 {
+    lapack_instrument( "trsen", 'z', 0, n, 0, internal::gflop_data_dependent );
+
     char sense_ = to_char( sense );
     char compq_ = to_char_comp( compq );
 
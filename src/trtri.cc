@@ -20,6 +20,8 @@ int64_t trtri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     float* A, int64_t lda )
 {
+    lapack_instrument( "trtri", 's', 0, n, 0, Gflop< float >::trtri( n ) );
+
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
@@ -41,6 +43,8 @@ int64_t trtri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     double* A, int64_t lda )
 {
+    lapack_instrument( "trtri", 'd', 0, n, 0, Gflop< double >::trtri( n ) );
+
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
@@ -62,6 +66,9 @@ int64_t trtri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
+    lapack_instrument( "trtri", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::trtri( n ) );
+
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
@@ -83,6 +90,9 @@ int64_t trtri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
+    lapack_instrument( "trtri", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::trtri( n ) );
+
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
@@ -21,6 +21,9 @@ int64_t trtrs(
     float const* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    lapack_instrument( "trtrs", 's', 0, n, nrhs,
+                       Gflop< float >::trtrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -47,6 +50,9 @@ int64_t trtrs(
     double const* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    lapack_instrument( "trtrs", 'd', 0, n, nrhs,
+                       Gflop< double >::trtrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -73,6 +79,9 @@ int64_t trtrs(
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    lapack_instrument( "trtrs", 'c', 0, n, nrhs,
+                       Gflop< std::complex<float> >::trtrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -99,6 +108,9 @@ int64_t trtrs(
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    lapack_instrument( "trtrs", 'z', 0, n, nrhs,
+                       Gflop< std::complex<double> >::trtrs( n, nrhs ) );
+
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
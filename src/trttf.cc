@@ -21,6 +21,8 @@ int64_t trttf(
     float const* A, int64_t lda,
     float* ARF )
 {
+    lapack_instrument( "trttf", 's', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -44,6 +46,8 @@ int64_t trttf(
     double const* A, int64_t lda,
     double* ARF )
 {
+    lapack_instrument( "trttf", 'd', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -67,6 +71,8 @@ int64_t trttf(
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* ARF )
 {
+    lapack_instrument( "trttf", 'c', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -90,6 +96,8 @@ int64_t trttf(
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* ARF )
 {
+    lapack_instrument( "trttf", 'z', 0, n, 0, internal::gflop_none );
+
     char transr_ = to_char( transr );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -21,6 +21,8 @@ int64_t trttp(
     float const* A, int64_t lda,
     float* AP )
 {
+    lapack_instrument( "trttp", 's', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -43,6 +45,8 @@ int64_t trttp(
     double const* A, int64_t lda,
     double* AP )
 {
+    lapack_instrument( "trttp", 'd', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -65,6 +69,8 @@ int64_t trttp(
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* AP )
 {
+    lapack_instrument( "trttp", 'c', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -87,6 +93,8 @@ int64_t trttp(
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* AP )
 {
+    lapack_instrument( "trttp", 'z', 0, n, 0, internal::gflop_none );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -0,0 +1,267 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/tune.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+char const* tune_routines[] = {
+    "getrf", "geqrf", "gebrd", "hetrd", "hetrd_2stage",
+};
+
+bool is_tunable( std::string const& routine )
+{
+    for (auto name : tune_routines) {
+        if (routine == name)
+            return true;
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Orders entries by routine, precision, then n_max, with -1 (all larger
+// sizes) last, so the first entry with n <= n_max applies.
+bool entry_less( tune::Entry const& a, tune::Entry const& b )
+{
+    if (a.routine != b.routine)
+        return a.routine < b.routine;
+    if (a.precision != b.precision)
+        return a.precision < b.precision;
+    uint64_t a_max = uint64_t( a.n_max );  // -1 => largest
+    uint64_t b_max = uint64_t( b.n_max );
+    return a_max < b_max;
+}
+
+//------------------------------------------------------------------------------
+// Entries, sorted by entry_less, as an immutable snapshot that ILAENV reads
+// without locking; null if there are none. Updates, serialized by mutex,
+// publish a new snapshot. Old snapshots are kept, since a lookup may still
+// be reading one; updates are rare (setup, or tune.py), so this is small.
+// Never destroyed, so ILAENV can look up during static destruction.
+struct TuneTable {
+    using Snapshot = std::vector< tune::Entry >;
+
+    std::mutex mutex;
+    std::atomic< Snapshot const* > entries { nullptr };
+    std::vector< std::unique_ptr< Snapshot const > > snapshots;
+
+    // Publishes list as the current entries. Call with mutex locked.
+    void publish( Snapshot&& list )
+    {
+        if (list.empty()) {
+            entries.store( nullptr, std::memory_order_release );
+        }
+        else {
+            snapshots.emplace_back( new Snapshot( std::move( list ) ) );
+            entries.store( snapshots.back().get(),
+                           std::memory_order_release );
+        }
+    }
+};
+
+TuneTable& tune_table()
+{
+    static TuneTable* t = new TuneTable;
+    return *t;
+}
+
+//------------------------------------------------------------------------------
+// Parses a tuning file into entries. Throws Error on failure.
+void tune_read( std::string const& filename, std::vector< tune::Entry >& entries )
+{
+    FILE* file = fopen( filename.c_str(), "r" );
+    if (file == nullptr) {
+        std::string msg = "cannot open " + filename;
+        throw Error( msg.c_str(), __func__ );
+    }
+
+    char line[ 1024 ];
+    int64_t line_num = 0;
+    std::string error;
+    while (fgets( line, sizeof(line), file ) != nullptr) {
+        ++line_num;
+        char* comment = strchr( line, '#' );
+        if (comment != nullptr)
+            *comment = '\0';
+
+        char routine[ 32 ], precision, extra;
+        long long n_max, nb, nx = -1;
+        int cnt = sscanf( line, "%31s %c %lld %lld %lld %c",
+                          routine, &precision, &n_max, &nb, &nx, &extra );
+        if (cnt <= 0)
+            continue;  // blank
+
+        if ((cnt != 4 && cnt != 5)
+            || ! is_tunable( routine )
+            || strchr( "sdcz", precision ) == nullptr
+            || n_max < -1 || nb < 1 || nx < -1) {
+            error = filename + ":" + std::to_string( line_num )
+                  + ": invalid tuning entry";
+            break;
+        }
+        entries.push_back( tune::Entry {
+            routine, precision, n_max, nb, nx } );
+    }
+    if (error.empty() && ferror( file ))
+        error = "cannot read " + filename;
+    fclose( file );
+
+    if (! error.empty())
+        throw Error( error.c_str(), __func__ );
+}
+
+//------------------------------------------------------------------------------
+// Loads LAPACKPP_TUNE at startup. This is in the same file as
+// tuned_block_size, which ILAENV references, so it is linked with it.
+struct TuneEnvironment {
+    TuneEnvironment()
+    {
+        char const* filename = std::getenv( "LAPACKPP_TUNE" );
+        if (filename != nullptr && filename[0] != '\0') {
+            try {
+                tune::load( filename );
+            }
+            catch (Error& err) {
+                fprintf( stderr, "LAPACKPP_TUNE: %s\n", err.what() );
+            }
+        }
+    }
+};
+
+TuneEnvironment tune_environment;
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+bool tuned_block_size(
+    char const* routine, char precision, int64_t n,
+    int64_t* nb, int64_t* nx )
+{
+    TuneTable::Snapshot const* list
+        = tune_table().entries.load( std::memory_order_acquire );
+    if (list == nullptr)
+        return false;
+
+    for (auto const& e : *list) {
+        if (e.precision == precision && e.routine == routine
+            && (n <= e.n_max || e.n_max == -1)) {
+            *nb = e.nb;
+            *nx = e.nx;
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace internal
+
+namespace tune {
+
+//------------------------------------------------------------------------------
+void set( std::string const& routine, char precision,
+          int64_t n_max, int64_t nb, int64_t nx )
+{
+    lapack_error_if_msg( ! internal::is_tunable( routine ),
+                         "routine %s is not tunable", routine.c_str() );
+    lapack_error_if( strchr( "sdcz", precision ) == nullptr
+                     || precision == '\0' );
+    lapack_error_if( n_max < -1 );
+    lapack_error_if( nb < 1 );
+    lapack_error_if( nx < -1 );
+
+    Entry entry { routine, precision, n_max, nb, nx };
+    internal::TuneTable& t = internal::tune_table();
+    std::lock_guard< std::mutex > lock( t.mutex );
+    std::vector< Entry > list = entries();
+    auto iter = std::lower_bound( list.begin(), list.end(),
+                                  entry, internal::entry_less );
+    if (iter != list.end() && ! internal::entry_less( entry, *iter ))
+        *iter = entry;
+    else
+        list.insert( iter, entry );
+    t.publish( std::move( list ) );
+}
+
+//------------------------------------------------------------------------------
+std::vector< Entry > entries()
+{
+    internal::TuneTable::Snapshot const* list
+        = internal::tune_table().entries.load( std::memory_order_acquire );
+    if (list == nullptr)
+        return std::vector< Entry >();
+    return *list;
+}
+
+//------------------------------------------------------------------------------
+void clear()
+{
+    internal::TuneTable& t = internal::tune_table();
+    std::lock_guard< std::mutex > lock( t.mutex );
+    t.publish( std::vector< Entry >() );
+}
+
+//------------------------------------------------------------------------------
+void load( std::string const& filename )
+{
+    std::vector< Entry > list;
+    internal::tune_read( filename, list );
+
+    // Sort, then keep the last of duplicate entries, as set would.
+    std::stable_sort( list.begin(), list.end(), internal::entry_less );
+    std::vector< Entry > unique;
+    for (auto const& e : list) {
+        if (! unique.empty() && ! internal::entry_less( unique.back(), e ))
+            unique.back() = e;
+        else
+            unique.push_back( e );
+    }
+
+    internal::TuneTable& t = internal::tune_table();
+    std::lock_guard< std::mutex > lock( t.mutex );
+    t.publish( std::move( unique ) );
+}
+
+//------------------------------------------------------------------------------
+// Writes aligned columns, with a header comment naming them.
+void save( std::string const& filename )
+{
+    std::vector< Entry > list = entries();
+
+    FILE* file = fopen( filename.c_str(), "w" );
+    if (file == nullptr) {
+        std::string msg = "cannot open " + filename;
+        throw Error( msg.c_str(), __func__ );
+    }
+
+    fprintf( file, "# LAPACK++ block sizes; see lapack/tune.hh\n"
+                   "# routine      type    n_max       nb       nx\n" );
+    for (auto const& e : list) {
+        fprintf( file, "%-14s %-4c %8lld %8lld %8lld\n",
+                 e.routine.c_str(), e.precision,
+                 llong( e.n_max ), llong( e.nb ), llong( e.nx ) );
+    }
+
+    bool okay = (ferror( file ) == 0);
+    okay = (fclose( file ) == 0) && okay;
+    if (! okay) {
+        std::string msg = "cannot write " + filename;
+        throw Error( msg.c_str(), __func__ );
+    }
+}
+
+}  // namespace tune
+}  // namespace lapack
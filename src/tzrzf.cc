@@ -22,6 +22,8 @@ int64_t tzrzf(
     float* A, int64_t lda,
     float* tau )
 {
+    lapack_instrument( "tzrzf", 's', m, n, 0, Gflop< float >::tzrzf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -60,6 +62,8 @@ int64_t tzrzf(
     double* A, int64_t lda,
     double* tau )
 {
+    lapack_instrument( "tzrzf", 'd', m, n, 0, Gflop< double >::tzrzf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -98,6 +102,9 @@ int64_t tzrzf(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    lapack_instrument( "tzrzf", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::tzrzf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -136,6 +143,9 @@ int64_t tzrzf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    lapack_instrument( "tzrzf", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::tzrzf( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
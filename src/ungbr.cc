@@ -23,6 +23,9 @@ int64_t ungbr(
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau )
 {
+    lapack_instrument( "ungbr", 'c', m, n, k,
+                       Gflop< std::complex<float> >::ungbr( vect, m, n, k ) );
+
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -130,6 +133,9 @@ int64_t ungbr(
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau )
 {
+    lapack_instrument( "ungbr", 'z', m, n, k,
+                       Gflop< std::complex<double> >::ungbr( vect, m, n, k ) );
+
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
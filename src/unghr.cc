@@ -23,6 +23,9 @@ int64_t unghr(
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau )
 {
+    lapack_instrument( "unghr", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::unghr( ilo, ihi ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
@@ -102,6 +105,9 @@ int64_t unghr(
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau )
 {
+    lapack_instrument( "unghr", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::unghr( ilo, ihi ) );
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
@@ -23,6 +23,9 @@ int64_t unglq(
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau )
 {
+    lapack_instrument( "unglq", 'c', m, n, k,
+                       Gflop< std::complex<float> >::unglq( m, n, k ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
@@ -101,6 +104,9 @@ int64_t unglq(
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau )
 {
+    lapack_instrument( "unglq", 'z', m, n, k,
+                       Gflop< std::complex<double> >::unglq( m, n, k ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
@@ -23,6 +23,9 @@ int64_t ungqr(
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau )
 {
+    lapack_instrument( "ungqr", 'c', m, n, k,
+                       Gflop< std::complex<float> >::ungqr( m, n, k ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
@@ -102,6 +105,9 @@ int64_t ungqr(
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau )
 {
+    lapack_instrument( "ungqr", 'z', m, n, k,
+                       Gflop< std::complex<double> >::ungqr( m, n, k ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int k_ = to_lapack_int( k );
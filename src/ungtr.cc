@@ -23,6 +23,9 @@ int64_t ungtr(
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau )
 {
+    lapack_instrument( "ungtr", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::ungtr( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -100,6 +103,9 @@ int64_t ungtr(
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau )
 {
+    lapack_instrument( "ungtr", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::ungtr( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
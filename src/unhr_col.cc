@@ -25,6 +25,9 @@ int64_t unhr_col(
     std::complex<float>* T, int64_t ldt,
     std::complex<float>* D )
 {
+    lapack_instrument( "unhr_col", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::unhr_col( m, n ) );
+
     lapack_error_if(m < n);
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -140,6 +143,9 @@ int64_t unhr_col(
     std::complex<double>* T, int64_t ldt,
     std::complex<double>* D )
 {
+    lapack_instrument( "unhr_col", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::unhr_col( m, n ) );
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nb_ = to_lapack_int( nb );
@@ -24,6 +24,10 @@ int64_t unmbr(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "unmbr", 'c', m, n, k,
+                       Gflop< std::complex<float> >::unmbr( vect, side, m, n,
+                                                            k ) );
+
     char vect_ = to_char( vect );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
@@ -165,6 +169,10 @@ int64_t unmbr(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "unmbr", 'z', m, n, k,
+                       Gflop< std::complex<double> >::unmbr( vect, side, m, n,
+                                                             k ) );
+
     char vect_ = to_char( vect );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
@@ -24,6 +24,10 @@ int64_t unmhr(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "unmhr", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::unmhr( side, m, n, ilo,
+                                                            ihi ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -144,6 +148,10 @@ int64_t unmhr(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "unmhr", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::unmhr( side, m, n, ilo,
+                                                             ihi ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -24,6 +24,9 @@ int64_t unmlq(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "unmlq", 'c', m, n, k,
+                       Gflop< std::complex<float> >::unmlq( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -138,6 +141,9 @@ int64_t unmlq(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "unmlq", 'z', m, n, k,
+                       Gflop< std::complex<double> >::unmlq( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
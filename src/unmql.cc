@@ -24,6 +24,9 @@ int64_t unmql(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "unmql", 'c', m, n, k,
+                       Gflop< std::complex<float> >::unmql( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -139,6 +142,9 @@ int64_t unmql(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "unmql", 'z', m, n, k,
+                       Gflop< std::complex<double> >::unmql( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -24,6 +24,9 @@ int64_t unmqr(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "unmqr", 'c', m, n, k,
+                       Gflop< std::complex<float> >::unmqr( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -140,6 +143,9 @@ int64_t unmqr(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "unmqr", 'z', m, n, k,
+                       Gflop< std::complex<double> >::unmqr( side, m, n, k ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
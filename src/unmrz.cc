@@ -23,6 +23,10 @@ int64_t unmrz(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "unmrz", 'c', m, n, k,
+                       Gflop< std::complex<float> >::unmrz( side, m, n, k,
+                                                            l ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -71,6 +75,10 @@ int64_t unmrz(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "unmrz", 'z', m, n, k,
+                       Gflop< std::complex<double> >::unmrz( side, m, n, k,
+                                                             l ) );
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
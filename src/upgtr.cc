@@ -23,6 +23,9 @@ int64_t upgtr(
     std::complex<float> const* tau,
     std::complex<float>* Q, int64_t ldq )
 {
+    lapack_instrument( "upgtr", 'c', 0, n, 0,
+                       Gflop< std::complex<float> >::ungtr( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldq_ = to_lapack_int( ldq );
@@ -51,6 +54,9 @@ int64_t upgtr(
     std::complex<double> const* tau,
     std::complex<double>* Q, int64_t ldq )
 {
+    lapack_instrument( "upgtr", 'z', 0, n, 0,
+                       Gflop< std::complex<double> >::ungtr( n ) );
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldq_ = to_lapack_int( ldq );
@@ -24,6 +24,9 @@ int64_t upmtr(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc )
 {
+    lapack_instrument( "upmtr", 'c', m, n, 0,
+                       Gflop< std::complex<float> >::unmtr( side, m, n ) );
+
     char side_ = to_char( side );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
@@ -122,6 +125,9 @@ int64_t upmtr(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc )
 {
+    lapack_instrument( "upmtr", 'z', m, n, 0,
+                       Gflop< std::complex<double> >::unmtr( side, m, n ) );
+
     char side_ = to_char( side );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
@@ -3,6 +3,9 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
+#ifndef CHECK_ORTHO_HH
+#define CHECK_ORTHO_HH
+
 #include "blas.hh"
 #include "lapack.hh"
 #include "error.hh"
@@ -51,3 +54,5 @@ blas::real_type< scalar_t > check_orthogonality(
     real_t resid = lanhe( Norm::One, Uplo::Upper, minmn, &R[0], ldr ) / k;
     return resid;
 }
+
+#endif  //  #ifndef CHECK_ORTHO_HH
@@ -446,6 +446,41 @@ void generate_geevx(
     throw std::exception();  // not implemented
 }
 
+// -----------------------------------------------------------------------------
+/// Loads matrix from a matrix file written by lapack::write_matrix_file.
+/// Copies the leading m-by-n submatrix; the file must be at least m-by-n.
+/// sigma is left unknown (NaN).
+///
+/// Internal function, called from generate_matrix().
+///
+/// @ingroup generate_matrix
+template< typename scalar_t >
+void generate_file(
+    MatrixParams& params,
+    std::string const& filename,
+    Matrix<scalar_t>& A )
+{
+    lapack::MatrixFile< scalar_t > file( filename );
+    if (file.m() < A.m || file.n() < A.n) {
+        fprintf( stderr, "%sError: matrix file '%s' is %lld-by-%lld,"
+                 " smaller than %lld-by-%lld.%s\n",
+                 ansi_red, filename.c_str(),
+                 llong( file.m() ), llong( file.n() ),
+                 llong( A.m ), llong( A.n ), ansi_normal );
+        throw std::exception();
+    }
+    if (file.layout() == blas::Layout::ColMajor) {
+        lapack::lacpy( lapack::MatrixType::General, A.m, A.n,
+                       file.data(), file.ld(), A(0,0), A.ld );
+    }
+    else {
+        for (int64_t i = 0; i < A.m; ++i) {
+            blas::copy( A.n, &file.data()[ i*file.ld() ], 1, A(i,0), A.ld );
+        }
+    }
+    params.cond_used() = testsweeper::no_data_flag;
+}
+
 // -----------------------------------------------------------------------------
 void generate_matrix_usage()
 {
@@ -474,6 +509,9 @@ void generate_matrix_usage()
     "syev^@    |  alias for heev\n"
     "geev^@    |  A = V T V^H, Schur-form T                       [not yet implemented]\n"
     "geevx^@   |  A = X T X^{-1}, Schur-form T, X ill-conditioned [not yet implemented]\n"
+    "          |  \n"
+    "file:path |  leading submatrix of matrix file 'path', as written by\n"
+    "          |  lapack::write_matrix_file; no suffixes\n"
     "\n"
     "^ and @ denote optional suffixes described below.\n"
     "\n"
@@ -596,6 +634,8 @@ void generate_matrix_usage()
 /// syev^@   | alias for heev
 /// geev^@   | $A = V T V^H$, Schur-form $T$                         [not yet implemented]
 /// geevx^@  | $A = X T X^{-1}$, Schur-form $T$, $X$ ill-conditioned [not yet implemented]
+/// --       | --
+/// file:path | leading m-by-n submatrix of matrix file path, as written by lapack::write_matrix_file; no suffixes
 ///
 /// Note for geev that $cond(\Lambda)$ is specified, where $\Lambda = diag(T)$;
 /// while $cond(T)$ and $cond(A)$ are usually much worse.
@@ -668,6 +708,15 @@ void generate_matrix(
 
     // locals
     std::string kind = params.kind();
+
+    // ----------
+    // load from file; paths can have "-_", so handle before splitting
+    if (kind.compare( 0, 5, "file:" ) == 0) {
+        lapack::laset( lapack::MatrixType::General, sigma.n, 1, nan, nan, sigma(0), sigma.n );
+        generate_file( params, kind.substr( 5 ), A );
+        return;
+    }
+
     std::vector< std::string > tokens = split( kind, "-_" );
 
     real_t cond = params.cond();
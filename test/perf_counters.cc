@@ -0,0 +1,238 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+
+#include <cstring>
+#include <vector>
+
+#if defined( __linux__ )
+    #include <dirent.h>
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// Hardware performance counters for --counters, using Linux perf_event_open.
+// Counters are opened on every thread of the process when a measurement
+// starts, and inherited by threads created during it, so multithreaded
+// BLAS and OpenMP regions are included. Counters the kernel or CPU don't
+// provide, e.g., due to /proc/sys/kernel/perf_event_paranoid, or on other
+// operating systems, are left as no data.
+
+#if defined( __linux__ )
+
+namespace {
+
+// -----------------------------------------------------------------------------
+enum Counter {
+    Cycles,
+    Instructions,
+    CacheMisses,
+    FP1,    // FP events, weighted by flops per instruction; see fp_events
+    FP2,
+    FP4,
+    FP8,
+    FP16,
+    NumCounters,
+};
+
+struct Event {
+    Counter counter;
+    uint32_t type;
+    uint64_t config;
+};
+
+// Opened counters: one file descriptor per thread and event.
+struct Open {
+    Counter counter;
+    int fd;
+};
+
+std::vector< Open > g_open;
+
+// -----------------------------------------------------------------------------
+// @return true if /proc/cpuinfo has vendor.
+bool cpu_vendor_is( char const* vendor )
+{
+    FILE* file = fopen( "/proc/cpuinfo", "r" );
+    if (file == nullptr)
+        return false;
+
+    bool found = false;
+    char line[ 256 ];
+    while (fgets( line, sizeof(line), file ) != nullptr) {
+        if (strncmp( line, "vendor_id", 9 ) == 0) {
+            found = (strstr( line, vendor ) != nullptr);
+            break;
+        }
+    }
+    fclose( file );
+    return found;
+}
+
+// -----------------------------------------------------------------------------
+// Raw events counting floating point operations, which perf has no generic
+// event for. On Intel (Skylake and later), FP_ARITH_INST_RETIRED (0xC7)
+// counts instructions per vector width; the umasks differ for single and
+// double, hence the datatype. Each FMA counts twice. On AMD Zen,
+// FpRetSseAvxOps (0x03) counts flops directly.
+void fp_events( testsweeper::DataType datatype, std::vector< Event >& events )
+{
+    using testsweeper::DataType;
+    bool single = (datatype == DataType::Single
+                   || datatype == DataType::SingleComplex);
+
+    static bool intel = cpu_vendor_is( "GenuineIntel" );
+    static bool amd   = cpu_vendor_is( "AuthenticAMD" );
+    if (intel) {
+        // umask: scalar, 128-bit, 256-bit, 512-bit packed.
+        // single: 0x02, 0x08, 0x20, 0x80; double: 0x01, 0x04, 0x10, 0x40.
+        if (single) {
+            events.push_back( { FP1,  PERF_TYPE_RAW, 0x02c7 } );
+            events.push_back( { FP4,  PERF_TYPE_RAW, 0x08c7 } );
+            events.push_back( { FP8,  PERF_TYPE_RAW, 0x20c7 } );
+            events.push_back( { FP16, PERF_TYPE_RAW, 0x80c7 } );
+        }
+        else {
+            events.push_back( { FP1,  PERF_TYPE_RAW, 0x01c7 } );
+            events.push_back( { FP2,  PERF_TYPE_RAW, 0x04c7 } );
+            events.push_back( { FP4,  PERF_TYPE_RAW, 0x10c7 } );
+            events.push_back( { FP8,  PERF_TYPE_RAW, 0x40c7 } );
+        }
+    }
+    else if (amd) {
+        events.push_back( { FP1, PERF_TYPE_RAW, 0xff03 } );
+    }
+}
+
+// -----------------------------------------------------------------------------
+int perf_event_open( perf_event_attr* attr, pid_t tid )
+{
+    return syscall( __NR_perf_event_open, attr, tid, -1, -1, 0 );
+}
+
+// -----------------------------------------------------------------------------
+// @return ids of all threads of this process.
+std::vector< pid_t > threads()
+{
+    std::vector< pid_t > tids;
+    DIR* dir = opendir( "/proc/self/task" );
+    if (dir == nullptr) {
+        tids.push_back( 0 );  // just this thread
+        return tids;
+    }
+    while (dirent* entry = readdir( dir )) {
+        if (entry->d_name[0] != '.')
+            tids.push_back( atoi( entry->d_name ) );
+    }
+    closedir( dir );
+    return tids;
+}
+
+// -----------------------------------------------------------------------------
+void close_all()
+{
+    for (auto const& open : g_open)
+        close( open.fd );
+    g_open.clear();
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+void perf_counters_start( Params& params )
+{
+    if (params.counters() != 'y')
+        return;
+
+    close_all();
+
+    std::vector< Event > events = {
+        { Cycles,       PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES   },
+        { Instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { CacheMisses,  PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    };
+    fp_events( params.datatype(), events );
+
+    for (pid_t tid : threads()) {
+        for (auto const& event : events) {
+            perf_event_attr attr;
+            memset( &attr, 0, sizeof(attr) );
+            attr.size           = sizeof(attr);
+            attr.type           = event.type;
+            attr.config         = event.config;
+            attr.disabled       = 1;
+            attr.inherit        = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED
+                                | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            int fd = perf_event_open( &attr, tid );
+            if (fd >= 0)
+                g_open.push_back( { event.counter, fd } );
+        }
+    }
+
+    for (auto const& open : g_open)
+        ioctl( open.fd, PERF_EVENT_IOC_ENABLE, 0 );
+}
+
+// -----------------------------------------------------------------------------
+void perf_counters_stop( Params& params, double time )
+{
+    if (params.counters() != 'y')
+        return;
+
+    for (auto const& open : g_open)
+        ioctl( open.fd, PERF_EVENT_IOC_DISABLE, 0 );
+
+    // Sum over threads. If the kernel multiplexed a counter, scale its
+    // count by enabled / running time.
+    double count[ NumCounters ] = { 0 };
+    bool available[ NumCounters ] = { false };
+    for (auto const& open : g_open) {
+        uint64_t values[ 3 ];  // count, time enabled, time running
+        if (read( open.fd, values, sizeof(values) ) != sizeof(values))
+            continue;
+        double value = double( values[ 0 ] );
+        if (values[ 2 ] > 0 && values[ 2 ] < values[ 1 ])
+            value *= double( values[ 1 ] ) / double( values[ 2 ] );
+        count[ open.counter ] += value;
+        available[ open.counter ] = true;
+    }
+    close_all();
+
+    if (available[ Cycles ])
+        params.gcycles() = 1e-9 * count[ Cycles ];
+    if (available[ Cycles ] && available[ Instructions ]
+        && count[ Cycles ] > 0)
+        params.ipc() = count[ Instructions ] / count[ Cycles ];
+    if (available[ CacheMisses ]) {
+        // Each miss loads a 64-byte cache line.
+        params.llc_misses() = 1e-6 * count[ CacheMisses ];
+        if (time > 0)
+            params.llc_gbytes() = 1e-9 * 64 * count[ CacheMisses ] / time;
+    }
+    if (available[ FP1 ] && time > 0) {
+        double flops = count[ FP1 ] + 2*count[ FP2 ] + 4*count[ FP4 ]
+                     + 8*count[ FP8 ] + 16*count[ FP16 ];
+        params.hw_gflops() = 1e-9 * flops / time;
+    }
+}
+
+#else  // not __linux__
+
+// -----------------------------------------------------------------------------
+void perf_counters_start( Params& params )
+{}
+
+// -----------------------------------------------------------------------------
+void perf_counters_stop( Params& params, double time )
+{}
+
+#endif
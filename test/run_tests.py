@@ -30,6 +30,9 @@ import subprocess
 import xml.etree.ElementTree as ET
 import io
 import time
+import struct
+import array
+import random
 
 # ------------------------------------------------------------------------------
 # command line arguments
@@ -358,7 +361,10 @@ if (opts.lu and opts.host):
     # todo: equed
     [ 'gesvx', gen + dtype + align + n + factored + trans ],
     [ 'getrf', gen + dtype + align + mn ],
+    [ 'getrf_ooc', gen + dtype + align + mn + nb ],
     [ 'getrs', gen + dtype + align + n + trans ],
+    [ 'gesv_layout', gen + dtype + layout + align + n + trans ],
+    [ 'gesv_view', gen + dtype + layout + align + n ],
     [ 'getri', gen + dtype + align + n ],
     [ 'gecon', gen + dtype + align + n ],
     [ 'gerfs', gen + dtype + align + n + trans ],
@@ -369,12 +375,14 @@ if (opts.lu and opts.device):
     # GPU
     cmds += [
     [ 'dev-getrf', gen + dtype + align + n ],
+    [ 'dev-getrs', gen + dtype + align + n + trans ],
     ]
 
 # General Banded
 if (opts.gb and opts.host):
     cmds += [
     [ 'gbsv',  gen + dtype + align + n  + kl + ku ],
+    [ 'gbsv_spike', gen + dtype + align + n + kl + ku ],
     [ 'gbtrf', gen + dtype + align + mn + kl + ku ],
     [ 'gbtrs', gen + dtype + align + n  + kl + ku + trans ],
     [ 'gbcon', gen + dtype + align + n  + kl + ku ],
@@ -386,6 +394,7 @@ if (opts.gb and opts.host):
 if (opts.gt and opts.host):
     cmds += [
     [ 'gtsv',  gen + dtype + align + n ],
+    [ 'gtsv_spike', gen + dtype + align + n ],
     [ 'gttrf', gen + dtype +         n ],
     [ 'gttrs', gen + dtype + align + n + trans ],
     [ 'gtcon', gen + dtype +         n ],
@@ -396,7 +405,13 @@ if (opts.gt and opts.host):
 if (opts.chol and opts.host):
     cmds += [
     [ 'posv',  gen + dtype + align + n + uplo ],
+    [ 'posv_layout', gen + dtype + layout + align + n + uplo ],
+    [ 'posv_async', gen + dtype + align + n + uplo + ' --nparts 1,16' ],
+    [ 'posv_instrument', gen + dtype + align + n + uplo ],
+    [ 'posv_trace', gen + dtype + align + n + uplo ],
     [ 'potrf', gen + dtype + align + n + uplo ],
+    [ 'potrf_ooc', gen + dtype + align + n + uplo + nb ],
+    [ 'potrf_update', gen + dtype + align + n + uplo ],
     [ 'potrs', gen + dtype + align + n + uplo ],
     [ 'potri', gen + dtype + align + n + uplo ],
     [ 'pocon', gen + dtype + align + n + uplo ],
@@ -432,6 +447,8 @@ if (opts.chol and opts.device):
     # GPU
     cmds += [
     [ 'dev-potrf', gen + dtype + align + n + uplo ],
+    [ 'dev-potrs', gen + dtype + align + n + uplo ],
+    [ 'dev-trtri', gen + dtype + align + n + uplo + diag ],
     ]
 
 # symmetric indefinite, Bunch-Kaufman
@@ -453,6 +470,13 @@ if (opts.sysv and opts.host):
     [ 'sprfs', gen + dtype + align + n + uplo ],
     ]
 
+if (opts.sysv and opts.device):
+    # GPU
+    cmds += [
+    [ 'dev-sytrf', gen + dtype + align + n + uplo ],
+    [ 'dev-sytrs', gen + dtype + align + n + uplo ],
+    ]
+
 # symmetric indefinite, rook
 if (opts.rook and opts.host):
     cmds += [
@@ -511,6 +535,8 @@ if (opts.least_squares and opts.host):
     #[ 'gelsd',  gen + dtype + align + mn ],
     [ 'gelss',  gen + dtype + align + mn ],
     [ 'getsls', gen + dtype + align + mn + trans_nc ],
+    [ 'qrstream', gen + dtype + align + mn + nb ],
+    [ 'gels_sketch', gen + dtype + align + mn ],  # m >= n
 
     # Generalized
     [ 'gglse', gen + dtype + align + mnk ],
@@ -523,6 +549,8 @@ if (opts.qr and opts.host):
     cmds += [
     [ 'geqr',  gen + dtype + align + n + wide + tall ],
     [ 'geqrf', gen + dtype + align + n + wide + tall ],
+    [ 'geqrf_layout', gen + dtype + layout + align + n + wide + tall ],
+    [ 'geqp3_rand', gen + dtype + align + n + wide + tall ],
     # todo: ggqrf is failing
     #[ 'ggqrf', gen + dtype + align + mnk ],
     [ 'ungqr', gen + dtype + align + mn ],  # m >= n
@@ -532,6 +560,9 @@ if (opts.qr and opts.host):
     [ 'orhr_col', gen + dtype_real + align + n + tall ],
     [ 'unhr_col', gen + dtype      + align + n + tall ],
 
+    [ 'qr_insert_col', gen + dtype + align + mn ],  # m > n
+    [ 'qr_delete_col', gen + dtype + align + mn ],  # m >= n
+
     [ 'gemqrt', gen + dtype_real    + align + n + nb + side + trans    ],  # real does trans = N, T, C
     [ 'gemqrt', gen + dtype_complex + align + n + nb + side + trans_nc ],  # complex does trans = N, C, not T
 
@@ -547,6 +578,9 @@ if (opts.qr and opts.device):
     # GPU
     cmds += [
     [ 'dev-geqrf', gen + dtype + align + n + wide + tall ],
+    [ 'dev-ungqr', gen + dtype + align + mn ],  # m >= n
+    [ 'dev-unmqr', gen + dtype_real    + align + mnk + side + trans    ],  # real does trans = N, T, C
+    [ 'dev-unmqr', gen + dtype_complex + align + mnk + side + trans_nc ],  # complex does trans = N, C, not T
     ]
 
 # LQ
@@ -593,9 +627,17 @@ if (opts.syev and opts.host):
     [ 'heevx', gen + dtype + align + n + jobz + uplo + vl + vu ],
     [ 'heevx', gen + dtype + align + n + jobz + uplo + il + iu ],
     [ 'heevd', gen + dtype + align + n + jobz + uplo ],
+    [ 'heev_qdwh', gen + dtype + align + n + jobz + uplo ],
+    [ 'heevd_layout', gen + dtype + layout + align + n + jobz + uplo ],
+    [ 'stedc_mt', gen + dtype + align + n + jobz + uplo ],
     [ 'heevr', gen + dtype + align + n + jobz + uplo + vl + vu ],
     [ 'heevr', gen + dtype + align + n + jobz + uplo + il + iu ],
+    [ 'heev_chfsi', gen + dtype + align + nk_tall + uplo ],
+    [ 'stemr_mt', gen + dtype + align + n + jobz + uplo + vl + vu ],
+    [ 'stemr_mt', gen + dtype + align + n + jobz + uplo + il + iu ],
+    [ 'stein_mt', gen + dtype + align + n + uplo + il + iu ],
     [ 'hetrd', gen + dtype + align + n + uplo ],
+    [ 'hetrd_2stage', gen + dtype + align + n + uplo ],
     [ 'lae2',  gen + dtype_real ],  # 2x2, eigvals only
     [ 'laev2', gen + dtype ],  # 2x2
     [ 'ungtr', gen + dtype + align + n + uplo ],
@@ -684,7 +726,14 @@ if (opts.svd and opts.host):
     #[ 'gesvd',         gen + dtype + align + mn + jobu + jobvt ],
     [ 'gesvd',         gen + dtype + align + mn + " --jobu n,a" + jobvt ],
     [ 'gesvd',         gen + dtype + align + mn + " --jobu o,s --jobvt n" ],
+    [ 'gesvd_layout',  gen + dtype + layout + align + mn + " --jobu n,s,a --jobvt n,s,a" ],
     [ 'gesdd',         gen + dtype + align + mn + jobu ],
+    [ 'bdsdc',         gen + dtype_real + align + n + jobz + uplo ],
+    [ 'bdsdc_mt',      gen + dtype_real + align + n + jobz + uplo ],
+    [ 'rsvd',          gen + dtype + align + mnk ],
+    [ 'polar',         gen + dtype + align + mn ],
+    [ 'gesvd_qdwh',    gen + dtype + align + mn + ' --jobu n,s' ],
+    [ 'gebrd',         gen + dtype + align + mn ],
     # todo: gesvdx is failing
     #[ 'gesvdx',        gen + dtype + align + mn + jobz + jobvr + vl + vu ],
     #[ 'gesvdx',        gen + dtype + align + mn + jobz + jobvr + il + iu ],
@@ -695,13 +744,41 @@ if (opts.svd and opts.host):
     #[ 'gesvj',         gen + dtype + align + mn + joba + jobu + jobv ],
     ]
 
+if (opts.svd and opts.device):
+    # GPU
+    cmds += [
+    # cuSolver requires m >= n
+    [ 'dev-gesvd', gen + dtype + align + n + tall + " --jobu n,s,a --jobvt n,s,a" ],
+    ]
+
+# ------------------------------------------------------------------------------
+# Writes an m-by-n random, double, column-major matrix file, independently of
+# lapack::write_matrix_file, to test --matrix file:.
+# See include/lapack/matrix_file.hh for the format.
+def write_matrix_file( filename, m, n ):
+    offset = 4096
+    header = struct.pack( '=8sIcccxqqqqqq', b'LAPACKPP', 1, b'd', b'C', b'G',
+                          m, n, m, offset, offset, 0 )
+    data = array.array( 'd', [ random.uniform( -1, 1 ) for i in range( m*n ) ] )
+    with open( filename, 'wb' ) as f:
+        f.write( header )
+        f.write( b'\0' * (offset - len( header )) )
+        data.tofile( f )
+# end
+
 # auxilary
 if (opts.aux and opts.host):
+    matrix_file = 'run_tests_matrix.mat'
+    if (not opts.dry_run):
+        write_matrix_file( matrix_file, 200, 100 )
     cmds += [
     [ 'lacpy', gen + dtype + align + mn + mtype ],
     [ 'laed4', gen + dtype_real + n ],
+    [ 'laed4_all', gen + dtype_real + n ],
     [ 'laset', gen + dtype + align + mn + mtype ],
     [ 'laswp', gen + dtype + align + mn ],
+    [ 'matrix_file', gen + dtype + layout + align + mn ],
+    [ 'matrix_file', gen + ' --type d --dim 200x100 --dim 100x50 --matrix file:' + matrix_file ],
     ]
 
 # auxilary - householder
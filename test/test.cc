@@ -108,6 +108,12 @@ std::vector< testsweeper::routines_t > routines = {
     { "gesv",               test_gesv,      Section::gesv },
     { "gbsv",               test_gbsv,      Section::gesv },
     { "gtsv",               test_gtsv,      Section::gesv },
+    { "gesv_layout",        test_gesv_layout, Section::gesv },
+    { "gesv_view",          test_gesv_view, Section::gesv },
+    { "",                   nullptr,        Section::newline },
+
+    { "gbsv_spike",         test_gbsv_spike, Section::gesv },
+    { "gtsv_spike",         test_gtsv_spike, Section::gesv },
     { "",                   nullptr,        Section::newline },
 
     { "gesvx",              test_gesvx,     Section::gesv }, // TODO Set up fact equed, (work array)=(LAPACKE rpivot)
@@ -120,6 +126,9 @@ std::vector< testsweeper::routines_t > routines = {
     { "gttrf",              test_gttrf,     Section::gesv },
     { "",                   nullptr,        Section::newline },
 
+    { "getrf_ooc",          test_getrf_ooc, Section::gesv },
+    { "",                   nullptr,        Section::newline },
+
     { "getrs",              test_getrs,     Section::gesv },
     { "gbtrs",              test_gbtrs,     Section::gesv },
     { "gttrs",              test_gttrs,     Section::gesv },
@@ -148,6 +157,10 @@ std::vector< testsweeper::routines_t > routines = {
     { "ppsv",               test_ppsv,      Section::posv },
     { "pbsv",               test_pbsv,      Section::posv },
     { "ptsv",               test_ptsv,      Section::posv },
+    { "posv_layout",        test_posv_layout, Section::posv },
+    { "posv_async",         test_posv_async, Section::posv },
+    { "posv_instrument",    test_posv_instrument, Section::posv },
+    { "posv_trace",         test_posv_trace, Section::posv },
     { "",                   nullptr,        Section::newline },
 
     { "potrf",              test_potrf,     Section::posv },
@@ -156,6 +169,10 @@ std::vector< testsweeper::routines_t > routines = {
     { "pttrf",              test_pttrf,     Section::posv },
     { "",                   nullptr,        Section::newline },
 
+    { "potrf_ooc",          test_potrf_ooc, Section::posv },
+    { "potrf_update",       test_potrf_update, Section::posv },
+    { "",                   nullptr,        Section::newline },
+
     { "potrs",              test_potrs,     Section::posv },
     { "pptrs",              test_pptrs,     Section::posv },
     { "pbtrs",              test_pbtrs,     Section::posv },
@@ -265,6 +282,8 @@ std::vector< testsweeper::routines_t > routines = {
     { "gelsd",              test_gelsd,     Section::gels }, // TODO: Segfaults for some Z sizes. src/gelsd.cc:275 lrwork_ too small?
     { "gelss",              test_gelss,     Section::gels }, // tested via LAPACKE using gcc/MKL TODO rcond=n
     { "getsls",             test_getsls,    Section::gels }, // tested via LAPACKE using gcc/MKL
+    { "qrstream",           test_qrstream,  Section::gels },
+    { "gels_sketch",        test_gels_sketch, Section::gels },
     { "",                   nullptr,        Section::newline },
 
     { "gglse",              test_gglse,     Section::gels }, // tested via LAPACKE using gcc/MKL
@@ -275,6 +294,8 @@ std::vector< testsweeper::routines_t > routines = {
     // QR, LQ, RQ, QL
     { "geqr",               test_geqr,      Section::qr }, // tested numerically
     { "geqrf",              test_geqrf,     Section::qr }, // tested numerically
+    { "geqrf_layout",       test_geqrf_layout, Section::qr }, // tested numerically
+    { "geqp3_rand",         test_geqp3_rand, Section::qr }, // tested numerically
     { "gelqf",              test_gelqf,     Section::qr }, // tested numerically
     { "geqlf",              test_geqlf,     Section::qr }, // tested numerically
     { "gerqf",              test_gerqf,     Section::qr }, // tested numerically; R, Q are full sizeof(A), could be smaller
@@ -299,6 +320,10 @@ std::vector< testsweeper::routines_t > routines = {
     { "unhr_col",           test_unhr_col,  Section::qr },
     { "",                   nullptr,        Section::newline },
 
+    { "qr_insert_col",      test_qr_insert_col, Section::qr },
+    { "qr_delete_col",      test_qr_delete_col, Section::qr },
+    { "",                   nullptr,        Section::newline },
+
     //{ "unmqr",              test_unmqr,     Section::qr }, // TODO segfaults
     //{ "unmlq",              test_unmlq,     Section::qr },
     //{ "unmql",              test_unmql,     Section::qr },
@@ -334,16 +359,23 @@ std::vector< testsweeper::routines_t > routines = {
     { "",                   nullptr,        Section::newline },
 
     { "heevd",              test_heevd,     Section::heev }, // backward error check
+    { "heev_qdwh",          test_heev_qdwh, Section::heev }, // backward error check
+    { "heevd_layout",       test_heevd_layout, Section::heev }, // backward error check
     { "hpevd",              test_hpevd,     Section::heev }, // tested via LAPACKE using gcc/MKL
     { "hbevd",              test_hbevd,     Section::heev }, // tested via LAPACKE using gcc/MKL
+    { "stedc_mt",           test_stedc_mt,  Section::heev }, // backward error check
     { "",                   nullptr,        Section::newline },
 
     { "heevr",              test_heevr,     Section::heev }, // backward error check
+    { "heev_chfsi",         test_heev_chfsi, Section::heev }, // backward error check
+    { "stemr_mt",           test_stemr_mt,  Section::heev }, // backward error check
+    { "stein_mt",           test_stein_mt,  Section::heev }, // backward error check
     { "lae2",               test_lae2,      Section::heev }, // forward  error check, compared to laev2
     { "laev2",              test_laev2,     Section::heev }, // backward error check
     { "",                   nullptr,        Section::newline },
 
     { "hetrd",              test_hetrd,     Section::heev }, // tested via LAPACKE using gcc/MKL
+    { "hetrd_2stage",       test_hetrd_2stage, Section::heev }, // eigenvalue check
     { "hptrd",              test_hptrd,     Section::heev }, // tested via LAPACKE using gcc/MKL
     //{ "hbtrd",              test_hbtrd,     Section::heev }, // Need to add to test.cc params a new vect option v,n,u for forming Q
     { "",                   nullptr,        Section::newline },
@@ -412,10 +444,13 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // driver: singular value decomposition
     { "gesvd",              test_gesvd,         Section::svd },
+    { "gesvd_layout",       test_gesvd_layout,  Section::svd },
     //{ "gesvd_2stage",       test_gesvd_2stage,  Section::svd }, // TODO No src
     { "",                   nullptr,            Section::newline },
 
     { "gesdd",              test_gesdd,         Section::svd },
+    { "bdsdc",              test_bdsdc,         Section::svd },
+    { "bdsdc_mt",           test_bdsdc_mt,      Section::svd }, // backward error check
     //{ "gesdd_2stage",       test_gesdd_2stage,  Section::svd }, // TODO No src
     { "",                   nullptr,            Section::newline },
 
@@ -423,6 +458,16 @@ std::vector< testsweeper::routines_t > routines = {
     //{ "gesvdx_2stage",      test_gesvdx_2stage, Section::svd }, // TODO No src
     { "",                   nullptr,            Section::newline },
 
+    { "rsvd",               test_rsvd,          Section::svd },
+    { "",                   nullptr,            Section::newline },
+
+    { "polar",              test_polar,         Section::svd },
+    { "gesvd_qdwh",         test_gesvd_qdwh,    Section::svd },
+    { "",                   nullptr,            Section::newline },
+
+    { "gebrd",              test_gebrd,         Section::svd }, // singular value check
+    { "",                   nullptr,            Section::newline },
+
     //{ "gejsv",              test_gejsv,     Section::svd }, // TODO No src
     //{ "gesvj",              test_gesvj,     Section::svd }, // TODO No src
     { "",                   nullptr,        Section::newline },
@@ -431,8 +476,10 @@ std::vector< testsweeper::routines_t > routines = {
     // auxiliary
     { "lacpy",              test_lacpy,     Section::aux },
     { "laed4",              test_laed4,     Section::aux },
+    { "laed4_all",          test_laed4_all, Section::aux },
     { "laset",              test_laset,     Section::aux },
     { "laswp",              test_laswp,     Section::aux },
+    { "matrix_file",        test_matrix_file, Section::aux },
     { "",                   nullptr,        Section::newline },
 
     // auxiliary: Householder
@@ -495,6 +542,14 @@ std::vector< testsweeper::routines_t > routines = {
     { "dev-getrf",          test_getrf_device,  Section::gpu },
     { "dev-geqrf",          test_geqrf_device,  Section::gpu },
     { "dev-heevd",          test_heevd_device,  Section::gpu },
+    { "dev-potrs",          test_potrs_device,  Section::gpu },
+    { "dev-getrs",          test_getrs_device,  Section::gpu },
+    { "dev-unmqr",          test_unmqr_device,  Section::gpu },
+    { "dev-ungqr",          test_ungqr_device,  Section::gpu },
+    { "dev-gesvd",          test_gesvd_device,  Section::gpu },
+    { "dev-sytrf",          test_sytrf_device,  Section::gpu },
+    { "dev-sytrs",          test_sytrs_device,  Section::gpu },
+    { "dev-trtri",          test_trtri_device,  Section::gpu },
     { "",                   nullptr,            Section::newline },
 };
 
@@ -518,6 +573,7 @@ Params::Params():
     repeat    ( "repeat",     0,    PT_Value,   1,    1, 1000, "times to repeat each test" ),
     verbose   ( "verbose",    0,    PT_Value,   0,    0,   10, "verbose level" ),
     cache     ( "cache",      0,    PT_Value,  20,    1, 1024, "total cache size, in MiB" ),
+    counters  ( "counters",   0, PT_Value, 'n', "ny", "measure hardware counters (Linux perf_event_open) around the tested routine" ),
 
     //----- routine parameters, enums
     //          name,         w, type,    default, help
@@ -560,6 +616,7 @@ Params::Params():
     ku        ( "ku",         6,    PT_List,      10,    0,  1e6, "upper bandwidth" ),
     nrhs      ( "nrhs",       6,    PT_List,      10,    0, 1e10, "number of right hand sides" ),
     nb        ( "nb",         4,    PT_List,     384,    0,  1e6, "block size" ),
+    nparts    ( "nparts",     6,    PT_List,       4,    0,  1e6, "number of partitions (e.g., gtsv_spike); 0 is number of threads" ),
 
     vl        ( "vl",         6, 3, PT_List,    -inf, -inf,  inf, "lower bound of eigen/singular values to find" ),
     vu        ( "vu",         6, 3, PT_List,     inf, -inf,  inf, "upper bound of eigen/singular values to find" ),
@@ -599,6 +656,12 @@ Params::Params():
     gbytes    ( "gbyte/s",   12, 3, PT_Out, no_data, 0, 0, "Gbyte/s rate" ),
     iters     ( "iters",      5,    PT_Out, 0,       0, 0, "iterations to solution" ),
 
+    gcycles   ( "Gcycles",     9, 3, PT_Out, no_data, 0, 0, "CPU cycles, in billions, summed over threads" ),
+    ipc       ( "IPC",         5, 2, PT_Out, no_data, 0, 0, "instructions per cycle" ),
+    llc_misses( "LLC Mmiss",   9, 3, PT_Out, no_data, 0, 0, "last-level cache misses, in millions" ),
+    llc_gbytes( "LLC gbyte/s", 11, 3, PT_Out, no_data, 0, 0, "memory bandwidth estimated from LLC misses" ),
+    hw_gflops ( "hw gflop/s",  12, 3, PT_Out, no_data, 0, 0, "Gflop/s rate counted by hardware" ),
+
     ref_time  ( "ref time (s)",  9, 3, PT_Out, no_data, 0, 0, "reference time to solution" ),
     ref_gflops( "ref gflop/s",  12, 3, PT_Out, no_data, 0, 0, "reference Gflop/s rate" ),
     ref_gbytes( "ref gbyte/s",  12, 3, PT_Out, no_data, 0, 0, "reference Gbyte/s rate" ),
@@ -626,6 +689,7 @@ Params::Params():
     repeat();
     verbose();
     cache();
+    counters();
 
     // routine's parameters are marked by the test routine; see main
 }
@@ -797,6 +861,15 @@ int main( int argc, char** argv )
             params.align.width( 5 );
         }
 
+        // show hardware counter columns if requested
+        if (params.counters() == 'y') {
+            params.gcycles();
+            params.ipc();
+            params.llc_misses();
+            params.llc_gbytes();
+            params.hw_gflops();
+        }
+
         // run tests
         int repeat = params.repeat();
         testsweeper::DataType last = params.datatype();
@@ -42,6 +42,7 @@ public:
     testsweeper::ParamInt    repeat;
     testsweeper::ParamInt    verbose;
     testsweeper::ParamInt    cache;
+    testsweeper::ParamChar   counters;
 
     //----- test matrix parameters
     MatrixParams matrix;
@@ -95,6 +96,7 @@ public:
     testsweeper::ParamInt     ku;
     testsweeper::ParamInt     nrhs;
     testsweeper::ParamInt     nb;
+    testsweeper::ParamInt     nparts;
     testsweeper::ParamDouble  vl;
     testsweeper::ParamDouble  vu;
     testsweeper::ParamInt     il;
@@ -125,6 +127,13 @@ public:
     testsweeper::ParamDouble     gbytes;
     testsweeper::ParamInt        iters;
 
+    // hardware counters, with --counters y
+    testsweeper::ParamDouble     gcycles;
+    testsweeper::ParamDouble     ipc;
+    testsweeper::ParamDouble     llc_misses;
+    testsweeper::ParamDouble     llc_gbytes;
+    testsweeper::ParamDouble     hw_gflops;
+
     testsweeper::ParamDouble     ref_time;
     testsweeper::ParamDouble     ref_gflops;
     testsweeper::ParamDouble     ref_gbytes;
@@ -134,6 +143,13 @@ public:
     testsweeper::ParamString     msg;
 };
 
+//------------------------------------------------------------------------------
+// With --counters y, measure hardware counters around the tested routine,
+// setting the counter columns. Call start just before the timed region,
+// and stop with its time just after. See perf_counters.cc.
+void perf_counters_start( Params& params );
+void perf_counters_stop( Params& params, double time );
+
 //------------------------------------------------------------------------------
 template< typename T >
 inline T roundup( T x, T y )
@@ -174,8 +190,11 @@ void require_( bool cond, const char* condstr, const char* file, int line )
 // LAPACK
 // LU, general
 void test_gesv  ( Params& params, bool run );
+void test_gesv_layout ( Params& params, bool run );
+void test_gesv_view ( Params& params, bool run );
 void test_gesvx ( Params& params, bool run );
 void test_getrf ( Params& params, bool run );
+void test_getrf_ooc ( Params& params, bool run );
 void test_getri ( Params& params, bool run );
 void test_getrs ( Params& params, bool run );
 void test_gecon ( Params& params, bool run );
@@ -184,6 +203,7 @@ void test_geequ ( Params& params, bool run );
 
 // LU, band
 void test_gbsv  ( Params& params, bool run );
+void test_gbsv_spike ( Params& params, bool run );
 void test_gbsvx ( Params& params, bool run );
 void test_gbtrf ( Params& params, bool run );
 void test_gbtrs ( Params& params, bool run );
@@ -193,6 +213,7 @@ void test_gbequ ( Params& params, bool run );
 
 // LU, tridiagonal
 void test_gtsv  ( Params& params, bool run );
+void test_gtsv_spike ( Params& params, bool run );
 void test_gtsvx ( Params& params, bool run );
 void test_gttrf ( Params& params, bool run );
 void test_gttrs ( Params& params, bool run );
@@ -202,8 +223,14 @@ void test_gtequ ( Params& params, bool run );
 
 // Cholesky
 void test_posv  ( Params& params, bool run );
+void test_posv_layout ( Params& params, bool run );
+void test_posv_async ( Params& params, bool run );
+void test_posv_instrument ( Params& params, bool run );
+void test_posv_trace ( Params& params, bool run );
 void test_posvx ( Params& params, bool run );
 void test_potrf ( Params& params, bool run );
+void test_potrf_ooc ( Params& params, bool run );
+void test_potrf_update ( Params& params, bool run );
 void test_potri ( Params& params, bool run );
 void test_potrs ( Params& params, bool run );
 void test_pocon ( Params& params, bool run );
@@ -296,12 +323,16 @@ void test_gelsy ( Params& params, bool run );
 void test_gelsd ( Params& params, bool run );
 void test_gelss ( Params& params, bool run );
 void test_getsls( Params& params, bool run );
+void test_qrstream( Params& params, bool run );
+void test_gels_sketch( Params& params, bool run );
 void test_gglse ( Params& params, bool run );
 void test_ggglm ( Params& params, bool run );
 
 // QR, LQ, QL, RQ
 void test_geqr  ( Params& params, bool run );
 void test_geqrf ( Params& params, bool run );
+void test_geqrf_layout ( Params& params, bool run );
+void test_geqp3_rand ( Params& params, bool run );
 void test_gelqf ( Params& params, bool run );
 void test_geqlf ( Params& params, bool run );
 void test_gerqf ( Params& params, bool run );
@@ -320,6 +351,9 @@ void test_ungrq ( Params& params, bool run );
 void test_orhr_col( Params& params, bool run );
 void test_unhr_col( Params& params, bool run );
 
+void test_qr_insert_col( Params& params, bool run );
+void test_qr_delete_col( Params& params, bool run );
+
 void test_unmqr ( Params& params, bool run );
 void test_unmlq ( Params& params, bool run );
 void test_unmql ( Params& params, bool run );
@@ -341,10 +375,17 @@ void test_tprfb ( Params& params, bool run );
 void test_heev  ( Params& params, bool run );
 void test_heevx ( Params& params, bool run );
 void test_heevd ( Params& params, bool run );
+void test_heev_qdwh ( Params& params, bool run );
+void test_heevd_layout ( Params& params, bool run );
 void test_heevr ( Params& params, bool run );
+void test_heev_chfsi ( Params& params, bool run );
 void test_hetrd ( Params& params, bool run );
+void test_hetrd_2stage ( Params& params, bool run );
 void test_lae2  ( Params& params, bool run );
 void test_laev2 ( Params& params, bool run );
+void test_stedc_mt ( Params& params, bool run );
+void test_stein_mt ( Params& params, bool run );
+void test_stemr_mt ( Params& params, bool run );
 void test_sturm ( Params& params, bool run );
 void test_ungtr ( Params& params, bool run );
 void test_unmtr ( Params& params, bool run );
@@ -408,8 +449,15 @@ void test_ggesx ( Params& params, bool run );
 
 // SVD
 void test_gesvd ( Params& params, bool run );
+void test_gebrd ( Params& params, bool run );
+void test_gesvd_layout ( Params& params, bool run );
 void test_gesdd ( Params& params, bool run );
 void test_gesvdx( Params& params, bool run );
+void test_bdsdc    ( Params& params, bool run );
+void test_bdsdc_mt ( Params& params, bool run );
+void test_rsvd ( Params& params, bool run );
+void test_polar ( Params& params, bool run );
+void test_gesvd_qdwh ( Params& params, bool run );
 void test_gesvd_2stage ( Params& params, bool run );
 void test_gesdd_2stage ( Params& params, bool run );
 void test_gesvdx_2stage( Params& params, bool run );
@@ -419,8 +467,10 @@ void test_gesvj ( Params& params, bool run );
 // auxiliary
 void test_lacpy ( Params& params, bool run );
 void test_laed4 ( Params& params, bool run );
+void test_laed4_all ( Params& params, bool run );
 void test_laset ( Params& params, bool run );
 void test_laswp ( Params& params, bool run );
+void test_matrix_file ( Params& params, bool run );
 
 // auxiliary - Householder
 void test_larfg ( Params& params, bool run );
@@ -473,5 +523,13 @@ void test_potrf_device ( Params& params, bool run );
 void test_getrf_device ( Params& params, bool run );
 void test_geqrf_device ( Params& params, bool run );
 void test_heevd_device ( Params& params, bool run );
+void test_potrs_device ( Params& params, bool run );
+void test_getrs_device ( Params& params, bool run );
+void test_unmqr_device ( Params& params, bool run );
+void test_ungqr_device ( Params& params, bool run );
+void test_gesvd_device ( Params& params, bool run );
+void test_sytrf_device ( Params& params, bool run );
+void test_sytrs_device ( Params& params, bool run );
+void test_trtri_device ( Params& params, bool run );
 
 #endif  //  #ifndef TEST_HH
@@ -0,0 +1,180 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Solves a batch of nparts independent systems A_i X_i = B_i by a pipeline
+// of lapack::async::potrf and potrs, each potrs depending on its potrf.
+// The reference is the same batch solved by lapack::posv in a loop.
+template< typename scalar_t >
+void test_posv_async_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.nparts();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    if (batch <= 0)
+        batch = std::max( 1u, std::thread::hardware_concurrency() );
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< std::vector< scalar_t > > A_tst( batch ), A_ref( batch );
+    std::vector< std::vector< scalar_t > > B_tst( batch ), B_ref( batch );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    for (int64_t i = 0; i < batch; ++i) {
+        A_tst[ i ].resize( size_A );
+        B_tst[ i ].resize( size_B );
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i ][0], lda );
+        lapack::larnv( idist, iseed, size_B, &B_tst[ i ][0] );
+        A_ref[ i ] = A_tst[ i ];
+        B_ref[ i ] = B_tst[ i ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "batch %lld of A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( batch ), llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        // Errors are rethrown by get; a failed potrf cancels its potrs.
+        auto f = lapack::async::potrf( uplo, -1, &A_tst[0][0], lda );
+        auto s = lapack::async::potrs( uplo, n, nrhs, &A_tst[0][0], lda,
+                                       &B_tst[0][0], ldb, { f } );
+        assert_throw( f.get(), lapack::Error );
+        assert_throw( s.get(), lapack::Error );
+        assert_throw( lapack::async::Future().get(), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    std::vector< lapack::async::Future > factors, solves;
+    for (int64_t i = 0; i < batch; ++i) {
+        factors.push_back( lapack::async::potrf(
+            uplo, n, &A_tst[ i ][0], lda ) );
+        solves.push_back( lapack::async::potrs(
+            uplo, n, nrhs, &A_tst[ i ][0], lda, &B_tst[ i ][0], ldb,
+            { factors.back() } ) );
+    }
+    int64_t info_tst = 0;
+    try {
+        info_tst = lapack::async::wait_all( solves );
+    }
+    catch (lapack::Error& err) {
+        info_tst = lapack::async::wait_all( factors );
+        fprintf( stderr, "lapack::async::potrs failed: %s\n", err.what() );
+    }
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::async::potrf returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::posv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over the batch of ||b - Ax|| / (n * ||A|| * ||x||).
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            std::vector< scalar_t > R = B_ref[ i ];
+            blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                        n, nrhs,
+                        -1.0, &A_ref[ i ][0], lda,
+                              &B_tst[ i ][0], ldb,
+                         1.0, &R[0], ldb );
+            real_t Rnorm = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[ i ][0], ldb );
+            real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A_ref[ i ][0], lda );
+            error = blas::max( error, Rnorm / (n * Anorm * Xnorm) );
+        }
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info = lapack::posv( uplo, n, nrhs, &A_ref[ i ][0], lda,
+                                         &B_ref[ i ][0], ldb );
+            if (info_ref == 0)
+                info_ref = info;
+        }
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::posv returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_posv_async( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_posv_async_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_posv_async_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_posv_async_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_posv_async_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,173 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_svd.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_bdsdc_mt_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+
+    // Constants
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    lapack::Job jobz = params.jobz();
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho_U();
+    params.ortho_V();
+    params.error2();
+    params.error2.name( "Sigma order" );
+    params.error3();
+    params.error3.name( "Sigma" );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t ldu = ldb;
+    int64_t ldvt = ldb;
+    size_t size_B = (size_t) ldb * n;
+
+    std::vector< real_t > D_tst( n );
+    std::vector< real_t > E_tst( blas::max( 1, n - 1 ) );
+    std::vector< real_t > U( size_B );
+    std::vector< real_t > VT( size_B );
+
+    int64_t idist = 3;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, D_tst.size(), &D_tst[0] );
+    lapack::larnv( idist, iseed, E_tst.size(), &E_tst[0] );
+    std::vector< real_t > D_ref( D_tst );
+    std::vector< real_t > E_ref( E_tst );
+
+    // Dense bidiagonal B for checking.
+    std::vector< real_t > B( size_B, 0 );
+    for (int64_t i = 0; i < n; ++i) {
+        B[ i + i*ldb ] = D_tst[ i ];
+        if (i < n-1) {
+            if (uplo == lapack::Uplo::Upper)
+                B[ i + (i+1)*ldb ] = E_tst[ i ];
+            else
+                B[ (i+1) + i*ldb ] = E_tst[ i ];
+        }
+    }
+
+    if (verbose >= 2) {
+        printf( "B = " ); print_matrix( n, n, &B[0], ldb );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::bdsdc_mt( uplo, jobz, n, &D_tst[0], &E_tst[0],
+                                         &U[0], ldu, &VT[0], ldvt );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::bdsdc_mt returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "U = " ); print_matrix( n, n, &U[0], ldu );
+        printf( "VT = " ); print_matrix( n, n, &VT[0], ldvt );
+        printf( "Sigma = " ); print_vector( n, &D_tst[0], 1 );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check numerical error
+        // result[ 0 ] = || B - U Sigma VT || / (||B|| n), if jobz != NoVec.
+        // result[ 1 ] = || I - U^H U || / n,  if jobz != NoVec.
+        // result[ 2 ] = || I - VT VT^H || / n, if jobz != NoVec.
+        // result[ 3 ] = 0 if Sigma is non-negative and non-increasing.
+        real_t result[ 4 ] = { (real_t) testsweeper::no_data_flag,
+                               (real_t) testsweeper::no_data_flag,
+                               (real_t) testsweeper::no_data_flag,
+                               (real_t) testsweeper::no_data_flag };
+
+        check_svd( jobz, jobz, n, n, &B[0], ldb,
+                   &D_tst[0], &U[0], ldu, &VT[0], ldvt, result );
+
+        params.error()   = result[ 0 ];
+        params.ortho_U() = result[ 1 ];
+        params.ortho_V() = result[ 2 ];
+        params.error2()  = result[ 3 ];
+        params.okay()    = (jobz == Job::NoVec || result[ 0 ] < tol)
+                        && (jobz == Job::NoVec || result[ 1 ] < tol)
+                        && (jobz == Job::NoVec || result[ 2 ] < tol)
+                        && result[ 3 ] < tol;
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        std::vector< real_t > U_ref( size_B );
+        std::vector< real_t > VT_ref( size_B );
+        real_t dummy[1];
+        int64_t idummy[1];
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::bdsdc( uplo, jobz, n, &D_ref[0], &E_ref[0],
+                                          &U_ref[0], ldu, &VT_ref[0], ldvt,
+                                          dummy, idummy );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::bdsdc returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        real_t error = 0;
+        if (info_tst != info_ref) {
+            error = 1;
+        }
+        error += rel_error( D_tst, D_ref );
+        params.error3() = error;
+        params.okay() = params.okay() && (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_bdsdc_mt( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_bdsdc_mt_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_bdsdc_mt_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+        case testsweeper::DataType::DoubleComplex:
+            params.msg() = "skipping: no complex version";
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -61,9 +61,11 @@ void test_gbcon_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gbcon( norm, n, kl, ku, &AB[0], ldab, &ipiv_tst[0], anorm, &rcond_tst );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gbcon returned error %lld\n", llong( info_tst ) );
     }
@@ -57,9 +57,11 @@ void test_gbequ_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gbequ( m, n, kl, ku, &AB[0], ldab, &R_tst[0], &C_tst[0], &rowcnd_tst, &colcnd_tst, &amax_tst );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gbequ returned error %lld\n", llong( info_tst ) );
     }
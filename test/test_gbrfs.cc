@@ -110,6 +110,7 @@ void test_gbrfs_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     // Refine solution in X_tst, using original AB and B, factored AFB.
     // AB rows 0:kl-1 are ignored; start in row kl.
@@ -118,6 +119,7 @@ void test_gbrfs_work( Params& params, bool run )
         &AB[ kl ], ldab, &AFB[0], ldafb, &ipiv_tst[0],
         &B[0], ldb, &X_tst[0], ldx, &ferr_tst[0], &berr_tst[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gbrfs returned error %lld\n", llong( info_tst ) );
     }
@@ -75,9 +75,11 @@ void test_gbsv_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gbsv( n, kl, ku, nrhs, &AB_tst[0], ldab, &ipiv_tst[0], &B_tst[0], ldb );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gbsv returned error %lld\n", llong( info_tst ) );
     }
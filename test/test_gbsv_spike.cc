@@ -0,0 +1,161 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gbsv_spike_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t kl = params.kl();
+    int64_t ku = params.ku();
+    int64_t nrhs = params.nrhs();
+    int64_t nparts = params.nparts();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t kd = kl + ku + 1;  // number of diagonals; no fill-in rows needed
+    int64_t ldab = roundup( kd, align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_AB = (size_t) ldab * n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > AB_tst( size_AB );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, AB_tst.size(), &AB_tst[0] );
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    B_ref = B_tst;
+
+    // SPIKE pivots only within partitions; make A diagonally dominant.
+    for (int64_t j = 0; j < n; ++j)
+        AB_tst[ ku + j*ldab ] += real_t( kd );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "AB n=%5lld, kl=%5lld, ku=%5lld, kd=%5lld, ldab=%5lld, nparts=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( n ), llong( kl ), llong( ku ), llong( kd ), llong( ldab ),
+                llong( nparts ),
+                llong( n ), llong( nrhs ), llong( ldb ) );
+    }
+    if (verbose >= 2) {
+        printf( "AB = " ); print_matrix( kd, n, &AB_tst[0], ldab );
+        printf( "B = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::gbsv_spike( n, kl, ku, nrhs, &AB_tst[0], ldab,
+                                           &B_tst[0], ldb, nparts );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gbsv_spike returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
+        // A is not overwritten, so use AB_tst directly.
+        std::vector< scalar_t > R( B_ref );
+        for (int64_t j = 0; j < nrhs; ++j) {
+            // R -= A * B_tst
+            cblas_gbmv( CblasColMajor, CblasNoTrans, n, n, kl, ku,
+                        -1.0, &AB_tst[0], ldab,
+                              &B_tst[ j*ldb ], 1,
+                         1.0, &R[ j*ldb ], 1 );
+        }
+        if (verbose >= 2) {
+            printf( "R = " ); print_matrix( n, nrhs, &R[0], ldb );
+        }
+
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
+        real_t Anorm = lapack::langb( lapack::Norm::One, n, kl, ku, &AB_tst[0], ldab );
+        error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        // gbsv needs kl extra rows for fill-in.
+        int64_t ldab_ref = roundup( 2*kl + ku + 1, align );
+        std::vector< scalar_t > AB_ref( (size_t) ldab_ref * n );
+        std::vector< lapack_int > ipiv_ref( n );
+        lapack::lacpy( lapack::MatrixType::General, kd, n,
+                       &AB_tst[0], ldab, &AB_ref[ kl ], ldab_ref );
+
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_gbsv( n, kl, ku, nrhs, &AB_ref[0], ldab_ref,
+                                         &ipiv_ref[0], &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_gbsv returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gbsv_spike( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gbsv_spike_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gbsv_spike_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gbsv_spike_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gbsv_spike_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -50,9 +50,11 @@ void test_gbtrf_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gbtrf( m, n, kl, ku, &AB_tst[0], ldab, &ipiv_tst[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gbtrf returned error %lld\n", llong( info_tst ) );
     }
@@ -0,0 +1,132 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gebrd_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t minmn = blas::min( m, n );
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_D = (size_t) (minmn);
+    size_t size_E = (size_t) (blas::max( 1, minmn - 1 ));
+    size_t size_tau = (size_t) (minmn);
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< real_t > D_tst( size_D );
+    std::vector< real_t > E_tst( size_E );
+    std::vector< scalar_t > tauq_tst( size_tau );
+    std::vector< scalar_t > taup_tst( size_tau );
+    std::vector< real_t > Sigma_ref( size_D );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::gebrd( m, n, &A_tst[0], lda, &D_tst[0], &E_tst[0], &tauq_tst[0], &taup_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gebrd returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::gebrd( m, n );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check numerical error
+        // The singular values of the bidiagonal B must equal those of A.
+        // B is upper bidiagonal if m >= n, else lower bidiagonal.
+        lapack::Uplo uplo = (m >= n ? lapack::Uplo::Upper
+                                    : lapack::Uplo::Lower);
+        scalar_t dummy[ 1 ];
+        int64_t info_bd = lapack::bdsqr( uplo, minmn, 0, 0, 0,
+                                         &D_tst[0], &E_tst[0],
+                                         dummy, 1, dummy, 1, dummy, 1 );
+        if (info_bd != 0) {
+            fprintf( stderr, "lapack::bdsqr returned error %lld\n", llong( info_bd ) );
+        }
+
+        int64_t info_ref = lapack::gesvd( Job::NoVec, Job::NoVec, m, n,
+                                          &A_ref[0], lda, &Sigma_ref[0],
+                                          dummy, 1, dummy, 1 );
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::gesvd returned error %lld\n", llong( info_ref ) );
+        }
+
+        real_t error = 0;
+        if (info_tst != 0 || info_bd != 0 || info_ref != 0) {
+            error = 1;
+        }
+        if (minmn > 0) {
+            error += rel_error( D_tst, Sigma_ref );
+        }
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gebrd( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gebrd_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gebrd_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gebrd_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gebrd_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
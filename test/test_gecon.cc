@@ -47,9 +47,11 @@ void test_gecon_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gecon( norm, n, &A[0], lda, anorm, &rcond_tst );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gecon returned error %lld\n", llong( info_tst ) );
     }
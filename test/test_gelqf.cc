@@ -53,9 +53,11 @@ void test_gelqf_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gelqf( m, n, &A_tst[0], lda, &tau_tst[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gelqf returned error %lld\n", llong( info_tst ) );
     }
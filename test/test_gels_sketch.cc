@@ -0,0 +1,151 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+#include "check_gels.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Solves min || A X - B || with gels_sketch, reporting the time of each
+// phase and the number of LSQR iterations in the message column.
+// The reference is gels.
+template< typename scalar_t >
+void test_gels_sketch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+    params.msg();
+
+    if (! run)
+        return;
+
+    // skip invalid sizes
+    if (m < n) {
+        params.msg() = "skipping: requires m >= n";
+        return;
+    }
+
+    // ---------- setup
+    const int64_t maxiter = 200;
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+
+    B_ref = B_tst;
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gels_sketch( m, -1, nrhs, &A_tst[0], lda, &B_tst[0], ldb, tol, maxiter ), lapack::Error );
+        assert_throw( lapack::gels_sketch( n-1, n, nrhs, &A_tst[0], lda, &B_tst[0], ldb, tol, maxiter ), lapack::Error );
+        assert_throw( lapack::gels_sketch( m, n, -1, &A_tst[0], lda, &B_tst[0], ldb, tol, maxiter ), lapack::Error );
+        assert_throw( lapack::gels_sketch( m, n, nrhs, &A_tst[0], m-1, &B_tst[0], ldb, tol, maxiter ), lapack::Error );
+        assert_throw( lapack::gels_sketch( m, n, nrhs, &A_tst[0], lda, &B_tst[0], m-1, tol, maxiter ), lapack::Error );
+        assert_throw( lapack::gels_sketch( m, n, nrhs, &A_tst[0], lda, &B_tst[0], ldb, tol, -1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    lapack::SketchStats stats;
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::gels_sketch( m, n, nrhs, &A_tst[0], lda,
+                                            &B_tst[0], ldb, real_t( 0 ),
+                                            maxiter, &stats );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gels_sketch returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    char buf[ 80 ];
+    snprintf( buf, sizeof( buf ), "sketch %.2e, qr %.2e, lsqr %.2e, iters %lld%s",
+              stats.time_sketch, stats.time_qr, stats.time_solve,
+              llong( stats.iters ), stats.converged ? "" : " (not converged)" );
+    params.msg() = buf;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        real_t error[2];
+        check_gels( false, lapack::Op::NoTrans, m, n, nrhs,
+                    &A_tst[0], lda, // original A
+                    &B_tst[0], ldb, // X
+                    &B_ref[0], ldb, // original B
+                    error );
+        params.error()  = error[0];
+        params.error2() = error[1];
+        params.okay() = (error[0] < tol) && (error[1] < tol)
+                        && stats.converged;
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_gels( 'n', m, n, nrhs, &A_tst[0], lda, &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_gels returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gels_sketch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gels_sketch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gels_sketch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gels_sketch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gels_sketch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -69,9 +69,11 @@ void test_gelsy_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gelsy( m, n, nrhs, &A_tst[0], lda, &B_tst[0], ldb, &jpvt_tst[0], rcond, &rank_tst );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gelsy returned error %lld\n", llong( info_tst ) );
     }
@@ -0,0 +1,167 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+#include "check_ortho.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Checks A P = Q R from geqp3_rand, and that P is a permutation.
+// The reference is geqp3. Gflop/s uses the geqrf flop count.
+template< typename scalar_t >
+void test_geqp3_rand_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.ortho();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+    int64_t minmn = blas::min( m, n );
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > tau_tst( minmn );
+    std::vector< scalar_t > tau_ref( minmn );
+    std::vector< int64_t > jpvt_tst( n, 0 );
+    std::vector< int64_t > jpvt_ref( n, 0 );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n",
+                llong( m ), llong( n ), llong( lda ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::geqp3_rand( -1, n, &A_tst[0], lda, &jpvt_tst[0], &tau_tst[0] ), lapack::Error );
+        assert_throw( lapack::geqp3_rand(  m,-1, &A_tst[0], lda, &jpvt_tst[0], &tau_tst[0] ), lapack::Error );
+        assert_throw( lapack::geqp3_rand(  m, n, &A_tst[0], m-1, &jpvt_tst[0], &tau_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::geqp3_rand( m, n, &A_tst[0], lda, &jpvt_tst[0], &tau_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::geqp3_rand returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::geqrf( m, n );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // || A P - Q R || / (n ||A||), and || I - Q^H Q || / n.
+        bool perm_okay = true;
+        std::vector< int > seen( n, 0 );
+        for (int64_t j = 0; j < n; ++j) {
+            int64_t p = jpvt_tst[ j ];
+            if (p < 1 || p > n || seen[ p-1 ]++)
+                perm_okay = false;
+        }
+
+        int64_t ldq = blas::max( 1, m );
+        int64_t ldr = blas::max( 1, minmn );
+        std::vector< scalar_t > Q( ldq * minmn );
+        std::vector< scalar_t > R( ldr * n );
+        std::vector< scalar_t > AP( size_A );
+        lapack::lacpy( lapack::MatrixType::Lower, m, minmn, &A_tst[0], lda, &Q[0], ldq );
+        int64_t info = lapack::ungqr( m, minmn, minmn, &Q[0], ldq, &tau_tst[0] );
+        if (info != 0) {
+            fprintf( stderr, "lapack::ungqr returned error %lld\n", llong( info ) );
+        }
+        lapack::laset( lapack::MatrixType::Lower, minmn, n, 0.0, 0.0, &R[0], ldr );
+        lapack::lacpy( lapack::MatrixType::Upper, minmn, n, &A_tst[0], lda, &R[0], ldr );
+
+        real_t error = 1;
+        if (perm_okay) {
+            for (int64_t j = 0; j < n; ++j)
+                blas::copy( m, &A_ref[ (jpvt_tst[ j ] - 1)*lda ], 1, &AP[ j*lda ], 1 );
+            blas::gemm( blas::Layout::ColMajor,
+                        blas::Op::NoTrans, blas::Op::NoTrans, m, n, minmn,
+                        -1.0, &Q[0], ldq, &R[0], ldr, 1.0, &AP[0], lda );
+            real_t Anorm = lapack::lange( lapack::Norm::One, m, n, &A_ref[0], lda );
+            error = lapack::lange( lapack::Norm::One, m, n, &AP[0], lda );
+            if (Anorm != 0)
+                error /= (n * Anorm);
+        }
+        params.error() = error;
+        params.ortho() = check_orthogonality( lapack::RowCol::Col, m, minmn,
+                                              &Q[0], ldq );
+        params.okay() = perm_okay && (error < tol) && (params.ortho() < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::geqp3( m, n, &A_ref[0], lda, &jpvt_ref[0], &tau_ref[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::geqp3 returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_geqp3_rand( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_geqp3_rand_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_geqp3_rand_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_geqp3_rand_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_geqp3_rand_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -58,9 +58,11 @@ void test_geqr_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     info_tst = lapack::geqr( m, n, &A_tst[0], lda, &T_tst[0], tsize );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::geqr returned error %lld\n", llong( info_tst ) );
     }
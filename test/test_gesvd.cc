@@ -82,6 +82,7 @@ void test_gesvd_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gesvd(
         jobu, jobvt, m, n,
@@ -90,6 +91,7 @@ void test_gesvd_work( Params& params, bool run )
         &U_tst[0], ldu,
         &VT_tst[0], ldvt );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gesvd returned error %lld\n", llong( info_tst ) );
     }
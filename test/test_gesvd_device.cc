@@ -0,0 +1,254 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/device.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+#include "check_svd.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gesvd_device_work( Params& params, bool run )
+{
+    using lapack::device_info_int;
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+
+    // get & mark input values
+    lapack::Job jobu = params.jobu();
+    lapack::Job jobvt = params.jobvt();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t device = params.device();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho_U();
+    params.ortho_V();
+    params.error2();
+    params.error2.name( "Sigma" );
+    params.msg();
+
+    if (! run)
+        return;
+
+    if (! lapack::device_available()) {
+        params.msg() = "skipping: no GPU devices or no GPU support";
+        return;
+    }
+
+    // skip invalid options
+    if (jobu  == Job::OverwriteVec && jobvt == Job::OverwriteVec) {
+        params.msg() = "skipping: jobu and jobvt cannot both be overwrite.";
+        return;
+    }
+    #if defined(LAPACK_HAVE_CUBLAS)
+        if (m < n) {
+            params.msg() = "skipping: cuSolver requires m >= n";
+            return;
+        }
+    #endif
+
+    // ---------- setup
+    int64_t minmn = blas::min( m, n );
+    int64_t u_ncol = (jobu == Job::AllVec ? m : minmn);
+    int64_t v_nrow = (jobvt == Job::AllVec ? n : minmn);
+    int64_t lda  = roundup( blas::max( 1, m ), align );
+    int64_t ldu  = roundup( blas::max( 1, m ), align );
+    int64_t ldvt = roundup( blas::max( 1, v_nrow ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_S = (size_t) minmn;
+    size_t size_U = (size_t) ldu * u_ncol;
+    size_t size_VT = (size_t) ldvt * n;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< real_t > Sigma_tst( size_S );
+    std::vector< real_t > Sigma_ref( size_S );
+    std::vector< scalar_t > U_tst( size_U );
+    std::vector< scalar_t > U_ref( size_U );
+    std::vector< scalar_t > VT_tst( size_VT );
+    std::vector< scalar_t > VT_ref( size_VT );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    // Allocate and copy to device.
+    lapack::Queue queue( device );
+    scalar_t*        dA_tst  = lapack::device_malloc< scalar_t >( size_A, queue );
+    real_t*          dSigma  = lapack::device_malloc< real_t   >( size_S, queue );
+    scalar_t*        dU_tst  = lapack::device_malloc< scalar_t >( size_U, queue );
+    scalar_t*        dVT_tst = lapack::device_malloc< scalar_t >( size_VT, queue );
+    device_info_int* d_info  = lapack::device_malloc< device_info_int >( 1, queue );
+    lapack::device_copy_matrix( m, n, A_tst.data(), lda, dA_tst, lda, queue );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n",
+                llong( m ), llong( n ), llong( lda ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // Allocate workspace
+    size_t d_size, h_size;
+    lapack::gesvd_work_size_bytes( jobu, jobvt, m, n, dA_tst, lda, dSigma,
+                                   dU_tst, ldu, dVT_tst, ldvt,
+                                   &d_size, &h_size, queue );
+    char* d_work = lapack::device_malloc< char >( d_size, queue );
+    std::vector<char> h_work_vector( h_size );
+    char* h_work = h_work_vector.data();
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gesvd( Job(0), jobvt, m, n, dA_tst, lda, dSigma, dU_tst, ldu, dVT_tst, ldvt, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::gesvd( jobu, Job(0),  m, n, dA_tst, lda, dSigma, dU_tst, ldu, dVT_tst, ldvt, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::gesvd( jobu, jobvt,  -1, n, dA_tst, lda, dSigma, dU_tst, ldu, dVT_tst, ldvt, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::gesvd( jobu, jobvt,  m, -1, dA_tst, lda, dSigma, dU_tst, ldu, dVT_tst, ldvt, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::gesvd( jobu, jobvt,  m, n, dA_tst, m-1, dSigma, dU_tst, ldu, dVT_tst, ldvt, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    queue.sync();
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+
+    lapack::gesvd( jobu, jobvt, m, n, dA_tst, lda, dSigma,
+                   dU_tst, ldu, dVT_tst, ldvt,
+                   d_work, d_size, h_work, h_size, d_info, queue );
+
+    queue.sync();
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+
+    params.time() = time;
+
+    // Copy result back to CPU.
+    device_info_int info_tst;
+    lapack::device_copy_matrix( m, n, dA_tst, lda, A_tst.data(), lda, queue );
+    lapack::device_memcpy( &Sigma_tst[0], dSigma, size_S, queue );
+    if (jobu == Job::AllVec || jobu == Job::SomeVec)
+        lapack::device_copy_matrix( m, u_ncol, dU_tst, ldu, U_tst.data(), ldu, queue );
+    if (jobvt == Job::AllVec || jobvt == Job::SomeVec)
+        lapack::device_copy_matrix( v_nrow, n, dVT_tst, ldvt, VT_tst.data(), ldvt, queue );
+    lapack::device_memcpy( &info_tst, d_info, 1, queue );
+    queue.sync();
+
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gesvd returned error %lld\n", llong( info_tst ) );
+    }
+
+    // Cleanup device memory.
+    lapack::device_free( dA_tst, queue );
+    lapack::device_free( dSigma, queue );
+    lapack::device_free( dU_tst, queue );
+    lapack::device_free( dVT_tst, queue );
+    lapack::device_free( d_info, queue );
+    lapack::device_free( d_work, queue );
+
+    if (verbose >= 2) {
+        printf( "A_out = " ); print_matrix( m, n, &A_tst[0], lda );
+        printf( "U = "     ); print_matrix( m, u_ncol, &U_tst[0], ldu );
+        printf( "VT = "    ); print_matrix( v_nrow, n, &VT_tst[0], ldvt );
+        printf( "Sigma = " ); print_vector( minmn, &Sigma_tst[0], 1 );
+    }
+
+    // ---------- check numerical error
+    // See check_svd for the definition of result[ 0:3 ].
+    real_t result[ 4 ] = { (real_t) testsweeper::no_data_flag,
+                           (real_t) testsweeper::no_data_flag,
+                           (real_t) testsweeper::no_data_flag,
+                           (real_t) testsweeper::no_data_flag };
+    if (params.check() == 'y') {
+        // U2 or VT2 points to A if overwriting
+        scalar_t* U2    = &U_tst[0];
+        int64_t   ldu2  = ldu;
+        scalar_t* VT2   = &VT_tst[0];
+        int64_t   ldvt2 = ldvt;
+        if (jobu == Job::OverwriteVec) {
+            U2   = &A_tst[0];
+            ldu2 = lda;
+        }
+        else if (jobvt == Job::OverwriteVec) {
+            VT2   = &A_tst[0];
+            ldvt2 = lda;
+        }
+        check_svd( jobu, jobvt, m, n, &A_ref[0], lda,
+                   &Sigma_tst[0], U2, ldu2, VT2, ldvt2, result );
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_gesvd(
+            to_char( jobu ), to_char( jobvt ), m, n,
+            &A_ref[0], lda,
+            &Sigma_ref[0],
+            &U_ref[0], ldu,
+            &VT_ref[0], ldvt );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_gesvd returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        if (info_tst != info_ref) {
+            result[ 0 ] = 1;
+        }
+        result[ 3 ] += rel_error( Sigma_tst, Sigma_ref );
+    }
+    params.error()   = result[ 0 ];
+    params.ortho_U() = result[ 1 ];
+    params.ortho_V() = result[ 2 ];
+    params.error2()  = result[ 3 ];
+    params.okay() = (
+        (jobu == Job::NoVec || jobvt == Job::NoVec || result[ 0 ] < tol)
+        && (jobu  == Job::NoVec || result[ 1 ] < tol)
+        && (jobvt == Job::NoVec || result[ 2 ] < tol)
+        && result[ 3 ] < tol);
+}
+
+// -----------------------------------------------------------------------------
+void test_gesvd_device( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gesvd_device_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesvd_device_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesvd_device_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesvd_device_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,167 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+#include "check_svd.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// QDWH-SVD; the reference is gesdd. Only jobu = n or s is supported.
+template< typename scalar_t >
+void test_gesvd_qdwh_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Job jobu = params.jobu();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho_U();
+    params.ortho_V();
+    params.error2();
+    params.error2.name( "Sigma" );
+
+    if (! run)
+        return;
+
+    // skip unsupported jobs
+    if (jobu != lapack::Job::NoVec && jobu != lapack::Job::SomeVec) {
+        params.msg() = "skipping: requires jobu = n or s";
+        return;
+    }
+
+    // ---------- setup
+    int64_t minmn = blas::min( m, n );
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldu = roundup( blas::max( 1, m ), align );
+    int64_t ldvt = roundup( blas::max( 1, minmn ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_S = (size_t) minmn;
+    size_t size_U = (size_t) ldu * minmn;
+    size_t size_VT = (size_t) ldvt * n;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< real_t > S_tst( size_S );
+    std::vector< real_t > S_ref( size_S );
+    std::vector< scalar_t > U_tst( size_U );
+    std::vector< scalar_t > U_ref( size_U );
+    std::vector< scalar_t > VT_tst( size_VT );
+    std::vector< scalar_t > VT_ref( size_VT );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n",
+                llong( m ), llong( n ), llong( lda ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gesvd_qdwh( lapack::Job::AllVec, m, n, &A_tst[0], lda, &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt ), lapack::Error );
+        assert_throw( lapack::gesvd_qdwh( jobu, -1, n, &A_tst[0], lda, &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt ), lapack::Error );
+        assert_throw( lapack::gesvd_qdwh( jobu,  m,-1, &A_tst[0], lda, &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt ), lapack::Error );
+        assert_throw( lapack::gesvd_qdwh( jobu,  m, n, &A_tst[0], m-1, &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::gesvd_qdwh( jobu, m, n, &A_tst[0], lda, &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gesvd_qdwh returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    // ---------- check numerical error
+    // errors[0] = || A - U diag(S) VT || / (||A|| max(m,n)),
+    //                                    if jobu  != NoVec
+    // errors[1] = || I - U^H U || / m,   if jobu  != NoVec
+    // errors[2] = || I - VT VT^H || / n, if jobu  != NoVec
+    // errors[3] = 0 if S has non-negative values in non-increasing order, else 1
+    real_t errors[4] = { (real_t) testsweeper::no_data_flag,
+                         (real_t) testsweeper::no_data_flag,
+                         (real_t) testsweeper::no_data_flag,
+                         (real_t) testsweeper::no_data_flag };
+    if (params.check() == 'y') {
+        check_svd( jobu, jobu, m, n, &A_tst[0], lda,
+                   &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt, errors );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_gesdd( to_char( jobu ), m, n, &A_ref[0], lda, &S_ref[0], &U_ref[0], ldu, &VT_ref[0], ldvt );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_gesdd returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        if (info_tst != info_ref) {
+            errors[0] = 1;
+        }
+        errors[3] += rel_error( S_tst, S_ref );
+    }
+    params.error()   = errors[0];
+    params.ortho_U() = errors[1];
+    params.ortho_V() = errors[2];
+    params.error2()  = errors[3];
+    params.okay() = (
+        (jobu == lapack::Job::NoVec || errors[0] < tol) &&
+        (jobu == lapack::Job::NoVec || errors[1] < tol) &&
+        (jobu == lapack::Job::NoVec || errors[2] < tol) &&
+        errors[3] < tol);
+}
+
+// -----------------------------------------------------------------------------
+void test_gesvd_qdwh( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gesvd_qdwh_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesvd_qdwh_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesvd_qdwh_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesvd_qdwh_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -105,6 +105,7 @@ void test_gesvx_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gesvx(
                            fact, trans, n, nrhs,
@@ -114,6 +115,7 @@ void test_gesvx_work( Params& params, bool run )
                            &B_tst[0], ldb, &X_tst[0], ldx,
                            &rcond_tst, &ferr_tst[0], &berr_tst[0], &rpivot_tst );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gesvx returned error %lld\n", llong( info_tst ) );
     }
@@ -40,7 +40,7 @@ void test_getrf_device_work( Params& params, bool run )
     if (! run)
         return;
 
-    if (blas::get_device_count() == 0) {
+    if (! lapack::device_available()) {
         params.msg() = "skipping: no GPU devices or no GPU support";
         return;
     }
@@ -59,12 +59,12 @@ void test_getrf_device_work( Params& params, bool run )
     lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
     A_ref = A_tst;
 
-    // Allocate and copy to GPU.
+    // Allocate and copy to device.
     lapack::Queue queue( device );
-    scalar_t*         dA_tst = blas::device_malloc< scalar_t >( size_A, queue );
-    device_pivot_int* d_ipiv = blas::device_malloc< device_pivot_int >( size_ipiv, queue );
-    device_info_int*  d_info = blas::device_malloc< device_info_int >( 1, queue );
-    blas::device_copy_matrix( m, n, A_tst.data(), lda, dA_tst, lda, queue );
+    scalar_t*         dA_tst = lapack::device_malloc< scalar_t >( size_A, queue );
+    device_pivot_int* d_ipiv = lapack::device_malloc< device_pivot_int >( size_ipiv, queue );
+    device_info_int*  d_info = lapack::device_malloc< device_info_int >( 1, queue );
+    lapack::device_copy_matrix( m, n, A_tst.data(), lda, dA_tst, lda, queue );
 
     if (verbose >= 1) {
         printf( "\n"
@@ -78,7 +78,7 @@ void test_getrf_device_work( Params& params, bool run )
     // Allocate workspace
     size_t d_size, h_size;
     lapack::getrf_work_size_bytes( m, n, dA_tst, lda, &d_size, &h_size, queue );
-    char* d_work = blas::device_malloc< char >( d_size, queue );
+    char* d_work = lapack::device_malloc< char >( d_size, queue );
     std::vector<char> h_work_vector( h_size );
     char* h_work = h_work_vector.data();
 
@@ -92,6 +92,7 @@ void test_getrf_device_work( Params& params, bool run )
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     queue.sync();
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
 
     lapack::getrf( m, n, dA_tst, lda, d_ipiv,
@@ -99,6 +100,7 @@ void test_getrf_device_work( Params& params, bool run )
 
     queue.sync();
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
     double gflop = lapack::Gflop< scalar_t >::getrf( m, n );
@@ -106,20 +108,20 @@ void test_getrf_device_work( Params& params, bool run )
 
     // Copy result back to CPU.
     device_info_int info_tst;
-    blas::device_copy_matrix( m, n, dA_tst, lda, A_tst.data(), lda, queue );
-    blas::device_memcpy( &info_tst, d_info, 1, queue );
-    blas::device_memcpy( &ipiv_tst[0], d_ipiv, size_ipiv, queue );
+    lapack::device_copy_matrix( m, n, dA_tst, lda, A_tst.data(), lda, queue );
+    lapack::device_memcpy( &info_tst, d_info, 1, queue );
+    lapack::device_memcpy( &ipiv_tst[0], d_ipiv, size_ipiv, queue );
     queue.sync();
 
     if (info_tst != 0) {
         fprintf( stderr, "lapack::getrf returned error %lld\n", llong( info_tst ) );
     }
 
-    // Cleanup GPU memory.
-    blas::device_free( dA_tst, queue );
-    blas::device_free( d_ipiv, queue );
-    blas::device_free( d_info, queue );
-    blas::device_free( d_work, queue );
+    // Cleanup device memory.
+    lapack::device_free( dA_tst, queue );
+    lapack::device_free( d_ipiv, queue );
+    lapack::device_free( d_info, queue );
+    lapack::device_free( d_work, queue );
 
     if (verbose >= 2) {
         printf( "A_factor = " ); print_matrix( m, n, &A_tst[0], lda );
@@ -0,0 +1,178 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+#include <cstdio>
+
+// -----------------------------------------------------------------------------
+// Tests getrf_ooc with A in a temporary file.
+// The window holds 5 panels of nb columns.
+template< typename scalar_t >
+void test_getrf_ooc_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nb = params.nb();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_ipiv = (size_t) (blas::min(m,n));
+    size_t window = 5 * blas::max( 1, m ) * nb * sizeof( scalar_t );
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< int64_t > ipiv_tst( size_ipiv );
+    std::vector< lapack_int > ipiv_ref( size_ipiv );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, nb=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( nb ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    std::FILE* file = std::tmpfile();
+    if (file == nullptr) {
+        params.msg() = "skipping: cannot create temporary file";
+        return;
+    }
+    lapack::OOCMatrix< scalar_t > A( fileno( file ), 0, m, n, lda );
+    A.write( 0, 0, m, n, &A_tst[0], lda );
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    lapack::OOCStats stats;
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::getrf_ooc( m, n, A, &ipiv_tst[0], window, &stats );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::getrf_ooc returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::getrf( m, n );
+    params.gflops() = gflop / time;
+
+    char buf[ 80 ];
+    snprintf( buf, sizeof( buf ), "read %.3g GB, write %.3g GB, overlap %.0f%%",
+              stats.bytes_read * 1e-9, stats.bytes_written * 1e-9,
+              100 * stats.overlap() );
+    params.msg() = buf;
+
+    A.read( 0, 0, m, n, &A_tst[0], lda );
+    std::fclose( file );
+
+    if (verbose >= 2) {
+        printf( "A_factor = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y' && m == n) {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
+        int64_t nrhs = 1;
+        int64_t ldb = roundup( blas::max( 1, n ), align );
+        size_t size_B = (size_t) ldb * nrhs;
+        std::vector< scalar_t > B_tst( size_B );
+        std::vector< scalar_t > B_ref( size_B );
+        int64_t idist = 1;
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+        B_ref = B_tst;
+
+        info_tst = lapack::getrs(
+            lapack::Op::NoTrans, n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb );
+        if (info_tst != 0) {
+            fprintf( stderr, "lapack::getrs returned error %lld\n", llong( info_tst ) );
+        }
+
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    n, nrhs, n,
+                    -1.0, &A_ref[0], lda,
+                          &B_tst[0], ldb,
+                     1.0, &B_ref[0], ldb );
+        if (verbose >= 2) {
+            printf( "R = " ); print_matrix( n, nrhs, &B_ref[0], ldb );
+        }
+
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &B_ref[0], ldb );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
+        real_t Anorm = lapack::lange( lapack::Norm::One, n, n,    &A_ref[0], lda );
+        error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_getrf( m, n, &A_ref[0], lda, &ipiv_ref[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_getrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_getrf_ooc( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_getrf_ooc_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_getrf_ooc_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_getrf_ooc_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_getrf_ooc_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -81,9 +81,11 @@ void test_getrs_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::getrs( trans, n, nrhs, &A[0], lda, &ipiv_tst[0], &B_tst[0], ldb );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::getrs returned error %lld\n", llong( info_tst ) );
     }
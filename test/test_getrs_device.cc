@@ -0,0 +1,215 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/device.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_getrs_device_work( Params& params, bool run )
+{
+    using lapack::device_info_int;
+    using lapack::device_pivot_int;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t device = params.device();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    if (! lapack::device_available()) {
+        params.msg() = "skipping: no GPU devices or no GPU support";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_ipiv = (size_t) n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< lapack_int > ipiv_ref( size_ipiv );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    // Allocate and copy to device.
+    lapack::Queue queue( device );
+    scalar_t*         dA_tst = lapack::device_malloc< scalar_t >( size_A, queue );
+    scalar_t*         dB_tst = lapack::device_malloc< scalar_t >( size_B, queue );
+    device_pivot_int* d_ipiv = lapack::device_malloc< device_pivot_int >( size_ipiv, queue );
+    device_info_int*  d_info = lapack::device_malloc< device_info_int >( 1, queue );
+    lapack::device_copy_matrix( n, n,    A_tst.data(), lda, dA_tst, lda, queue );
+    lapack::device_copy_matrix( n, nrhs, B_tst.data(), ldb, dB_tst, ldb, queue );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "B = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Op;
+        assert_throw( lapack::getrs( Op(0),  n, nrhs, dA_tst, lda, d_ipiv, dB_tst, ldb, d_info, queue ), lapack::Error );
+        assert_throw( lapack::getrs( trans, -1, nrhs, dA_tst, lda, d_ipiv, dB_tst, ldb, d_info, queue ), lapack::Error );
+        assert_throw( lapack::getrs( trans,  n,   -1, dA_tst, lda, d_ipiv, dB_tst, ldb, d_info, queue ), lapack::Error );
+        assert_throw( lapack::getrs( trans,  n, nrhs, dA_tst, n-1, d_ipiv, dB_tst, ldb, d_info, queue ), lapack::Error );
+        assert_throw( lapack::getrs( trans,  n, nrhs, dA_tst, lda, d_ipiv, dB_tst, n-1, d_info, queue ), lapack::Error );
+    }
+
+    // ---------- factor matrix
+    // Takes workspace and dev_info from the queue's pool.
+    lapack::getrf( n, n, dA_tst, lda, d_ipiv, queue );
+    queue.sync();
+    int64_t info_trf = queue.info();
+    if (info_trf != 0) {
+        fprintf( stderr, "lapack::getrf returned error %lld\n", llong( info_trf ) );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    queue.sync();
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+
+    lapack::getrs( trans, n, nrhs, dA_tst, lda, d_ipiv, dB_tst, ldb, d_info, queue );
+
+    queue.sync();
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::getrs( n, nrhs );
+    params.gflops() = gflop / time;
+
+    // Copy result back to CPU.
+    device_info_int info_tst;
+    lapack::device_copy_matrix( n, nrhs, dB_tst, ldb, B_tst.data(), ldb, queue );
+    lapack::device_memcpy( &info_tst, d_info, 1, queue );
+    queue.sync();
+
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::getrs returned error %lld\n", llong( info_tst ) );
+    }
+
+    // Cleanup device memory.
+    lapack::device_free( dA_tst, queue );
+    lapack::device_free( dB_tst, queue );
+    lapack::device_free( d_ipiv, queue );
+    lapack::device_free( d_info, queue );
+
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||B - op(A) X|| / (n * ||A|| * ||X||).
+        std::vector< scalar_t > R( B_ref );
+        blas::gemm( blas::Layout::ColMajor, trans, blas::Op::NoTrans,
+                    n, nrhs, n,
+                    -1.0, &A_ref[0], lda,
+                          &B_tst[0], ldb,
+                     1.0, &R[0], ldb );
+        if (verbose >= 2) {
+            printf( "R = " ); print_matrix( n, nrhs, &R[0], ldb );
+        }
+
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
+        real_t Anorm = lapack::lange( lapack::Norm::One, n, n, &A_ref[0], lda );
+        if (n > 0 && Xnorm > 0)
+            error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        int64_t info_ref = LAPACKE_getrf( n, n, &A_ref[0], lda, &ipiv_ref[0] );
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_getrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        info_ref = LAPACKE_getrs( to_char( trans ), n, nrhs, &A_ref[0], lda, &ipiv_ref[0], &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_getrs returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+
+        if (verbose >= 2) {
+            printf( "Xref = " ); print_matrix( n, nrhs, &B_ref[0], ldb );
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_getrs_device( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_getrs_device_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_getrs_device_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_getrs_device_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_getrs_device_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -110,9 +110,11 @@ void test_gglse_work( Params& params, bool run )
     // minimize || c - A*x ||_2   subject to   B*x = d
     // A is M-by-N matrix, B is P-by-N matrix, c is M-vector, and d is P-vector
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gglse( m, n, p, &A_tst[0], lda, &B_tst[0], ldb, &C_tst[0], &D_tst[0], &X_tst[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gglse returned error %lld\n", llong( info_tst ) );
     }
@@ -59,9 +59,11 @@ void test_ggrqf_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::ggrqf( m, p, n, &A_tst[0], lda, &taua_tst[0], &B_tst[0], ldb, &taub_tst[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::ggrqf returned error %lld\n", llong( info_tst ) );
     }
@@ -0,0 +1,147 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gtsv_spike_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t nparts = params.nparts();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_DL = (size_t) (n-1);
+    size_t size_D = (size_t) (n);
+    size_t size_DU = (size_t) (n-1);
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > DL( size_DL );
+    std::vector< scalar_t > D( size_D );
+    std::vector< scalar_t > DU( size_DU );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, DL.size(), &DL[0] );
+    lapack::larnv( idist, iseed, D.size(), &D[0] );
+    lapack::larnv( idist, iseed, DU.size(), &DU[0] );
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    B_ref = B_tst;
+
+    // SPIKE pivots only within partitions; make A diagonally dominant.
+    for (int64_t i = 0; i < n; ++i)
+        D[ i ] += real_t( 3 );
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::gtsv_spike( n, nrhs, &DL[0], &D[0], &DU[0],
+                                           &B_tst[0], ldb, nparts );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gtsv_spike returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
+        std::vector< scalar_t > R( B_ref );
+        for (int64_t j = 0; j < nrhs; ++j) {
+            scalar_t const* x = &B_tst[ j*ldb ];
+            scalar_t* r = &R[ j*ldb ];
+            for (int64_t i = 0; i < n; ++i) {
+                r[ i ] -= D[ i ] * x[ i ];
+                if (i > 0)
+                    r[ i ] -= DL[ i-1 ] * x[ i-1 ];
+                if (i < n-1)
+                    r[ i ] -= DU[ i ] * x[ i+1 ];
+            }
+        }
+
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
+        real_t Anorm = lapack::langt( lapack::Norm::One, n, &DL[0], &D[0], &DU[0] );
+        error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< scalar_t > DL_ref( DL );
+        std::vector< scalar_t > D_ref( D );
+        std::vector< scalar_t > DU_ref( DU );
+
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_gtsv( n, nrhs, &DL_ref[0], &D_ref[0], &DU_ref[0],
+                                         &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_gtsv returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gtsv_spike( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gtsv_spike_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gtsv_spike_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gtsv_spike_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gtsv_spike_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -58,9 +58,11 @@ void test_gttrf_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gttrf( n, &DL_tst[0], &D_tst[0], &DU_tst[0], &DU2_tst[0], &ipiv_tst[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gttrf returned error %lld\n", llong( info_tst ) );
     }
@@ -69,9 +69,11 @@ void test_gttrs_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gttrs( trans, n, nrhs, &DL[0], &D[0], &DU[0], &DU2[0], &ipiv_tst[0], &B_tst[0], ldb );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gttrs returned error %lld\n", llong( info_tst ) );
     }
@@ -68,12 +68,14 @@ void test_hbevd_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::hbevd(
                            jobz, uplo, n, kd,
                            &Aband_tst[0], lda,
                            &Lambda_tst[0], &Z[0], ldz );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::hbevd returned error %lld\n", llong( info_tst ) );
     }
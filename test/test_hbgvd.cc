@@ -95,6 +95,7 @@ void test_hbgvd_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::hbgvd(
                            jobz, uplo, n, ka, kb,
@@ -102,6 +103,7 @@ void test_hbgvd_work( Params& params, bool run )
                            &Bband_tst[0], ldb,
                            &Lambda_tst[0], &Z[0], ldz );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::hbgvd returned error %lld\n", llong( info_tst ) );
     }
@@ -0,0 +1,210 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_heev.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Computes the k smallest eigenpairs with heev_chfsi, then solves again
+// warm-started from those eigenvectors, reporting iterations of both
+// solves in the message column. The reference is heevr with il = 1, iu = k.
+template< typename scalar_t >
+void test_heev_chfsi_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+
+    // Constants
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nev = params.dim.k();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho();
+    params.error2();
+    params.error2.name( "Lambda" );
+    params.msg();
+
+    if (! run)
+        return;
+
+    // skip invalid sizes
+    if (nev > n) {
+        params.msg() = "skipping: requires k <= n";
+        return;
+    }
+
+    // ---------- setup
+    // Residual tolerance; Ritz values are then accurate to about eps.
+    const real_t chfsi_tol = std::sqrt( eps );
+    const int64_t maxiter = 100;
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldz = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_Z = (size_t) ldz * blas::max( 1, n );
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > Z_tst( size_Z );
+    std::vector< scalar_t > Z_ref( size_Z );
+    std::vector< real_t > Lambda_tst( n );
+    std::vector< real_t > Lambda_ref( n );
+    std::vector< lapack_int > isuppz_ref( 2 * blas::max( 1, n ) );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n" );
+        printf( "A n=%5lld, nev=%5lld, lda=%5lld\n",
+                llong( n ), llong( nev ), llong( lda ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " );
+        print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::heev_chfsi( uplo, -1, nev, &A_tst[0], lda, &Lambda_tst[0], &Z_tst[0], ldz, false, chfsi_tol, maxiter ), lapack::Error );
+        assert_throw( lapack::heev_chfsi( uplo, n, n+1, &A_tst[0], lda, &Lambda_tst[0], &Z_tst[0], ldz, false, chfsi_tol, maxiter ), lapack::Error );
+        assert_throw( lapack::heev_chfsi( uplo, n, nev, &A_tst[0], n-1, &Lambda_tst[0], &Z_tst[0], ldz, false, chfsi_tol, maxiter ), lapack::Error );
+        assert_throw( lapack::heev_chfsi( uplo, n, nev, &A_tst[0], lda, &Lambda_tst[0], &Z_tst[0], n-1, false, chfsi_tol, maxiter ), lapack::Error );
+        assert_throw( lapack::heev_chfsi( uplo, n, nev, &A_tst[0], lda, &Lambda_tst[0], &Z_tst[0], ldz, false, real_t( 0 ), maxiter ), lapack::Error );
+        assert_throw( lapack::heev_chfsi( uplo, n, nev, &A_tst[0], lda, &Lambda_tst[0], &Z_tst[0], ldz, false, chfsi_tol, -1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    lapack::ChfsiStats stats;
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::heev_chfsi(
+                           uplo, n, nev, &A_tst[0], lda,
+                           &Lambda_tst[0], &Z_tst[0], ldz, false,
+                           chfsi_tol, maxiter, &stats );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::heev_chfsi returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    // warm start from the computed eigenvectors
+    lapack::ChfsiStats stats_warm;
+    std::vector< scalar_t > Z_warm = Z_tst;
+    std::vector< real_t > Lambda_warm( n );
+    lapack::heev_chfsi( uplo, n, nev, &A_tst[0], lda,
+                        &Lambda_warm[0], &Z_warm[0], ldz, true,
+                        chfsi_tol, maxiter, &stats_warm );
+
+    char buf[ 80 ];
+    snprintf( buf, sizeof( buf ), "iters %lld, warm iters %lld%s",
+              llong( stats.iters ), llong( stats_warm.iters ),
+              stats.fallback ? " (heevr)" : "" );
+    params.msg() = buf;
+
+    if (verbose >= 2) {
+        printf( "Lambda = " );
+        print_vector( nev, &Lambda_tst[0], 1 );
+        printf( "Z = " );
+        print_matrix( n, nev, &Z_tst[0], ldz );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check numerical error
+        // result[ 0 ] = || Z^H A Z - Lambda || / (n ||A||).
+        // result[ 1 ] = || I - Z^H Z || / n.
+        // result[ 2 ] = 0 if Lambda is in non-decreasing order, else > 0.
+        real_t result[ 3 ] = { (real_t) testsweeper::no_data_flag,
+                               (real_t) testsweeper::no_data_flag,
+                               (real_t) testsweeper::no_data_flag };
+
+        check_heev( Job::Vec, uplo, n, &A_ref[0], lda,
+                    nev, &Lambda_tst[0], &Z_tst[0], ldz, result );
+
+        params.error()  = result[ 0 ];
+        params.ortho()  = result[ 1 ];
+        params.error2() = result[ 2 ];
+        params.okay()   = result[ 0 ] < tol
+                       && result[ 1 ] < tol
+                       && result[ 2 ] < tol;
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        lapack_int nfound_ref;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_heevr(
+                               'V', 'I', to_char( uplo ), n,
+                               &A_ref[0], lda,
+                               0, 0, 1, nev, 0, &nfound_ref,
+                               &Lambda_ref[0], &Z_ref[0], ldz, &isuppz_ref[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_heevr returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        // max_i | Lambda_tst[ i ] - Lambda_ref[ i ] | / ||A||
+        real_t error = 0;
+        real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A_tst[0], lda );
+        for (int64_t i = 0; i < nev; ++i) {
+            error = std::max( error, std::abs( Lambda_tst[ i ] - Lambda_ref[ i ] ) );
+        }
+        if (Anorm != 0)
+            error /= Anorm;
+        if (info_tst != info_ref) {
+            error += 1;
+        }
+        params.error2() = error;
+        params.okay() = params.okay() && (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_heev_chfsi( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_heev_chfsi_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_heev_chfsi_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_heev_chfsi_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_heev_chfsi_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
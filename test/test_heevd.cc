@@ -67,10 +67,12 @@ void test_heevd_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::heevd(
         jobz, uplo, n, &Z[0], lda, &Lambda_tst[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::heevd returned error %lld\n", llong( info_tst ) );
     }
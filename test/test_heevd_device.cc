@@ -45,7 +45,7 @@ void test_heevd_device_work( Params& params, bool run )
     if (! run)
         return;
 
-    if (blas::get_device_count() == 0) {
+    if (! lapack::device_available()) {
         params.msg() = "skipping: no GPU devices or no GPU support";
         return;
     }
@@ -65,19 +65,19 @@ void test_heevd_device_work( Params& params, bool run )
     lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
     Z = A;
 
-    // Allocate and copy to GPU
+    // Allocate and copy to device
     lapack::Queue queue( device );
-    scalar_t*        dA_tst = blas::device_malloc< scalar_t >( size_A, queue );
-    real_t*          dW_tst = blas::device_malloc< real_t >  ( size_W, queue );
-    device_info_int* d_info = blas::device_malloc< device_info_int >( 1, queue );
-    blas::device_copy_matrix( n, n, A.data(), lda, dA_tst, lda, queue );
+    scalar_t*        dA_tst = lapack::device_malloc< scalar_t >( size_A, queue );
+    real_t*          dW_tst = lapack::device_malloc< real_t >  ( size_W, queue );
+    device_info_int* d_info = lapack::device_malloc< device_info_int >( 1, queue );
+    lapack::device_copy_matrix( n, n, A.data(), lda, dA_tst, lda, queue );
 
 
     // Allocate workspace
     size_t d_size, h_size;
     lapack::heevd_work_size_bytes( jobz, uplo, n, dA_tst, lda, dW_tst,
                                    &d_size, &h_size, queue );
-    char* d_work = blas::device_malloc< char >( d_size, queue );
+    char* d_work = lapack::device_malloc< char >( d_size, queue );
     std::vector<char> h_work_vector( h_size );
     char* h_work = h_work_vector.data();
 
@@ -93,6 +93,7 @@ void test_heevd_device_work( Params& params, bool run )
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     queue.sync();
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
 
     lapack::heevd( jobz, uplo, n, dA_tst, lda, dW_tst, d_work, d_size,
@@ -100,6 +101,7 @@ void test_heevd_device_work( Params& params, bool run )
 
     queue.sync();
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
     // double gflop = lapack::Gflop< scalar_t >::heev( jobz, n );
@@ -107,9 +109,9 @@ void test_heevd_device_work( Params& params, bool run )
 
     // Copy result back to CPU.
     device_info_int info_tst;
-    blas::device_copy_matrix( n, n, dA_tst, lda, Z.data(), ldz, queue );
-    blas::device_copy_vector( n, dW_tst, 1, Lambda_tst.data(), 1, queue );
-    blas::device_memcpy( &info_tst, d_info, 1, queue );
+    lapack::device_copy_matrix( n, n, dA_tst, lda, Z.data(), ldz, queue );
+    lapack::device_copy_vector( n, dW_tst, 1, Lambda_tst.data(), 1, queue );
+    lapack::device_memcpy( &info_tst, d_info, 1, queue );
     queue.sync();
 
 
@@ -117,11 +119,11 @@ void test_heevd_device_work( Params& params, bool run )
         fprintf( stderr, "lapack::heev returned error %lld\n", llong( info_tst ) );
     }
 
-    // Cleanup GPU memory
-    blas::device_free( dA_tst, queue );
-    blas::device_free( dW_tst, queue );
-    blas::device_free( d_work, queue );
-    blas::device_free( d_info, queue );
+    // Cleanup device memory
+    lapack::device_free( dA_tst, queue );
+    lapack::device_free( dW_tst, queue );
+    lapack::device_free( d_work, queue );
+    lapack::device_free( d_info, queue );
 
     if (verbose >= 2) {
         printf( "Z = " ); print_matrix( n, n, &Z[0], ldz );
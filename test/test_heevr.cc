@@ -89,12 +89,14 @@ void test_heevr_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::heevr(
                            jobz, range, uplo, n, &A_tst[0], lda,
                            vl, vu, il, iu, abstol, &nfound,
                            &Lambda_tst[0], &Z[0], ldz, &isuppz_tst[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::heevr returned error %lld\n", llong( info_tst ) );
     }
@@ -83,6 +83,7 @@ void test_heevx_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::heevx(
                            jobz, range, uplo, n,
@@ -90,6 +91,7 @@ void test_heevx_work( Params& params, bool run )
                            vl, vu, il, iu, abstol, &nfound,
                            &Lambda_tst[0], &Z[0], ldz, &ifail_tst[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::heevx returned error %lld\n", llong( info_tst ) );
     }
@@ -76,10 +76,12 @@ void test_hegst_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::hegst(
         itype, uplo, n, &A_tst[0], lda, &B[0], ldb );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::hegst returned error %lld\n", llong( info_tst ) );
     }
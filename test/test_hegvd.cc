@@ -80,6 +80,7 @@ void test_hegvd_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::hegvd(
                            itype, jobz, uplo, n,
@@ -87,6 +88,7 @@ void test_hegvd_work( Params& params, bool run )
                            &B_tst[0], ldb,
                            &Lambda_tst[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::hegvd returned error %lld\n", llong( info_tst ) );
     }
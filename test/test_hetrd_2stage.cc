@@ -0,0 +1,143 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+#if LAPACK_VERSION >= 30700  // >= 3.7.0
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_hetrd_2stage_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_D = (size_t) (n);
+    size_t size_E = (size_t) (blas::max( 1, n-1 ));
+    size_t size_tau = (size_t) (blas::max( 1, n-1 ));
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< real_t > D_tst( size_D );
+    std::vector< real_t > E_tst( size_E );
+    std::vector< scalar_t > tau_tst( size_tau );
+    std::vector< real_t > Lambda_ref( size_D );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // query for size of hous2, which depends on the band width kd
+    scalar_t qry_hous2[ 1 ];
+    lapack::hetrd_2stage( Job::NoVec, uplo, n, &A_tst[0], lda,
+                          &D_tst[0], &E_tst[0], &tau_tst[0], qry_hous2, -1 );
+    int64_t lhous2 = int64_t( std::real( qry_hous2[ 0 ] ) );
+    std::vector< scalar_t > hous2_tst( lhous2 );
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::hetrd_2stage( Job::NoVec, uplo, n, &A_tst[0], lda, &D_tst[0], &E_tst[0], &tau_tst[0], &hous2_tst[0], lhous2 );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::hetrd_2stage returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::hetrd( n );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check numerical error
+        // The eigenvalues of the tridiagonal T must equal those of A.
+        int64_t info_st = lapack::sterf( n, &D_tst[0], &E_tst[0] );
+        if (info_st != 0) {
+            fprintf( stderr, "lapack::sterf returned error %lld\n", llong( info_st ) );
+        }
+
+        int64_t info_ref = lapack::heev( Job::NoVec, uplo, n, &A_ref[0], lda,
+                                         &Lambda_ref[0] );
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::heev returned error %lld\n", llong( info_ref ) );
+        }
+
+        real_t error = 0;
+        if (info_tst != 0 || info_st != 0 || info_ref != 0) {
+            error = 1;
+        }
+        if (n > 0) {
+            error += rel_error( D_tst, Lambda_ref );
+        }
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_hetrd_2stage( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_hetrd_2stage_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_hetrd_2stage_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_hetrd_2stage_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_hetrd_2stage_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+#else
+
+// -----------------------------------------------------------------------------
+void test_hetrd_2stage( Params& params, bool run )
+{
+    fprintf( stderr, "hetrd_2stage requires LAPACK >= 3.7.0\n\n" );
+    exit(0);
+}
+
+#endif  // LAPACK >= 3.7.0
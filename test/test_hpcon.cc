@@ -58,9 +58,11 @@ void test_hpcon_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::hpcon( uplo, n, &AP[0], &ipiv_tst[0], anorm, &rcond_tst );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::hpcon returned error %lld\n", llong( info_tst ) );
     }
@@ -61,11 +61,13 @@ void test_hpev_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::hpev(
                            jobz, uplo, n,
                            &Apack_tst[0], &Lambda_tst[0], &Z[0], ldz );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::hpev returned error %lld\n", llong( info_tst ) );
     }
@@ -61,11 +61,13 @@ void test_hpevd_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::hpevd(
         jobz, uplo, n,
         &Apack_tst[0], &Lambda_tst[0], &Z[0], ldz );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::hpevd returned error %lld\n", llong( info_tst ) );
     }
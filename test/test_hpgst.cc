@@ -70,9 +70,11 @@ void test_hpgst_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::hpgst( itype, uplo, n, &AP_tst[0], &BP[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::hpgst returned error %lld\n", llong( info_tst ) );
     }
@@ -52,9 +52,11 @@ void test_hptrd_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::hptrd( uplo, n, &AP_tst[0], &D_tst[0], &E_tst[0], &tau_tst[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::hptrd returned error %lld\n", llong( info_tst ) );
     }
@@ -0,0 +1,431 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <set>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Returns the record of routine in precision, or a record with calls = 0.
+static lapack::instrument::Record find_record(
+    std::vector< lapack::instrument::Record > const& records,
+    char const* routine, char precision )
+{
+    for (auto const& r : records) {
+        if (r.routine == routine && r.precision == precision)
+            return r;
+    }
+    return lapack::instrument::Record { routine, precision, 0, 0, 0, 0, 0, 0 };
+}
+
+// -----------------------------------------------------------------------------
+// Solves A X = B by potrf and potrs with lapack::instrument enabled,
+// and checks the records of both calls against the arguments and
+// lapack::Gflop. The reference is lapack::posv with instrument disabled,
+// which must record nothing.
+template< typename scalar_t >
+void test_posv_instrument_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ) );
+    }
+
+    // Restore the state on exit, as other tests share the counters.
+    bool was_enabled = lapack::instrument::enabled();
+
+    // ---------- run test
+    lapack::instrument::reset();
+    lapack::instrument::enable();
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::potrf( uplo, n, &A_tst[0], lda );
+    if (info_tst == 0) {
+        lapack::potrs( uplo, n, nrhs, &A_tst[0], lda, &B_tst[0], ldb );
+    }
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    lapack::instrument::enable( false );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info_tst ) );
+    }
+
+    auto records = lapack::instrument::snapshot();
+    char precision = blas::is_complex< scalar_t >::value
+                   ? (sizeof( real_t ) == sizeof( float ) ? 'c' : 'z')
+                   : (sizeof( real_t ) == sizeof( float ) ? 's' : 'd');
+    auto rec_potrf = find_record( records, "potrf", precision );
+    auto rec_potrs = find_record( records, "potrs", precision );
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::posv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 1) {
+        for (auto const& r : records) {
+            printf( "%c%-8s calls %lld, time %.2e, gflop %.2e, "
+                    "m %lld, n %lld, k %lld\n",
+                    r.precision, r.routine.c_str(), llong( r.calls ),
+                    r.time, r.gflop,
+                    llong( r.m_max ), llong( r.n_max ), llong( r.k_max ) );
+        }
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check records
+        double gflop_potrf = lapack::Gflop< scalar_t >::potrf( n );
+        double gflop_potrs = lapack::Gflop< scalar_t >::potrs( n, nrhs );
+        bool okay_rec =
+            rec_potrf.calls == 1
+            && rec_potrf.n_max == n
+            && rec_potrf.gflop == gflop_potrf
+            && rec_potrf.time >= 0 && rec_potrf.time <= time
+            && rec_potrs.calls == (info_tst == 0 ? 1 : 0)
+            && (info_tst != 0
+                || (rec_potrs.n_max == n
+                    && rec_potrs.k_max == nrhs
+                    && rec_potrs.gflop == gflop_potrs));
+        if (! okay_rec) {
+            fprintf( stderr, "lapack::instrument records don't match calls\n" );
+        }
+
+        // ---------- check error
+        // Relative backwards error = ||B - AX|| / (n * ||A|| * ||X||).
+        std::vector< scalar_t > R( B_ref );
+        blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                    n, nrhs,
+                    -1.0, &A_ref[0], lda,
+                          &B_tst[0], ldb,
+                     1.0, &R[0], ldb );
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
+        real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A_ref[0], lda );
+        if (n > 0 && Xnorm > 0)
+            error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol) && okay_rec;
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference, disabled
+        lapack::instrument::reset();
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::posv( uplo, n, nrhs, &A_ref[0], lda,
+                                         &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::posv returned error %lld\n", llong( info_ref ) );
+        }
+        if (! lapack::instrument::snapshot().empty()) {
+            fprintf( stderr, "lapack::instrument recorded calls when disabled\n" );
+            params.okay() = false;
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+
+    lapack::instrument::enable( was_enabled );
+}
+
+// -----------------------------------------------------------------------------
+void test_posv_instrument( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_posv_instrument_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_posv_instrument_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_posv_instrument_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_posv_instrument_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Solves A X = B by lapack::async::potrf and potrs with lapack::trace
+// enabled, and checks the trace: each routine runs inside an async task on
+// the same thread, with its arguments, and potrs starts after potrf ends.
+// The dumped JSON must have one complete event per event.
+template< typename scalar_t >
+void test_posv_trace_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::trace::Event;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    // Restore the state on exit, e.g., if enabled by LAPACKPP_TRACE.
+    bool was_enabled = lapack::trace::enabled();
+
+    // ---------- run test
+    lapack::trace::enable();
+    lapack::trace::clear();
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    auto f = lapack::async::potrf( uplo, n, &A_tst[0], lda );
+    auto s = lapack::async::potrs( uplo, n, nrhs, &A_tst[0], lda,
+                                   &B_tst[0], ldb, { f } );
+    int64_t info_tst = 0;
+    try {
+        info_tst = s.get();
+    }
+    catch (lapack::Error& err) {
+        info_tst = f.get();
+        fprintf( stderr, "lapack::async::potrs failed: %s\n", err.what() );
+    }
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+
+    // Two short-lived threads in turn: the second reuses the first's
+    // buffer, but the first's event is kept, with its own thread.
+    scalar_t a1 = 4, a2 = 9;
+    std::thread( [&] { lapack::potrf( uplo, 1, &a1, 1 ); } ).join();
+    std::thread( [&] { lapack::potrf( uplo, 1, &a2, 1 ); } ).join();
+    lapack::trace::enable( was_enabled );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info_tst ) );
+    }
+
+    // Events of other threads, e.g., a previous test's pool, are also kept,
+    // but clear() discarded earlier ones.
+    std::vector< Event > events = lapack::trace::events();
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::posv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 1) {
+        for (auto const& e : events) {
+            printf( "thread %2lld %-8s %-6s start %.2e end %.2e, "
+                    "m %lld, n %lld, k %lld, work %lld bytes\n",
+                    llong( e.thread ), e.name.c_str(), e.category.c_str(),
+                    e.start, e.end, llong( e.m ), llong( e.n ), llong( e.k ),
+                    llong( e.work_bytes ) );
+        }
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check trace
+        char precision = blas::is_complex< scalar_t >::value
+                       ? (sizeof( real_t ) == sizeof( float ) ? 'c' : 'z')
+                       : (sizeof( real_t ) == sizeof( float ) ? 's' : 'd');
+        std::string potrf_name = std::string( 1, precision ) + "potrf";
+        std::string potrs_name = std::string( 1, precision ) + "potrs";
+
+        // Returns the first event named name, or null.
+        auto find = [&events]( std::string const& name ) -> Event const* {
+            for (auto const& e : events) {
+                if (e.name == name)
+                    return &e;
+            }
+            return nullptr;
+        };
+
+        // Returns true if an async task on e's thread contains e.
+        auto in_task = [&events]( Event const* e ) {
+            for (auto const& t : events) {
+                if (t.category == "async" && t.thread == e->thread
+                    && t.start <= e->start && e->end <= t.end
+                    && t.queued <= t.start)
+                    return true;
+            }
+            return false;
+        };
+
+        Event const* e_potrf = find( potrf_name );
+        Event const* e_potrs = find( potrs_name );
+        bool okay_trace =
+            e_potrf != nullptr
+            && e_potrf->category == "lapack"
+            && e_potrf->n == n
+            && e_potrf->start <= e_potrf->end
+            && in_task( e_potrf );
+        if (okay_trace && info_tst == 0) {
+            okay_trace =
+                e_potrs != nullptr
+                && e_potrs->n == n
+                && e_potrs->k == nrhs
+                && e_potrf->end <= e_potrs->start
+                && in_task( e_potrs );
+        }
+
+        // Both short-lived threads' potrf, on different threads.
+        std::set< int64_t > threads_1x1;
+        int64_t calls_1x1 = 0;
+        for (auto const& e : events) {
+            if (e.name == potrf_name && e.n == 1 && e.category == "lapack") {
+                ++calls_1x1;
+                threads_1x1.insert( e.thread );
+            }
+        }
+        okay_trace = okay_trace
+            && calls_1x1 >= 2 && threads_1x1.size() >= 2;
+
+        // Dumped JSON has one complete ("X") event per event.
+        std::FILE* file = std::tmpfile();
+        lapack::trace::dump( file );
+        std::rewind( file );
+        std::string json;
+        char buf[ 1024 ];
+        size_t len;
+        while ((len = std::fread( buf, 1, sizeof(buf), file )) > 0)
+            json.append( buf, len );
+        std::fclose( file );
+        size_t complete = 0;
+        for (size_t pos = json.find( "\"ph\": \"X\"" );
+             pos != std::string::npos;
+             pos = json.find( "\"ph\": \"X\"", pos + 1 )) {
+            ++complete;
+        }
+        okay_trace = okay_trace
+            && json.compare( 0, 2, "{\"" ) == 0
+            && json.find( "\"traceEvents\"" ) != std::string::npos
+            && complete >= events.size();
+        if (! okay_trace) {
+            fprintf( stderr, "lapack::trace events don't match calls\n" );
+        }
+
+        // ---------- check error
+        // Relative backwards error = ||B - AX|| / (n * ||A|| * ||X||).
+        std::vector< scalar_t > R( B_ref );
+        blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                    n, nrhs,
+                    -1.0, &A_ref[0], lda,
+                          &B_tst[0], ldb,
+                     1.0, &R[0], ldb );
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
+        real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A_ref[0], lda );
+        if (n > 0 && Xnorm > 0)
+            error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol) && okay_trace;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_posv_trace( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_posv_trace_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_posv_trace_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_posv_trace_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_posv_trace_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -49,9 +49,11 @@ void test_lacpy_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     lapack::lacpy( matrixtype, m, n, &A[0], lda, &B_tst[0], ldb );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
     //double gflop = lapack::Gflop< scalar_t >::lacpy( m, n );
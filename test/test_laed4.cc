@@ -54,10 +54,12 @@ void test_laed4_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::laed4( n, i, &d[0], &z[0],
                                       &delta_tst[0], rho, &lambda_tst );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::laed4 returned error %lld\n", llong( info_tst ) );
     }
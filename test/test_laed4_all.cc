@@ -0,0 +1,127 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_laed4_all_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    real_t rho = std::abs( params.alpha.get<real_t>() );
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lddelta = roundup( blas::max( 1, n ), align );
+    size_t size_Delta = (size_t) lddelta * n;
+
+    std::vector< scalar_t > d( n );
+    std::vector< scalar_t > z( n );
+    std::vector< scalar_t > lambda_tst( n );
+    std::vector< scalar_t > lambda_ref( n );
+    std::vector< scalar_t > Delta_tst( size_Delta );
+    std::vector< scalar_t > Delta_ref( size_Delta );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, d.size(), &d[0] );
+    lapack::larnv( idist, iseed, z.size(), &z[0] );
+
+    // sort d.
+    std::sort( d.begin(), d.end() );
+
+    // z should have unit norm.
+    real_t z_norm = blas::nrm2( n, &z[0], 1 );
+    for (int64_t i = 0; i < n; ++i)
+        z[ i ] /= z_norm;
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::laed4_all( n, &d[0], &z[0],
+                                          &Delta_tst[0], lddelta,
+                                          rho, &lambda_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::laed4_all returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference, one root at a time
+        int64_t info_ref = 0;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < n; ++i) {
+            int64_t info = LAPACKE_laed4( n, i, &d[0], &z[0],
+                                          &Delta_ref[ i*lddelta ], rho,
+                                          &lambda_ref[ i ] );
+            if (info != 0 && info_ref == 0)
+                info_ref = i + 1;
+        }
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_laed4 returned error for root %lld\n",
+                     llong( info_ref - 1 ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        real_t error = 0;
+        if (info_tst != info_ref) {
+            error = 1;
+        }
+        for (int64_t i = 0; i < n; ++i) {
+            for (int64_t j = 0; j < n; ++j)
+                error += std::abs( Delta_tst[ j + i*lddelta ]
+                                 - Delta_ref[ j + i*lddelta ] );
+        }
+        error += abs_error( lambda_tst, lambda_ref );
+        params.error() = error;
+        params.okay() = (error == 0);  // expect bitwise identical to laed4
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_laed4_all( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_laed4_all_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_laed4_all_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+        case testsweeper::DataType::DoubleComplex:
+            params.msg() = "skipping: no complex version";
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
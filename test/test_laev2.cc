@@ -62,10 +62,12 @@ void test_laev2_work( Params& params, bool run )
 
     //---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     // no info returned
     lapack::laev2( a, b, c, &rt1, &rt2, &cs1, &sn1 );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
 
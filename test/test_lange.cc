@@ -53,9 +53,11 @@ void test_lange_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     real_t norm_tst = lapack::lange( norm, m, n, &A[0], lda );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
     //double gflop = lapack::Gflop< scalar_t >::lange( norm, m, n );
@@ -48,9 +48,11 @@ void test_langt_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     real_t norm_tst = lapack::langt( norm, n, &DL[0], &D[0], &DU[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
     // double gflop = lapack::Gflop< scalar_t >::langt( norm, n );
@@ -50,9 +50,11 @@ void test_lanhb_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     real_t norm_tst = lapack::lanhb( norm, uplo, n, kd, &AB[0], ldab );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
     //double gflop = lapack::Gflop< scalar_t >::lanhb( norm, n, kd );
@@ -45,9 +45,11 @@ void test_lanht_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     real_t norm_tst = lapack::lanht( norm, n, &D[0], &E[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
     // double gflop = lapack::Gflop< scalar_t >::lanht( norm, n );
@@ -60,9 +60,11 @@ void test_larf_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     lapack::larf( side, m, n, &V[0], incv, tau, &C_tst[0], ldc );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
     //double gflop = lapack::Gflop< scalar_t >::larf( side, m, n );
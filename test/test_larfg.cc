@@ -59,9 +59,11 @@ void test_larfg_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     lapack::larfg( n, &alpha_tst, &X_tst[0], incx, &tau_tst );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
     double gflop = lapack::Gflop< scalar_t >::larfg( n );
@@ -65,9 +65,11 @@ void test_lasr_work( Params& params, bool run )
 
     //---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     lapack::lasr( side, pivot, direction, m, n, &C[0], &S[0], &A_tst[0], lda );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
 
@@ -58,9 +58,11 @@ void test_laswp_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     lapack::laswp( n, &A_tst[0], lda, k1, k2, &ipiv_tst[0], incx );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
     //double gflop = lapack::Gflop< scalar_t >::laswp( n );
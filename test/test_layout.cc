@@ -0,0 +1,823 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_heev.hh"
+#include "check_svd.hh"
+
+#include <vector>
+
+// Testers for the Layout overloads in lapack/layout.hh. Each tester stores
+// the matrices in params.layout() order, runs the overload, copies the
+// results back to column-major, and applies the usual checks. The
+// reference is the column-major routine on the column-major copy, so
+// ref_time compares the two layouts directly.
+
+// -----------------------------------------------------------------------------
+// Leading dimension of an m-by-n matrix stored in the given layout.
+inline int64_t layout_ld( blas::Layout layout, int64_t m, int64_t n,
+                          int64_t align )
+{
+    return roundup( blas::max( 1, layout == blas::Layout::ColMajor ? m : n ),
+                    align );
+}
+
+// -----------------------------------------------------------------------------
+// Copies the m-by-n column-major matrix A into B, stored in the given layout.
+template< typename scalar_t >
+void colmajor_to_layout(
+    blas::Layout layout, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    if (layout == blas::Layout::ColMajor) {
+        lapack::lacpy( lapack::MatrixType::General, m, n, A, lda, B, ldb );
+    }
+    else {
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < m; ++i)
+                B[ j + i*ldb ] = A[ i + j*lda ];
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Copies the m-by-n matrix A, stored in the given layout, into the
+// column-major matrix B.
+template< typename scalar_t >
+void layout_to_colmajor(
+    blas::Layout layout, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    if (layout == blas::Layout::ColMajor) {
+        lapack::lacpy( lapack::MatrixType::General, m, n, A, lda, B, ldb );
+    }
+    else {
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < m; ++i)
+                B[ i + j*ldb ] = A[ j + i*lda ];
+    }
+}
+
+// -----------------------------------------------------------------------------
+// gesv( layout ) for trans = n; getrf( layout ) and getrs( layout, trans )
+// otherwise.
+template< typename scalar_t >
+void test_gesv_layout_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+
+    // get & mark input values
+    Layout layout = params.layout();
+    lapack::Op trans = params.trans();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = layout_ld( layout, n, nrhs, align );
+    int64_t ldb_ref = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * (layout == Layout::ColMajor ? nrhs : n);
+    size_t size_B_ref = (size_t) ldb_ref * nrhs;
+
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > B_ref( size_B_ref );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > X( size_B_ref );
+    std::vector< int64_t > ipiv_tst( n );
+    std::vector< int64_t > ipiv_ref( n );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_ref[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_ref.size(), &B_ref[0] );
+    colmajor_to_layout( layout, n, n, &A_ref[0], lda, &A_tst[0], lda );
+    colmajor_to_layout( layout, n, nrhs, &B_ref[0], ldb_ref, &B_tst[0], ldb );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gesv( Layout(0), n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gesv( layout,   -1, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gesv( layout,    n,   -1, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gesv( layout,    n, nrhs, &A_tst[0], n-1, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::getrs( layout, lapack::Op(0), n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst;
+    if (trans == lapack::Op::NoTrans) {
+        info_tst = lapack::gesv( layout, n, nrhs, &A_tst[0], lda,
+                                 &ipiv_tst[0], &B_tst[0], ldb );
+    }
+    else {
+        info_tst = lapack::getrf( layout, n, n, &A_tst[0], lda, &ipiv_tst[0] );
+        if (info_tst == 0) {
+            lapack::getrs( layout, trans, n, nrhs, &A_tst[0], lda,
+                           &ipiv_tst[0], &B_tst[0], ldb );
+        }
+    }
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gesv returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::gesv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - op(A) x|| / (n * ||A|| * ||x||).
+        layout_to_colmajor( layout, n, nrhs, &B_tst[0], ldb, &X[0], ldb_ref );
+        std::vector< scalar_t > R = B_ref;
+        blas::gemm( Layout::ColMajor, trans, blas::Op::NoTrans, n, nrhs, n,
+                    -1.0, &A_ref[0], lda, &X[0], ldb_ref,
+                     1.0, &R[0], ldb_ref );
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb_ref );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X[0], ldb_ref );
+        real_t Anorm = lapack::lange( trans == lapack::Op::NoTrans
+                                          ? lapack::Norm::One
+                                          : lapack::Norm::Inf,
+                                      n, n, &A_ref[0], lda );
+        error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::getrf( n, n, &A_ref[0], lda, &ipiv_ref[0] );
+        if (info_ref == 0) {
+            lapack::getrs( trans, n, nrhs, &A_ref[0], lda, &ipiv_ref[0],
+                           &B_ref[0], ldb_ref );
+        }
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::getrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_posv_layout_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+
+    // get & mark input values
+    Layout layout = params.layout();
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = layout_ld( layout, n, nrhs, align );
+    int64_t ldb_ref = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * (layout == Layout::ColMajor ? nrhs : n);
+    size_t size_B_ref = (size_t) ldb_ref * nrhs;
+
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > B_ref( size_B_ref );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > X( size_B_ref );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_ref[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_ref.size(), &B_ref[0] );
+    colmajor_to_layout( layout, n, n, &A_ref[0], lda, &A_tst[0], lda );
+    colmajor_to_layout( layout, n, nrhs, &B_ref[0], ldb_ref, &B_tst[0], ldb );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        assert_throw( lapack::posv( Layout(0), uplo,    n, nrhs, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::posv( layout,    Uplo(0), n, nrhs, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::posv( layout,    uplo,   -1, nrhs, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::posv( layout,    uplo,    n,   -1, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::posv( layout,    uplo,    n, nrhs, &A_tst[0], n-1, &B_tst[0], ldb ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::posv(
+        layout, uplo, n, nrhs, &A_tst[0], lda, &B_tst[0], ldb );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::posv returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::posv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
+        layout_to_colmajor( layout, n, nrhs, &B_tst[0], ldb, &X[0], ldb_ref );
+        std::vector< scalar_t > R = B_ref;
+        blas::hemm( Layout::ColMajor, blas::Side::Left, uplo,
+                    n, nrhs,
+                    -1.0, &A_ref[0], lda,
+                          &X[0], ldb_ref,
+                     1.0, &R[0], ldb_ref );
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb_ref );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X[0], ldb_ref );
+        real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A_ref[0], lda );
+        error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::posv(
+            uplo, n, nrhs, &A_ref[0], lda, &B_ref[0], ldb_ref );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::posv returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_geqrf_layout_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+
+    // get & mark input values
+    Layout layout = params.layout();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.gflops();
+    params.ortho();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t minmn = blas::min( m, n );
+    int64_t lda = layout_ld( layout, m, n, align );
+    int64_t lda_ref = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * (layout == Layout::ColMajor ? n : m);
+    size_t size_A_ref = (size_t) lda_ref * n;
+
+    std::vector< scalar_t > A_ref( size_A_ref );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > tau_tst( minmn );
+    std::vector< scalar_t > tau_ref( minmn );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_ref[0], lda_ref );
+    colmajor_to_layout( layout, m, n, &A_ref[0], lda_ref, &A_tst[0], lda );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n",
+                llong( m ), llong( n ), llong( lda ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::geqrf( Layout(0), m, n, &A_tst[0], lda, &tau_tst[0] ), lapack::Error );
+        assert_throw( lapack::geqrf( layout,   -1, n, &A_tst[0], lda, &tau_tst[0] ), lapack::Error );
+        assert_throw( lapack::geqrf( layout,    m,-1, &A_tst[0], lda, &tau_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::geqrf( layout, m, n, &A_tst[0], lda, &tau_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::geqrf returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::geqrf( m, n );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // The factor has the same meaning in either layout, so form Q and R
+        // in column-major and check || A - Q R ||_1 / (n ||A||_1) and
+        // || I - Q^H Q ||_1 / n, as in test_geqrf.
+        std::vector< scalar_t > QR( size_A_ref );
+        layout_to_colmajor( layout, m, n, &A_tst[0], lda, &QR[0], lda_ref );
+        int64_t ldr = roundup( blas::max( 1, minmn ), align );
+        std::vector< scalar_t > Q( lda_ref * minmn );
+        std::vector< scalar_t > R( ldr * n );
+        lapack::lacpy( lapack::MatrixType::Lower, m, minmn, &QR[0], lda_ref,
+                       &Q[0], lda_ref );
+        lapack::ungqr( m, minmn, minmn, &Q[0], lda_ref, &tau_tst[0] );
+        lapack::laset( lapack::MatrixType::Lower, minmn, n, 0.0, 0.0,
+                       &R[0], ldr );
+        lapack::lacpy( lapack::MatrixType::Upper, minmn, n, &QR[0], lda_ref,
+                       &R[0], ldr );
+
+        std::vector< scalar_t > E = A_ref;
+        blas::gemm( Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    m, n, minmn,
+                    -1.0, &Q[0], lda_ref, &R[0], ldr, 1.0, &E[0], lda_ref );
+        real_t Anorm = lapack::lange( lapack::Norm::One, m, n, &A_ref[0], lda_ref );
+        real_t error = lapack::lange( lapack::Norm::One, m, n, &E[0], lda_ref );
+        if (Anorm > 0)
+            error /= (n * Anorm);
+
+        std::vector< scalar_t > I( ldr * minmn );
+        lapack::laset( lapack::MatrixType::Upper, minmn, minmn, 0.0, 1.0,
+                       &I[0], ldr );
+        blas::herk( Layout::ColMajor, blas::Uplo::Upper, blas::Op::ConjTrans,
+                    minmn, m, -1.0, &Q[0], lda_ref, 1.0, &I[0], ldr );
+        real_t ortho = lapack::lanhe( lapack::Norm::One, lapack::Uplo::Upper,
+                                      minmn, &I[0], ldr );
+        ortho /= blas::max( 1, n );
+
+        params.error() = error;
+        params.ortho() = ortho;
+        params.okay() = (error < tol) && (ortho < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::geqrf( m, n, &A_ref[0], lda_ref, &tau_ref[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::geqrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gesvd_layout_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    using lapack::Job;
+
+    // get & mark input values
+    Layout layout = params.layout();
+    Job jobu = params.jobu();
+    Job jobvt = params.jobvt();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho_U();
+    params.ortho_V();
+    params.error2();
+    params.error2.name( "Sigma" );
+
+    if (! run)
+        return;
+
+    // Overwritten vectors end up in A; not checked here.
+    if (jobu == Job::OverwriteVec || jobvt == Job::OverwriteVec) {
+        params.msg() = "skipping: jobu and jobvt cannot be overwrite";
+        return;
+    }
+
+    // ---------- setup
+    int64_t minmn = blas::min( m, n );
+    int64_t u_ncol = (jobu == Job::AllVec ? m : minmn);
+    int64_t v_nrow = (jobvt == Job::AllVec ? n : minmn);
+    int64_t lda = layout_ld( layout, m, n, align );
+    int64_t ldu = layout_ld( layout, m, u_ncol, align );
+    int64_t ldvt = layout_ld( layout, v_nrow, n, align );
+    int64_t lda_ref = roundup( blas::max( 1, m ), align );
+    int64_t ldu_ref = lda_ref;
+    int64_t ldvt_ref = roundup( blas::max( 1, v_nrow ), align );
+    bool col = (layout == Layout::ColMajor);
+    size_t size_A = (size_t) lda * (col ? n : m);
+    size_t size_U = (size_t) ldu * (col ? u_ncol : m);
+    size_t size_VT = (size_t) ldvt * (col ? n : v_nrow);
+
+    std::vector< scalar_t > A_ref( lda_ref * n );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< real_t > S_tst( minmn );
+    std::vector< real_t > S_ref( minmn );
+    std::vector< scalar_t > U_tst( size_U );
+    std::vector< scalar_t > VT_tst( size_VT );
+    std::vector< scalar_t > U_ref( ldu_ref * u_ncol );
+    std::vector< scalar_t > VT_ref( ldvt_ref * n );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_ref[0], lda_ref );
+    colmajor_to_layout( layout, m, n, &A_ref[0], lda_ref, &A_tst[0], lda );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n",
+                llong( m ), llong( n ), llong( lda ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gesvd( Layout(0), jobu, jobvt, m, n, &A_tst[0], lda, &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt ), lapack::Error );
+        assert_throw( lapack::gesvd( layout,    jobu, jobvt,-1, n, &A_tst[0], lda, &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt ), lapack::Error );
+        assert_throw( lapack::gesvd( layout,    jobu, jobvt, m,-1, &A_tst[0], lda, &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::gesvd(
+        layout, jobu, jobvt, m, n, &A_tst[0], lda, &S_tst[0],
+        &U_tst[0], ldu, &VT_tst[0], ldvt );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gesvd returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    // ---------- check numerical error
+    // errors[0] = || A - U diag(S) VT || / (||A|| max(m,n)),
+    //                                    if jobu != NoVec and jobvt != NoVec
+    // errors[1] = || I - U^H U || / m,   if jobu  != NoVec
+    // errors[2] = || I - VT VT^H || / n, if jobvt != NoVec
+    // errors[3] = 0 if S has non-negative values in non-increasing order, else 1
+    real_t errors[4] = { (real_t) testsweeper::no_data_flag,
+                         (real_t) testsweeper::no_data_flag,
+                         (real_t) testsweeper::no_data_flag,
+                         (real_t) testsweeper::no_data_flag };
+    if (params.check() == 'y') {
+        std::vector< scalar_t > U( ldu_ref * u_ncol );
+        std::vector< scalar_t > VT( ldvt_ref * n );
+        if (jobu != Job::NoVec)
+            layout_to_colmajor( layout, m, u_ncol, &U_tst[0], ldu,
+                                &U[0], ldu_ref );
+        if (jobvt != Job::NoVec)
+            layout_to_colmajor( layout, v_nrow, n, &VT_tst[0], ldvt,
+                                &VT[0], ldvt_ref );
+        check_svd( jobu, jobvt, m, n, &A_ref[0], lda_ref, &S_tst[0],
+                   &U[0], ldu_ref, &VT[0], ldvt_ref, errors );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::gesvd(
+            jobu, jobvt, m, n, &A_ref[0], lda_ref, &S_ref[0],
+            &U_ref[0], ldu_ref, &VT_ref[0], ldvt_ref );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::gesvd returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        if (info_tst != info_ref) {
+            errors[3] = 1;
+        }
+        errors[3] += rel_error( S_tst, S_ref );
+    }
+    params.error()   = errors[0];
+    params.ortho_U() = errors[1];
+    params.ortho_V() = errors[2];
+    params.error2()  = errors[3];
+    params.okay() = (
+        (jobu  == Job::NoVec || jobvt == Job::NoVec || errors[0] < tol) &&
+        (jobu  == Job::NoVec || errors[1] < tol) &&
+        (jobvt == Job::NoVec || errors[2] < tol) &&
+        errors[3] < tol);
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_heevd_layout_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    using lapack::Job;
+
+    // get & mark input values
+    Layout layout = params.layout();
+    Job jobz = params.jobz();
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho();
+    params.error2();
+    params.error2.name( "Lambda" );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > Z( size_A );
+    std::vector< real_t > Lambda_tst( n );
+    std::vector< real_t > Lambda_ref( n );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_ref[0], lda );
+    colmajor_to_layout( layout, n, n, &A_ref[0], lda, &A_tst[0], lda );
+
+    if (verbose >= 1) {
+        printf( "\n" );
+        printf( "A n=%5lld, lda=%5lld\n", llong( n ), llong( lda ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::heevd( Layout(0), jobz, uplo, n, &A_tst[0], lda, &Lambda_tst[0] ), lapack::Error );
+        assert_throw( lapack::heevd( layout, jobz, lapack::Uplo(0), n, &A_tst[0], lda, &Lambda_tst[0] ), lapack::Error );
+        assert_throw( lapack::heevd( layout, jobz, uplo, -1, &A_tst[0], lda, &Lambda_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::heevd(
+        layout, jobz, uplo, n, &A_tst[0], lda, &Lambda_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::heevd returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (params.check() == 'y') {
+        // ---------- check numerical error
+        // results[0] = || A - Z Lambda Z^H || / (n ||A||), if jobz != NoVec
+        // results[1] = || I - Z^H Z || / n,                if jobz != NoVec
+        // results[2] = 0 if Lambda is in non-decreasing order, else >= 1
+        real_t results[3] = { (real_t) testsweeper::no_data_flag,
+                              (real_t) testsweeper::no_data_flag,
+                              (real_t) testsweeper::no_data_flag };
+        if (jobz != Job::NoVec)
+            layout_to_colmajor( layout, n, n, &A_tst[0], lda, &Z[0], lda );
+        check_heev( jobz, uplo, n, &A_ref[0], lda, n, &Lambda_tst[0],
+                    &Z[0], lda, results );
+        params.error() = results[0];
+        params.ortho() = results[1];
+        params.okay() = (jobz == Job::NoVec
+                         || (results[0] < tol && results[1] < tol))
+                        && results[2] == 0;
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::heevd(
+            jobz, uplo, n, &A_ref[0], lda, &Lambda_ref[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::heevd returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        real_t error = 0;
+        if (info_tst != info_ref) {
+            error = 1;
+        }
+        error += rel_error( Lambda_tst, Lambda_ref );
+        params.error2() = error;
+        params.okay() = params.okay() && (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gesv_layout( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gesv_layout_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesv_layout_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesv_layout_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesv_layout_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_posv_layout( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_posv_layout_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_posv_layout_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_posv_layout_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_posv_layout_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_geqrf_layout( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_geqrf_layout_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_geqrf_layout_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_geqrf_layout_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_geqrf_layout_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gesvd_layout( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gesvd_layout_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesvd_layout_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesvd_layout_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesvd_layout_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_heevd_layout( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_heevd_layout_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_heevd_layout_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_heevd_layout_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_heevd_layout_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,248 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/matrix_file.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Copies file src to dst, after applying edit to its bytes.
+template< typename Edit >
+static void copy_edited( std::string const& src, std::string const& dst,
+                         Edit edit )
+{
+    std::ifstream in( src, std::ios::binary );
+    std::vector< char > bytes( (std::istreambuf_iterator< char >( in )),
+                               std::istreambuf_iterator< char >() );
+    in.close();
+    edit( bytes );
+    std::ofstream out( dst, std::ios::binary | std::ios::trunc );
+    out.write( bytes.data(), bytes.size() );
+}
+
+// -----------------------------------------------------------------------------
+// @return true if reading the header of filename throws lapack::Error.
+static bool header_rejected( std::string const& filename, int verbose )
+{
+    try {
+        lapack::read_matrix_file_info( filename );
+    }
+    catch (lapack::Error const& err) {
+        if (verbose >= 1)
+            printf( "rejected: %s\n", err.what() );
+        return true;
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_matrix_file_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Layout;
+
+    // get & mark input values
+    Layout layout = params.layout();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.gbytes();
+    params.error.name( "mmap" );
+    params.error2();
+    params.error2.name( "ooc, write" );
+    params.error3();
+    params.error3.name( "header" );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+    std::vector< scalar_t > A( size_A );
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A[0], lda );
+    }
+
+    std::string filename = "test_matrix_file.mat";
+    std::string bad_name = "test_matrix_file_bad.mat";
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    lapack::write_matrix_file( filename, m, n, &A[0], lda,
+                               lapack::MatrixType::General, layout );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+
+    params.time() = time;
+    params.gbytes() = 1e-9 * sizeof(scalar_t) * m * n / time;
+
+    if (params.check() == 'y') {
+        // ---------- check header
+        int64_t header_errors = 0;
+        lapack::MatrixFileInfo info = lapack::read_matrix_file_info( filename );
+        int64_t ld = blas::max( 1, layout == Layout::ColMajor ? m : n );
+        int64_t data_size = sizeof(scalar_t) * ld
+                          * (layout == Layout::ColMajor ? n : m);
+        header_errors += (info.layout != layout);
+        header_errors += (info.type != lapack::MatrixType::General);
+        header_errors += (info.m != m || info.n != n || info.ld != ld);
+        header_errors += (info.alignment != 4096 || info.offset != 4096);
+
+        // ---------- check data through the memory map
+        std::vector< scalar_t > B( size_A );
+        {
+            lapack::MatrixFile< scalar_t > file( filename );
+            header_errors += (file.info().precision != info.precision);
+            scalar_t const* F = file.data();
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    B[ i + j*lda ] = (layout == Layout::ColMajor
+                                      ? F[ i + j*file.ld() ]
+                                      : F[ j + i*file.ld() ]);
+                }
+            }
+        }
+        real_t error = abs_error( B, A );
+
+        // ---------- check data through OOCMatrix, and writing back
+        int64_t io_errors = 0;
+        if (m > 0 && n > 0) {
+            if (layout == Layout::ColMajor) {
+                lapack::MatrixFile< scalar_t > file( filename );
+                std::vector< scalar_t > C( size_A );
+                file.ooc().read( 0, 0, m, n, &C[0], lda );
+                io_errors += (abs_error( C, A ) != 0);
+            }
+
+            // Writes to a read-only (copy-on-write) map stay in memory.
+            scalar_t a00 = A[ 0 ];
+            {
+                lapack::MatrixFile< scalar_t > file( filename );
+                file.data()[ 0 ] = a00 + real_t( 1 );
+            }
+            {
+                lapack::MatrixFile< scalar_t > file( filename );
+                io_errors += (file.data()[ 0 ] != a00);
+            }
+
+            // Writes to a writable map go to the file.
+            {
+                lapack::MatrixFile< scalar_t > file( filename, true );
+                file.data()[ 0 ] = a00 + real_t( 1 );
+                file.sync();
+            }
+            {
+                lapack::MatrixFile< scalar_t > file( filename );
+                io_errors += (file.data()[ 0 ] != a00 + real_t( 1 ));
+            }
+        }
+
+        // ---------- check invalid headers are rejected
+        // Byte-swapped version, as from a machine of the other byte order.
+        copy_edited( filename, bad_name, []( std::vector< char >& bytes ) {
+            std::swap( bytes[ 8 ], bytes[ 11 ] );
+            std::swap( bytes[ 9 ], bytes[ 10 ] );
+        } );
+        header_errors += ! header_rejected( bad_name, verbose );
+
+        // Bad magic.
+        copy_edited( filename, bad_name, []( std::vector< char >& bytes ) {
+            bytes[ 0 ] = 'X';
+        } );
+        header_errors += ! header_rejected( bad_name, verbose );
+
+        // Wrong precision for scalar_t.
+        copy_edited( filename, bad_name, [&]( std::vector< char >& bytes ) {
+            bytes[ 12 ] = (info.precision == 'd' ? 's' : 'd');
+        } );
+        try {
+            lapack::MatrixFile< scalar_t > file( bad_name );
+            ++header_errors;
+        }
+        catch (lapack::Error const&) {}
+
+        // Truncated data.
+        if (data_size > 0) {
+            copy_edited( filename, bad_name, []( std::vector< char >& bytes ) {
+                bytes.pop_back();
+            } );
+            header_errors += ! header_rejected( bad_name, verbose );
+        }
+
+        // ld so large that the data size overflows int64 (to 0 for
+        // power-of-2 element sizes).
+        if (data_size > 0) {
+            copy_edited( filename, bad_name, []( std::vector< char >& bytes ) {
+                int64_t huge = int64_t( 1 ) << 62;
+                std::memcpy( &bytes[ 32 ], &huge, sizeof(huge) );  // ld
+            } );
+            header_errors += ! header_rejected( bad_name, verbose );
+        }
+
+        // offset so large that offset + data size overflows int64.
+        copy_edited( filename, bad_name, []( std::vector< char >& bytes ) {
+            int64_t align = 1;
+            int64_t huge = std::numeric_limits< int64_t >::max() - 16;
+            std::memcpy( &bytes[ 40 ], &align, sizeof(align) );
+            std::memcpy( &bytes[ 48 ], &huge, sizeof(huge) );  // offset
+        } );
+        header_errors += ! header_rejected( bad_name, verbose );
+
+        std::remove( filename.c_str() );
+        std::remove( bad_name.c_str() );
+
+        params.error()  = error;
+        params.error2() = io_errors;
+        params.error3() = header_errors;
+        params.okay() = (error == 0 && io_errors == 0 && header_errors == 0);
+    }
+    else {
+        std::remove( filename.c_str() );
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_matrix_file( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_matrix_file_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_matrix_file_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_matrix_file_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_matrix_file_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
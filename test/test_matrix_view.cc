@@ -0,0 +1,187 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Solves A X = B with the MatrixView overload of gesv, where A and B are
+// submatrices of one larger matrix C, stored in params.layout() order.
+// Checks the backward error, and that entries of C outside A and B,
+// including the padding up to ldc, are untouched, i.e., nothing was copied
+// back over them.
+template< typename scalar_t >
+void test_gesv_view_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+
+    // get & mark input values
+    Layout layout = params.layout();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // C is (n + 2)-by-(n + nrhs + 2); A = C( 1 : n, 1 : n ) and
+    // B = C( 1 : n, n+1 : n+nrhs ), leaving a border of one row and
+    // column around them.
+    int64_t mc = n + 2;
+    int64_t nc = n + nrhs + 2;
+    int64_t ldc = roundup( layout == Layout::ColMajor ? mc : nc, align );
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    size_t size_C = (size_t) ldc * (layout == Layout::ColMajor ? nc : mc);
+
+    std::vector< scalar_t > C_tst( size_C );
+    std::vector< scalar_t > A_ref( lda * n );
+    std::vector< scalar_t > B_ref( lda * nrhs );
+    std::vector< int64_t > ipiv_tst( n );
+    std::vector< int64_t > ipiv_ref( n );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, C_tst.size(), &C_tst[0] );
+    lapack::generate_matrix( params.matrix, n, n, &A_ref[0], lda );
+    lapack::larnv( idist, iseed, B_ref.size(), &B_ref[0] );
+
+    lapack::MatrixView< scalar_t > C( &C_tst[0], mc, nc, ldc, layout );
+    auto A = C.sub( 1, n, 1, n );
+    auto B = C.sub( 1, n, n+1, nrhs );
+    for (int64_t j = 0; j < n; ++j)
+        for (int64_t i = 0; i < n; ++i)
+            A( i, j ) = A_ref[ i + j*lda ];
+    for (int64_t j = 0; j < nrhs; ++j)
+        for (int64_t i = 0; i < n; ++i)
+            B( i, j ) = B_ref[ i + j*lda ];
+    std::vector< scalar_t > C_ref = C_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "C m=%5lld, n=%5lld, ldc=%5lld, layout=%c\n"
+                "A n=%5lld; B n=%5lld, nrhs=%5lld\n",
+                llong( mc ), llong( nc ), llong( ldc ), char( layout ),
+                llong( n ), llong( n ), llong( nrhs ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        // sub out of range; A not square; B with wrong number of rows;
+        // mixed layouts.
+        assert_throw( C.sub( 1, n+2, 0, 1 ), lapack::Error );
+        assert_throw( lapack::gesv( C.sub( 0, n, 0, n+1 ), &ipiv_tst[0], B ), lapack::Error );
+        assert_throw( lapack::gesv( A, &ipiv_tst[0], C.sub( 0, n+1, 0, nrhs ) ), lapack::Error );
+        if (nrhs <= ldc) {
+            lapack::MatrixView< scalar_t > Bt(
+                B.data(), n, nrhs, ldc,
+                layout == Layout::ColMajor ? Layout::RowMajor
+                                           : Layout::ColMajor );
+            assert_throw( lapack::gesv( A, &ipiv_tst[0], Bt ), lapack::Error );
+        }
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::gesv( A, &ipiv_tst[0], B );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gesv returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::gesv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
+        std::vector< scalar_t > X( lda * nrhs );
+        for (int64_t j = 0; j < nrhs; ++j)
+            for (int64_t i = 0; i < n; ++i)
+                X[ i + j*lda ] = B( i, j );
+        std::vector< scalar_t > R = B_ref;
+        blas::gemm( Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    n, nrhs, n,
+                    -1.0, &A_ref[0], lda, &X[0], lda,
+                     1.0, &R[0], lda );
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], lda );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X[0], lda );
+        real_t Anorm = lapack::lange( lapack::Norm::One, n, n, &A_ref[0], lda );
+        error /= (n * Anorm * Xnorm);
+
+        // Zero A and B in both copies of C; the rest must match exactly.
+        lapack::MatrixView< scalar_t > Cr( &C_ref[0], mc, nc, ldc, layout );
+        for (int64_t j = 0; j < n + nrhs; ++j) {
+            for (int64_t i = 0; i < n; ++i) {
+                C( i+1, j+1 ) = 0;
+                Cr( i+1, j+1 ) = 0;
+            }
+        }
+        if (C_tst != C_ref)
+            error = 1;
+
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::gesv( n, nrhs, &A_ref[0], lda,
+                                         &ipiv_ref[0], &B_ref[0], lda );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::gesv returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gesv_view( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gesv_view_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesv_view_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesv_view_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesv_view_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
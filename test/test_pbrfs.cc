@@ -103,12 +103,14 @@ void test_pbrfs_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     // Refine solution in X_tst, using original AB and B, factored AFB.
     int64_t info_tst = lapack::pbrfs(
         uplo, n, kd, nrhs, &AB[0], ldab, &AFB[0], ldafb,
         &B[0], ldb, &X_tst[0], ldx, &ferr_tst[0], &berr_tst[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::pbrfs returned error %lld\n", llong( info_tst ) );
     }
@@ -59,9 +59,11 @@ void test_pbtrf_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::pbtrf( uplo, n, kd, &AB_tst[0], ldab );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::pbtrf returned error %lld\n", llong( info_tst ) );
     }
@@ -0,0 +1,166 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+#include "check_ortho.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Checks A = U_p H from the QDWH polar decomposition, with U_p orthonormal
+// and H positive semi-definite. The reference is the SVD via gesdd,
+// from which U_p = U V^H.
+template< typename scalar_t >
+void test_polar_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho();
+    params.error2();
+    params.error2.name( "H error" );
+
+    if (! run)
+        return;
+
+    // skip invalid sizes
+    if (m < n) {
+        params.msg() = "skipping: requires m >= n";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldh = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_H = (size_t) ldh * n;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > H( size_H );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n",
+                llong( m ), llong( n ), llong( lda ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::polar( m, -1, &A_tst[0], lda, &H[0], ldh ), lapack::Error );
+        assert_throw( lapack::polar( n-1, n, &A_tst[0], lda, &H[0], ldh ), lapack::Error );
+        assert_throw( lapack::polar( m, n, &A_tst[0], m-1, &H[0], ldh ), lapack::Error );
+        assert_throw( lapack::polar( m, n, &A_tst[0], lda, &H[0], n-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::polar( m, n, &A_tst[0], lda, &H[0], ldh );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::polar returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // || A - U_p H ||_1 / (n ||A||_1), and || I - U_p^H U_p || / n.
+        real_t Anorm = lapack::lange( lapack::Norm::One, m, n, &A_ref[0], lda );
+        std::vector< scalar_t > E = A_ref;
+        blas::gemm( blas::Layout::ColMajor,
+                    blas::Op::NoTrans, blas::Op::NoTrans, m, n, n,
+                    -1.0, &A_tst[0], lda, &H[0], ldh, 1.0, &E[0], lda );
+        real_t error = lapack::lange( lapack::Norm::One, m, n, &E[0], lda );
+        if (Anorm != 0)
+            error /= (n * Anorm);
+        params.error() = error;
+        params.ortho() = check_orthogonality( lapack::RowCol::Col, m, n,
+                                              &A_tst[0], lda );
+
+        // H is semi-definite: max( 0, -lambda_min( H ) ) / ||A||_1.
+        real_t error2 = 0;
+        if (n > 0) {
+            std::vector< real_t > Lambda( n );
+            lapack::heev( lapack::Job::NoVec, lapack::Uplo::Lower, n,
+                          &H[0], ldh, &Lambda[0] );
+            error2 = blas::max( real_t( 0 ), -Lambda[ 0 ] );
+            if (Anorm != 0)
+                error2 /= Anorm;
+        }
+        params.error2() = error2;
+        params.okay() = (error < tol) && (params.ortho() < tol)
+                        && (error2 < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        int64_t ldvt = ldh;
+        std::vector< real_t > S( n );
+        std::vector< scalar_t > U( size_A );
+        std::vector< scalar_t > VT( ldvt * n );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_gesdd( 's', m, n, &A_ref[0], lda, &S[0],
+                                          &U[0], lda, &VT[0], ldvt );
+        blas::gemm( blas::Layout::ColMajor,
+                    blas::Op::NoTrans, blas::Op::NoTrans, m, n, n,
+                    1.0, &U[0], lda, &VT[0], ldvt, 0.0, &A_ref[0], lda );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_gesdd returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_polar( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_polar_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_polar_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_polar_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_polar_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -41,7 +41,7 @@ void test_potrf_device_work( Params& params, bool run )
         return;
     }
 
-    if (blas::get_device_count() == 0) {
+    if (! lapack::device_available()) {
         params.msg() = "skipping: no GPU devices or no GPU support";
         return;
     }
@@ -56,11 +56,11 @@ void test_potrf_device_work( Params& params, bool run )
     lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
     A_ref = A_tst;
 
-    // Allocate and copy to GPU.
+    // Allocate and copy to device.
     lapack::Queue queue( device );
-    scalar_t*        dA_tst = blas::device_malloc< scalar_t >( size_A, queue );
-    device_info_int* d_info = blas::device_malloc< device_info_int >( 1, queue );
-    blas::device_copy_matrix( n, n, A_tst.data(), lda, dA_tst, lda, queue );
+    scalar_t*        dA_tst = lapack::device_malloc< scalar_t >( size_A, queue );
+    device_info_int* d_info = lapack::device_malloc< device_info_int >( 1, queue );
+    lapack::device_copy_matrix( n, n, A_tst.data(), lda, dA_tst, lda, queue );
 
     if (verbose >= 1) {
         printf( "\n"
@@ -82,12 +82,14 @@ void test_potrf_device_work( Params& params, bool run )
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     queue.sync();
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
 
     lapack::potrf( uplo, n, dA_tst, lda, d_info, queue );
 
     queue.sync();
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time;
     double gflop = lapack::Gflop< scalar_t >::potrf( n );
@@ -95,17 +97,17 @@ void test_potrf_device_work( Params& params, bool run )
 
     // Copy result back to CPU.
     device_info_int info_tst;
-    blas::device_copy_matrix( n, n, dA_tst, lda, A_tst.data(), lda, queue );
-    blas::device_memcpy( &info_tst, d_info, 1, queue );
+    lapack::device_copy_matrix( n, n, dA_tst, lda, A_tst.data(), lda, queue );
+    lapack::device_memcpy( &info_tst, d_info, 1, queue );
     queue.sync();
 
     if (info_tst != 0) {
         fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info_tst ) );
     }
 
-    // Cleanup GPU memory.
-    blas::device_free( dA_tst, queue );
-    blas::device_free( d_info, queue );
+    // Cleanup device memory.
+    lapack::device_free( dA_tst, queue );
+    lapack::device_free( d_info, queue );
 
     if (verbose >= 2) {
         printf( "A_factor = " ); print_matrix( n, n, &A_tst[0], lda );
@@ -0,0 +1,204 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+#if LAPACK_VERSION >= 30400  // >= 3.4.0
+
+// -----------------------------------------------------------------------------
+// Factors A with potrf, updates the factor to that of A + V V^H, with V
+// n-by-nrhs, and checks it against A + V V^H. Then downdates by V and
+// checks the result against the original factor.
+// The reference refactors A + V V^H with potrf.
+template< typename scalar_t >
+void test_potrf_update_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    using lapack::Uplo;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t k = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.error2();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldv = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_V = (size_t) ldv * k;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > V( size_V );
+
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, V.size(), &V[0] );
+
+    // F0 = chol( A ), A_ref = A + V V^H
+    std::vector< scalar_t > F0( A );
+    int64_t info = lapack::potrf( uplo, n, &F0[0], lda );
+    if (info != 0) {
+        fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info ) );
+    }
+    std::vector< scalar_t > A_ref( A );
+    blas::herk( Layout::ColMajor, uplo, blas::Op::NoTrans, n, k,
+                1.0, &V[0], ldv, 1.0, &A_ref[0], lda );
+    std::vector< scalar_t > F_tst( F0 );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "V n=%5lld, k=%5lld, ldv=%5lld\n",
+                llong( n ), llong( lda ), llong( n ), llong( k ), llong( ldv ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A[0], lda );
+        printf( "V = " ); print_matrix( n, k, &V[0], ldv );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::potrf_update( Uplo(0), n,  k, &F_tst[0], lda, &V[0], ldv ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,   -1,  k, &F_tst[0], lda, &V[0], ldv ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,    n, -1, &F_tst[0], lda, &V[0], ldv ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,    n,  k, &F_tst[0], n-1, &V[0], ldv ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,    n,  k, &F_tst[0], lda, &V[0], n-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    lapack::potrf_update( uplo, n, k, &F_tst[0], lda, &V[0], ldv );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "F_update = " ); print_matrix( n, n, &F_tst[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // || F^H F - (A + V V^H) || / (n ||A + V V^H||), for upper F = U;
+        // || F F^H - (A + V V^H) || / (n ||A + V V^H||), for lower F = L.
+        std::vector< scalar_t > FF( size_A );
+        lapack::laset( lapack::MatrixType::General, n, n, 0.0, 0.0, &FF[0], lda );
+        if (uplo == Uplo::Upper) {
+            lapack::lacpy( lapack::MatrixType::Upper, n, n, &F_tst[0], lda, &FF[0], lda );
+            blas::trmm( Layout::ColMajor, blas::Side::Left, uplo,
+                        blas::Op::ConjTrans, blas::Diag::NonUnit,
+                        n, n, 1.0, &F_tst[0], lda, &FF[0], lda );
+        }
+        else {
+            lapack::lacpy( lapack::MatrixType::Lower, n, n, &F_tst[0], lda, &FF[0], lda );
+            blas::trmm( Layout::ColMajor, blas::Side::Right, uplo,
+                        blas::Op::ConjTrans, blas::Diag::NonUnit,
+                        n, n, 1.0, &F_tst[0], lda, &FF[0], lda );
+        }
+        real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A_ref[0], lda );
+        for (int64_t j = 0; j < n; ++j)
+            blas::axpy( n, -1.0, &A_ref[ j*lda ], 1, &FF[ j*lda ], 1 );
+        real_t error = lapack::lanhe( lapack::Norm::One, uplo, n, &FF[0], lda );
+        if (Anorm != 0)
+            error /= (n * Anorm);
+        params.error() = error;
+
+        // Downdate back to the factor of A.
+        // || F_downdate - F0 || / (n ||F0||)
+        info = lapack::potrf_downdate( uplo, n, k, &F_tst[0], lda, &V[0], ldv );
+        if (info != 0) {
+            fprintf( stderr, "lapack::potrf_downdate returned error %lld\n", llong( info ) );
+        }
+        real_t Fnorm = lapack::lantr( lapack::Norm::One, uplo, lapack::Diag::NonUnit,
+                                      n, n, &F0[0], lda );
+        for (int64_t j = 0; j < n; ++j)
+            blas::axpy( n, -1.0, &F0[ j*lda ], 1, &F_tst[ j*lda ], 1 );
+        real_t error2 = lapack::lantr( lapack::Norm::One, uplo, lapack::Diag::NonUnit,
+                                       n, n, &F_tst[0], lda );
+        if (Fnorm != 0)
+            error2 /= (n * Fnorm);
+        params.error2() = error2;
+        params.okay() = (error < tol) && (error2 < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_potrf( to_char( uplo ), n, &A_ref[0], lda );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_potrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        double gflop = lapack::Gflop< scalar_t >::potrf( n );
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_update( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_potrf_update_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_update_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_update_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_update_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+#else
+
+// -----------------------------------------------------------------------------
+void test_potrf_update( Params& params, bool run )
+{
+    fprintf( stderr, "potrf_update requires LAPACK >= 3.4.0\n\n" );
+    exit(0);
+}
+
+#endif  // LAPACK >= 3.4.0
@@ -0,0 +1,187 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+#include "check_ortho.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Factors A with geqrf and ungqr, deletes column n/2,
+// and checks Q R against the new A.
+// Also factors A with geqrt and checks the update with Q not stored,
+// for which C = Q^H A, without column n/2, must become [R; 0].
+// The reference refactors the new A with geqrf.
+template< typename scalar_t >
+void test_qr_delete_col_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho();
+    params.error2();
+    params.error2.name( "WY error" );
+    params.msg();
+
+    if (! run)
+        return;
+
+    // skip invalid sizes
+    if (m < n || n < 1) {
+        params.msg() = "skipping: requires m >= n >= 1";
+        return;
+    }
+
+    // ---------- setup
+    int64_t j = n / 2;
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldq = lda;
+    int64_t ldr = roundup( n, align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_Q = (size_t) ldq * n;
+    size_t size_R = (size_t) ldr * n;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > Q( size_Q );
+    std::vector< scalar_t > R( size_R );
+    std::vector< scalar_t > tau( n );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    std::vector< scalar_t > A0( A );
+
+    // Q R = A
+    lapack::lacpy( lapack::MatrixType::General, m, n, &A[0], lda, &Q[0], ldq );
+    int64_t info = lapack::geqrf( m, n, &Q[0], ldq, &tau[0] );
+    if (info != 0) {
+        fprintf( stderr, "lapack::geqrf returned error %lld\n", llong( info ) );
+    }
+    lapack::laset( lapack::MatrixType::Lower, n, n, 0.0, 0.0, &R[0], ldr );
+    lapack::lacpy( lapack::MatrixType::Upper, n, n, &Q[0], ldq, &R[0], ldr );
+    info = lapack::ungqr( m, n, n, &Q[0], ldq, &tau[0] );
+    if (info != 0) {
+        fprintf( stderr, "lapack::ungqr returned error %lld\n", llong( info ) );
+    }
+
+    // A = [ A(:, 0:j-1), A(:, j+1:n-1) ]
+    for (int64_t k = j; k < n - 1; ++k)
+        blas::copy( m, &A[ (k+1)*lda ], 1, &A[ k*lda ], 1 );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, j=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( j ) );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    lapack::qr_delete_col( m, n, j, &Q[0], ldq, &R[0], ldr );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "Q = " ); print_matrix( m, n - 1, &Q[0], ldq );
+        printf( "R = " ); print_matrix( n - 1, n - 1, &R[0], ldr );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // || A - Q R || / (m ||A||)
+        std::vector< scalar_t > QR( Q );
+        blas::trmm( blas::Layout::ColMajor, blas::Side::Right,
+                    blas::Uplo::Upper, blas::Op::NoTrans, blas::Diag::NonUnit,
+                    m, n - 1, 1.0, &R[0], ldr, &QR[0], ldq );
+        real_t Anorm = lapack::lange( lapack::Norm::One, m, n - 1, &A[0], lda );
+        for (int64_t k = 0; k < n - 1; ++k)
+            blas::axpy( m, -1.0, &A[ k*lda ], 1, &QR[ k*ldq ], 1 );
+        real_t error = lapack::lange( lapack::Norm::One, m, n - 1, &QR[0], ldq );
+        if (Anorm != 0)
+            error /= (m * Anorm);
+        params.error() = error;
+        params.ortho() = check_orthogonality( lapack::RowCol::Col, m, n - 1,
+                                              &Q[0], ldq );
+
+        // ---------- check update with Q from geqrt, not stored
+        // || C - [R; 0] || / (m ||A||), with C = Q^H A
+        int64_t nb = blas::min( 32, n );
+        int64_t ldt = nb;
+        std::vector< scalar_t > T( ldt * n );
+        std::vector< scalar_t > R2( size_R, 0.0 );
+        std::vector< scalar_t > C( A );
+        lapack::geqrt( m, n, nb, &A0[0], lda, &T[0], ldt );
+        lapack::gemqrt( lapack::Side::Left, lapack::Op::ConjTrans,
+                        m, n - 1, n, nb, &A0[0], lda, &T[0], ldt,
+                        &C[0], lda );
+        lapack::lacpy( lapack::MatrixType::Upper, n, n, &A0[0], lda, &R2[0], ldr );
+        lapack::qr_delete_col( m, n, j, &R2[0], ldr, n - 1, &C[0], lda );
+        for (int64_t k = 0; k < n - 1; ++k)
+            blas::axpy( k + 1, -1.0, &R2[ k*ldr ], 1, &C[ k*lda ], 1 );
+        real_t error2 = lapack::lange( lapack::Norm::One, m, n - 1, &C[0], lda );
+        if (Anorm != 0)
+            error2 /= (m * Anorm);
+        params.error2() = error2;
+
+        params.okay() = (error < tol) && (params.ortho() < tol)
+                        && (error2 < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_geqrf( m, n - 1, &A[0], lda, &tau[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_geqrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_qr_delete_col( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_qr_delete_col_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_qr_delete_col_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_qr_delete_col_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_qr_delete_col_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,190 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+#include "check_gels.hh"
+
+#include <vector>
+
+#if LAPACK_VERSION >= 30400  // >= 3.4.0
+
+// -----------------------------------------------------------------------------
+// Tests QRStream, appending rows of A and B in blocks of nb rows, then
+// removing the first block, checking both least squares solutions.
+template< typename scalar_t >
+void test_qrstream_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t nb = params.nb();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.error2();
+    params.msg();
+
+    if (! run)
+        return;
+
+    // skip invalid sizes
+    if (m < n || nb < 1) {
+        params.msg() = "skipping: requires m >= n and nb >= 1";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m ), align );
+    int64_t ldx = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+    size_t size_X = (size_t) ldx * nrhs;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > B( size_B );
+    std::vector< scalar_t > X( size_X );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_ref( size_B );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+    A_ref = A;
+    B_ref = B;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, nb=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( nb ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A[0], lda );
+        printf( "B = " ); print_matrix( m, nrhs, &B[0], ldb );
+    }
+
+    // ---------- run test
+    lapack::QRStream< scalar_t > qr( n, nrhs );
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < m; i += nb) {
+        int64_t ib = blas::min( nb, m - i );
+        qr.update( ib, &A[ i ], lda, &B[ i ], ldb );
+    }
+    int64_t info_tst = qr.solve( &X[0], ldx );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::QRStream::solve returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::gels( m, n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &X[0], ldx );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Appended rows: residual orthogonal to A.
+        real_t error[2];
+        check_gels( false, lapack::Op::NoTrans, m, n, nrhs,
+                    &A[0], lda,
+                    &X[0], ldx,
+                    &B[0], ldb,
+                    error );
+        params.error() = error[0];
+        real_t error2 = 0;
+
+        // After removing the first block, if at least n rows remain.
+        int64_t ib = blas::min( nb, m - n );
+        if (ib > 0) {
+            info_tst = qr.downdate( ib, &A[0], lda, &B[0], ldb );
+            if (info_tst != 0) {
+                fprintf( stderr, "lapack::QRStream::downdate returned error %lld\n", llong( info_tst ) );
+            }
+            qr.solve( &X[0], ldx );
+            check_gels( false, lapack::Op::NoTrans, m - ib, n, nrhs,
+                        &A[ ib ], lda,
+                        &X[0], ldx,
+                        &B[ ib ], ldb,
+                        error );
+            error2 = error[0];
+            params.error2() = error2;
+        }
+        params.okay() = (params.error() < tol) && (error2 < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_gels( 'n', m, n, nrhs, &A_ref[0], lda, &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_gels returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_qrstream( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_qrstream_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_qrstream_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_qrstream_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_qrstream_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+#else
+
+// -----------------------------------------------------------------------------
+void test_qrstream( Params& params, bool run )
+{
+    fprintf( stderr, "QRStream requires LAPACK >= 3.4.0\n\n" );
+    exit(0);
+}
+
+#endif  // LAPACK >= 3.4.0
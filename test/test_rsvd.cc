@@ -0,0 +1,188 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+#include "check_ortho.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Computes a rank-k approximation U S V^H of the m-by-n matrix A with rsvd,
+// using oversampling 10 and 2 power iterations, and compares its error
+// with the optimal rank-k error from the singular values of A.
+// k is clamped to min( m, n ).
+// The reference computes the full SVD with gesdd.
+template< typename scalar_t >
+void test_rsvd_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t k = blas::min( params.dim.k(), blas::min( m, n ) );
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho_U();
+    params.ortho_V();
+    params.error2();
+    params.error2.name( "optimal" );
+
+    if (! run) {
+        params.matrix.kind.set_default( "svd_geo" );
+        return;
+    }
+
+    // ---------- setup
+    const int64_t p = 10, q = 2;
+    int64_t minmn = blas::min( m, n );
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldu = roundup( blas::max( 1, m ), align );
+    int64_t ldvt = roundup( blas::max( 1, k ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_U = (size_t) ldu * k;
+    size_t size_VT = (size_t) ldvt * n;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > U( size_U );
+    std::vector< scalar_t > VT( size_VT );
+    std::vector< real_t > S( k );
+    std::vector< real_t > S_ref( minmn );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, k=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( k ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::rsvd( -1, n, k, p, q, &A[0], lda, &S[0], &U[0], ldu, &VT[0], ldvt, iseed ), lapack::Error );
+        assert_throw( lapack::rsvd( m, -1, k, p, q, &A[0], lda, &S[0], &U[0], ldu, &VT[0], ldvt, iseed ), lapack::Error );
+        assert_throw( lapack::rsvd( m, n, minmn+1, p, q, &A[0], lda, &S[0], &U[0], ldu, &VT[0], ldvt, iseed ), lapack::Error );
+        assert_throw( lapack::rsvd( m, n, k, -1, q, &A[0], lda, &S[0], &U[0], ldu, &VT[0], ldvt, iseed ), lapack::Error );
+        assert_throw( lapack::rsvd( m, n, k, p, -1, &A[0], lda, &S[0], &U[0], ldu, &VT[0], ldvt, iseed ), lapack::Error );
+        assert_throw( lapack::rsvd( m, n, k, p, q, &A[0], m-1, &S[0], &U[0], ldu, &VT[0], ldvt, iseed ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::rsvd( m, n, k, p, q, &A[0], lda, &S[0],
+                                     &U[0], ldu, &VT[0], ldvt, iseed );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::rsvd returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "S = " ); print_vector( k, &S[0], 1 );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // error  = || A - U S V^H ||_F / || A ||_F,
+        // error2 = sqrt( sum_{i >= k} sigma_i^2 ) / || A ||_F, the optimal.
+        // The randomized error should be close to optimal.
+        std::vector< scalar_t > R( A ), US( U );
+        for (int64_t j = 0; j < k; ++j)
+            blas::scal( m, S[ j ], &US[ j*ldu ], 1 );
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    m, n, k, -1.0, &US[0], ldu, &VT[0], ldvt, 1.0, &R[0], lda );
+        real_t Anorm = lapack::lange( lapack::Norm::Fro, m, n, &A[0], lda );
+        real_t error = lapack::lange( lapack::Norm::Fro, m, n, &R[0], lda );
+
+        std::vector< scalar_t > A2( A );
+        int64_t info = lapack::gesdd( lapack::Job::NoVec, m, n, &A2[0], lda,
+                                      &S_ref[0], nullptr, 1, nullptr, 1 );
+        if (info != 0) {
+            fprintf( stderr, "lapack::gesdd returned error %lld\n", llong( info ) );
+        }
+        real_t error2 = 0;
+        for (int64_t i = k; i < minmn; ++i)
+            error2 += S_ref[ i ] * S_ref[ i ];
+        error2 = sqrt( error2 );
+        if (Anorm != 0) {
+            error  /= Anorm;
+            error2 /= Anorm;
+        }
+        params.error() = error;
+        params.error2() = error2;
+        params.ortho_U() = check_orthogonality( lapack::RowCol::Col, m, k,
+                                                &U[0], ldu );
+        params.ortho_V() = check_orthogonality( lapack::RowCol::Row, k, n,
+                                                &VT[0], ldvt );
+        params.okay() = (error < 2*error2 + tol)
+                        && (params.ortho_U() < tol)
+                        && (params.ortho_V() < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< scalar_t > A_ref( A );
+        std::vector< scalar_t > U_ref( (size_t) ldu * minmn );
+        int64_t ldvt_ref = roundup( blas::max( 1, minmn ), align );
+        std::vector< scalar_t > VT_ref( (size_t) ldvt_ref * n );
+
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_gesdd( 's', m, n, &A_ref[0], lda, &S_ref[0],
+                                          &U_ref[0], ldu, &VT_ref[0], ldvt_ref );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_gesdd returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_rsvd( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_rsvd_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_rsvd_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_rsvd_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_rsvd_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
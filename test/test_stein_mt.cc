@@ -0,0 +1,190 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_heev.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests stein_mt with eigenvalues from bisection:
+// A = Q T Q^H via hetrd, selected eigenvalues of T via stemr_mt without
+// vectors, eigenvectors Z of T via stein_mt, then back-transform Z to Q Z
+// via unmtr. Compares with stein.
+template< typename scalar_t >
+void test_stein_mt_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+
+    // Constants
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // get_range fills in range, il, iu, vl, vu
+    real_t  vl, vu;
+    int64_t il, iu;
+    lapack::Range range;
+    params.get_range( n, &range, &vl, &vu, &il, &iu );
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho();
+    params.error2();
+    params.error2.name( "Lambda" );
+
+    if (! run)
+        return;
+
+    // skip invalid ranges
+    if (il > iu) {
+        params.msg() = "skipping: requires 1 <= il <= iu <= n";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldz = lda;
+    int64_t nfound;
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > QT( size_A );
+    std::vector< scalar_t > Z_tst( size_A );
+    std::vector< scalar_t > Z_ref( size_A );
+    std::vector< scalar_t > tau( blas::max( 1, n - 1 ) );
+    std::vector< real_t > D( n );
+    std::vector< real_t > E( blas::max( 1, n - 1 ) );
+    std::vector< real_t > Lambda( n );
+    std::vector< int64_t > iblock( n, 1 );
+    std::vector< int64_t > isplit( n, n );
+    std::vector< int64_t > ifail_tst( n );
+    std::vector< int64_t > ifail_ref( n );
+
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+
+    // Reduce to tridiagonal, T = (D, E), and find eigenvalues by bisection.
+    // T is treated as one block.
+    QT = A;
+    lapack::hetrd( uplo, n, &QT[0], lda, &D[0], &E[0], &tau[0] );
+    lapack::stemr_mt< real_t >(
+        Job::NoVec, range, n, &D[0], &E[0], vl, vu, il, iu, &nfound,
+        &Lambda[0], nullptr, 1, nullptr );
+
+    if (verbose >= 1) {
+        printf( "\n" );
+        printf( "A n=%5lld, lda=%5lld, nfound=%5lld\n",
+                llong( n ), llong( lda ), llong( nfound ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A[0], lda );
+        printf( "Lambda = " ); print_vector( nfound, &Lambda[0], 1 );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::stein_mt(
+        n, &D[0], &E[0], nfound, &Lambda[0], &iblock[0], &isplit[0],
+        &Z_tst[0], ldz, &ifail_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::stein_mt returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (nfound > 0) {
+        lapack::unmtr( lapack::Side::Left, uplo, lapack::Op::NoTrans,
+                       n, nfound, &QT[0], lda, &tau[0], &Z_tst[0], ldz );
+    }
+
+    if (verbose >= 2) {
+        printf( "Z = " ); print_matrix( n, nfound, &Z_tst[0], ldz );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check numerical error
+        // result[ 0 ] = || A - Z Lambda Z^H || / (n ||A||).
+        // result[ 1 ] = || I - Z^H Z || / n.
+        // result[ 2 ] = 0 if Lambda is in non-decreasing order, else > 0.
+        real_t result[ 3 ] = { (real_t) testsweeper::no_data_flag,
+                               (real_t) testsweeper::no_data_flag,
+                               (real_t) testsweeper::no_data_flag };
+
+        check_heev( Job::Vec, uplo, n, &A[0], lda,
+                    nfound, &Lambda[0], &Z_tst[0], ldz, result );
+
+        params.error()  = result[ 0 ];
+        params.ortho()  = result[ 1 ];
+        params.error2() = result[ 2 ];
+        params.okay()   = result[ 0 ] < tol
+                       && result[ 1 ] < tol
+                       && result[ 2 ] < tol;
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::stein(
+            n, &D[0], &E[0], nfound, &Lambda[0], &iblock[0], &isplit[0],
+            &Z_ref[0], ldz, &ifail_ref[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::stein returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        real_t error = 0;
+        if (info_tst != info_ref) {
+            error = 1;
+        }
+        params.error2() = error;
+        params.okay() = params.okay() && (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_stein_mt( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_stein_mt_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_stein_mt_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_stein_mt_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_stein_mt_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
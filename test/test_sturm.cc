@@ -128,6 +128,7 @@ void test_sturm_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t r_min_before, r_min_after;
     int64_t r_mid_before, r_mid_after;
@@ -193,6 +194,7 @@ void test_sturm_work( Params& params, bool run )
     }
 
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.ref_time() = time;
     params.error() = error;
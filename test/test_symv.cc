@@ -99,9 +99,11 @@ void test_symv_work( Params& params, bool run )
 
     // run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = get_wtime();
     blas::symv( layout, uplo, n, alpha, &A[0], lda, &x[0], incx, beta, &y[0], incy );
     time = get_wtime() - time;
+    perf_counters_stop( params, time );
 
     double gflop = Gflop < scalar_t >::symv( n );
     double gbyte = Gbyte < scalar_t >::symv( n );
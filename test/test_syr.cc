@@ -87,9 +87,11 @@ void test_syr_work( Params& params, bool run )
 
     // run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     blas::syr( layout, uplo, n, alpha, &x[0], incx, &A[0], lda );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
 
     params.time() = time * 1000;  // msec
     double gflop = blas::Gflop< scalar_t >::syr( n );
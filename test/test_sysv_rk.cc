@@ -65,9 +65,11 @@ void test_sysv_rk_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::sysv_rk( uplo, n, nrhs, &A_tst[0], lda, &E_tst[0], &ipiv_tst[0], &B_tst[0], ldb );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::sysv_rk returned error %lld\n", llong( info_tst ) );
     }
@@ -84,6 +84,7 @@ void test_tgexc_work( Params& params, bool run )
 
     //---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
 
     info_tst = lapack::tgexc(
@@ -93,6 +94,7 @@ void test_tgexc_work( Params& params, bool run )
         &ifst_tst, &ilst_tst );
 
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::tgexc returned error %lld\n", llong( info_tst ) );
     }
@@ -99,6 +99,7 @@ void test_tgsen_work( Params& params, bool run )
 
     //---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
 
     info_tst = lapack::tgsen(
@@ -108,6 +109,7 @@ void test_tgsen_work( Params& params, bool run )
         &sdim_tst, &pl_tst, &pr_tst, &dif_tst[0] );
 
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::tgsen returned error %lld\n", llong( info_tst ) );
     }
@@ -86,10 +86,12 @@ void test_tplqt2_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::tplqt2(
         m, n, L, &A_tst[0], lda, &B_tst[0], ldb, &T_tst[0], ldt );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::tplqt2 returned error %lld\n", llong( info_tst ) );
     }
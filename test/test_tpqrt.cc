@@ -87,10 +87,12 @@ void test_tpqrt_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::tpqrt(
         m, n, L, nb, &A_tst[0], lda, &B_tst[0], ldb, &T_tst[0], ldt );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::tpqrt returned error %lld\n", llong( info_tst ) );
     }
@@ -93,9 +93,11 @@ void test_tprfb_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     lapack::tprfb( side, trans, direction, storev, m, n, k, l, &V[0], ldv, &T[0], ldt, &A_tst[0], lda, &B_tst[0], ldb );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     // internal routine: no argument check so no info.
     //if (info_tst != 0) {
     //    fprintf( stderr, "lapack::tprfb returned error %lld\n", llong( info_tst ) );
@@ -0,0 +1,212 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/device.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_trtri_device_work( Params& params, bool run )
+{
+    using lapack::device_info_int;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    lapack::Diag diag = params.diag();
+    int64_t n = params.dim.n();
+    int64_t device = params.device();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    if (! lapack::device_available()) {
+        params.msg() = "skipping: no GPU devices or no GPU support";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    // Allocate and copy to device.
+    lapack::Queue queue( device );
+    scalar_t*        dA_tst = lapack::device_malloc< scalar_t >( size_A, queue );
+    device_info_int* d_info = lapack::device_malloc< device_info_int >( 1, queue );
+    lapack::device_copy_matrix( n, n, A_tst.data(), lda, dA_tst, lda, queue );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n",
+                llong( n ), llong( lda ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // Allocate workspace
+    size_t d_size, h_size;
+    lapack::trtri_work_size_bytes( uplo, diag, n, dA_tst, lda, &d_size, &h_size, queue );
+    char* d_work = lapack::device_malloc< char >( d_size, queue );
+    std::vector<char> h_work_vector( h_size );
+    char* h_work = h_work_vector.data();
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        using lapack::Diag;
+        assert_throw( lapack::trtri( Uplo(0), diag,  n, dA_tst, lda, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::trtri( uplo, Diag(0),  n, dA_tst, lda, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::trtri( uplo, diag,    -1, dA_tst, lda, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::trtri( uplo, diag,     n, dA_tst, n-1, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    queue.sync();
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+
+    lapack::trtri( uplo, diag, n, dA_tst, lda,
+                   d_work, d_size, h_work, h_size, d_info, queue );
+
+    queue.sync();
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::trtri( n );
+    params.gflops() = gflop / time;
+
+    // Copy result back to CPU.
+    device_info_int info_tst;
+    lapack::device_copy_matrix( n, n, dA_tst, lda, A_tst.data(), lda, queue );
+    lapack::device_memcpy( &info_tst, d_info, 1, queue );
+    queue.sync();
+
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::trtri returned error %lld\n", llong( info_tst ) );
+    }
+
+    // Cleanup device memory.
+    lapack::device_free( dA_tst, queue );
+    lapack::device_free( d_info, queue );
+    lapack::device_free( d_work, queue );
+
+    if (verbose >= 2) {
+        printf( "A_inv = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // error = ||I - A inv(A)|| / (n * ||A|| * ||inv(A)||).
+        // Copy inv(A) to W, with zeros in the opposite triangle
+        // and ones on the diagonal if unit.
+        int64_t ldw = lda;
+        std::vector< scalar_t > W( size_A );
+        lapack::laset( lapack::MatrixType::General, n, n, 0.0, 0.0, &W[0], ldw );
+        lapack::MatrixType type = (uplo == lapack::Uplo::Lower
+                                   ? lapack::MatrixType::Lower
+                                   : lapack::MatrixType::Upper);
+        lapack::lacpy( type, n, n, &A_tst[0], lda, &W[0], ldw );
+        if (diag == lapack::Diag::Unit) {
+            for (int64_t i = 0; i < n; ++i)
+                W[ i + i*ldw ] = 1.0;
+        }
+
+        // W = A inv(A)
+        blas::trmm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                    blas::Op::NoTrans, diag, n, n,
+                    1.0, &A_ref[0], lda,
+                         &W[0], ldw );
+
+        // W = A inv(A) - I
+        for (int64_t i = 0; i < n; ++i)
+            W[ i + i*ldw ] -= 1.0;
+
+        if (verbose >= 2) {
+            printf( "R = " ); print_matrix( n, n, &W[0], ldw );
+        }
+
+        real_t error = lapack::lange( lapack::Norm::One, n, n, &W[0], ldw );
+        real_t Anorm = lapack::lantr( lapack::Norm::One, uplo, diag, n, n,
+                                      &A_ref[0], lda );
+        real_t Ainv_norm = lapack::lantr( lapack::Norm::One, uplo, diag, n, n,
+                                          &A_tst[0], lda );
+        if (n > 0 && Anorm > 0 && Ainv_norm > 0)
+            error /= (n * Anorm * Ainv_norm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::trtri( uplo, diag, n, &A_ref[0], lda );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::trtri returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+
+        if (verbose >= 2) {
+            printf( "Aref_inv = " ); print_matrix( n, n, &A_ref[0], lda );
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_trtri_device( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_trtri_device_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_trtri_device_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_trtri_device_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_trtri_device_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
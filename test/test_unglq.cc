@@ -70,9 +70,11 @@ void test_unglq_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    perf_counters_start( params );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::unglq( m, n, k, &A_tst[0], lda, &tau[0] );
     time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::unglq returned error %lld\n", llong( info_tst ) );
     }
@@ -0,0 +1,221 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/device.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_ungqr_device_work( Params& params, bool run )
+{
+    using lapack::device_info_int;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t device = params.device();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ortho();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    if (! lapack::device_available()) {
+        params.msg() = "skipping: no GPU devices or no GPU support";
+        return;
+    }
+
+    // skip invalid sizes
+    if (! (n <= m && k <= n)) {
+        params.msg() = "skipping: requires n <= m and k <= n";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_tau = (size_t) k;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > A_factored( size_A );
+    std::vector< scalar_t > tau( size_tau );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    // ---------- factor matrix on host
+    int64_t info_qrf = lapack::geqrf( m, n, &A_tst[0], lda, &tau[0] );
+    if (info_qrf != 0) {
+        fprintf( stderr, "lapack::geqrf returned error %lld\n", llong( info_qrf ) );
+    }
+    A_factored = A_tst;
+
+    // Allocate and copy to device.
+    lapack::Queue queue( device );
+    scalar_t*        dA_tst = lapack::device_malloc< scalar_t >( size_A, queue );
+    scalar_t*        d_tau  = lapack::device_malloc< scalar_t >( size_tau, queue );
+    device_info_int* d_info = lapack::device_malloc< device_info_int >( 1, queue );
+    lapack::device_copy_matrix( m, n, A_tst.data(), lda, dA_tst, lda, queue );
+    lapack::device_memcpy( d_tau, tau.data(), size_tau, queue );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, k=%5lld, lda=%5lld\n",
+                llong( m ), llong( n ), llong( k ), llong( lda ) );
+    }
+    if (verbose >= 2) {
+        printf( "A_factor = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // Allocate workspace
+    size_t d_size, h_size;
+    lapack::ungqr_work_size_bytes( m, n, k, dA_tst, lda, d_tau,
+                                   &d_size, &h_size, queue );
+    char* d_work = lapack::device_malloc< char >( d_size, queue );
+    std::vector<char> h_work_vector( h_size );
+    char* h_work = h_work_vector.data();
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::ungqr( -1,  n,  k, dA_tst, lda, d_tau, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::ungqr(  m, -1,  k, dA_tst, lda, d_tau, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::ungqr(  m,  n, -1, dA_tst, lda, d_tau, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::ungqr(  m,  n,  k, dA_tst, m-1, d_tau, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    queue.sync();
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+
+    lapack::ungqr( m, n, k, dA_tst, lda, d_tau,
+                   d_work, d_size, h_work, h_size, d_info, queue );
+
+    queue.sync();
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::ungqr( m, n, k );
+    params.gflops() = gflop / time;
+
+    // Copy result back to CPU.
+    device_info_int info_tst;
+    lapack::device_copy_matrix( m, n, dA_tst, lda, A_tst.data(), lda, queue );
+    lapack::device_memcpy( &info_tst, d_info, 1, queue );
+    queue.sync();
+
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::ungqr returned error %lld\n", llong( info_tst ) );
+    }
+
+    // Cleanup device memory.
+    lapack::device_free( dA_tst, queue );
+    lapack::device_free( d_tau, queue );
+    lapack::device_free( d_info, queue );
+    lapack::device_free( d_work, queue );
+
+    if (verbose >= 2) {
+        printf( "Q = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Following lapack/TESTING/LIN/zqrt02.f, as in test_ungqr.
+        int64_t ldr = blas::max( 1, n );
+        std::vector< scalar_t > R( ldr * n );
+
+        // Copy R(1:n,1:k)
+        lapack::laset( lapack::MatrixType::General, n, k, 0.0, 0.0, &R[0], ldr );
+        lapack::lacpy( lapack::MatrixType::Upper, n, k, &A_factored[0], lda, &R[0], ldr );
+
+        // Compute R - Q'*A
+        blas::gemm( blas::Layout::ColMajor,
+                    blas::Op::ConjTrans, blas::Op::NoTrans, n, k, m,
+                    -1.0, &A_tst[0], lda, &A_ref[0], lda, 1.0, &R[0], ldr );
+
+        // Compute norm( R - Q'*A ) / ( M * norm(A) * EPS ) .
+        real_t Anorm = lapack::lange( lapack::Norm::One, m, k, &A_ref[0], lda );
+        real_t resid1 = lapack::lange( lapack::Norm::One, n, k, &R[0], ldr );
+        real_t error1 = 0;
+        if (Anorm > 0)
+            error1 = resid1 / ( m * Anorm );
+
+        // Compute I - Q'*Q
+        lapack::laset( lapack::MatrixType::General, n, n, 0.0, 1.0, &R[0], ldr );
+        blas::herk( blas::Layout::ColMajor, blas::Uplo::Upper, blas::Op::ConjTrans,
+                    n, m, -1.0, &A_tst[0], lda, 1.0, &R[0], ldr );
+
+        // Compute norm( I - Q'*Q ) / ( M * EPS ) .
+        real_t resid2 = lapack::lansy( lapack::Norm::One, lapack::Uplo::Upper, n, &R[0], ldr );
+        real_t error2 = 0;
+        if (m > 0)
+            error2 = resid2 / m;
+
+        params.error() = error1;
+        params.ortho() = error2;
+        params.okay() = (error1 < tol) && (error2 < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::ungqr( m, n, k, &A_factored[0], lda, &tau[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::ungqr returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_ungqr_device( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_ungqr_device_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_ungqr_device_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_ungqr_device_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_ungqr_device_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,217 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/device.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_unmqr_device_work( Params& params, bool run )
+{
+    using lapack::device_info_int;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Side side = params.side();
+    lapack::Op trans = params.trans();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t device = params.device();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    if (! lapack::device_available()) {
+        params.msg() = "skipping: no GPU devices or no GPU support";
+        return;
+    }
+
+    // A is nq-by-k, the order of Q.
+    int64_t nq = (side == lapack::Side::Left ? m : n);
+
+    // skip invalid sizes and ops
+    if (k > nq) {
+        params.msg() = "skipping: requires k <= m (left) or k <= n (right)";
+        return;
+    }
+    if (blas::is_complex< scalar_t >::value && trans == lapack::Op::Trans) {
+        params.msg() = "skipping: complex requires trans = n or c";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, nq ), align );
+    int64_t ldc = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * k;
+    size_t size_tau = (size_t) k;
+    size_t size_C = (size_t) ldc * n;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > tau( size_tau );
+    std::vector< scalar_t > C_tst( size_C );
+    std::vector< scalar_t > C_ref( size_C );
+
+    lapack::generate_matrix( params.matrix, nq, k, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, C_tst.size(), &C_tst[0] );
+    C_ref = C_tst;
+
+    // ---------- factor matrix on host
+    int64_t info_qrf = lapack::geqrf( nq, k, &A[0], lda, &tau[0] );
+    if (info_qrf != 0) {
+        fprintf( stderr, "lapack::geqrf returned error %lld\n", llong( info_qrf ) );
+    }
+
+    // Allocate and copy to device.
+    lapack::Queue queue( device );
+    scalar_t*        dA     = lapack::device_malloc< scalar_t >( size_A, queue );
+    scalar_t*        d_tau  = lapack::device_malloc< scalar_t >( size_tau, queue );
+    scalar_t*        dC_tst = lapack::device_malloc< scalar_t >( size_C, queue );
+    device_info_int* d_info = lapack::device_malloc< device_info_int >( 1, queue );
+    lapack::device_copy_matrix( nq, k, A.data(), lda, dA, lda, queue );
+    lapack::device_memcpy( d_tau, tau.data(), size_tau, queue );
+    lapack::device_copy_matrix( m, n, C_tst.data(), ldc, dC_tst, ldc, queue );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A nq=%5lld, k=%5lld, lda=%5lld\n"
+                "C m=%5lld, n=%5lld, ldc=%5lld\n",
+                llong( nq ), llong( k ), llong( lda ),
+                llong( m ), llong( n ), llong( ldc ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( nq, k, &A[0], lda );
+        printf( "C = " ); print_matrix( m, n, &C_tst[0], ldc );
+    }
+
+    // Allocate workspace
+    size_t d_size, h_size;
+    lapack::unmqr_work_size_bytes( side, trans, m, n, k, dA, lda, d_tau,
+                                   dC_tst, ldc, &d_size, &h_size, queue );
+    char* d_work = lapack::device_malloc< char >( d_size, queue );
+    std::vector<char> h_work_vector( h_size );
+    char* h_work = h_work_vector.data();
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Side;
+        using lapack::Op;
+        assert_throw( lapack::unmqr( Side(0), trans, m, n, k, dA, lda, d_tau, dC_tst, ldc, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::unmqr( side,   Op(0), m, n, k, dA, lda, d_tau, dC_tst, ldc, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::unmqr( side,   trans,-1, n, k, dA, lda, d_tau, dC_tst, ldc, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::unmqr( side,   trans, m,-1, k, dA, lda, d_tau, dC_tst, ldc, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::unmqr( side,   trans, m, n,-1, dA, lda, d_tau, dC_tst, ldc, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::unmqr( side,   trans, m, n, k, dA, nq-1, d_tau, dC_tst, ldc, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::unmqr( side,   trans, m, n, k, dA, lda, d_tau, dC_tst, m-1, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    queue.sync();
+    perf_counters_start( params );
+    double time = testsweeper::get_wtime();
+
+    lapack::unmqr( side, trans, m, n, k, dA, lda, d_tau, dC_tst, ldc,
+                   d_work, d_size, h_work, h_size, d_info, queue );
+
+    queue.sync();
+    time = testsweeper::get_wtime() - time;
+    perf_counters_stop( params, time );
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::unmqr( side, m, n, k );
+    params.gflops() = gflop / time;
+
+    // Copy result back to CPU.
+    device_info_int info_tst;
+    lapack::device_copy_matrix( m, n, dC_tst, ldc, C_tst.data(), ldc, queue );
+    lapack::device_memcpy( &info_tst, d_info, 1, queue );
+    queue.sync();
+
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::unmqr returned error %lld\n", llong( info_tst ) );
+    }
+
+    // Cleanup device memory.
+    lapack::device_free( dA, queue );
+    lapack::device_free( d_tau, queue );
+    lapack::device_free( dC_tst, queue );
+    lapack::device_free( d_info, queue );
+    lapack::device_free( d_work, queue );
+
+    if (verbose >= 2) {
+        printf( "QC = " ); print_matrix( m, n, &C_tst[0], ldc );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::unmqr( side, trans, m, n, k, &A[0], lda, &tau[0], &C_ref[0], ldc );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::unmqr returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+
+        if (verbose >= 2) {
+            printf( "QCref = " ); print_matrix( m, n, &C_ref[0], ldc );
+        }
+
+        // ---------- check error compared to reference
+        // Q is unitary, so ||QC|| = ||C||, and the relative difference
+        // ||QC_tst - QC_ref|| / ||QC_ref|| should be O(eps).
+        real_t error = rel_error( C_tst, C_ref );
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_unmqr_device( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_unmqr_device_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_unmqr_device_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_unmqr_device_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_unmqr_device_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
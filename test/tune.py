@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+# This program is free software: you can redistribute it and/or modify it under
+# the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+#
+# Tunes the block sizes nb (and optionally nx) of blocked factorizations
+# by timing the tester over a sweep of block sizes, and writes the fastest
+# for each routine, precision, and size range to a tuning file.
+# See include/lapack/tune.hh.
+#
+# Example usage:
+# help
+#     ./tune.py -h
+#
+# tune getrf and geqrf in double, write tune.txt
+#     ./tune.py --type d getrf geqrf
+#
+# then use the tuned block sizes at runtime
+#     export LAPACKPP_TUNE=`pwd`/tune.txt
+#
+# The block sizes take effect only if LAPACK++ was built with
+# ilaenv_override=yes, and LAPACK calls ILAENV; otherwise all block sizes
+# time the same.
+
+from __future__ import print_function
+
+import sys
+import os
+import re
+import argparse
+import subprocess
+import tempfile
+
+routines = [ 'getrf', 'geqrf', 'gebrd', 'hetrd', 'hetrd_2stage' ]
+
+# routines that have a crossover nx; see lapack/tune.hh
+routines_nx = [ 'geqrf', 'gebrd', 'hetrd' ]
+
+# ------------------------------------------------------------------------------
+# command line arguments
+parser = argparse.ArgumentParser()
+parser.add_argument( '-t', '--test', action='store',
+    help='tester to run; default "%(default)s"', default='./tester' )
+parser.add_argument( '-o', '--output', action='store',
+    help='tuning file to write; default "%(default)s"', default='tune.txt' )
+parser.add_argument( '--type', action='store',
+    help='default=%(default)s', default='s,d,c,z' )
+parser.add_argument( '--dim', action='store',
+    help='square sizes to tune; default=%(default)s',
+    default='500,1000,2000,4000' )
+parser.add_argument( '--nb', action='store',
+    help='block sizes to try; default=%(default)s',
+    default='16,24,32,48,64,96,128,192,256' )
+parser.add_argument( '--nx', action='store',
+    help='crossover sizes to try for ' + ', '.join( routines_nx )
+         + ', after nb; default is LAPACK\'s', default='' )
+parser.add_argument( '--repeat', action='store',
+    help='times to run each size, keeping the fastest; default=%(default)s',
+    default='3' )
+parser.add_argument( '--check', action='store',
+    help='check results; default=%(default)s', default='n' )
+parser.add_argument( '--dry-run', action='store_true',
+    help='print commands, but do not execute them' )
+parser.add_argument( 'routines', nargs=argparse.REMAINDER, default=[],
+    help='routines to tune; default all of ' + ', '.join( routines ) )
+opts = parser.parse_args()
+
+for routine in opts.routines:
+    if (routine not in routines):
+        print( 'unknown routine', routine, '; tunable routines are',
+               ', '.join( routines ), file=sys.stderr )
+        sys.exit( 1 )
+if (not opts.routines):
+    opts.routines = routines
+
+dims = sorted( map( int, opts.dim.split( ',' ) ) )
+nbs  = list( map( int, opts.nb.split( ',' ) ) )
+nxs  = list( map( int, opts.nx.split( ',' ) ) ) if (opts.nx) else []
+
+# ------------------------------------------------------------------------------
+# Writes entries [(routine, precision, n_max, nb, nx), ...] to filename.
+def write_tune_file( filename, entries ):
+    with open( filename, 'w' ) as f:
+        f.write( '# LAPACK++ block sizes from test/tune.py; see lapack/tune.hh\n'
+               + '# routine      type    n_max       nb       nx\n' )
+        for (routine, precision, n_max, nb, nx) in entries:
+            f.write( '%-14s %-4s %8d %8d %8d\n'
+                     % (routine, precision, n_max, nb, nx) )
+# end
+
+# ------------------------------------------------------------------------------
+# Runs the tester on routine in precision for all dims, using the block
+# sizes in entries.
+# Returns { n: gflop/s }, the fastest of the repeats for each size.
+def run_tester( routine, precision, entries ):
+    (fd, filename) = tempfile.mkstemp( prefix='lapackpp_tune_', suffix='.txt' )
+    os.close( fd )
+    write_tune_file( filename, entries )
+
+    cmd = [ opts.test, '--type', precision,
+            '--dim', ','.join( map( str, dims ) ),
+            '--repeat', opts.repeat, '--check', opts.check, '--ref', 'n',
+            routine ]
+    print( 'LAPACKPP_TUNE=' + filename, ' '.join( cmd ), file=sys.stderr )
+    if (opts.dry_run):
+        os.remove( filename )
+        return {}
+
+    env = dict( os.environ, LAPACKPP_TUNE=filename )
+    p = subprocess.Popen( cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                          env=env, universal_newlines=True )
+    (output, _) = p.communicate()
+    os.remove( filename )
+    if (p.returncode != 0):
+        print( output, file=sys.stderr )
+        print( 'tester failed with code', p.returncode, file=sys.stderr )
+        sys.exit( 1 )
+
+    # The tester right-aligns each value under its column header,
+    # so a value ends where its header ends.
+    n_end = None
+    gflops_end = None
+    result = {}
+    for line in output.splitlines():
+        if (gflops_end is None):
+            m_gflops = re.search( r'(?<!\S)gflop/s(?!\S)', line )
+            m_n      = re.search( r'(?<!\S)n(?!\S)', line )
+            if (m_gflops and m_n):
+                gflops_end = m_gflops.end()
+                n_end      = m_n.end()
+            continue
+        fields = line.split()
+        if (not fields or fields[0] != precision or len( line ) < gflops_end):
+            continue
+        try:
+            n      = int(   line[ : n_end      ].split()[-1] )
+            gflops = float( line[ : gflops_end ].split()[-1] )
+        except (ValueError, IndexError):
+            continue
+        result[ n ] = max( result.get( n, 0 ), gflops )
+    return result
+# end
+
+# ------------------------------------------------------------------------------
+# Sweeps nb, then nx, for routine in precision.
+# Returns entries [(routine, precision, n_max, nb, nx), ...], merging
+# consecutive sizes with the same block sizes into one range.
+def tune( routine, precision ):
+    # best[ n ] = (gflops, nb, nx)
+    best = {}
+    for nb in nbs:
+        result = run_tester( routine, precision,
+                             [ (routine, precision, -1, nb, -1) ] )
+        for (n, gflops) in result.items():
+            if (n not in best or gflops > best[ n ][0]):
+                best[ n ] = (gflops, nb, -1)
+
+    if (routine in routines_nx):
+        for nx in nxs:
+            # best nb for each size, with this nx
+            entries = [ (routine, precision, n, best[ n ][1], nx)
+                        for n in sorted( best.keys() ) ]
+            result = run_tester( routine, precision, entries )
+            for (n, gflops) in result.items():
+                if (n in best and gflops > best[ n ][0]):
+                    best[ n ] = (gflops, best[ n ][1], nx)
+
+    sizes = sorted( best.keys() )
+    for n in sizes:
+        print( '%-14s %s n %6d: nb %4d, nx %4d, %8.2f gflop/s'
+               % (routine, precision, n, best[ n ][1], best[ n ][2],
+                  best[ n ][0]) )
+
+    # A range ends halfway between sizes with different block sizes;
+    # the last range covers all larger sizes.
+    entries = []
+    for (i, n) in enumerate( sizes ):
+        (gflops, nb, nx) = best[ n ]
+        if (i + 1 < len( sizes )):
+            n_next = sizes[ i + 1 ]
+            if (best[ n_next ][1:] == (nb, nx)):
+                continue
+            n_max = (n + n_next) // 2
+        else:
+            n_max = -1
+        entries.append( (routine, precision, n_max, nb, nx) )
+    return entries
+# end
+
+# ------------------------------------------------------------------------------
+entries = []
+for routine in opts.routines:
+    for precision in opts.type.split( ',' ):
+        entries += tune( routine, precision )
+
+if (not opts.dry_run):
+    write_tune_file( opts.output, entries )
+    print( 'wrote', opts.output )
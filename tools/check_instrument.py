@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+# This program is free software: you can redistribute it and/or modify it under
+# the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+'''
+Checks that every exported routine in src/*.cc is instrumented:
+its first statement, after any comments, is lapack_instrument(...),
+and no lapack_instrument passes a literal 0 Gflop count; routines
+without a count pass internal::gflop_none, gflop_data_dependent, or
+gflop_no_formula (see src/lapack_internal.hh).
+
+An exported routine is a function defined at column 0 in namespace lapack,
+outside namespaces internal, impl (mid-level wrappers), and anonymous,
+that is not static and not a class member. Class members that are routines are listed in members.
+Files of runtime infrastructure, listed in skip_files, are not checked.
+
+Example usage:
+
+    lapackpp> ./tools/check_instrument.py
+    checked 1234 routines in 321 files
+
+Exits with status 1, listing the routines, if any check fails.
+'''
+
+from __future__ import print_function
+
+import sys
+import os
+import re
+import glob
+
+# Infrastructure that isn't a LAPACK routine: thread pool and futures,
+# device queues (device routines are asynchronous, so host timing would
+# measure only the launch), the ILAENV override, the instrumentation
+# itself, trace and tuning setup, and version queries.
+skip_files = [
+    'async.cc',
+    'device_queue.cc',
+    'ilaenv.cc',
+    'instrument.cc',
+    'trace.cc',
+    'tune.cc',
+    'version.cc',
+]
+
+# Functions not checked: read_matrix_file_info reads only a file header.
+skip_functions = [
+    'read_matrix_file_info',
+]
+
+# Class members that are routines, so are checked.
+members = [
+    'QRStream< scalar_t >::update',
+    'QRStream< scalar_t >::downdate',
+    'QRStream< scalar_t >::solve',
+]
+
+# Start of a function definition: return type, then name( at column 0.
+# The name includes :: for class members.
+re_function = re.compile( r'^(?!static\b|template\b|typedef\b|using\b|return\b)'
+                          r'\w[\w:<>,*& ]*?[\s*&]'
+                          r'((?:\w+(?:< \w+ >)?::)*~?\w+)\s*\(' )
+
+# Gflop count, the last argument, of lapack_instrument( ... ).
+re_zero_gflop = re.compile( r'lapack_instrument\([^;]*,\s*0(\.0*)?\s*\);' )
+
+#-------------------------------------------------------------------------------
+# Returns list of errors in file filename.
+def check_file( filename ):
+    errors = []
+    count = 0
+    lines = open( filename ).read().split( '\n' )
+    filename = os.path.relpath( filename )
+    namespaces = []
+    i = 0
+    while (i < len( lines )):
+        line = lines[ i ]
+        m = re.search( r'^namespace\s*(\w*)\s*\{', line )
+        if (m):
+            namespaces.append( m.group( 1 ) or 'anonymous' )
+            i += 1
+            continue
+        if (re.search( r'^\}\s*//.*namespace', line )):
+            if (namespaces):
+                namespaces.pop()
+            i += 1
+            continue
+
+        m = re_function.search( line )
+        if (not m or line.rstrip().endswith( ';' )):
+            i += 1
+            continue
+
+        # Find the body's opening brace, at column 0.
+        j = i
+        while (j < len( lines ) and lines[ j ] != '{'
+               and not lines[ j ].rstrip().endswith( ';' )):
+            j += 1
+        if (j == len( lines ) or lines[ j ] != '{'):
+            i += 1
+            continue
+
+        name = m.group( 1 )
+        exported = (namespaces[ :1 ] == [ 'lapack' ]
+                    and 'internal'  not in namespaces
+                    and 'impl'      not in namespaces
+                    and 'anonymous' not in namespaces
+                    and not lines[ i - 1 ].startswith( 'static' )
+                    and name not in skip_functions
+                    and ('::' not in name or name in members))
+        if (exported):
+            count += 1
+            k = j + 1
+            while (k < len( lines ) and (lines[ k ].strip() == ''
+                   or lines[ k ].strip().startswith( '//' ))):
+                k += 1
+            if (not lines[ k ].strip().startswith( 'lapack_instrument(' )):
+                errors.append( '%s:%d: %s is not instrumented'
+                               % (filename, i + 1, name) )
+        i = j + 1
+
+    text = '\n'.join( lines )
+    for m in re_zero_gflop.finditer( text ):
+        line = text.count( '\n', 0, m.start() ) + 1
+        errors.append( '%s:%d: lapack_instrument with literal 0 Gflop; '
+                       'use a count from lapack/flops.hh or an internal::gflop_'
+                       ' constant' % (filename, line) )
+    return (errors, count)
+# end
+
+#-------------------------------------------------------------------------------
+srcdir = os.path.join( os.path.dirname( os.path.abspath( __file__ ) ),
+                       '..', 'src' )
+errors = []
+count = 0
+files = sorted( glob.glob( os.path.join( srcdir, '*.cc' ) ) )
+files = [ f for f in files if os.path.basename( f ) not in skip_files ]
+for filename in files:
+    (file_errors, file_count) = check_file( filename )
+    errors += file_errors
+    count  += file_count
+
+for error in errors:
+    print( error, file=sys.stderr )
+print( 'checked', count, 'routines in', len( files ), 'files' )
+if (errors):
+    print( len( errors ), 'errors', file=sys.stderr )
+    sys.exit( 1 )